@@ -58,6 +58,14 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
       {
         return Spec_Agile_AEAD_AES256_GCM;
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return Spec_Agile_AEAD_AES128_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return Spec_Agile_AEAD_AES256_GCM;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -78,6 +86,37 @@ create_in_chacha20_poly1305(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   return EverCrypt_Error_Success;
 }
 
+/* The portable fallbacks keep their 64-bit context in the `ek` field. */
+static EverCrypt_Error_error_code
+create_in_hacl_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  uint64_t
+  *ctx = (uint64_t *)KRML_HOST_CALLOC(Hacl_AES_GCM_CT64_aes128_ctx_len, sizeof (uint64_t));
+  Hacl_AES_GCM_CT64_aes128_init(ctx, k);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s
+  *p = (EverCrypt_AEAD_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U]
+  = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = (uint8_t *)ctx });
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
+static EverCrypt_Error_error_code
+create_in_hacl_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  uint64_t
+  *ctx = (uint64_t *)KRML_HOST_CALLOC(Hacl_AES_GCM_CT64_aes256_ctx_len, sizeof (uint64_t));
+  Hacl_AES_GCM_CT64_aes256_init(ctx, k);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s
+  *p = (EverCrypt_AEAD_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U]
+  = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = (uint8_t *)ctx });
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
 static EverCrypt_Error_error_code
 create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
 {
@@ -101,7 +140,7 @@ create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  return create_in_hacl_aes128_gcm(dst, k);
 }
 
 static EverCrypt_Error_error_code
@@ -127,7 +166,7 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  return create_in_hacl_aes256_gcm(dst, k);
 }
 
 EverCrypt_Error_error_code
@@ -432,6 +471,40 @@ EverCrypt_AEAD_encrypt(
       {
         return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        Hacl_AES_GCM_CT64_aes128_encrypt((uint64_t *)ek,
+          plain_len,
+          cipher,
+          plain,
+          ad_len,
+          ad,
+          iv_len,
+          iv,
+          tag);
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        Hacl_AES_GCM_CT64_aes256_encrypt((uint64_t *)ek,
+          plain_len,
+          cipher,
+          plain,
+          ad_len,
+          ad,
+          iv_len,
+          iv,
+          tag);
+        return EverCrypt_Error_Success;
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         if (iv_len != (uint32_t)12U)
@@ -449,6 +522,143 @@ EverCrypt_AEAD_encrypt(
   }
 }
 
+/**
+Encrypt a batch of `len` independent records.
+
+  The arguments `s`, `iv`, `iv_len`, `ad`, `ad_len`, `plain`, `plain_len`, `cipher`
+  and `tag` are arrays of `len` elements; the i-th record is processed exactly as
+  `encrypt(s[i], iv[i], iv_len[i], ad[i], ad_len[i], plain[i], plain_len[i], cipher[i], tag[i])`.
+
+  All records are validated before any of them is encrypted: if one of them is
+  invalid, the corresponding error code is returned and no output is written.
+
+  ChaCha20-Poly1305 records are processed 8 at a time, with their key streams
+  computed in parallel across the AVX2 vector lanes. AES-GCM records are
+  processed one after the other.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  uint32_t len,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t *iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **plain,
+  uint32_t *plain_len,
+  uint8_t **cipher,
+  uint8_t **tag
+)
+{
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    if (s[i] == NULL)
+    {
+      return EverCrypt_Error_InvalidKey;
+    }
+    Spec_Cipher_Expansion_impl impl = s[i]->impl;
+    if (impl == Spec_Cipher_Expansion_Hacl_CHACHA20 && iv_len[i] != (uint32_t)12U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    if (impl != Spec_Cipher_Expansion_Hacl_CHACHA20 && iv_len[i] == (uint32_t)0U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+  }
+  uint8_t *k8[8U] = { 0U };
+  uint8_t *n8[8U] = { 0U };
+  uint32_t ad_len8[8U] = { 0U };
+  uint8_t *ad8[8U] = { 0U };
+  uint32_t plain_len8[8U] = { 0U };
+  uint8_t *plain8[8U] = { 0U };
+  uint8_t *cipher8[8U] = { 0U };
+  uint8_t *tag8[8U] = { 0U };
+  uint32_t j = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    EverCrypt_AEAD_state_s scrut = *s[i];
+    if (scrut.impl == Spec_Cipher_Expansion_Hacl_CHACHA20)
+    {
+      k8[j] = scrut.ek;
+      n8[j] = iv[i];
+      ad_len8[j] = ad_len[i];
+      ad8[j] = ad[i];
+      plain_len8[j] = plain_len[i];
+      plain8[j] = plain[i];
+      cipher8[j] = cipher[i];
+      tag8[j] = tag[i];
+      j++;
+      if (j == (uint32_t)8U)
+      {
+        EverCrypt_Chacha20Poly1305_aead_encrypt_8(k8,
+          n8,
+          ad_len8,
+          ad8,
+          plain_len8,
+          plain8,
+          cipher8,
+          tag8);
+        j = (uint32_t)0U;
+      }
+    }
+    else
+    {
+      EverCrypt_Error_error_code
+      r =
+        EverCrypt_AEAD_encrypt(s[i],
+          iv[i],
+          iv_len[i],
+          ad[i],
+          ad_len[i],
+          plain[i],
+          plain_len[i],
+          cipher[i],
+          tag[i]);
+      if (r != EverCrypt_Error_Success)
+      {
+        return r;
+      }
+    }
+  }
+  if (j == (uint32_t)1U)
+  {
+    EverCrypt_Chacha20Poly1305_aead_encrypt(k8[0U],
+      n8[0U],
+      ad_len8[0U],
+      ad8[0U],
+      plain_len8[0U],
+      plain8[0U],
+      cipher8[0U],
+      tag8[0U]);
+  }
+  else if (j > (uint32_t)1U)
+  {
+    /* Fill the unused lanes with empty records whose tags go to a scratch buffer. */
+    uint8_t scratch_tag[16U] = { 0U };
+    for (uint32_t i = j; i < (uint32_t)8U; i++)
+    {
+      k8[i] = k8[0U];
+      n8[i] = n8[0U];
+      ad_len8[i] = (uint32_t)0U;
+      ad8[i] = ad8[0U];
+      plain_len8[i] = (uint32_t)0U;
+      plain8[i] = plain8[0U];
+      cipher8[i] = cipher8[0U];
+      tag8[i] = scratch_tag;
+    }
+    EverCrypt_Chacha20Poly1305_aead_encrypt_8(k8,
+      n8,
+      ad_len8,
+      ad8,
+      plain_len8,
+      plain8,
+      cipher8,
+      tag8);
+  }
+  return EverCrypt_Error_Success;
+}
+
 /**
 WARNING: this function doesn't perform any dynamic
   hardware check. You MUST make sure your hardware supports the
@@ -873,7 +1083,13 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint64_t ctx[Hacl_AES_GCM_CT64_aes128_ctx_len] = { 0U };
+  Hacl_AES_GCM_CT64_aes128_init(ctx, k);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = (uint8_t *)ctx };
+  EverCrypt_Error_error_code
+  r = EverCrypt_AEAD_encrypt(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  Lib_Memzero0_memzero(ctx, Hacl_AES_GCM_CT64_aes128_ctx_len * sizeof (ctx[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -1012,7 +1228,13 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint64_t ctx[Hacl_AES_GCM_CT64_aes256_ctx_len] = { 0U };
+  Hacl_AES_GCM_CT64_aes256_init(ctx, k);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = (uint8_t *)ctx };
+  EverCrypt_Error_error_code
+  r = EverCrypt_AEAD_encrypt(&p, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  Lib_Memzero0_memzero(ctx, Hacl_AES_GCM_CT64_aes256_ctx_len * sizeof (ctx[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -1401,6 +1623,59 @@ decrypt_chacha20_poly1305(
   return EverCrypt_Error_AuthenticationFailure;
 }
 
+static EverCrypt_Error_error_code
+decrypt_hacl_aes_gcm(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint64_t *ctx = (uint64_t *)scrut.ek;
+  bool ok;
+  if (scrut.impl == Spec_Cipher_Expansion_Hacl_AES128)
+  {
+    ok =
+      Hacl_AES_GCM_CT64_aes128_decrypt(ctx,
+        cipher_len,
+        dst,
+        cipher,
+        ad_len,
+        ad,
+        iv_len,
+        iv,
+        tag);
+  }
+  else
+  {
+    ok =
+      Hacl_AES_GCM_CT64_aes256_decrypt(ctx,
+        cipher_len,
+        dst,
+        cipher,
+        ad_len,
+        ad,
+        iv_len,
+        iv,
+        tag);
+  }
+  if (ok)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt(
   EverCrypt_AEAD_state_s *s,
@@ -1430,6 +1705,14 @@ EverCrypt_AEAD_decrypt(
       {
         return decrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return decrypt_hacl_aes_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return decrypt_hacl_aes_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         return decrypt_chacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
@@ -1887,7 +2170,13 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint64_t ctx[Hacl_AES_GCM_CT64_aes128_ctx_len] = { 0U };
+  Hacl_AES_GCM_CT64_aes128_init(ctx, k);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = (uint8_t *)ctx };
+  EverCrypt_Error_error_code
+  r = EverCrypt_AEAD_decrypt(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  Lib_Memzero0_memzero(ctx, Hacl_AES_GCM_CT64_aes128_ctx_len * sizeof (ctx[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -2037,7 +2326,13 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint64_t ctx[Hacl_AES_GCM_CT64_aes256_ctx_len] = { 0U };
+  Hacl_AES_GCM_CT64_aes256_init(ctx, k);
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = (uint8_t *)ctx };
+  EverCrypt_Error_error_code
+  r = EverCrypt_AEAD_decrypt(&p, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  Lib_Memzero0_memzero(ctx, Hacl_AES_GCM_CT64_aes256_ctx_len * sizeof (ctx[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -38,6 +38,7 @@ extern "C" {
 #include "Hacl_Spec.h"
 #include "EverCrypt_Error.h"
 #include "EverCrypt_Chacha20Poly1305.h"
+#include "Hacl_AES_GCM_CT64.h"
 #include "EverCrypt_AutoConfig2.h"
 #include "evercrypt_targetconfig.h"
 typedef struct EverCrypt_AEAD_state_s_s EverCrypt_AEAD_state_s;
@@ -46,6 +47,13 @@ bool EverCrypt_AEAD_uu___is_Ek(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s pro
 
 Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s);
 
+/**
+Create a state for the algorithm `a` and the key `k`.
+
+  AES-GCM uses the Vale AES-NI and PCLMULQDQ code when the CPU supports it, and the portable
+  constant-time implementation of `Hacl_AES_GCM_CT64` otherwise, e.g. on ARM, on older x86
+  CPUs, or after `EverCrypt_AutoConfig2_disable_aesni`.
+*/
 EverCrypt_Error_error_code
 EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, uint8_t *k);
 
@@ -62,6 +70,34 @@ EverCrypt_AEAD_encrypt(
   uint8_t *tag
 );
 
+/**
+Encrypt a batch of `len` independent records.
+
+  The arguments `s`, `iv`, `iv_len`, `ad`, `ad_len`, `plain`, `plain_len`, `cipher`
+  and `tag` are arrays of `len` elements; the i-th record is processed exactly as
+  `encrypt(s[i], iv[i], iv_len[i], ad[i], ad_len[i], plain[i], plain_len[i], cipher[i], tag[i])`.
+
+  All records are validated before any of them is encrypted: if one of them is
+  invalid, the corresponding error code is returned and no output is written.
+
+  ChaCha20-Poly1305 records are processed 8 at a time, with their key streams
+  computed in parallel across the AVX2 vector lanes. AES-GCM records are
+  processed one after the other.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  uint32_t len,
+  EverCrypt_AEAD_state_s **s,
+  uint8_t **iv,
+  uint32_t *iv_len,
+  uint8_t **ad,
+  uint32_t *ad_len,
+  uint8_t **plain,
+  uint32_t *plain_len,
+  uint8_t **cipher,
+  uint8_t **tag
+);
+
 /**
 WARNING: this function doesn't perform any dynamic
   hardware check. You MUST make sure your hardware supports the
@@ -22,9 +22,26 @@
  */
 
 
-#include "EverCrypt_AutoConfig2.h"
+#include "internal/EverCrypt_AutoConfig2.h"
 
 #include "internal/Vale.h"
+#include "internal/EverCrypt_Poly1305.h"
+#include "internal/EverCrypt_Hash.h"
+#include "internal/Hacl_Hash_Blake2.h"
+#include "internal/Hacl_Hash_Blake2s_128.h"
+#include "internal/Hacl_Hash_Blake2b_256.h"
+#include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20Poly1305_32.h"
+#include "Hacl_Chacha20Poly1305_128.h"
+#include "Hacl_Chacha20Poly1305_256.h"
+#include "Hacl_Poly1305_32.h"
+#include "Hacl_Poly1305_128.h"
+#include "Hacl_Poly1305_256.h"
+#include "Hacl_Curve25519_51.h"
+#include "Hacl_Curve25519_64.h"
+#include "Hacl_SHA2_Vec256.h"
 
 static bool cpu_has_shaext[1U] = { false };
 
@@ -48,6 +65,145 @@ static bool cpu_has_rdrand[1U] = { false };
 
 static bool cpu_has_avx512[1U] = { false };
 
+/* Encrypts the 8 records one at a time, for machines without AVX2. */
+static void
+chacha20poly1305_encrypt_8_loop(
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **tag
+)
+{
+  const EverCrypt_AutoConfig2_dispatch_s *d = EverCrypt_AutoConfig2_get_dispatch();
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    d->chacha20poly1305_encrypt(k[i], n[i], aadlen[i], aad[i], mlen[i], m[i], cipher[i], tag[i]);
+  }
+}
+
+static const EverCrypt_AutoConfig2_dispatch_s
+dispatch_default =
+  {
+    .chacha20poly1305_encrypt = Hacl_Chacha20Poly1305_32_aead_encrypt,
+    .chacha20poly1305_decrypt = Hacl_Chacha20Poly1305_32_aead_decrypt,
+    #if HACL_CAN_COMPILE_VALE
+    .poly1305_mac = EverCrypt_Poly1305_poly1305_vale,
+    #else
+    .poly1305_mac = Hacl_Poly1305_32_poly1305_mac,
+    #endif
+    .chacha20_encrypt = Hacl_Chacha20_chacha20_encrypt,
+    .curve25519_secret_to_public = Hacl_Curve25519_51_secret_to_public,
+    .curve25519_scalarmult = Hacl_Curve25519_51_scalarmult,
+    .curve25519_ecdh = Hacl_Curve25519_51_ecdh,
+    .sha256_update_multi = Hacl_Hash_SHA2_update_multi_256,
+    .sha1_update_multi = Hacl_Hash_SHA1_legacy_update_multi,
+    .sha512_update_multi = Hacl_Hash_SHA2_update_multi_512,
+    .blake2s_hash = Hacl_Hash_Blake2_hash_blake2s_32,
+    .blake2b_hash = Hacl_Hash_Blake2_hash_blake2b_32,
+    .sha2_256_lanes_8 = NULL,
+    .sha2_256_lanes_4 = NULL,
+    .sha2_512_lanes_4 = NULL,
+    .chacha20poly1305_encrypt_8 = chacha20poly1305_encrypt_8_loop
+  };
+
+/* One table per combination of the features read by resolve_dispatch. A table is
+   filled once and never written again: dispatch_state[k] is 0 while table k is
+   unused, 1 while a thread fills it and 2 once it is ready. */
+static EverCrypt_AutoConfig2_dispatch_s dispatch_tables[16U];
+
+static uint32_t dispatch_state[16U] = { 0U };
+
+static const EverCrypt_AutoConfig2_dispatch_s *dispatch_current = &dispatch_default;
+
+const EverCrypt_AutoConfig2_dispatch_s *EverCrypt_AutoConfig2_get_dispatch()
+{
+  return __atomic_load_n(&dispatch_current, __ATOMIC_ACQUIRE);
+}
+
+/* Publishes the dispatch table for the current cpu_has_* flags, with the same
+   preferences as the per-call checks it replaces. The table is built in a local
+   and copied into its slot before the release store of dispatch_current, so that
+   readers never observe a partially updated table. */
+static void resolve_dispatch()
+{
+  bool vec256 = cpu_has_avx2[0U] || has_vec256_not_avx2();
+  bool vec128 = cpu_has_avx[0U] || has_vec128_not_avx();
+  bool adx_bmi2 = cpu_has_adx[0U] && cpu_has_bmi2[0U];
+  bool shaext = cpu_has_shaext[0U] && cpu_has_sse[0U];
+  uint32_t
+  key =
+    (uint32_t)vec128
+    | (uint32_t)vec256 << (uint32_t)1U
+    | (uint32_t)adx_bmi2 << (uint32_t)2U
+    | (uint32_t)shaext << (uint32_t)3U;
+  uint32_t expected = (uint32_t)0U;
+  if
+  (
+    !__atomic_compare_exchange_n(&dispatch_state[key],
+      &expected,
+      (uint32_t)1U,
+      false,
+      __ATOMIC_ACQUIRE,
+      __ATOMIC_ACQUIRE)
+  )
+  {
+    while (__atomic_load_n(&dispatch_state[key], __ATOMIC_ACQUIRE) != (uint32_t)2U)
+    {
+    }
+    __atomic_store_n(&dispatch_current, &dispatch_tables[key], __ATOMIC_RELEASE);
+    return;
+  }
+  EverCrypt_AutoConfig2_dispatch_s t = dispatch_default;
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    t.chacha20poly1305_encrypt = Hacl_Chacha20Poly1305_128_aead_encrypt;
+    t.chacha20poly1305_decrypt = Hacl_Chacha20Poly1305_128_aead_decrypt;
+    t.poly1305_mac = Hacl_Poly1305_128_poly1305_mac;
+    t.chacha20_encrypt = Hacl_Chacha20_Vec128_chacha20_encrypt_128;
+    t.blake2s_hash = Hacl_Hash_Blake2s_128_hash_blake2s_128;
+    t.sha2_256_lanes_4 = EverCrypt_Hash_sha2_256_lanes_4;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    t.chacha20poly1305_encrypt = Hacl_Chacha20Poly1305_256_aead_encrypt;
+    t.chacha20poly1305_decrypt = Hacl_Chacha20Poly1305_256_aead_decrypt;
+    t.poly1305_mac = Hacl_Poly1305_256_poly1305_mac;
+    t.chacha20_encrypt = Hacl_Chacha20_Vec256_chacha20_encrypt_256;
+    t.sha512_update_multi = Hacl_SHA2_Vec256_sha512_update_multi;
+    t.blake2b_hash = Hacl_Hash_Blake2b_256_hash_blake2b_256;
+    t.sha2_256_lanes_8 = EverCrypt_Hash_sha2_256_lanes_8;
+    t.sha2_512_lanes_4 = EverCrypt_Hash_sha2_512_lanes_4;
+    t.chacha20poly1305_encrypt_8 = Hacl_Chacha20Poly1305_256_aead_encrypt_8;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VALE
+  if (adx_bmi2)
+  {
+    t.curve25519_secret_to_public = Hacl_Curve25519_64_secret_to_public;
+    t.curve25519_scalarmult = Hacl_Curve25519_64_scalarmult;
+    t.curve25519_ecdh = Hacl_Curve25519_64_ecdh;
+  }
+  if (shaext)
+  {
+    t.sha256_update_multi = EverCrypt_Hash_update_multi_256_shaext;
+    t.sha1_update_multi = EverCrypt_Hash_update_multi_sha1_shaext;
+    /* Hashing one input at a time with SHA-NI beats the multi-buffer SHA-256 kernels. */
+    t.sha2_256_lanes_8 = NULL;
+    t.sha2_256_lanes_4 = NULL;
+  }
+  #endif
+  dispatch_tables[key] = t;
+  __atomic_store_n(&dispatch_state[key], (uint32_t)2U, __ATOMIC_RELEASE);
+  __atomic_store_n(&dispatch_current, &dispatch_tables[key], __ATOMIC_RELEASE);
+}
+
 bool EverCrypt_AutoConfig2_has_shaext()
 {
   return cpu_has_shaext[0U];
@@ -108,7 +264,7 @@ void EverCrypt_AutoConfig2_recall()
 
 }
 
-void EverCrypt_AutoConfig2_init()
+static void detect_cpu_features()
 {
   #if HACL_CAN_COMPILE_VALE
   uint64_t scrut = check_aesni();
@@ -193,59 +349,76 @@ void EverCrypt_AutoConfig2_init()
   #endif
 }
 
+void EverCrypt_AutoConfig2_init()
+{
+  detect_cpu_features();
+  resolve_dispatch();
+}
+
 void EverCrypt_AutoConfig2_disable_avx2()
 {
   cpu_has_avx2[0U] = false;
+  resolve_dispatch();
 }
 
 void EverCrypt_AutoConfig2_disable_avx()
 {
   cpu_has_avx[0U] = false;
+  resolve_dispatch();
 }
 
 void EverCrypt_AutoConfig2_disable_bmi2()
 {
   cpu_has_bmi2[0U] = false;
+  resolve_dispatch();
 }
 
 void EverCrypt_AutoConfig2_disable_adx()
 {
   cpu_has_adx[0U] = false;
+  resolve_dispatch();
 }
 
 void EverCrypt_AutoConfig2_disable_shaext()
 {
   cpu_has_shaext[0U] = false;
+  resolve_dispatch();
 }
 
 void EverCrypt_AutoConfig2_disable_aesni()
 {
   cpu_has_aesni[0U] = false;
+  resolve_dispatch();
 }
 
 void EverCrypt_AutoConfig2_disable_pclmulqdq()
 {
   cpu_has_pclmulqdq[0U] = false;
+  resolve_dispatch();
 }
 
 void EverCrypt_AutoConfig2_disable_sse()
 {
   cpu_has_sse[0U] = false;
+  resolve_dispatch();
 }
 
 void EverCrypt_AutoConfig2_disable_movbe()
 {
   cpu_has_movbe[0U] = false;
+  resolve_dispatch();
 }
 
 void EverCrypt_AutoConfig2_disable_rdrand()
 {
   cpu_has_rdrand[0U] = false;
+  resolve_dispatch();
 }
 
 void EverCrypt_AutoConfig2_disable_avx512()
 {
   cpu_has_avx512[0U] = false;
+  resolve_dispatch();
 }
 
 bool EverCrypt_AutoConfig2_has_vec128()
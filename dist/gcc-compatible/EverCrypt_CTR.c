@@ -27,6 +27,7 @@
 #include "internal/Vale.h"
 #include "internal/Hacl_Spec.h"
 #include "internal/Hacl_Chacha20.h"
+#include "internal/EverCrypt_AutoConfig2.h"
 
 typedef struct EverCrypt_CTR_state_s_s
 {
@@ -371,6 +372,142 @@ void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t
   }
 }
 
+/* AES-CTR over `len` bytes with the Vale kernels, where block j uses the counter block
+   iv + (c + j) mod 2^32, as update_block does. The kernels only increment the low 32 bits of
+   their counter block, whereas update_block adds the counter to the whole 128-bit block, so
+   a request is split where these 32 bits wrap around, as well as where c + j does. A trailing
+   partial block goes through a zero-padded copy. */
+static void
+vale_update(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *ek,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *dst,
+  uint8_t *src,
+  uint32_t len,
+  uint32_t c
+)
+{
+  #if HACL_CAN_COMPILE_VALE
+  uint8_t ctr_block[16U] = { 0U };
+  uint8_t inout_b[16U] = { 0U };
+  memcpy(ctr_block, iv, iv_len * sizeof (uint8_t));
+  FStar_UInt128_uint128 iv0 = load128_be(ctr_block);
+  uint32_t num_blocks = len / (uint32_t)16U;
+  uint32_t rem = len % (uint32_t)16U;
+  uint8_t block[16U] = { 0U };
+  memcpy(block, src + num_blocks * (uint32_t)16U, rem * sizeof (uint8_t));
+  uint32_t j = (uint32_t)0U;
+  while (j < num_blocks + (uint32_t)(rem != (uint32_t)0U))
+  {
+    uint32_t cj = c + j;
+    FStar_UInt128_uint128
+    ctr = FStar_UInt128_add_mod(iv0, FStar_UInt128_uint64_to_uint128((uint64_t)cj));
+    uint64_t lo = (uint64_t)(uint32_t)FStar_UInt128_uint128_to_uint64(ctr);
+    uint64_t before_wrap = (uint64_t)0x100000000U - lo;
+    if ((uint64_t)0x100000000U - (uint64_t)cj < before_wrap)
+    {
+      before_wrap = (uint64_t)0x100000000U - (uint64_t)cj;
+    }
+    uint8_t *in_b = src + j * (uint32_t)16U;
+    uint8_t *out_b = dst + j * (uint32_t)16U;
+    uint32_t nb = num_blocks - j;
+    if (nb == (uint32_t)0U)
+    {
+      in_b = block;
+      out_b = block;
+      nb = (uint32_t)1U;
+    }
+    else if ((uint64_t)nb > before_wrap)
+    {
+      nb = (uint32_t)before_wrap;
+    }
+    store128_le(ctr_block, ctr);
+    switch (i)
+    {
+      case Spec_Cipher_Expansion_Vale_AES128:
+        {
+          uint64_t
+          scrut =
+            gctr128_bytes(in_b,
+              (uint64_t)(nb * (uint32_t)16U),
+              out_b,
+              inout_b,
+              ek,
+              ctr_block,
+              (uint64_t)nb);
+          break;
+        }
+      case Spec_Cipher_Expansion_Vale_AES256:
+        {
+          uint64_t
+          scrut =
+            gctr256_bytes(in_b,
+              (uint64_t)(nb * (uint32_t)16U),
+              out_b,
+              inout_b,
+              ek,
+              ctr_block,
+              (uint64_t)nb);
+          break;
+        }
+      default:
+        {
+          KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+          KRML_HOST_EXIT(253U);
+        }
+    }
+    j = j + nb;
+  }
+  memcpy(dst + num_blocks * (uint32_t)16U, block, rem * sizeof (uint8_t));
+  #endif
+}
+
+void
+EverCrypt_CTR_update(
+  EverCrypt_CTR_state_s *p,
+  uint8_t *dst,
+  uint8_t *src,
+  uint32_t len,
+  uint32_t c
+)
+{
+  EverCrypt_CTR_state_s scrut = *p;
+  Spec_Cipher_Expansion_impl i = scrut.i;
+  uint8_t *iv = scrut.iv;
+  uint32_t iv_len = scrut.iv_len;
+  uint8_t *ek = scrut.xkey;
+  uint32_t c1;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        vale_update(i, ek, iv, iv_len, dst, src, len, c);
+        c1 = c + (len + (uint32_t)15U) / (uint32_t)16U;
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        vale_update(i, ek, iv, iv_len, dst, src, len, c);
+        c1 = c + (len + (uint32_t)15U) / (uint32_t)16U;
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        EverCrypt_AutoConfig2_get_dispatch()->chacha20_encrypt(len, dst, src, ek, iv, c);
+        c1 = c + (len + (uint32_t)63U) / (uint32_t)64U;
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  *p = ((EverCrypt_CTR_state_s){ .i = i, .iv = iv, .iv_len = iv_len, .xkey = ek, .ctr = c1 });
+}
+
 void EverCrypt_CTR_free(EverCrypt_CTR_state_s *p)
 {
   EverCrypt_CTR_state_s scrut = *p;
@@ -76,6 +76,25 @@ EverCrypt_CTR_init(
 
 void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src);
 
+/**
+Encrypt (or decrypt) `len` bytes of `src` into `dst`, starting from the block counter `c`.
+
+  The block of index `j` of `src` is XORed with the keystream block of counter `c + j`, as
+  `EverCrypt_CTR_update_block` would produce it with the state counter set to `c + j`, so
+  that a whole buffer goes through the pipelined Vale AES-CTR or vectorized ChaCha20
+  kernels in a single call. `len` need not be a multiple of the block size (16 bytes for
+  AES, 64 bytes for ChaCha20), and `dst` may be equal to `src`. Afterwards, the counter of
+  the state is the one following the last block used.
+*/
+void
+EverCrypt_CTR_update(
+  EverCrypt_CTR_state_s *p,
+  uint8_t *dst,
+  uint8_t *src,
+  uint32_t len,
+  uint32_t c
+);
+
 void EverCrypt_CTR_free(EverCrypt_CTR_state_s *p);
 
 #if defined(__cplusplus)
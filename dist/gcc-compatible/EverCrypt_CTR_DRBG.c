@@ -0,0 +1,398 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EverCrypt_CTR_DRBG.h"
+
+#include "internal/Vale.h"
+
+uint32_t EverCrypt_CTR_DRBG_reseed_interval = (uint32_t)1024U;
+
+uint32_t EverCrypt_CTR_DRBG_max_output_length = (uint32_t)65536U;
+
+uint32_t EverCrypt_CTR_DRBG_max_personalization_string_length = (uint32_t)65536U;
+
+uint32_t EverCrypt_CTR_DRBG_max_additional_input_length = (uint32_t)65536U;
+
+uint32_t EverCrypt_CTR_DRBG_min_length = (uint32_t)32U;
+
+/* Expand the 32-byte AES key `k` into the 240-byte round keys `xkey`. */
+static void ctr_drbg_expand(uint8_t *xkey, uint8_t *k)
+{
+  #if HACL_CAN_COMPILE_VALE
+  uint64_t scrut = aes256_key_expansion(k, xkey);
+  #endif
+}
+
+/* Encrypt the single block `src` into `dst`, as the keystream of a one-block CTR request
+   whose counter block is `src`. */
+static void ctr_drbg_block(uint8_t *xkey, uint8_t *dst, uint8_t *src)
+{
+  #if HACL_CAN_COMPILE_VALE
+  uint8_t zeroes[16U] = { 0U };
+  uint8_t inout_b[16U] = { 0U };
+  uint8_t ctr_block[16U] = { 0U };
+  store128_le(ctr_block, load128_be(src));
+  uint64_t
+  scrut = gctr256_bytes(zeroes, (uint64_t)16U, dst, inout_b, xkey, ctr_block, (uint64_t)1U);
+  #endif
+}
+
+/* Write `len` bytes of AES-CTR keystream for the counter blocks v + 1, v + 2, ... into
+   `dst`, and leave the last counter block used in `v`. The Vale kernel only increments the
+   low 32 bits of its counter block, so a request is split where these wrap around, and the
+   carry is propagated over the full 128 bits here, as SP 800-90A requires. */
+static void ctr_drbg_keystream(uint8_t *xkey, uint8_t *v, uint8_t *dst, uint32_t len)
+{
+  #if HACL_CAN_COMPILE_VALE
+  uint8_t zeroes[1024U] = { 0U };
+  uint8_t inout_b[16U] = { 0U };
+  uint8_t ctr_block[16U] = { 0U };
+  uint32_t num_blocks = len / (uint32_t)16U;
+  uint32_t i = (uint32_t)0U;
+  while (i < num_blocks)
+  {
+    FStar_UInt128_uint128
+    c = FStar_UInt128_add_mod(load128_be(v), FStar_UInt128_uint64_to_uint128((uint64_t)1U));
+    uint64_t lo = (uint64_t)(uint32_t)FStar_UInt128_uint128_to_uint64(c);
+    uint64_t before_wrap = (uint64_t)0x100000000U - lo;
+    uint32_t nb = num_blocks - i;
+    if (nb > (uint32_t)64U)
+    {
+      nb = (uint32_t)64U;
+    }
+    if ((uint64_t)nb > before_wrap)
+    {
+      nb = (uint32_t)before_wrap;
+    }
+    store128_le(ctr_block, c);
+    uint64_t
+    scrut =
+      gctr256_bytes(zeroes,
+        (uint64_t)(nb * (uint32_t)16U),
+        dst + i * (uint32_t)16U,
+        inout_b,
+        xkey,
+        ctr_block,
+        (uint64_t)nb);
+    store128_be(v,
+      FStar_UInt128_add_mod(c, FStar_UInt128_uint64_to_uint128((uint64_t)(nb - (uint32_t)1U))));
+    i = i + nb;
+  }
+  uint32_t rem = len % (uint32_t)16U;
+  if (rem != (uint32_t)0U)
+  {
+    uint8_t block[16U] = { 0U };
+    ctr_drbg_keystream(xkey, v, block, (uint32_t)16U);
+    memcpy(dst + num_blocks * (uint32_t)16U, block, rem * sizeof (uint8_t));
+    Lib_Memzero0_memzero(block, (uint32_t)16U * sizeof (block[0U]));
+  }
+  #endif
+}
+
+/* CTR_DRBG_Update: derive the next key and counter from three blocks of keystream XORed
+   with the 48 bytes of `provided_data`. */
+static void ctr_drbg_update(EverCrypt_CTR_DRBG_state *st, uint8_t *provided_data)
+{
+  uint8_t temp[48U] = { 0U };
+  ctr_drbg_keystream(st->xkey, st->v, temp, (uint32_t)48U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)48U; i++)
+  {
+    temp[i] = temp[i] ^ provided_data[i];
+  }
+  ctr_drbg_expand(st->xkey, temp);
+  memcpy(st->v, temp + (uint32_t)32U, (uint32_t)16U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(temp, (uint32_t)48U * sizeof (temp[0U]));
+}
+
+/* Block_Cipher_df, returning 48 bytes derived from the concatenation of `a`, `b` and `c`.
+   The three BCC chains are computed over a single buffer IV || S, of which only the first
+   four bytes of the IV change. */
+static void
+ctr_drbg_df(
+  uint8_t *out,
+  uint32_t a_len,
+  uint8_t *a,
+  uint32_t b_len,
+  uint8_t *b,
+  uint32_t c_len,
+  uint8_t *c
+)
+{
+  uint32_t input_len = a_len + b_len + c_len;
+  uint32_t s_len = ((uint32_t)25U + input_len + (uint32_t)15U) / (uint32_t)16U * (uint32_t)16U;
+  KRML_CHECK_SIZE(sizeof (uint8_t), s_len);
+  uint8_t s[s_len];
+  memset(s, 0U, s_len * sizeof (uint8_t));
+  store32_be(s + (uint32_t)16U, input_len);
+  store32_be(s + (uint32_t)20U, (uint32_t)48U);
+  if (a_len != (uint32_t)0U)
+  {
+    memcpy(s + (uint32_t)24U, a, a_len * sizeof (uint8_t));
+  }
+  if (b_len != (uint32_t)0U)
+  {
+    memcpy(s + (uint32_t)24U + a_len, b, b_len * sizeof (uint8_t));
+  }
+  if (c_len != (uint32_t)0U)
+  {
+    memcpy(s + (uint32_t)24U + a_len + b_len, c, c_len * sizeof (uint8_t));
+  }
+  s[(uint32_t)24U + input_len] = (uint8_t)0x80U;
+  uint8_t k[32U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    k[i] = (uint8_t)i;
+  }
+  uint8_t xkey[240U] = { 0U };
+  ctr_drbg_expand(xkey, k);
+  uint8_t temp[48U] = { 0U };
+  uint8_t x[16U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)3U; i++)
+  {
+    uint8_t *chain = temp + i * (uint32_t)16U;
+    store32_be(s, i);
+    for (uint32_t j = (uint32_t)0U; j < s_len / (uint32_t)16U; j++)
+    {
+      for (uint32_t l = (uint32_t)0U; l < (uint32_t)16U; l++)
+      {
+        x[l] = chain[l] ^ s[j * (uint32_t)16U + l];
+      }
+      ctr_drbg_block(xkey, chain, x);
+    }
+  }
+  ctr_drbg_expand(xkey, temp);
+  ctr_drbg_block(xkey, out, temp + (uint32_t)32U);
+  ctr_drbg_block(xkey, out + (uint32_t)16U, out);
+  ctr_drbg_block(xkey, out + (uint32_t)32U, out + (uint32_t)16U);
+  Lib_Memzero0_memzero(s, s_len * sizeof (s[0U]));
+  Lib_Memzero0_memzero(xkey, (uint32_t)240U * sizeof (xkey[0U]));
+  Lib_Memzero0_memzero(temp, (uint32_t)48U * sizeof (temp[0U]));
+  Lib_Memzero0_memzero(x, (uint32_t)16U * sizeof (x[0U]));
+}
+
+EverCrypt_CTR_DRBG_state *EverCrypt_CTR_DRBG_create(void)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  #if HACL_CAN_COMPILE_VALE
+  if (has_aesni && has_pclmulqdq && has_avx && has_sse)
+  {
+    uint8_t *xkey = (uint8_t *)KRML_HOST_CALLOC((uint32_t)240U, sizeof (uint8_t));
+    uint8_t *v = (uint8_t *)KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
+    KRML_CHECK_SIZE(sizeof (EverCrypt_CTR_DRBG_state), (uint32_t)1U);
+    EverCrypt_CTR_DRBG_state
+    *p = (EverCrypt_CTR_DRBG_state *)KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_DRBG_state));
+    p[0U] =
+      ((EverCrypt_CTR_DRBG_state){ .xkey = xkey, .v = v, .reseed_counter = (uint32_t)0U });
+    return p;
+  }
+  #endif
+  return NULL;
+}
+
+void
+EverCrypt_CTR_DRBG_instantiate_with_entropy(
+  EverCrypt_CTR_DRBG_state *st,
+  uint32_t entropy_input_len,
+  uint8_t *entropy_input,
+  uint32_t nonce_len,
+  uint8_t *nonce,
+  uint32_t personalization_string_len,
+  uint8_t *personalization_string
+)
+{
+  uint8_t seed_material[48U] = { 0U };
+  ctr_drbg_df(seed_material,
+    entropy_input_len,
+    entropy_input,
+    nonce_len,
+    nonce,
+    personalization_string_len,
+    personalization_string);
+  uint8_t k[32U] = { 0U };
+  ctr_drbg_expand(st->xkey, k);
+  memset(st->v, 0U, (uint32_t)16U * sizeof (uint8_t));
+  ctr_drbg_update(st, seed_material);
+  st->reseed_counter = (uint32_t)1U;
+  Lib_Memzero0_memzero(seed_material, (uint32_t)48U * sizeof (seed_material[0U]));
+}
+
+void
+EverCrypt_CTR_DRBG_reseed_with_entropy(
+  EverCrypt_CTR_DRBG_state *st,
+  uint32_t entropy_input_len,
+  uint8_t *entropy_input,
+  uint32_t additional_input_len,
+  uint8_t *additional_input
+)
+{
+  uint8_t seed_material[48U] = { 0U };
+  ctr_drbg_df(seed_material,
+    entropy_input_len,
+    entropy_input,
+    additional_input_len,
+    additional_input,
+    (uint32_t)0U,
+    NULL);
+  ctr_drbg_update(st, seed_material);
+  st->reseed_counter = (uint32_t)1U;
+  Lib_Memzero0_memzero(seed_material, (uint32_t)48U * sizeof (seed_material[0U]));
+}
+
+bool
+EverCrypt_CTR_DRBG_generate_no_reseed(
+  uint8_t *output,
+  EverCrypt_CTR_DRBG_state *st,
+  uint32_t n,
+  uint32_t additional_input_len,
+  uint8_t *additional_input
+)
+{
+  if
+  (
+    n
+    > EverCrypt_CTR_DRBG_max_output_length
+    || additional_input_len > EverCrypt_CTR_DRBG_max_additional_input_length
+    || st->reseed_counter > EverCrypt_CTR_DRBG_reseed_interval
+  )
+  {
+    return false;
+  }
+  uint8_t additional[48U] = { 0U };
+  if (additional_input_len != (uint32_t)0U)
+  {
+    ctr_drbg_df(additional,
+      additional_input_len,
+      additional_input,
+      (uint32_t)0U,
+      NULL,
+      (uint32_t)0U,
+      NULL);
+    ctr_drbg_update(st, additional);
+  }
+  ctr_drbg_keystream(st->xkey, st->v, output, n);
+  ctr_drbg_update(st, additional);
+  st->reseed_counter = st->reseed_counter + (uint32_t)1U;
+  Lib_Memzero0_memzero(additional, (uint32_t)48U * sizeof (additional[0U]));
+  return true;
+}
+
+bool
+EverCrypt_CTR_DRBG_instantiate(
+  EverCrypt_CTR_DRBG_state *st,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  if (personalization_string_len > EverCrypt_CTR_DRBG_max_personalization_string_length)
+  {
+    return false;
+  }
+  uint32_t entropy_input_len = EverCrypt_CTR_DRBG_min_length;
+  uint32_t nonce_len = EverCrypt_CTR_DRBG_min_length / (uint32_t)2U;
+  uint32_t min_entropy = entropy_input_len + nonce_len;
+  KRML_CHECK_SIZE(sizeof (uint8_t), min_entropy);
+  uint8_t entropy[min_entropy];
+  memset(entropy, 0U, min_entropy * sizeof (uint8_t));
+  bool ok = Lib_RandomBuffer_System_randombytes(entropy, min_entropy);
+  if (!ok)
+  {
+    return false;
+  }
+  EverCrypt_CTR_DRBG_instantiate_with_entropy(st,
+    entropy_input_len,
+    entropy,
+    nonce_len,
+    entropy + entropy_input_len,
+    personalization_string_len,
+    personalization_string);
+  Lib_Memzero0_memzero(entropy, min_entropy * sizeof (entropy[0U]));
+  return true;
+}
+
+bool
+EverCrypt_CTR_DRBG_reseed(
+  EverCrypt_CTR_DRBG_state *st,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if (additional_input_len > EverCrypt_CTR_DRBG_max_additional_input_length)
+  {
+    return false;
+  }
+  uint32_t entropy_input_len = EverCrypt_CTR_DRBG_min_length;
+  KRML_CHECK_SIZE(sizeof (uint8_t), entropy_input_len);
+  uint8_t entropy_input[entropy_input_len];
+  memset(entropy_input, 0U, entropy_input_len * sizeof (uint8_t));
+  bool ok = Lib_RandomBuffer_System_randombytes(entropy_input, entropy_input_len);
+  if (!ok)
+  {
+    return false;
+  }
+  EverCrypt_CTR_DRBG_reseed_with_entropy(st,
+    entropy_input_len,
+    entropy_input,
+    additional_input_len,
+    additional_input);
+  Lib_Memzero0_memzero(entropy_input, entropy_input_len * sizeof (entropy_input[0U]));
+  return true;
+}
+
+bool
+EverCrypt_CTR_DRBG_generate(
+  uint8_t *output,
+  EverCrypt_CTR_DRBG_state *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if
+  (
+    additional_input_len
+    > EverCrypt_CTR_DRBG_max_additional_input_length
+    || n > EverCrypt_CTR_DRBG_max_output_length
+  )
+  {
+    return false;
+  }
+  if (!EverCrypt_CTR_DRBG_reseed(st, additional_input, additional_input_len))
+  {
+    return false;
+  }
+  return EverCrypt_CTR_DRBG_generate_no_reseed(output, st, n, (uint32_t)0U, NULL);
+}
+
+void EverCrypt_CTR_DRBG_uninstantiate(EverCrypt_CTR_DRBG_state *st)
+{
+  Lib_Memzero0_memzero(st->xkey, (uint32_t)240U * sizeof (st->xkey[0U]));
+  Lib_Memzero0_memzero(st->v, (uint32_t)16U * sizeof (st->v[0U]));
+  st->reseed_counter = (uint32_t)0U;
+  KRML_HOST_FREE(st->xkey);
+  KRML_HOST_FREE(st->v);
+  KRML_HOST_FREE(st);
+}
+
@@ -0,0 +1,162 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __EverCrypt_CTR_DRBG_H
+#define __EverCrypt_CTR_DRBG_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Lib_RandomBuffer_System.h"
+#include "Lib_Memzero0.h"
+#include "Hacl_Krmllib.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "evercrypt_targetconfig.h"
+extern uint32_t EverCrypt_CTR_DRBG_reseed_interval;
+
+extern uint32_t EverCrypt_CTR_DRBG_max_output_length;
+
+extern uint32_t EverCrypt_CTR_DRBG_max_personalization_string_length;
+
+extern uint32_t EverCrypt_CTR_DRBG_max_additional_input_length;
+
+extern uint32_t EverCrypt_CTR_DRBG_min_length;
+
+/**
+State of an AES-256 CTR_DRBG (NIST SP 800-90A, section 10.2.1, with derivation function).
+
+  The key is only kept in its expanded form `xkey` (240 bytes, as produced by the Vale
+  AES-NI key expansion), next to the 16-byte counter `v`.
+*/
+typedef struct EverCrypt_CTR_DRBG_state_s
+{
+  uint8_t *xkey;
+  uint8_t *v;
+  uint32_t reseed_counter;
+}
+EverCrypt_CTR_DRBG_state;
+
+/**
+Allocate a CTR_DRBG state, or return NULL if the Vale AES-NI code is not available on
+this platform. The state must be instantiated before use.
+*/
+EverCrypt_CTR_DRBG_state *EverCrypt_CTR_DRBG_create(void);
+
+/**
+Instantiate `st` from caller-provided entropy input, nonce and personalization string.
+
+  This is the deterministic CTR_DRBG_Instantiate_algorithm, meant for known-answer tests
+  and for callers with their own entropy source; `entropy_input_len` should be at least
+  `EverCrypt_CTR_DRBG_min_length`.
+*/
+void
+EverCrypt_CTR_DRBG_instantiate_with_entropy(
+  EverCrypt_CTR_DRBG_state *st,
+  uint32_t entropy_input_len,
+  uint8_t *entropy_input,
+  uint32_t nonce_len,
+  uint8_t *nonce,
+  uint32_t personalization_string_len,
+  uint8_t *personalization_string
+);
+
+/**
+Reseed `st` from caller-provided entropy input and additional input.
+*/
+void
+EverCrypt_CTR_DRBG_reseed_with_entropy(
+  EverCrypt_CTR_DRBG_state *st,
+  uint32_t entropy_input_len,
+  uint8_t *entropy_input,
+  uint32_t additional_input_len,
+  uint8_t *additional_input
+);
+
+/**
+Write `n` bytes of output into `output`, without reseeding.
+
+  Returns false, leaving `st` untouched, if `n` exceeds `EverCrypt_CTR_DRBG_max_output_length`
+  or if the state has reached its reseed interval.
+*/
+bool
+EverCrypt_CTR_DRBG_generate_no_reseed(
+  uint8_t *output,
+  EverCrypt_CTR_DRBG_state *st,
+  uint32_t n,
+  uint32_t additional_input_len,
+  uint8_t *additional_input
+);
+
+/**
+Instantiate `st` with entropy input and nonce taken from the system random source.
+*/
+bool
+EverCrypt_CTR_DRBG_instantiate(
+  EverCrypt_CTR_DRBG_state *st,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+);
+
+/**
+Reseed `st` with entropy input taken from the system random source.
+*/
+bool
+EverCrypt_CTR_DRBG_reseed(
+  EverCrypt_CTR_DRBG_state *st,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+);
+
+/**
+Write `n` bytes of output into `output`.
+
+  As with `EverCrypt_DRBG_generate`, every request first reseeds `st` from the system
+  random source and the additional input (prediction resistance).
+*/
+bool
+EverCrypt_CTR_DRBG_generate(
+  uint8_t *output,
+  EverCrypt_CTR_DRBG_state *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+);
+
+/**
+Zero out and free `st`.
+*/
+void EverCrypt_CTR_DRBG_uninstantiate(EverCrypt_CTR_DRBG_state *st);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_CTR_DRBG_H_DEFINED
+#endif
@@ -24,6 +24,7 @@
 
 #include "EverCrypt_Chacha20Poly1305.h"
 
+#include "internal/EverCrypt_AutoConfig2.h"
 
 
 void
@@ -38,25 +39,44 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   uint8_t *tag
 )
 {
-  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
-  bool avx = EverCrypt_AutoConfig2_has_avx();
-  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
-  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
-  #if HACL_CAN_COMPILE_VEC256
-  if (vec256)
-  {
-    Hacl_Chacha20Poly1305_256_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
-    return;
-  }
-  #endif
-  #if HACL_CAN_COMPILE_VEC128
-  if (vec128)
-  {
-    Hacl_Chacha20Poly1305_128_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
-    return;
-  }
-  #endif
-  Hacl_Chacha20Poly1305_32_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  EverCrypt_AutoConfig2_get_dispatch()->chacha20poly1305_encrypt(k,
+    n,
+    aadlen,
+    aad,
+    mlen,
+    m,
+    cipher,
+    tag);
+}
+
+/**
+Encrypt and authenticate 8 independent ChaCha20-Poly1305 records.
+
+  The arguments are arrays of 8 elements; the i-th record is processed exactly as
+  `aead_encrypt(k[i], n[i], aadlen[i], aad[i], mlen[i], m[i], cipher[i], tag[i])`.
+  On AVX2-capable machines, the ChaCha20 key streams of the 8 records are computed
+  in parallel, one record per vector lane.
+*/
+void
+EverCrypt_Chacha20Poly1305_aead_encrypt_8(
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **tag
+)
+{
+  EverCrypt_AutoConfig2_get_dispatch()->chacha20poly1305_encrypt_8(k,
+    n,
+    aadlen,
+    aad,
+    mlen,
+    m,
+    cipher,
+    tag);
 }
 
 uint32_t
@@ -71,22 +91,14 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   uint8_t *tag
 )
 {
-  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
-  bool avx = EverCrypt_AutoConfig2_has_avx();
-  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
-  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
-  #if HACL_CAN_COMPILE_VEC256
-  if (vec256)
-  {
-    return Hacl_Chacha20Poly1305_256_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
-  }
-  #endif
-  #if HACL_CAN_COMPILE_VEC128
-  if (vec128)
-  {
-    return Hacl_Chacha20Poly1305_128_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
-  }
-  #endif
-  return Hacl_Chacha20Poly1305_32_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  return
+    EverCrypt_AutoConfig2_get_dispatch()->chacha20poly1305_decrypt(k,
+      n,
+      aadlen,
+      aad,
+      mlen,
+      m,
+      cipher,
+      tag);
 }
 
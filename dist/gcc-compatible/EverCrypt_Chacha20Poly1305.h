@@ -52,6 +52,26 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   uint8_t *tag
 );
 
+/**
+Encrypt and authenticate 8 independent ChaCha20-Poly1305 records.
+
+  The arguments are arrays of 8 elements; the i-th record is processed exactly as
+  `aead_encrypt(k[i], n[i], aadlen[i], aad[i], mlen[i], m[i], cipher[i], tag[i])`.
+  On AVX2-capable machines, the ChaCha20 key streams of the 8 records are computed
+  in parallel, one record per vector lane.
+*/
+void
+EverCrypt_Chacha20Poly1305_aead_encrypt_8(
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **tag
+);
+
 uint32_t
 EverCrypt_Chacha20Poly1305_aead_decrypt(
   uint8_t *k,
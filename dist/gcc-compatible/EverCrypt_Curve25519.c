@@ -24,47 +24,21 @@
 
 #include "EverCrypt_Curve25519.h"
 
+#include "internal/EverCrypt_AutoConfig2.h"
 
 
-static inline bool has_adx_bmi2()
-{
-  bool has_bmi2 = EverCrypt_AutoConfig2_has_bmi2();
-  bool has_adx = EverCrypt_AutoConfig2_has_adx();
-  return has_bmi2 && has_adx;
-}
-
 void EverCrypt_Curve25519_secret_to_public(uint8_t *pub, uint8_t *priv)
 {
-  #if HACL_CAN_COMPILE_VALE
-  if (has_adx_bmi2())
-  {
-    Hacl_Curve25519_64_secret_to_public(pub, priv);
-    return;
-  }
-  #endif
-  Hacl_Curve25519_51_secret_to_public(pub, priv);
+  EverCrypt_AutoConfig2_get_dispatch()->curve25519_secret_to_public(pub, priv);
 }
 
 void EverCrypt_Curve25519_scalarmult(uint8_t *shared, uint8_t *my_priv, uint8_t *their_pub)
 {
-  #if HACL_CAN_COMPILE_VALE
-  if (has_adx_bmi2())
-  {
-    Hacl_Curve25519_64_scalarmult(shared, my_priv, their_pub);
-    return;
-  }
-  #endif
-  Hacl_Curve25519_51_scalarmult(shared, my_priv, their_pub);
+  EverCrypt_AutoConfig2_get_dispatch()->curve25519_scalarmult(shared, my_priv, their_pub);
 }
 
 bool EverCrypt_Curve25519_ecdh(uint8_t *shared, uint8_t *my_priv, uint8_t *their_pub)
 {
-  #if HACL_CAN_COMPILE_VALE
-  if (has_adx_bmi2())
-  {
-    return Hacl_Curve25519_64_ecdh(shared, my_priv, their_pub);
-  }
-  #endif
-  return Hacl_Curve25519_51_ecdh(shared, my_priv, their_pub);
+  return EverCrypt_AutoConfig2_get_dispatch()->curve25519_ecdh(shared, my_priv, their_pub);
 }
 
@@ -1288,19 +1288,7 @@ EverCrypt_DRBG_generate_sha2_256(
       }
     }
     uint8_t *output1 = output;
-    uint32_t max = n / (uint32_t)32U;
-    uint8_t *out = output1;
-    for (uint32_t i = (uint32_t)0U; i < max; i++)
-    {
-      EverCrypt_HMAC_compute_sha2_256(v, k, (uint32_t)32U, v, (uint32_t)32U);
-      memcpy(out + i * (uint32_t)32U, v, (uint32_t)32U * sizeof (uint8_t));
-    }
-    if (max * (uint32_t)32U < n)
-    {
-      uint8_t *block = output1 + max * (uint32_t)32U;
-      EverCrypt_HMAC_compute_sha2_256(v, k, (uint32_t)32U, v, (uint32_t)32U);
-      memcpy(block, v, (n - max * (uint32_t)32U) * sizeof (uint8_t));
-    }
+    EverCrypt_HMAC_iterate_sha2_256(output1, n, k, (uint32_t)32U, v);
     uint32_t input_len = (uint32_t)33U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -1509,19 +1497,7 @@ EverCrypt_DRBG_generate_sha2_384(
       }
     }
     uint8_t *output1 = output;
-    uint32_t max = n / (uint32_t)48U;
-    uint8_t *out = output1;
-    for (uint32_t i = (uint32_t)0U; i < max; i++)
-    {
-      EverCrypt_HMAC_compute_sha2_384(v, k, (uint32_t)48U, v, (uint32_t)48U);
-      memcpy(out + i * (uint32_t)48U, v, (uint32_t)48U * sizeof (uint8_t));
-    }
-    if (max * (uint32_t)48U < n)
-    {
-      uint8_t *block = output1 + max * (uint32_t)48U;
-      EverCrypt_HMAC_compute_sha2_384(v, k, (uint32_t)48U, v, (uint32_t)48U);
-      memcpy(block, v, (n - max * (uint32_t)48U) * sizeof (uint8_t));
-    }
+    EverCrypt_HMAC_iterate_sha2_384(output1, n, k, (uint32_t)48U, v);
     uint32_t input_len = (uint32_t)49U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -1730,19 +1706,7 @@ EverCrypt_DRBG_generate_sha2_512(
       }
     }
     uint8_t *output1 = output;
-    uint32_t max = n / (uint32_t)64U;
-    uint8_t *out = output1;
-    for (uint32_t i = (uint32_t)0U; i < max; i++)
-    {
-      EverCrypt_HMAC_compute_sha2_512(v, k, (uint32_t)64U, v, (uint32_t)64U);
-      memcpy(out + i * (uint32_t)64U, v, (uint32_t)64U * sizeof (uint8_t));
-    }
-    if (max * (uint32_t)64U < n)
-    {
-      uint8_t *block = output1 + max * (uint32_t)64U;
-      EverCrypt_HMAC_compute_sha2_512(v, k, (uint32_t)64U, v, (uint32_t)64U);
-      memcpy(block, v, (n - max * (uint32_t)64U) * sizeof (uint8_t));
-    }
+    EverCrypt_HMAC_iterate_sha2_512(output1, n, k, (uint32_t)64U, v);
     uint32_t input_len = (uint32_t)65U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -2011,3 +1975,102 @@ void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st)
   KRML_HOST_EXIT(255U);
 }
 
+EverCrypt_DRBG_pool
+*EverCrypt_DRBG_pool_create(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t len,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  if
+  (
+    len == (uint32_t)0U
+    || personalization_string_len > EverCrypt_DRBG_max_personalization_string_length - (uint32_t)4U
+  )
+  {
+    return NULL;
+  }
+  KRML_CHECK_SIZE(sizeof (EverCrypt_DRBG_state_s *), len);
+  EverCrypt_DRBG_state_s
+  **states = (EverCrypt_DRBG_state_s **)KRML_HOST_CALLOC(len, sizeof (EverCrypt_DRBG_state_s *));
+  if (states == NULL)
+  {
+    return NULL;
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), personalization_string_len + (uint32_t)4U);
+  uint8_t ps[personalization_string_len + (uint32_t)4U];
+  memset(ps, 0U, (personalization_string_len + (uint32_t)4U) * sizeof (uint8_t));
+  memcpy(ps, personalization_string, personalization_string_len * sizeof (uint8_t));
+  /* Stop at the first state that cannot be instantiated: n states have been created. */
+  uint32_t n = (uint32_t)0U;
+  bool ok = true;
+  while (ok && n < len)
+  {
+    store32_be(ps + personalization_string_len, n);
+    EverCrypt_DRBG_state_s *st = EverCrypt_DRBG_create(a);
+    states[n] = st;
+    n = n + (uint32_t)1U;
+    ok = EverCrypt_DRBG_instantiate(st, ps, personalization_string_len + (uint32_t)4U);
+  }
+  if (ok)
+  {
+    KRML_CHECK_SIZE(sizeof (EverCrypt_DRBG_pool), (uint32_t)1U);
+    EverCrypt_DRBG_pool
+    *p = (EverCrypt_DRBG_pool *)KRML_HOST_MALLOC(sizeof (EverCrypt_DRBG_pool));
+    if (p != NULL)
+    {
+      p[0U] = ((EverCrypt_DRBG_pool){ .len = len, .states = states });
+      return p;
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    EverCrypt_DRBG_uninstantiate(states[i]);
+  }
+  KRML_HOST_FREE(states);
+  return NULL;
+}
+
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_pool_get(EverCrypt_DRBG_pool *p, uint32_t i)
+{
+  if (i >= p->len)
+  {
+    return NULL;
+  }
+  return p->states[i];
+}
+
+bool
+EverCrypt_DRBG_pool_generate(
+  uint8_t *output,
+  EverCrypt_DRBG_pool *p,
+  uint32_t i,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  EverCrypt_DRBG_state_s *st = EverCrypt_DRBG_pool_get(p, i);
+  if (st == NULL)
+  {
+    return false;
+  }
+  return
+    EverCrypt_DRBG_generate(output,
+      st,
+      n,
+      additional_input,
+      additional_input_len);
+}
+
+void EverCrypt_DRBG_pool_free(EverCrypt_DRBG_pool *p)
+{
+  for (uint32_t i = (uint32_t)0U; i < p->len; i++)
+  {
+    EverCrypt_DRBG_uninstantiate(p->states[i]);
+  }
+  KRML_HOST_FREE(p->states);
+  KRML_HOST_FREE(p);
+}
+
@@ -208,6 +208,60 @@ EverCrypt_DRBG_generate(
 
 void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st);
 
+typedef struct EverCrypt_DRBG_pool_s
+{
+  uint32_t len;
+  EverCrypt_DRBG_state_s **states;
+}
+EverCrypt_DRBG_pool;
+
+/**
+Create a pool of `len` independent DRBG states for the algorithm `a`, or return NULL if
+one of them cannot be instantiated.
+
+  Each state is instantiated with its own entropy input, and with the personalization
+  string followed by the 4-byte big-endian index of the state. The states do not share
+  any mutable data, so that threads using distinct indices, e.g. one per thread or per
+  core, can generate concurrently without locking.
+*/
+EverCrypt_DRBG_pool
+*EverCrypt_DRBG_pool_create(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t len,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+);
+
+/**
+Return the state of index `i` of the pool `p`, or NULL if `i` is not less than the size
+of the pool.
+
+  A state is not synchronized: two threads must not use the same index concurrently.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_pool_get(EverCrypt_DRBG_pool *p, uint32_t i);
+
+/**
+Generate `n` bytes into `output` with the state of index `i` of the pool `p`, as
+`EverCrypt_DRBG_generate`. Returns false if `i` is not less than the size of the pool.
+*/
+bool
+EverCrypt_DRBG_pool_generate(
+  uint8_t *output,
+  EverCrypt_DRBG_pool *p,
+  uint32_t i,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+);
+
+/**
+Uninstantiate every state of the pool `p`, as `EverCrypt_DRBG_uninstantiate`, then free
+the pool itself.
+
+  No thread may be using a state of the pool when it is freed.
+*/
+void EverCrypt_DRBG_pool_free(EverCrypt_DRBG_pool *p);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -493,3 +493,89 @@ EverCrypt_HKDF_extract(
   }
 }
 
+EverCrypt_HKDF_expand_state
+*EverCrypt_HKDF_expand_create_in(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *prk,
+  uint32_t prklen,
+  uint8_t *info,
+  uint32_t infolen
+)
+{
+  EverCrypt_HMAC_state *hmac = EverCrypt_HMAC_create_in(a, prk, prklen);
+  if (hmac == NULL)
+  {
+    return NULL;
+  }
+  uint32_t tlen = EverCrypt_Hash_Incremental_hash_len(a);
+  uint8_t *info1 = (uint8_t *)KRML_HOST_CALLOC(infolen + (uint32_t)1U, sizeof (uint8_t));
+  memcpy(info1, info, infolen * sizeof (uint8_t));
+  uint8_t *block = (uint8_t *)KRML_HOST_CALLOC(tlen, sizeof (uint8_t));
+  EverCrypt_HKDF_expand_state
+  s =
+    {
+      .hmac = hmac,
+      .info = info1,
+      .infolen = infolen,
+      .block = block,
+      .pos = tlen,
+      .counter = (uint8_t)0U,
+      .remaining = (uint32_t)255U * tlen
+    };
+  KRML_CHECK_SIZE(sizeof (EverCrypt_HKDF_expand_state), (uint32_t)1U);
+  EverCrypt_HKDF_expand_state
+  *p = (EverCrypt_HKDF_expand_state *)KRML_HOST_MALLOC(sizeof (EverCrypt_HKDF_expand_state));
+  p[0U] = s;
+  return p;
+}
+
+/* T(i) = HMAC(prk, T(i - 1) || info || i), with T(0) empty */
+static void hkdf_expand_next_block(EverCrypt_HKDF_expand_state *s, uint32_t tlen)
+{
+  EverCrypt_HMAC_reset(s->hmac);
+  if (s->counter > (uint8_t)0U)
+  {
+    EverCrypt_HMAC_update(s->hmac, s->block, tlen);
+  }
+  s->counter = s->counter + (uint8_t)1U;
+  EverCrypt_HMAC_update(s->hmac, s->info, s->infolen);
+  EverCrypt_HMAC_update(s->hmac, &s->counter, (uint32_t)1U);
+  EverCrypt_HMAC_finish(s->hmac, s->block);
+  s->pos = (uint32_t)0U;
+}
+
+bool EverCrypt_HKDF_expand_next(EverCrypt_HKDF_expand_state *s, uint8_t *okm, uint32_t len)
+{
+  if (len > s->remaining)
+  {
+    return false;
+  }
+  uint32_t tlen = EverCrypt_Hash_Incremental_hash_len(EverCrypt_HMAC_alg_of_state(s->hmac));
+  s->remaining = s->remaining - len;
+  uint32_t off = (uint32_t)0U;
+  while (off < len)
+  {
+    if (s->pos == tlen)
+    {
+      hkdf_expand_next_block(s, tlen);
+    }
+    uint32_t n = tlen - s->pos;
+    if (len - off < n)
+    {
+      n = len - off;
+    }
+    memcpy(okm + off, s->block + s->pos, n * sizeof (uint8_t));
+    s->pos = s->pos + n;
+    off = off + n;
+  }
+  return true;
+}
+
+void EverCrypt_HKDF_expand_free(EverCrypt_HKDF_expand_state *s)
+{
+  EverCrypt_HMAC_free(s->hmac);
+  KRML_HOST_FREE(s->info);
+  KRML_HOST_FREE(s->block);
+  KRML_HOST_FREE(s);
+}
+
@@ -173,6 +173,46 @@ EverCrypt_HKDF_extract(
   uint32_t ikmlen
 );
 
+typedef struct EverCrypt_HKDF_expand_state_s
+{
+  EverCrypt_HMAC_state *hmac;
+  uint8_t *info;
+  uint32_t infolen;
+  uint8_t *block;
+  uint32_t pos;
+  uint8_t counter;
+  uint32_t remaining;
+}
+EverCrypt_HKDF_expand_state;
+
+/**
+Allocate a state that produces the output of HKDF-Expand for the algorithm `a`, the
+pseudorandom key `prk` and the context `info`, or return NULL if `a` is not supported.
+
+  Output blocks are only computed when `EverCrypt_HKDF_expand_next` asks for them, so
+  that the output can be consumed in pieces without knowing its total length upfront.
+  The key schedule of HMAC is computed once for all blocks.
+*/
+EverCrypt_HKDF_expand_state
+*EverCrypt_HKDF_expand_create_in(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *prk,
+  uint32_t prklen,
+  uint8_t *info,
+  uint32_t infolen
+);
+
+/**
+Write the next `len` bytes of the output of HKDF-Expand into `okm`.
+
+  The concatenation of the outputs of successive calls is the output of
+  `EverCrypt_HKDF_expand` for the same arguments. Returns false, without writing to
+  `okm`, if the total output would exceed 255 times the hash length.
+*/
+bool EverCrypt_HKDF_expand_next(EverCrypt_HKDF_expand_state *s, uint8_t *okm, uint32_t len);
+
+void EverCrypt_HKDF_expand_free(EverCrypt_HKDF_expand_state *s);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -933,3 +933,247 @@ EverCrypt_HMAC_compute(
   }
 }
 
+void
+EverCrypt_HMAC_iterate_sha2_256(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+)
+{
+  uint8_t key_block[64U] = { 0U };
+  uint8_t ipad[64U] = { 0U };
+  uint8_t opad[64U] = { 0U };
+  uint8_t hash1[32U] = { 0U };
+  uint32_t inner[8U] = { 0U };
+  uint32_t outer[8U] = { 0U };
+  uint32_t st[8U] = { 0U };
+  if (key_len <= (uint32_t)64U)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_hash_256(key, key_len, key_block);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    ipad[i] = (uint8_t)0x36U ^ key_block[i];
+    opad[i] = (uint8_t)0x5cU ^ key_block[i];
+  }
+  Hacl_Hash_Core_SHA2_init_256(inner);
+  EverCrypt_Hash_update_multi_256(inner, ipad, (uint32_t)1U);
+  Hacl_Hash_Core_SHA2_init_256(outer);
+  EverCrypt_Hash_update_multi_256(outer, opad, (uint32_t)1U);
+  uint32_t n = (dst_len + (uint32_t)31U) / (uint32_t)32U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    memcpy(st, inner, (uint32_t)8U * sizeof (uint32_t));
+    EverCrypt_Hash_update_last_256(st, (uint64_t)(uint32_t)64U, v, (uint32_t)32U);
+    Hacl_Hash_Core_SHA2_finish_256(st, hash1);
+    memcpy(st, outer, (uint32_t)8U * sizeof (uint32_t));
+    EverCrypt_Hash_update_last_256(st, (uint64_t)(uint32_t)64U, hash1, (uint32_t)32U);
+    Hacl_Hash_Core_SHA2_finish_256(st, v);
+    uint32_t len = dst_len - i * (uint32_t)32U;
+    if (len > (uint32_t)32U)
+    {
+      len = (uint32_t)32U;
+    }
+    memcpy(dst + i * (uint32_t)32U, v, len * sizeof (uint8_t));
+  }
+}
+
+void
+EverCrypt_HMAC_iterate_sha2_384(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+)
+{
+  Hacl_HMAC_SHA2_384_iterate(dst, dst_len, key, key_len, v);
+}
+
+void
+EverCrypt_HMAC_iterate_sha2_512(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+)
+{
+  Hacl_HMAC_SHA2_512_iterate(dst, dst_len, key, key_len, v);
+}
+
+/* The message is buffered so that the last block, which BLAKE2 compresses
+   differently, is only processed by finish. As in Hacl_Streaming, the buffer is
+   full when total_len is a non-zero multiple of the block length. */
+static uint32_t hmac_buffered_len(uint32_t block_len, uint64_t total_len)
+{
+  if (total_len % (uint64_t)block_len == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    return block_len;
+  }
+  return (uint32_t)(total_len % (uint64_t)block_len);
+}
+
+EverCrypt_HMAC_state
+*EverCrypt_HMAC_create_in(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len)
+{
+  if (!EverCrypt_HMAC_is_supported_alg(a))
+  {
+    return NULL;
+  }
+  uint32_t block_len = EverCrypt_Hash_Incremental_block_len(a);
+  uint8_t *key_block = (uint8_t *)KRML_HOST_CALLOC(block_len, sizeof (uint8_t));
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC(block_len, sizeof (uint8_t));
+  EverCrypt_HMAC_state
+  s =
+    {
+      .alg = a,
+      .key_block = key_block,
+      .inner = EverCrypt_Hash_create_in(a),
+      .outer = EverCrypt_Hash_create_in(a),
+      .block_state = EverCrypt_Hash_create_in(a),
+      .tmp = EverCrypt_Hash_create_in(a),
+      .buf = buf,
+      .total_len = (uint64_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (EverCrypt_HMAC_state), (uint32_t)1U);
+  EverCrypt_HMAC_state *p = (EverCrypt_HMAC_state *)KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_state));
+  p[0U] = s;
+  EverCrypt_HMAC_init(key, key_len, p);
+  return p;
+}
+
+void EverCrypt_HMAC_init(uint8_t *key, uint32_t key_len, EverCrypt_HMAC_state *s)
+{
+  Spec_Hash_Definitions_hash_alg a = s->alg;
+  uint32_t block_len = EverCrypt_Hash_Incremental_block_len(a);
+  uint8_t *key_block = s->key_block;
+  memset(key_block, 0U, block_len * sizeof (uint8_t));
+  if (key_len <= block_len)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_hash(a, key_block, key, key_len);
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), block_len);
+  uint8_t pad[block_len];
+  memset(pad, 0U, block_len * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < block_len; i++)
+  {
+    pad[i] = (uint8_t)0x36U ^ key_block[i];
+  }
+  EverCrypt_Hash_init(s->inner);
+  EverCrypt_Hash_update_multi2(s->inner, (uint64_t)0U, pad, block_len);
+  for (uint32_t i = (uint32_t)0U; i < block_len; i++)
+  {
+    pad[i] = (uint8_t)0x5cU ^ key_block[i];
+  }
+  EverCrypt_Hash_init(s->outer);
+  EverCrypt_Hash_update_multi2(s->outer, (uint64_t)0U, pad, block_len);
+  EverCrypt_HMAC_reset(s);
+}
+
+void EverCrypt_HMAC_reset(EverCrypt_HMAC_state *s)
+{
+  EverCrypt_Hash_copy(s->inner, s->block_state);
+  s->total_len = (uint64_t)0U;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HMAC_update(EverCrypt_HMAC_state *s, uint8_t *data, uint32_t len)
+{
+  uint32_t block_len = EverCrypt_Hash_Incremental_block_len(s->alg);
+  uint64_t total_len = s->total_len;
+  if
+  (
+    (uint64_t)len
+    > EverCrypt_Hash_Incremental_max_input_len64(s->alg) - (uint64_t)block_len - total_len
+  )
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint8_t *buf = s->buf;
+  uint32_t sz = hmac_buffered_len(block_len, total_len);
+  s->total_len = total_len + (uint64_t)len;
+  if (len <= block_len - sz)
+  {
+    memcpy(buf + sz, data, len * sizeof (uint8_t));
+    return EverCrypt_Error_Success;
+  }
+  uint32_t diff = block_len - sz;
+  uint64_t prevlen = (uint64_t)block_len + total_len - (uint64_t)sz;
+  memcpy(buf + sz, data, diff * sizeof (uint8_t));
+  EverCrypt_Hash_update_multi2(s->block_state, prevlen, buf, block_len);
+  uint8_t *data1 = data + diff;
+  uint32_t len1 = len - diff;
+  uint32_t ite;
+  if (len1 % block_len == (uint32_t)0U)
+  {
+    ite = block_len;
+  }
+  else
+  {
+    ite = len1 % block_len;
+  }
+  uint32_t data1_len = len1 - ite;
+  EverCrypt_Hash_update_multi2(s->block_state, prevlen + (uint64_t)block_len, data1, data1_len);
+  memcpy(buf, data1 + data1_len, ite * sizeof (uint8_t));
+  return EverCrypt_Error_Success;
+}
+
+void EverCrypt_HMAC_finish(EverCrypt_HMAC_state *s, uint8_t *dst)
+{
+  Spec_Hash_Definitions_hash_alg a = s->alg;
+  uint32_t block_len = EverCrypt_Hash_Incremental_block_len(a);
+  uint32_t hash_len = EverCrypt_Hash_Incremental_hash_len(a);
+  uint64_t total_len = s->total_len;
+  uint8_t hash1[64U] = { 0U };
+  if (total_len == (uint64_t)0U)
+  {
+    /* The inner padded key is the last block of the inner hash */
+    KRML_CHECK_SIZE(sizeof (uint8_t), block_len);
+    uint8_t ipad[block_len];
+    memset(ipad, 0U, block_len * sizeof (uint8_t));
+    for (uint32_t i = (uint32_t)0U; i < block_len; i++)
+    {
+      ipad[i] = (uint8_t)0x36U ^ s->key_block[i];
+    }
+    EverCrypt_Hash_init(s->tmp);
+    EverCrypt_Hash_update_last2(s->tmp, (uint64_t)0U, ipad, block_len);
+  }
+  else
+  {
+    uint32_t r = hmac_buffered_len(block_len, total_len);
+    EverCrypt_Hash_copy(s->block_state, s->tmp);
+    EverCrypt_Hash_update_last2(s->tmp, (uint64_t)block_len + total_len - (uint64_t)r, s->buf, r);
+  }
+  EverCrypt_Hash_finish(s->tmp, hash1);
+  EverCrypt_Hash_copy(s->outer, s->tmp);
+  EverCrypt_Hash_update_last2(s->tmp, (uint64_t)block_len, hash1, hash_len);
+  EverCrypt_Hash_finish(s->tmp, dst);
+}
+
+Spec_Hash_Definitions_hash_alg EverCrypt_HMAC_alg_of_state(EverCrypt_HMAC_state *s)
+{
+  return s->alg;
+}
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state *s)
+{
+  KRML_HOST_FREE(s->key_block);
+  EverCrypt_Hash_free(s->inner);
+  EverCrypt_Hash_free(s->outer);
+  EverCrypt_Hash_free(s->block_state);
+  EverCrypt_Hash_free(s->tmp);
+  KRML_HOST_FREE(s->buf);
+  KRML_HOST_FREE(s);
+}
+
@@ -110,6 +110,94 @@ EverCrypt_HMAC_compute(
   uint32_t datalen
 );
 
+/**
+Replace `v` with HMAC-SHA2-256(key, v) as many times as needed to fill `dst` with the
+successive values of `v`, as `Hacl_HMAC_SHA2_256_iterate`, with the compression function
+selected for the current CPU.
+*/
+void
+EverCrypt_HMAC_iterate_sha2_256(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+);
+
+void
+EverCrypt_HMAC_iterate_sha2_384(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+);
+
+void
+EverCrypt_HMAC_iterate_sha2_512(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+);
+
+typedef struct EverCrypt_HMAC_state_s
+{
+  Spec_Hash_Definitions_hash_alg alg;
+  uint8_t *key_block;
+  EverCrypt_Hash_state_s *inner;
+  EverCrypt_Hash_state_s *outer;
+  EverCrypt_Hash_state_s *block_state;
+  EverCrypt_Hash_state_s *tmp;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+EverCrypt_HMAC_state;
+
+/**
+Allocate an incremental HMAC state for the algorithm `a` and the key `key` of length
+`key_len`, or return NULL if `a` is not supported by HMAC.
+
+  The key is processed once: the inner and outer padded keys are compressed here and
+  every MAC computed from the state starts from the cached chaining values. Messages
+  are then streamed with `update` and authenticated with `finish`, with the block
+  function selected by EverCrypt_Hash for the current CPU.
+*/
+EverCrypt_HMAC_state
+*EverCrypt_HMAC_create_in(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len);
+
+/**
+Re-key the state `s` with `key` and reset its message to the empty message.
+*/
+void EverCrypt_HMAC_init(uint8_t *key, uint32_t key_len, EverCrypt_HMAC_state *s);
+
+/**
+Reset the message of the state `s` to the empty message, keeping its key.
+*/
+void EverCrypt_HMAC_reset(EverCrypt_HMAC_state *s);
+
+/**
+Append `len` bytes of `data` to the message of the state `s`.
+
+  Returns `MaximumLengthExceeded` and leaves the state unchanged if the total length of
+  the message would exceed the maximum input length of the hash algorithm.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HMAC_update(EverCrypt_HMAC_state *s, uint8_t *data, uint32_t len);
+
+/**
+Write the MAC of the message of the state `s` into `dst`, whose length is the hash
+length of the algorithm of the state.
+
+  The state is not modified, so that the message can be extended further.
+*/
+void EverCrypt_HMAC_finish(EverCrypt_HMAC_state *s, uint8_t *dst);
+
+Spec_Hash_Definitions_hash_alg EverCrypt_HMAC_alg_of_state(EverCrypt_HMAC_state *s);
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state *s);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -22,15 +22,22 @@
  */
 
 
-#include "EverCrypt_Hash.h"
+#include "internal/EverCrypt_Hash.h"
 
 #include "internal/Vale.h"
+#include "internal/EverCrypt_AutoConfig2.h"
 #include "internal/Hacl_Hash_SHA2.h"
 #include "internal/Hacl_Hash_SHA1.h"
 #include "internal/Hacl_Hash_MD5.h"
 #include "internal/Hacl_Hash_Blake2s_128.h"
 #include "internal/Hacl_Hash_Blake2b_256.h"
 #include "internal/Hacl_Hash_Blake2.h"
+#include "Hacl_SHA2_Vec256.h"
+#include "Hacl_SHA2_Vec128.h"
+
+#if HACL_CAN_COMPILE_VALE
+#include <immintrin.h>
+#endif
 
 C_String_t EverCrypt_Hash_string_of_alg(Spec_Hash_Definitions_hash_alg uu___)
 {
@@ -530,19 +537,115 @@ k224_256[64U] =
     (uint32_t)0x90befffaU, (uint32_t)0xa4506cebU, (uint32_t)0xbef9a3f7U, (uint32_t)0xc67178f2U
   };
 
+#if HACL_CAN_COMPILE_VALE
+void EverCrypt_Hash_update_multi_256_shaext(uint32_t *s, uint8_t *blocks, uint32_t n)
+{
+  uint64_t n1 = (uint64_t)n;
+  uint64_t scrut = sha256_update(s, blocks, n1, k224_256);
+}
+#endif
+
 void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n)
 {
-  bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
-  #if HACL_CAN_COMPILE_VALE
-  if (has_shaext && has_sse)
-  {
-    uint64_t n1 = (uint64_t)n;
-    uint64_t scrut = sha256_update(s, blocks, n1, k224_256);
-    return;
-  }
-  #endif
-  Hacl_Hash_SHA2_update_multi_256(s, blocks, n);
+  EverCrypt_AutoConfig2_get_dispatch()->sha256_update_multi(s, blocks, n);
+}
+
+#if HACL_CAN_COMPILE_VALE
+/* Vale has no SHA-1: this path uses the SHA extension intrinsics, compiled for that target only,
+   and is selected by EverCrypt_AutoConfig2 under the same conditions as the SHA-256 one. The
+   message words of a block are kept in MSG0..MSG3, four at a time; each group of four rounds
+   schedules the words of the following groups. */
+__attribute__((target("sha,sse4.1")))
+void EverCrypt_Hash_update_multi_sha1_shaext(uint32_t *s, uint8_t *blocks, uint32_t n)
+{
+  const __m128i mask = _mm_set_epi64x(0x0001020304050607LL, 0x08090a0b0c0d0e0fLL);
+  __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)s), 0x1B);
+  __m128i e0 = _mm_set_epi32((int)s[4U], 0, 0, 0);
+  __m128i e1;
+  __m128i msg0;
+  __m128i msg1;
+  __m128i msg2;
+  __m128i msg3;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint8_t *b = blocks + i * (uint32_t)64U;
+    __m128i abcd_save = abcd;
+    __m128i e0_save = e0;
+    /* Rounds 0-15 */
+    msg0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)b), mask);
+    e0 = _mm_add_epi32(e0, msg0);
+    e1 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+    msg1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(b + (uint32_t)16U)), mask);
+    e1 = _mm_sha1nexte_epu32(e1, msg1);
+    e0 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+    msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+    msg2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(b + (uint32_t)32U)), mask);
+    e0 = _mm_sha1nexte_epu32(e0, msg2);
+    e1 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+    msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+    msg0 = _mm_xor_si128(msg0, msg2);
+    msg3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(b + (uint32_t)48U)), mask);
+    e1 = _mm_sha1nexte_epu32(e1, msg3);
+    e0 = abcd;
+    msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+    abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+    msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+    msg1 = _mm_xor_si128(msg1, msg3);
+    /* Rounds 16-67: group g uses the words in msg(g % 4), completes msg(g + 1), starts
+       msg(g + 3) and adds into msg(g + 2). The round function changes every 20 rounds. */
+#define SHA1_ROUNDS4(ex, ey, m, m1, m2, m3, f) \
+    ex = _mm_sha1nexte_epu32(ex, m); \
+    ey = abcd; \
+    m1 = _mm_sha1msg2_epu32(m1, m); \
+    abcd = _mm_sha1rnds4_epu32(abcd, ex, f); \
+    m3 = _mm_sha1msg1_epu32(m3, m); \
+    m2 = _mm_xor_si128(m2, m);
+    SHA1_ROUNDS4(e0, e1, msg0, msg1, msg2, msg3, 0)
+    SHA1_ROUNDS4(e1, e0, msg1, msg2, msg3, msg0, 1)
+    SHA1_ROUNDS4(e0, e1, msg2, msg3, msg0, msg1, 1)
+    SHA1_ROUNDS4(e1, e0, msg3, msg0, msg1, msg2, 1)
+    SHA1_ROUNDS4(e0, e1, msg0, msg1, msg2, msg3, 1)
+    SHA1_ROUNDS4(e1, e0, msg1, msg2, msg3, msg0, 1)
+    SHA1_ROUNDS4(e0, e1, msg2, msg3, msg0, msg1, 2)
+    SHA1_ROUNDS4(e1, e0, msg3, msg0, msg1, msg2, 2)
+    SHA1_ROUNDS4(e0, e1, msg0, msg1, msg2, msg3, 2)
+    SHA1_ROUNDS4(e1, e0, msg1, msg2, msg3, msg0, 2)
+    SHA1_ROUNDS4(e0, e1, msg2, msg3, msg0, msg1, 2)
+    SHA1_ROUNDS4(e1, e0, msg3, msg0, msg1, msg2, 3)
+    SHA1_ROUNDS4(e0, e1, msg0, msg1, msg2, msg3, 3)
+#undef SHA1_ROUNDS4
+    /* Rounds 68-79 */
+    e1 = _mm_sha1nexte_epu32(e1, msg1);
+    e0 = abcd;
+    msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+    abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+    msg3 = _mm_xor_si128(msg3, msg1);
+    e0 = _mm_sha1nexte_epu32(e0, msg2);
+    e1 = abcd;
+    msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+    abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+    e1 = _mm_sha1nexte_epu32(e1, msg3);
+    e0 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+    e0 = _mm_sha1nexte_epu32(e0, e0_save);
+    abcd = _mm_add_epi32(abcd, abcd_save);
+  }
+  _mm_storeu_si128((__m128i *)s, _mm_shuffle_epi32(abcd, 0x1B));
+  s[4U] = (uint32_t)_mm_extract_epi32(e0, 3);
+}
+#endif
+
+void EverCrypt_Hash_update_multi_sha1(uint32_t *s, uint8_t *blocks, uint32_t n)
+{
+  EverCrypt_AutoConfig2_get_dispatch()->sha1_update_multi(s, blocks, n);
+}
+
+void EverCrypt_Hash_update_multi_512(uint64_t *s, uint8_t *blocks, uint32_t n)
+{
+  EverCrypt_AutoConfig2_get_dispatch()->sha512_update_multi(s, blocks, n);
 }
 
 void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t *block)
@@ -557,7 +660,7 @@ void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t
   if (scrut.tag == SHA1_s)
   {
     uint32_t *p1 = scrut.case_SHA1_s;
-    Hacl_Hash_Core_SHA1_legacy_update(p1, block);
+    EverCrypt_Hash_update_multi_sha1(p1, block, (uint32_t)1U);
     return;
   }
   if (scrut.tag == SHA2_224_s)
@@ -575,13 +678,13 @@ void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t
   if (scrut.tag == SHA2_384_s)
   {
     uint64_t *p1 = scrut.case_SHA2_384_s;
-    Hacl_Hash_Core_SHA2_update_384(p1, block);
+    EverCrypt_Hash_update_multi_512(p1, block, (uint32_t)1U);
     return;
   }
   if (scrut.tag == SHA2_512_s)
   {
     uint64_t *p1 = scrut.case_SHA2_512_s;
-    Hacl_Hash_Core_SHA2_update_512(p1, block);
+    EverCrypt_Hash_update_multi_512(p1, block, (uint32_t)1U);
     return;
   }
   if (scrut.tag == SHA3_256_s)
@@ -665,7 +768,7 @@ EverCrypt_Hash_update_multi2(
   {
     uint32_t *p1 = scrut.case_SHA1_s;
     uint32_t n = len / (uint32_t)64U;
-    Hacl_Hash_SHA1_legacy_update_multi(p1, blocks, n);
+    EverCrypt_Hash_update_multi_sha1(p1, blocks, n);
     return;
   }
   if (scrut.tag == SHA2_224_s)
@@ -686,14 +789,14 @@ EverCrypt_Hash_update_multi2(
   {
     uint64_t *p1 = scrut.case_SHA2_384_s;
     uint32_t n = len / (uint32_t)128U;
-    Hacl_Hash_SHA2_update_multi_384(p1, blocks, n);
+    EverCrypt_Hash_update_multi_512(p1, blocks, n);
     return;
   }
   if (scrut.tag == SHA2_512_s)
   {
     uint64_t *p1 = scrut.case_SHA2_512_s;
     uint32_t n = len / (uint32_t)128U;
-    Hacl_Hash_SHA2_update_multi_512(p1, blocks, n);
+    EverCrypt_Hash_update_multi_512(p1, blocks, n);
     return;
   }
   if (scrut.tag == SHA3_256_s)
@@ -801,6 +904,76 @@ EverCrypt_Hash_update_last_256(
   EverCrypt_Hash_update_multi_256(s, tmp, tmp_len / (uint32_t)64U);
 }
 
+void
+EverCrypt_Hash_update_last_sha1(
+  uint32_t *s,
+  uint64_t prev_len,
+  uint8_t *input,
+  uint32_t input_len
+)
+{
+  uint32_t blocks_n = input_len / (uint32_t)64U;
+  uint32_t blocks_len = blocks_n * (uint32_t)64U;
+  uint8_t *blocks = input;
+  uint32_t rest_len = input_len - blocks_len;
+  uint8_t *rest = input + blocks_len;
+  EverCrypt_Hash_update_multi_sha1(s, blocks, blocks_n);
+  uint64_t total_input_len = prev_len + (uint64_t)input_len;
+  uint32_t
+  pad_len =
+    (uint32_t)1U
+    +
+      ((uint32_t)128U - ((uint32_t)9U + (uint32_t)(total_input_len % (uint64_t)(uint32_t)64U)))
+      % (uint32_t)64U
+    + (uint32_t)8U;
+  uint32_t tmp_len = rest_len + pad_len;
+  uint8_t tmp_twoblocks[128U] = { 0U };
+  uint8_t *tmp = tmp_twoblocks;
+  uint8_t *tmp_rest = tmp;
+  uint8_t *tmp_pad = tmp + rest_len;
+  memcpy(tmp_rest, rest, rest_len * sizeof (uint8_t));
+  Hacl_Hash_Core_SHA1_legacy_pad(total_input_len, tmp_pad);
+  EverCrypt_Hash_update_multi_sha1(s, tmp, tmp_len / (uint32_t)64U);
+}
+
+void
+EverCrypt_Hash_update_last_512(
+  uint64_t *s,
+  FStar_UInt128_uint128 prev_len,
+  uint8_t *input,
+  uint32_t input_len
+)
+{
+  uint32_t blocks_n = input_len / (uint32_t)128U;
+  uint32_t blocks_len = blocks_n * (uint32_t)128U;
+  uint8_t *blocks = input;
+  uint32_t rest_len = input_len - blocks_len;
+  uint8_t *rest = input + blocks_len;
+  EverCrypt_Hash_update_multi_512(s, blocks, blocks_n);
+  FStar_UInt128_uint128
+  total_input_len =
+    FStar_UInt128_add(prev_len,
+      FStar_UInt128_uint64_to_uint128((uint64_t)input_len));
+  uint32_t
+  pad_len =
+    (uint32_t)1U
+    +
+      ((uint32_t)256U
+      -
+        ((uint32_t)17U
+        + (uint32_t)(FStar_UInt128_uint128_to_uint64(total_input_len) % (uint64_t)(uint32_t)128U)))
+      % (uint32_t)128U
+    + (uint32_t)16U;
+  uint32_t tmp_len = rest_len + pad_len;
+  uint8_t tmp_twoblocks[256U] = { 0U };
+  uint8_t *tmp = tmp_twoblocks;
+  uint8_t *tmp_rest = tmp;
+  uint8_t *tmp_pad = tmp + rest_len;
+  memcpy(tmp_rest, rest, rest_len * sizeof (uint8_t));
+  Hacl_Hash_Core_SHA2_pad_512(total_input_len, tmp_pad);
+  EverCrypt_Hash_update_multi_512(s, tmp, tmp_len / (uint32_t)128U);
+}
+
 void
 EverCrypt_Hash_update_last2(
   EverCrypt_Hash_state_s *s,
@@ -819,7 +992,7 @@ EverCrypt_Hash_update_last2(
   if (scrut.tag == SHA1_s)
   {
     uint32_t *p1 = scrut.case_SHA1_s;
-    Hacl_Hash_SHA1_legacy_update_last(p1, prev_len, last, last_len);
+    EverCrypt_Hash_update_last_sha1(p1, prev_len, last, last_len);
     return;
   }
   if (scrut.tag == SHA2_224_s)
@@ -837,13 +1010,13 @@ EverCrypt_Hash_update_last2(
   if (scrut.tag == SHA2_384_s)
   {
     uint64_t *p1 = scrut.case_SHA2_384_s;
-    Hacl_Hash_SHA2_update_last_384(p1, FStar_UInt128_uint64_to_uint128(prev_len), last, last_len);
+    EverCrypt_Hash_update_last_512(p1, FStar_UInt128_uint64_to_uint128(prev_len), last, last_len);
     return;
   }
   if (scrut.tag == SHA2_512_s)
   {
     uint64_t *p1 = scrut.case_SHA2_512_s;
-    Hacl_Hash_SHA2_update_last_512(p1, FStar_UInt128_uint64_to_uint128(prev_len), last, last_len);
+    EverCrypt_Hash_update_last_512(p1, FStar_UInt128_uint64_to_uint128(prev_len), last, last_len);
     return;
   }
   if (scrut.tag == SHA3_256_s)
@@ -1443,6 +1616,113 @@ void EverCrypt_Hash_hash_224(uint8_t *input, uint32_t input_len, uint8_t *dst)
   Hacl_Hash_Core_SHA2_finish_224(s, dst);
 }
 
+void EverCrypt_Hash_hash_sha1(uint8_t *input, uint32_t input_len, uint8_t *dst)
+{
+  uint32_t
+  scrut[5U] =
+    {
+      (uint32_t)0x67452301U, (uint32_t)0xefcdab89U, (uint32_t)0x98badcfeU, (uint32_t)0x10325476U,
+      (uint32_t)0xc3d2e1f0U
+    };
+  uint32_t *s = scrut;
+  uint32_t blocks_n0 = input_len / (uint32_t)64U;
+  uint32_t blocks_n1;
+  if (input_len % (uint32_t)64U == (uint32_t)0U && blocks_n0 > (uint32_t)0U)
+  {
+    blocks_n1 = blocks_n0 - (uint32_t)1U;
+  }
+  else
+  {
+    blocks_n1 = blocks_n0;
+  }
+  uint32_t blocks_len0 = blocks_n1 * (uint32_t)64U;
+  uint8_t *blocks0 = input;
+  uint32_t rest_len0 = input_len - blocks_len0;
+  uint8_t *rest0 = input + blocks_len0;
+  uint32_t blocks_n = blocks_n1;
+  uint32_t blocks_len = blocks_len0;
+  uint8_t *blocks = blocks0;
+  uint32_t rest_len = rest_len0;
+  uint8_t *rest = rest0;
+  EverCrypt_Hash_update_multi_sha1(s, blocks, blocks_n);
+  EverCrypt_Hash_update_last_sha1(s, (uint64_t)blocks_len, rest, rest_len);
+  Hacl_Hash_Core_SHA1_legacy_finish(s, dst);
+}
+
+void EverCrypt_Hash_hash_384(uint8_t *input, uint32_t input_len, uint8_t *dst)
+{
+  uint64_t
+  scrut[8U] =
+    {
+      (uint64_t)0xcbbb9d5dc1059ed8U, (uint64_t)0x629a292a367cd507U, (uint64_t)0x9159015a3070dd17U,
+      (uint64_t)0x152fecd8f70e5939U, (uint64_t)0x67332667ffc00b31U, (uint64_t)0x8eb44a8768581511U,
+      (uint64_t)0xdb0c2e0d64f98fa7U, (uint64_t)0x47b5481dbefa4fa4U
+    };
+  uint64_t *s = scrut;
+  uint32_t blocks_n0 = input_len / (uint32_t)128U;
+  uint32_t blocks_n1;
+  if (input_len % (uint32_t)128U == (uint32_t)0U && blocks_n0 > (uint32_t)0U)
+  {
+    blocks_n1 = blocks_n0 - (uint32_t)1U;
+  }
+  else
+  {
+    blocks_n1 = blocks_n0;
+  }
+  uint32_t blocks_len0 = blocks_n1 * (uint32_t)128U;
+  uint8_t *blocks0 = input;
+  uint32_t rest_len0 = input_len - blocks_len0;
+  uint8_t *rest0 = input + blocks_len0;
+  uint32_t blocks_n = blocks_n1;
+  uint32_t blocks_len = blocks_len0;
+  uint8_t *blocks = blocks0;
+  uint32_t rest_len = rest_len0;
+  uint8_t *rest = rest0;
+  EverCrypt_Hash_update_multi_512(s, blocks, blocks_n);
+  EverCrypt_Hash_update_last_512(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)blocks_len),
+    rest,
+    rest_len);
+  Hacl_Hash_Core_SHA2_finish_384(s, dst);
+}
+
+void EverCrypt_Hash_hash_512(uint8_t *input, uint32_t input_len, uint8_t *dst)
+{
+  uint64_t
+  scrut[8U] =
+    {
+      (uint64_t)0x6a09e667f3bcc908U, (uint64_t)0xbb67ae8584caa73bU, (uint64_t)0x3c6ef372fe94f82bU,
+      (uint64_t)0xa54ff53a5f1d36f1U, (uint64_t)0x510e527fade682d1U, (uint64_t)0x9b05688c2b3e6c1fU,
+      (uint64_t)0x1f83d9abfb41bd6bU, (uint64_t)0x5be0cd19137e2179U
+    };
+  uint64_t *s = scrut;
+  uint32_t blocks_n0 = input_len / (uint32_t)128U;
+  uint32_t blocks_n1;
+  if (input_len % (uint32_t)128U == (uint32_t)0U && blocks_n0 > (uint32_t)0U)
+  {
+    blocks_n1 = blocks_n0 - (uint32_t)1U;
+  }
+  else
+  {
+    blocks_n1 = blocks_n0;
+  }
+  uint32_t blocks_len0 = blocks_n1 * (uint32_t)128U;
+  uint8_t *blocks0 = input;
+  uint32_t rest_len0 = input_len - blocks_len0;
+  uint8_t *rest0 = input + blocks_len0;
+  uint32_t blocks_n = blocks_n1;
+  uint32_t blocks_len = blocks_len0;
+  uint8_t *blocks = blocks0;
+  uint32_t rest_len = rest_len0;
+  uint8_t *rest = rest0;
+  EverCrypt_Hash_update_multi_512(s, blocks, blocks_n);
+  EverCrypt_Hash_update_last_512(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)blocks_len),
+    rest,
+    rest_len);
+  Hacl_Hash_Core_SHA2_finish_512(s, dst);
+}
+
 void
 EverCrypt_Hash_hash(
   Spec_Hash_Definitions_hash_alg a,
@@ -1460,7 +1740,7 @@ EverCrypt_Hash_hash(
       }
     case Spec_Hash_Definitions_SHA1:
       {
-        Hacl_Hash_SHA1_legacy_hash(input, len, dst);
+        EverCrypt_Hash_hash_sha1(input, len, dst);
         break;
       }
     case Spec_Hash_Definitions_SHA2_224:
@@ -1475,12 +1755,12 @@ EverCrypt_Hash_hash(
       }
     case Spec_Hash_Definitions_SHA2_384:
       {
-        Hacl_Hash_SHA2_hash_384(input, len, dst);
+        EverCrypt_Hash_hash_384(input, len, dst);
         break;
       }
     case Spec_Hash_Definitions_SHA2_512:
       {
-        Hacl_Hash_SHA2_hash_512(input, len, dst);
+        EverCrypt_Hash_hash_512(input, len, dst);
         break;
       }
     case Spec_Hash_Definitions_SHA3_256:
@@ -1490,28 +1770,12 @@ EverCrypt_Hash_hash(
       }
     case Spec_Hash_Definitions_Blake2S:
       {
-        bool vec128 = EverCrypt_AutoConfig2_has_vec128();
-        #if HACL_CAN_COMPILE_VEC128
-        if (vec128)
-        {
-          Hacl_Hash_Blake2s_128_hash_blake2s_128(input, len, dst);
-          return;
-        }
-        #endif
-        Hacl_Hash_Blake2_hash_blake2s_32(input, len, dst);
+        EverCrypt_AutoConfig2_get_dispatch()->blake2s_hash(input, len, dst);
         break;
       }
     case Spec_Hash_Definitions_Blake2B:
       {
-        bool vec256 = EverCrypt_AutoConfig2_has_vec256();
-        #if HACL_CAN_COMPILE_VEC256
-        if (vec256)
-        {
-          Hacl_Hash_Blake2b_256_hash_blake2b_256(input, len, dst);
-          return;
-        }
-        #endif
-        Hacl_Hash_Blake2_hash_blake2b_32(input, len, dst);
+        EverCrypt_AutoConfig2_get_dispatch()->blake2b_hash(input, len, dst);
         break;
       }
     default:
@@ -1522,6 +1786,254 @@ EverCrypt_Hash_hash(
   }
 }
 
+typedef struct hash_many_job_s
+{
+  uint32_t len;
+  uint32_t i;
+}
+hash_many_job;
+
+static int hash_many_cmp(const void *x, const void *y)
+{
+  uint32_t lx = ((const hash_many_job *)x)->len;
+  uint32_t ly = ((const hash_many_job *)y)->len;
+  if (lx < ly)
+  {
+    return -1;
+  }
+  if (lx > ly)
+  {
+    return 1;
+  }
+  uint32_t ix = ((const hash_many_job *)x)->i;
+  uint32_t iy = ((const hash_many_job *)y)->i;
+  return (ix > iy) - (ix < iy);
+}
+
+/* Multi-buffer kernels, selected by EverCrypt_AutoConfig2 for EverCrypt_Hash_hash_many:
+   lanes_8 (resp. lanes_4) hashes the 8 (resp. 4) inputs in, all of length len, into out,
+   for a = SHA2_256 or SHA2_224 (resp. SHA2_512 or SHA2_384 for sha2_512). */
+#if HACL_CAN_COMPILE_VEC256
+void
+EverCrypt_Hash_sha2_256_lanes_8(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t **out,
+  uint32_t len,
+  uint8_t **in
+)
+{
+  if (a == Spec_Hash_Definitions_SHA2_256)
+  {
+    Hacl_SHA2_Vec256_sha256_8(out[0U],
+      out[1U],
+      out[2U],
+      out[3U],
+      out[4U],
+      out[5U],
+      out[6U],
+      out[7U],
+      len,
+      in[0U],
+      in[1U],
+      in[2U],
+      in[3U],
+      in[4U],
+      in[5U],
+      in[6U],
+      in[7U]);
+    return;
+  }
+  Hacl_SHA2_Vec256_sha224_8(out[0U],
+    out[1U],
+    out[2U],
+    out[3U],
+    out[4U],
+    out[5U],
+    out[6U],
+    out[7U],
+    len,
+    in[0U],
+    in[1U],
+    in[2U],
+    in[3U],
+    in[4U],
+    in[5U],
+    in[6U],
+    in[7U]);
+}
+#endif
+
+#if HACL_CAN_COMPILE_VEC128
+void
+EverCrypt_Hash_sha2_256_lanes_4(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t **out,
+  uint32_t len,
+  uint8_t **in
+)
+{
+  if (a == Spec_Hash_Definitions_SHA2_256)
+  {
+    Hacl_SHA2_Vec128_sha256_4(out[0U],
+      out[1U],
+      out[2U],
+      out[3U],
+      len,
+      in[0U],
+      in[1U],
+      in[2U],
+      in[3U]);
+    return;
+  }
+  Hacl_SHA2_Vec128_sha224_4(out[0U],
+    out[1U],
+    out[2U],
+    out[3U],
+    len,
+    in[0U],
+    in[1U],
+    in[2U],
+    in[3U]);
+}
+#endif
+
+#if HACL_CAN_COMPILE_VEC256
+void
+EverCrypt_Hash_sha2_512_lanes_4(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t **out,
+  uint32_t len,
+  uint8_t **in
+)
+{
+  if (a == Spec_Hash_Definitions_SHA2_512)
+  {
+    Hacl_SHA2_Vec256_sha512_4(out[0U],
+      out[1U],
+      out[2U],
+      out[3U],
+      len,
+      in[0U],
+      in[1U],
+      in[2U],
+      in[3U]);
+    return;
+  }
+  Hacl_SHA2_Vec256_sha384_4(out[0U],
+    out[1U],
+    out[2U],
+    out[3U],
+    len,
+    in[0U],
+    in[1U],
+    in[2U],
+    in[3U]);
+}
+#endif
+
+/* Hashes the g jobs at jobs, which all have length len, using the widest
+   multi-buffer kernel of the dispatch table d for a. Returns the number of jobs
+   hashed, which is 0 if no kernel applies. */
+static uint32_t
+hash_many_lanes(
+  const EverCrypt_AutoConfig2_dispatch_s *d,
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t **inputs,
+  uint8_t **outs,
+  hash_many_job *jobs,
+  uint32_t g,
+  uint32_t len
+)
+{
+  bool sha256 = a == Spec_Hash_Definitions_SHA2_224 || a == Spec_Hash_Definitions_SHA2_256;
+  void (*kernel)(Spec_Hash_Definitions_hash_alg x0, uint8_t **x1, uint32_t x2, uint8_t **x3);
+  uint32_t lanes;
+  if (sha256 && d->sha2_256_lanes_8 != NULL && g >= (uint32_t)8U)
+  {
+    kernel = d->sha2_256_lanes_8;
+    lanes = (uint32_t)8U;
+  }
+  else if (sha256 && d->sha2_256_lanes_4 != NULL && g >= (uint32_t)4U)
+  {
+    kernel = d->sha2_256_lanes_4;
+    lanes = (uint32_t)4U;
+  }
+  else if (!sha256 && d->sha2_512_lanes_4 != NULL && g >= (uint32_t)4U)
+  {
+    kernel = d->sha2_512_lanes_4;
+    lanes = (uint32_t)4U;
+  }
+  else
+  {
+    return (uint32_t)0U;
+  }
+  uint8_t *in[8U] = { 0U };
+  uint8_t *out[8U] = { 0U };
+  for (uint32_t k = (uint32_t)0U; k < lanes; k++)
+  {
+    in[k] = inputs[jobs[k].i];
+    out[k] = outs[jobs[k].i];
+  }
+  kernel(a, out, len, in);
+  return lanes;
+}
+
+void
+EverCrypt_Hash_hash_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t **inputs,
+  uint32_t *lens,
+  uint8_t **outs,
+  uint32_t n
+)
+{
+  const EverCrypt_AutoConfig2_dispatch_s *d = EverCrypt_AutoConfig2_get_dispatch();
+  bool sha256 = a == Spec_Hash_Definitions_SHA2_224 || a == Spec_Hash_Definitions_SHA2_256;
+  bool sha512 = a == Spec_Hash_Definitions_SHA2_384 || a == Spec_Hash_Definitions_SHA2_512;
+  bool lanes =
+    (sha256 && (d->sha2_256_lanes_8 != NULL || d->sha2_256_lanes_4 != NULL))
+    || (sha512 && d->sha2_512_lanes_4 != NULL);
+  if (n < (uint32_t)4U || !lanes)
+  {
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      EverCrypt_Hash_hash(a, outs[i], inputs[i], lens[i]);
+    }
+    return;
+  }
+  KRML_CHECK_SIZE(sizeof (hash_many_job), n);
+  hash_many_job *jobs = (hash_many_job *)KRML_HOST_MALLOC(sizeof (hash_many_job) * n);
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    jobs[i] = ((hash_many_job){ .len = lens[i], .i = i });
+  }
+  qsort(jobs, n, sizeof (hash_many_job), hash_many_cmp);
+  uint32_t i = (uint32_t)0U;
+  while (i < n)
+  {
+    uint32_t len = jobs[i].len;
+    uint32_t g = (uint32_t)1U;
+    while (i + g < n && jobs[i + g].len == len)
+    {
+      g++;
+    }
+    uint32_t done = (uint32_t)0U;
+    while (done < g)
+    {
+      uint32_t k = hash_many_lanes(d, a, inputs, outs, jobs + i + done, g - done, len);
+      if (k == (uint32_t)0U)
+      {
+        uint32_t x = jobs[i + done].i;
+        EverCrypt_Hash_hash(a, outs[x], inputs[x], len);
+        k = (uint32_t)1U;
+      }
+      done = done + k;
+    }
+    i = i + g;
+  }
+  KRML_HOST_FREE(jobs);
+}
+
 uint32_t EverCrypt_Hash_Incremental_hash_len(Spec_Hash_Definitions_hash_alg a)
 {
   switch (a)
@@ -2356,12 +2868,12 @@ EverCrypt_Hash_Incremental_finish_blake2s(
       % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_Blake2S));
   }
   uint8_t *buf_1 = buf_;
-  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
   EverCrypt_Hash_state_s s;
   #if HACL_CAN_COMPILE_VEC128
   KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 buf0[4U] KRML_POST_ALIGN(16) = { 0U };
   uint32_t buf[16U] = { 0U };
-  if (vec128)
+  /* The copy below needs the representation chosen when the state was created. */
+  if (block_state->tag == Blake2S_128_s)
   {
     s = ((EverCrypt_Hash_state_s){ .tag = Blake2S_128_s, { .case_Blake2S_128_s = buf0 } });
   }
@@ -2427,12 +2939,12 @@ EverCrypt_Hash_Incremental_finish_blake2b(
       % (uint64_t)EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_Blake2B));
   }
   uint8_t *buf_1 = buf_;
-  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
   EverCrypt_Hash_state_s s;
   #if HACL_CAN_COMPILE_VEC256
   KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 buf0[4U] KRML_POST_ALIGN(32) = { 0U };
   uint64_t buf[16U] = { 0U };
-  if (vec256)
+  /* The copy below needs the representation chosen when the state was created. */
+  if (block_state->tag == Blake2B_256_s)
   {
     s = ((EverCrypt_Hash_state_s){ .tag = Blake2B_256_s, { .case_Blake2B_256_s = buf0 } });
   }
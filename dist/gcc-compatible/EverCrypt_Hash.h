@@ -137,6 +137,10 @@ void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s);
 
 void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n);
 
+void EverCrypt_Hash_update_multi_sha1(uint32_t *s, uint8_t *blocks, uint32_t n);
+
+void EverCrypt_Hash_update_multi_512(uint64_t *s, uint8_t *blocks, uint32_t n);
+
 void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t *block);
 
 KRML_DEPRECATED("Use update2 instead")
@@ -163,6 +167,22 @@ EverCrypt_Hash_update_last_256(
   uint32_t input_len1
 );
 
+void
+EverCrypt_Hash_update_last_sha1(
+  uint32_t *s,
+  uint64_t prev_len,
+  uint8_t *input,
+  uint32_t input_len
+);
+
+void
+EverCrypt_Hash_update_last_512(
+  uint64_t *s,
+  FStar_UInt128_uint128 prev_len,
+  uint8_t *input,
+  uint32_t input_len
+);
+
 void
 EverCrypt_Hash_update_last2(
   EverCrypt_Hash_state_s *s,
@@ -185,6 +205,12 @@ void EverCrypt_Hash_hash_256(uint8_t *input, uint32_t input_len, uint8_t *dst);
 
 void EverCrypt_Hash_hash_224(uint8_t *input, uint32_t input_len, uint8_t *dst);
 
+void EverCrypt_Hash_hash_sha1(uint8_t *input, uint32_t input_len, uint8_t *dst);
+
+void EverCrypt_Hash_hash_384(uint8_t *input, uint32_t input_len, uint8_t *dst);
+
+void EverCrypt_Hash_hash_512(uint8_t *input, uint32_t input_len, uint8_t *dst);
+
 void
 EverCrypt_Hash_hash(
   Spec_Hash_Definitions_hash_alg a,
@@ -193,6 +219,25 @@ EverCrypt_Hash_hash(
   uint32_t len
 );
 
+/**
+Hash n independent messages: outs[i] receives the digest of the lens[i] bytes at
+inputs[i].
+
+Messages of equal length are grouped and hashed together by the SHA2 multi-buffer
+kernels (8 lanes for SHA2-224/256 and 4 for SHA2-384/512 with AVX2, 4 lanes for
+SHA2-224/256 with AVX), in any input order. Leftover messages, other algorithms, and
+SHA2-224/256 on CPUs with SHA extensions (whose single-buffer code is faster than
+the vectorized kernels) use `EverCrypt_Hash_hash`.
+*/
+void
+EverCrypt_Hash_hash_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t **inputs,
+  uint32_t *lens,
+  uint8_t **outs,
+  uint32_t n
+);
+
 uint32_t EverCrypt_Hash_Incremental_hash_len(Spec_Hash_Definitions_hash_alg a);
 
 uint32_t EverCrypt_Hash_Incremental_block_len(Spec_Hash_Definitions_hash_alg a);
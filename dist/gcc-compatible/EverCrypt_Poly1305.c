@@ -22,11 +22,13 @@
  */
 
 
-#include "EverCrypt_Poly1305.h"
+#include "internal/EverCrypt_Poly1305.h"
 
 #include "internal/Vale.h"
+#include "internal/EverCrypt_AutoConfig2.h"
 
-static void poly1305_vale(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key)
+#if HACL_CAN_COMPILE_VALE
+void EverCrypt_Poly1305_poly1305_vale(uint8_t *dst, uint32_t len, uint8_t *src, uint8_t *key)
 {
   uint8_t ctx[192U] = { 0U };
   memcpy(ctx + (uint32_t)24U, key, (uint32_t)32U * sizeof (uint8_t));
@@ -48,29 +50,10 @@ static void poly1305_vale(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key
   }
   memcpy(dst, ctx, (uint32_t)16U * sizeof (uint8_t));
 }
+#endif
 
 void EverCrypt_Poly1305_poly1305(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key)
 {
-  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
-  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
-  #if HACL_CAN_COMPILE_VEC256
-  if (vec256)
-  {
-    Hacl_Poly1305_256_poly1305_mac(dst, len, src, key);
-    return;
-  }
-  #endif
-  #if HACL_CAN_COMPILE_VEC128
-  if (vec128)
-  {
-    Hacl_Poly1305_128_poly1305_mac(dst, len, src, key);
-    return;
-  }
-  #endif
-  #if HACL_CAN_COMPILE_VALE
-  poly1305_vale(dst, src, len, key);
-  #else
-  Hacl_Poly1305_32_poly1305_mac(dst, len, src, key);
-  #endif
+  EverCrypt_AutoConfig2_get_dispatch()->poly1305_mac(dst, len, src, key);
 }
 
@@ -0,0 +1,742 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Hacl_AES_GCM_CT64.h"
+
+/* Portable, constant-time AES-GCM.
+
+   AES is bitsliced over 64-bit words, four blocks at a time: q[b] holds bit b of each of
+   the 64 bytes, the byte of index i (= 4 * column + row) of block j being at bit 4 * i + j.
+   With this layout, ShiftRows rotates each row by a multiple of 16 bits, MixColumns rotates
+   nibbles within 16-bit lanes, and the round keys are expanded once into the same form.
+
+   GHASH multiplies in GF(2^128) with integer multiplications on operands whose set bits are
+   spread four positions apart, so that carries never reach a meaningful bit; no table
+   indexed by secret data is used anywhere. */
+
+static void sub_bytes(uint64_t *q)
+{
+  uint64_t x0 = q[7U];
+  uint64_t x1 = q[6U];
+  uint64_t x2 = q[5U];
+  uint64_t x3 = q[4U];
+  uint64_t x4 = q[3U];
+  uint64_t x5 = q[2U];
+  uint64_t x6 = q[1U];
+  uint64_t x7 = q[0U];
+  uint64_t y14 = x3 ^ x5;
+  uint64_t y13 = x0 ^ x6;
+  uint64_t y9 = x0 ^ x3;
+  uint64_t y8 = x0 ^ x5;
+  uint64_t t0 = x1 ^ x2;
+  uint64_t y1 = t0 ^ x7;
+  uint64_t y4 = y1 ^ x3;
+  uint64_t y12 = y13 ^ y14;
+  uint64_t y2 = y1 ^ x0;
+  uint64_t y5 = y1 ^ x6;
+  uint64_t y3 = y5 ^ y8;
+  uint64_t t1 = x4 ^ y12;
+  uint64_t y15 = t1 ^ x5;
+  uint64_t y20 = t1 ^ x1;
+  uint64_t y6 = y15 ^ x7;
+  uint64_t y10 = y15 ^ t0;
+  uint64_t y11 = y20 ^ y9;
+  uint64_t y7 = x7 ^ y11;
+  uint64_t y17 = y10 ^ y11;
+  uint64_t y19 = y10 ^ y8;
+  uint64_t y16 = t0 ^ y11;
+  uint64_t y21 = y13 ^ y16;
+  uint64_t y18 = x0 ^ y16;
+  uint64_t t2 = y12 & y15;
+  uint64_t t3 = y3 & y6;
+  uint64_t t4 = t3 ^ t2;
+  uint64_t t5 = y4 & x7;
+  uint64_t t6 = t5 ^ t2;
+  uint64_t t7 = y13 & y16;
+  uint64_t t8 = y5 & y1;
+  uint64_t t9 = t8 ^ t7;
+  uint64_t t10 = y2 & y7;
+  uint64_t t11 = t10 ^ t7;
+  uint64_t t12 = y9 & y11;
+  uint64_t t13 = y14 & y17;
+  uint64_t t14 = t13 ^ t12;
+  uint64_t t15 = y8 & y10;
+  uint64_t t16 = t15 ^ t12;
+  uint64_t t17 = t4 ^ t14;
+  uint64_t t18 = t6 ^ t16;
+  uint64_t t19 = t9 ^ t14;
+  uint64_t t20 = t11 ^ t16;
+  uint64_t t21 = t17 ^ y20;
+  uint64_t t22 = t18 ^ y19;
+  uint64_t t23 = t19 ^ y21;
+  uint64_t t24 = t20 ^ y18;
+  uint64_t t25 = t21 ^ t22;
+  uint64_t t26 = t21 & t23;
+  uint64_t t27 = t24 ^ t26;
+  uint64_t t28 = t25 & t27;
+  uint64_t t29 = t28 ^ t22;
+  uint64_t t30 = t23 ^ t24;
+  uint64_t t31 = t22 ^ t26;
+  uint64_t t32 = t31 & t30;
+  uint64_t t33 = t32 ^ t24;
+  uint64_t t34 = t23 ^ t33;
+  uint64_t t35 = t27 ^ t33;
+  uint64_t t36 = t24 & t35;
+  uint64_t t37 = t36 ^ t34;
+  uint64_t t38 = t27 ^ t36;
+  uint64_t t39 = t29 & t38;
+  uint64_t t40 = t25 ^ t39;
+  uint64_t t41 = t40 ^ t37;
+  uint64_t t42 = t29 ^ t33;
+  uint64_t t43 = t29 ^ t40;
+  uint64_t t44 = t33 ^ t37;
+  uint64_t t45 = t42 ^ t41;
+  uint64_t z0 = t44 & y15;
+  uint64_t z1 = t37 & y6;
+  uint64_t z2 = t33 & x7;
+  uint64_t z3 = t43 & y16;
+  uint64_t z4 = t40 & y1;
+  uint64_t z5 = t29 & y7;
+  uint64_t z6 = t42 & y11;
+  uint64_t z7 = t45 & y17;
+  uint64_t z8 = t41 & y10;
+  uint64_t z9 = t44 & y12;
+  uint64_t z10 = t37 & y3;
+  uint64_t z11 = t33 & y4;
+  uint64_t z12 = t43 & y13;
+  uint64_t z13 = t40 & y5;
+  uint64_t z14 = t29 & y2;
+  uint64_t z15 = t42 & y9;
+  uint64_t z16 = t45 & y14;
+  uint64_t z17 = t41 & y8;
+  uint64_t t46 = z15 ^ z16;
+  uint64_t t47 = z10 ^ z11;
+  uint64_t t48 = z5 ^ z13;
+  uint64_t t49 = z9 ^ z10;
+  uint64_t t50 = z2 ^ z12;
+  uint64_t t51 = z2 ^ z5;
+  uint64_t t52 = z7 ^ z8;
+  uint64_t t53 = z0 ^ z3;
+  uint64_t t54 = z6 ^ z7;
+  uint64_t t55 = z16 ^ z17;
+  uint64_t t56 = z12 ^ t48;
+  uint64_t t57 = t50 ^ t53;
+  uint64_t t58 = z4 ^ t46;
+  uint64_t t59 = z3 ^ t54;
+  uint64_t t60 = t46 ^ t57;
+  uint64_t t61 = z14 ^ t57;
+  uint64_t t62 = t52 ^ t58;
+  uint64_t t63 = t49 ^ t58;
+  uint64_t t64 = z4 ^ t59;
+  uint64_t t65 = t61 ^ t62;
+  uint64_t t66 = z1 ^ t63;
+  uint64_t s0 = t59 ^ t63;
+  uint64_t s6 = t56 ^ ~t62;
+  uint64_t s7 = t48 ^ ~t60;
+  uint64_t t67 = t64 ^ t65;
+  uint64_t s3 = t53 ^ t66;
+  uint64_t s4 = t51 ^ t66;
+  uint64_t s5 = t47 ^ t65;
+  uint64_t s1 = t64 ^ ~s3;
+  uint64_t s2 = t55 ^ ~t67;
+  q[7U] = s0;
+  q[6U] = s1;
+  q[5U] = s2;
+  q[4U] = s3;
+  q[3U] = s4;
+  q[2U] = s5;
+  q[1U] = s6;
+  q[0U] = s7;
+}
+
+static void shift_rows(uint64_t *q)
+{
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    uint64_t x = q[i];
+    uint64_t r1 = x & (uint64_t)0x00F000F000F000F0U;
+    uint64_t r2 = x & (uint64_t)0x0F000F000F000F00U;
+    uint64_t r3 = x & (uint64_t)0xF000F000F000F000U;
+    q[i] =
+      (x & (uint64_t)0x000F000F000F000FU)
+      | (r1 >> (uint32_t)16U | r1 << (uint32_t)48U)
+      | (r2 >> (uint32_t)32U | r2 << (uint32_t)32U)
+      | (r3 >> (uint32_t)48U | r3 << (uint32_t)16U););
+}
+
+/* Rotate the four nibbles of each 16-bit lane, so that each row sees the next one. */
+static inline uint64_t rotate_row1(uint64_t x)
+{
+  return
+    (x >> (uint32_t)4U & (uint64_t)0x0FFF0FFF0FFF0FFFU)
+    | (x & (uint64_t)0x000F000F000F000FU) << (uint32_t)12U;
+}
+
+static inline uint64_t rotate_row2(uint64_t x)
+{
+  return
+    (x >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU)
+    | (x & (uint64_t)0x00FF00FF00FF00FFU) << (uint32_t)8U;
+}
+
+/* out = 2 * a0 + 3 * a1 + a2 + a3 = 2 * (a0 + a1) + a1 + (a2 + a3), per column */
+static void mix_columns(uint64_t *q)
+{
+  uint64_t t[8U] = { 0U };
+  uint64_t u[8U] = { 0U };
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    uint64_t a1 = rotate_row1(q[i]);
+    t[i] = q[i] ^ a1;
+    u[i] = a1 ^ rotate_row2(t[i]););
+  q[0U] = t[7U] ^ u[0U];
+  q[1U] = t[0U] ^ t[7U] ^ u[1U];
+  q[2U] = t[1U] ^ u[2U];
+  q[3U] = t[2U] ^ t[7U] ^ u[3U];
+  q[4U] = t[3U] ^ t[7U] ^ u[4U];
+  q[5U] = t[4U] ^ u[5U];
+  q[6U] = t[5U] ^ u[6U];
+  q[7U] = t[6U] ^ u[7U];
+}
+
+static inline void add_round_key(uint64_t *q, uint64_t *rk)
+{
+  KRML_MAYBE_FOR8(i, (uint32_t)0U, (uint32_t)8U, (uint32_t)1U, q[i] = q[i] ^ rk[i];);
+}
+
+/* Exchange the bits selected by `m` in b with the bits selected by m << s in a. */
+static inline void swap_move(uint64_t *a, uint64_t *b, uint64_t m, uint32_t s)
+{
+  uint64_t t = (a[0U] >> s ^ b[0U]) & m;
+  b[0U] = b[0U] ^ t;
+  a[0U] = a[0U] ^ t << s;
+}
+
+/* Transpose the eight 8x8 bit matrices formed by the bytes of same index in q[0..7]; this
+   is an involution. */
+static void ortho(uint64_t *q)
+{
+  swap_move(q, q + (uint32_t)1U, (uint64_t)0x5555555555555555U, (uint32_t)1U);
+  swap_move(q + (uint32_t)2U, q + (uint32_t)3U, (uint64_t)0x5555555555555555U, (uint32_t)1U);
+  swap_move(q + (uint32_t)4U, q + (uint32_t)5U, (uint64_t)0x5555555555555555U, (uint32_t)1U);
+  swap_move(q + (uint32_t)6U, q + (uint32_t)7U, (uint64_t)0x5555555555555555U, (uint32_t)1U);
+  swap_move(q, q + (uint32_t)2U, (uint64_t)0x3333333333333333U, (uint32_t)2U);
+  swap_move(q + (uint32_t)1U, q + (uint32_t)3U, (uint64_t)0x3333333333333333U, (uint32_t)2U);
+  swap_move(q + (uint32_t)4U, q + (uint32_t)6U, (uint64_t)0x3333333333333333U, (uint32_t)2U);
+  swap_move(q + (uint32_t)5U, q + (uint32_t)7U, (uint64_t)0x3333333333333333U, (uint32_t)2U);
+  swap_move(q, q + (uint32_t)4U, (uint64_t)0x0F0F0F0F0F0F0F0FU, (uint32_t)4U);
+  swap_move(q + (uint32_t)1U, q + (uint32_t)5U, (uint64_t)0x0F0F0F0F0F0F0F0FU, (uint32_t)4U);
+  swap_move(q + (uint32_t)2U, q + (uint32_t)6U, (uint64_t)0x0F0F0F0F0F0F0F0FU, (uint32_t)4U);
+  swap_move(q + (uint32_t)3U, q + (uint32_t)7U, (uint64_t)0x0F0F0F0F0F0F0F0FU, (uint32_t)4U);
+}
+
+/* Reorder the bytes b0 .. b7 of x into b0 b2 b4 b6 b1 b3 b5 b7, or back with zip_bytes. */
+static inline uint64_t unzip_bytes(uint64_t x)
+{
+  uint64_t t0 = (x >> (uint32_t)8U ^ x) & (uint64_t)0x0000FF000000FF00U;
+  uint64_t x1 = x ^ t0 ^ t0 << (uint32_t)8U;
+  uint64_t t1 = (x1 >> (uint32_t)16U ^ x1) & (uint64_t)0x00000000FFFF0000U;
+  return x1 ^ t1 ^ t1 << (uint32_t)16U;
+}
+
+static inline uint64_t zip_bytes(uint64_t x)
+{
+  uint64_t t1 = (x >> (uint32_t)16U ^ x) & (uint64_t)0x00000000FFFF0000U;
+  uint64_t x1 = x ^ t1 ^ t1 << (uint32_t)16U;
+  uint64_t t0 = (x1 >> (uint32_t)8U ^ x1) & (uint64_t)0x0000FF000000FF00U;
+  return x1 ^ t0 ^ t0 << (uint32_t)8U;
+}
+
+/* Load four 16-byte blocks into the bitsliced representation: word j (resp. j + 4) gets the
+   even (resp. odd) bytes of block j, so that the transposition puts byte i of block j at bit
+   4 * i + j. */
+static void load_blocks(uint64_t *q, uint8_t *b)
+{
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    uint64_t lo = unzip_bytes(load64_le(b + i * (uint32_t)16U));
+    uint64_t hi = unzip_bytes(load64_le(b + i * (uint32_t)16U + (uint32_t)8U));
+    q[i] = (lo & (uint64_t)0xFFFFFFFFU) | hi << (uint32_t)32U;
+    q[i + (uint32_t)4U] = lo >> (uint32_t)32U | (hi & (uint64_t)0xFFFFFFFF00000000U););
+  ortho(q);
+}
+
+static void store_blocks(uint8_t *b, uint64_t *q)
+{
+  ortho(q);
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    uint64_t even = q[i];
+    uint64_t odd = q[i + (uint32_t)4U];
+    uint64_t lo = (even & (uint64_t)0xFFFFFFFFU) | odd << (uint32_t)32U;
+    uint64_t hi = even >> (uint32_t)32U | (odd & (uint64_t)0xFFFFFFFF00000000U);
+    store64_le(b + i * (uint32_t)16U, zip_bytes(lo));
+    store64_le(b + i * (uint32_t)16U + (uint32_t)8U, zip_bytes(hi)););
+}
+
+static void encrypt_blocks4(uint64_t *q, uint64_t *rk, uint32_t nr)
+{
+  add_round_key(q, rk);
+  for (uint32_t i = (uint32_t)1U; i < nr; i++)
+  {
+    sub_bytes(q);
+    shift_rows(q);
+    mix_columns(q);
+    add_round_key(q, rk + i * (uint32_t)8U);
+  }
+  sub_bytes(q);
+  shift_rows(q);
+  add_round_key(q, rk + nr * (uint32_t)8U);
+}
+
+/* SubWord on a 32-bit word, through the bitsliced S-box on a single lane. */
+static uint32_t sub_word(uint32_t w)
+{
+  uint64_t q[8U] = { 0U };
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    uint32_t x = w >> i & (uint32_t)0x01010101U;
+    q[i] =
+      (uint64_t)((x & (uint32_t)1U) | (x >> (uint32_t)7U & (uint32_t)2U)
+      | (x >> (uint32_t)14U & (uint32_t)4U)
+      | (x >> (uint32_t)21U & (uint32_t)8U)););
+  sub_bytes(q);
+  uint32_t r = (uint32_t)0U;
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    uint32_t x = (uint32_t)q[i];
+    r =
+      r
+      |
+        ((x & (uint32_t)1U) | (x & (uint32_t)2U) << (uint32_t)7U
+        | (x & (uint32_t)4U) << (uint32_t)14U
+        | (x & (uint32_t)8U) << (uint32_t)21U)
+        << i;);
+  return r;
+}
+
+static const
+uint32_t
+rcon[10U] =
+  {
+    (uint32_t)0x01U, (uint32_t)0x02U, (uint32_t)0x04U, (uint32_t)0x08U, (uint32_t)0x10U,
+    (uint32_t)0x20U, (uint32_t)0x40U, (uint32_t)0x80U, (uint32_t)0x1bU, (uint32_t)0x36U
+  };
+
+/* Expand a key of nk 32-bit words into nr + 1 bitsliced round keys of 8 words each. Words
+   are handled in little-endian order, so that RotWord is a rotation to the right. */
+static void key_expansion(uint64_t *rk, uint8_t *key, uint32_t nk, uint32_t nr)
+{
+  uint32_t w[60U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < nk; i++)
+  {
+    w[i] = load32_le(key + i * (uint32_t)4U);
+  }
+  for (uint32_t i = nk; i < (nr + (uint32_t)1U) * (uint32_t)4U; i++)
+  {
+    uint32_t t = w[i - (uint32_t)1U];
+    if (i % nk == (uint32_t)0U)
+    {
+      t = sub_word(t >> (uint32_t)8U | t << (uint32_t)24U) ^ rcon[i / nk - (uint32_t)1U];
+    }
+    else if (nk > (uint32_t)6U && i % nk == (uint32_t)4U)
+    {
+      t = sub_word(t);
+    }
+    w[i] = w[i - nk] ^ t;
+  }
+  for (uint32_t r = (uint32_t)0U; r <= nr; r++)
+  {
+    KRML_MAYBE_FOR8(b,
+      (uint32_t)0U,
+      (uint32_t)8U,
+      (uint32_t)1U,
+      uint64_t x = (uint64_t)0U;
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        uint32_t wi = w[r * (uint32_t)4U + i / (uint32_t)4U];
+        uint64_t bit = (uint64_t)(wi >> (i % (uint32_t)4U * (uint32_t)8U + b) & (uint32_t)1U);
+        x = x | ((uint64_t)0U - bit & (uint64_t)0xFU) << i * (uint32_t)4U;
+      }
+      rk[r * (uint32_t)8U + b] = x;);
+  }
+  Lib_Memzero0_memzero(w, (uint32_t)60U * sizeof (w[0U]));
+}
+
+/* Encrypt or decrypt len bytes in CTR mode, the counter of the first block being ctr in the
+   last four bytes of j0, incremented modulo 2^32 as GCM requires. */
+static void
+ctr32(
+  uint64_t *rk,
+  uint32_t nr,
+  uint8_t *j0,
+  uint32_t ctr,
+  uint8_t *out,
+  uint8_t *text,
+  uint32_t len
+)
+{
+  uint8_t ctrs[64U] = { 0U };
+  uint8_t ks[64U] = { 0U };
+  uint64_t q[8U] = { 0U };
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    memcpy(ctrs + i * (uint32_t)16U, j0, (uint32_t)12U * sizeof (uint8_t)););
+  /* Counting blocks rather than bytes keeps the loop from wrapping for len close to 2^32. */
+  uint32_t n_blocks = len / (uint32_t)64U + (uint32_t)(len % (uint32_t)64U != (uint32_t)0U);
+  for (uint32_t b = (uint32_t)0U; b < n_blocks; b++)
+  {
+    uint32_t i = b * (uint32_t)64U;
+    KRML_MAYBE_FOR4(j,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      store32_be(ctrs + j * (uint32_t)16U + (uint32_t)12U, ctr + j););
+    ctr = ctr + (uint32_t)4U;
+    load_blocks(q, ctrs);
+    encrypt_blocks4(q, rk, nr);
+    store_blocks(ks, q);
+    uint32_t n = len - i;
+    if (n > (uint32_t)64U)
+    {
+      n = (uint32_t)64U;
+    }
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      out[i + j] = text[i + j] ^ ks[j];
+    }
+  }
+  Lib_Memzero0_memzero(ks, (uint32_t)64U * sizeof (ks[0U]));
+  Lib_Memzero0_memzero(q, (uint32_t)8U * sizeof (q[0U]));
+}
+
+/* Low 64 bits of the carryless product of x and y. */
+static inline uint64_t bmul64(uint64_t x, uint64_t y)
+{
+  uint64_t x0 = x & (uint64_t)0x1111111111111111U;
+  uint64_t x1 = x & (uint64_t)0x2222222222222222U;
+  uint64_t x2 = x & (uint64_t)0x4444444444444444U;
+  uint64_t x3 = x & (uint64_t)0x8888888888888888U;
+  uint64_t y0 = y & (uint64_t)0x1111111111111111U;
+  uint64_t y1 = y & (uint64_t)0x2222222222222222U;
+  uint64_t y2 = y & (uint64_t)0x4444444444444444U;
+  uint64_t y3 = y & (uint64_t)0x8888888888888888U;
+  uint64_t z0 = x0 * y0 ^ x1 * y3 ^ x2 * y2 ^ x3 * y1;
+  uint64_t z1 = x0 * y1 ^ x1 * y0 ^ x2 * y3 ^ x3 * y2;
+  uint64_t z2 = x0 * y2 ^ x1 * y1 ^ x2 * y0 ^ x3 * y3;
+  uint64_t z3 = x0 * y3 ^ x1 * y2 ^ x2 * y1 ^ x3 * y0;
+  return
+    (z0 & (uint64_t)0x1111111111111111U)
+    | (z1 & (uint64_t)0x2222222222222222U)
+    | (z2 & (uint64_t)0x4444444444444444U)
+    | (z3 & (uint64_t)0x8888888888888888U);
+}
+
+static inline uint64_t rev64(uint64_t x)
+{
+  uint64_t
+  x1 =
+    (x & (uint64_t)0x5555555555555555U) << (uint32_t)1U
+    | (x >> (uint32_t)1U & (uint64_t)0x5555555555555555U);
+  uint64_t
+  x2 =
+    (x1 & (uint64_t)0x3333333333333333U) << (uint32_t)2U
+    | (x1 >> (uint32_t)2U & (uint64_t)0x3333333333333333U);
+  uint64_t
+  x3 =
+    (x2 & (uint64_t)0x0F0F0F0F0F0F0F0FU) << (uint32_t)4U
+    | (x2 >> (uint32_t)4U & (uint64_t)0x0F0F0F0F0F0F0F0FU);
+  uint64_t
+  x4 =
+    (x3 & (uint64_t)0x00FF00FF00FF00FFU) << (uint32_t)8U
+    | (x3 >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU);
+  uint64_t
+  x5 =
+    (x4 & (uint64_t)0x0000FFFF0000FFFFU) << (uint32_t)16U
+    | (x4 >> (uint32_t)16U & (uint64_t)0x0000FFFF0000FFFFU);
+  return x5 << (uint32_t)32U | x5 >> (uint32_t)32U;
+}
+
+/* y <- (y + x) * h in GF(2^128) with the GCM bit order, y and h being stored as their
+   big-endian high and low 64-bit halves. The 128x128 product uses Karatsuba over 64-bit
+   halves, computing high halves of 64x64 products as bit-reversed low halves. */
+static void gf128_mul_add(uint64_t *y, uint64_t *h, uint64_t x1, uint64_t x0)
+{
+  uint64_t h1 = h[0U];
+  uint64_t h0 = h[1U];
+  uint64_t h0r = rev64(h0);
+  uint64_t h1r = rev64(h1);
+  uint64_t h2 = h0 ^ h1;
+  uint64_t h2r = h0r ^ h1r;
+  uint64_t y1 = y[0U] ^ x1;
+  uint64_t y0 = y[1U] ^ x0;
+  uint64_t y0r = rev64(y0);
+  uint64_t y1r = rev64(y1);
+  uint64_t y2 = y0 ^ y1;
+  uint64_t y2r = y0r ^ y1r;
+  uint64_t z0 = bmul64(y0, h0);
+  uint64_t z1 = bmul64(y1, h1);
+  uint64_t z2 = bmul64(y2, h2);
+  uint64_t z0h = bmul64(y0r, h0r);
+  uint64_t z1h = bmul64(y1r, h1r);
+  uint64_t z2h = bmul64(y2r, h2r);
+  z2 = z2 ^ z0 ^ z1;
+  z2h = z2h ^ z0h ^ z1h;
+  z0h = rev64(z0h) >> (uint32_t)1U;
+  z1h = rev64(z1h) >> (uint32_t)1U;
+  z2h = rev64(z2h) >> (uint32_t)1U;
+  uint64_t v0 = z0;
+  uint64_t v1 = z0h ^ z2;
+  uint64_t v2 = z1 ^ z2h;
+  uint64_t v3 = z1h;
+  v3 = v3 << (uint32_t)1U | v2 >> (uint32_t)63U;
+  v2 = v2 << (uint32_t)1U | v1 >> (uint32_t)63U;
+  v1 = v1 << (uint32_t)1U | v0 >> (uint32_t)63U;
+  v0 = v0 << (uint32_t)1U;
+  v2 = v2 ^ v0 ^ v0 >> (uint32_t)1U ^ v0 >> (uint32_t)2U ^ v0 >> (uint32_t)7U;
+  v1 = v1 ^ v0 << (uint32_t)63U ^ v0 << (uint32_t)62U ^ v0 << (uint32_t)57U;
+  v3 = v3 ^ v1 ^ v1 >> (uint32_t)1U ^ v1 >> (uint32_t)2U ^ v1 >> (uint32_t)7U;
+  v2 = v2 ^ v1 << (uint32_t)63U ^ v1 << (uint32_t)62U ^ v1 << (uint32_t)57U;
+  y[0U] = v3;
+  y[1U] = v2;
+}
+
+/* Absorb len bytes of data into the GHASH accumulator y, zero-padding the last block. */
+static void ghash(uint64_t *y, uint64_t *h, uint8_t *data, uint32_t len)
+{
+  uint32_t n = len / (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint8_t *b = data + i * (uint32_t)16U;
+    gf128_mul_add(y, h, load64_be(b), load64_be(b + (uint32_t)8U));
+  }
+  uint32_t rem = len % (uint32_t)16U;
+  if (rem != (uint32_t)0U)
+  {
+    uint8_t last[16U] = { 0U };
+    memcpy(last, data + n * (uint32_t)16U, rem * sizeof (uint8_t));
+    gf128_mul_add(y, h, load64_be(last), load64_be(last + (uint32_t)8U));
+  }
+}
+
+static void init(uint64_t *ctx, uint8_t *key, uint32_t nk, uint32_t nr)
+{
+  uint64_t *rk = ctx;
+  uint64_t *h = ctx + (nr + (uint32_t)1U) * (uint32_t)8U;
+  key_expansion(rk, key, nk, nr);
+  uint8_t zero[16U] = { 0U };
+  uint8_t hb[16U] = { 0U };
+  ctr32(rk, nr, zero, (uint32_t)0U, hb, zero, (uint32_t)16U);
+  h[0U] = load64_be(hb);
+  h[1U] = load64_be(hb + (uint32_t)8U);
+  Lib_Memzero0_memzero(hb, (uint32_t)16U * sizeof (hb[0U]));
+}
+
+/* Compute the pre-counter block J0 from the IV. */
+static void compute_j0(uint64_t *h, uint8_t *j0, uint32_t iv_len, uint8_t *iv)
+{
+  if (iv_len == (uint32_t)12U)
+  {
+    memcpy(j0, iv, (uint32_t)12U * sizeof (uint8_t));
+    store32_be(j0 + (uint32_t)12U, (uint32_t)1U);
+  }
+  else
+  {
+    uint64_t y[2U] = { 0U };
+    ghash(y, h, iv, iv_len);
+    gf128_mul_add(y, h, (uint64_t)0U, (uint64_t)iv_len * (uint64_t)8U);
+    store64_be(j0, y[0U]);
+    store64_be(j0 + (uint32_t)8U, y[1U]);
+  }
+}
+
+/* tag = E(K, J0) + GHASH(H, aad || cipher || lengths), shared by encryption, after the
+   ciphertext is produced, and decryption, before it is checked. */
+static void
+compute_tag(
+  uint64_t *ctx,
+  uint32_t nr,
+  uint8_t *j0,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint64_t *rk = ctx;
+  uint64_t *h = ctx + (nr + (uint32_t)1U) * (uint32_t)8U;
+  uint64_t y[2U] = { 0U };
+  ghash(y, h, aad, aad_len);
+  ghash(y, h, cipher, len);
+  gf128_mul_add(y, h, (uint64_t)aad_len * (uint64_t)8U, (uint64_t)len * (uint64_t)8U);
+  uint8_t s[16U] = { 0U };
+  store64_be(s, y[0U]);
+  store64_be(s + (uint32_t)8U, y[1U]);
+  ctr32(rk, nr, j0, load32_be(j0 + (uint32_t)12U), tag, s, (uint32_t)16U);
+}
+
+static void
+encrypt(
+  uint64_t *ctx,
+  uint32_t nr,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint8_t *tag
+)
+{
+  uint64_t *rk = ctx;
+  uint64_t *h = ctx + (nr + (uint32_t)1U) * (uint32_t)8U;
+  uint8_t j0[16U] = { 0U };
+  compute_j0(h, j0, iv_len, iv);
+  ctr32(rk, nr, j0, load32_be(j0 + (uint32_t)12U) + (uint32_t)1U, out, text, len);
+  compute_tag(ctx, nr, j0, aad_len, aad, len, out, tag);
+}
+
+static bool
+decrypt(
+  uint64_t *ctx,
+  uint32_t nr,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint8_t *tag
+)
+{
+  uint64_t *rk = ctx;
+  uint64_t *h = ctx + (nr + (uint32_t)1U) * (uint32_t)8U;
+  uint8_t j0[16U] = { 0U };
+  compute_j0(h, j0, iv_len, iv);
+  uint8_t tag1[16U] = { 0U };
+  compute_tag(ctx, nr, j0, aad_len, aad, len, cipher, tag1);
+  uint8_t res = (uint8_t)0U;
+  KRML_MAYBE_FOR16(i,
+    (uint32_t)0U,
+    (uint32_t)16U,
+    (uint32_t)1U,
+    res = res | (tag1[i] ^ tag[i]););
+  if (res == (uint8_t)0U)
+  {
+    ctr32(rk, nr, j0, load32_be(j0 + (uint32_t)12U) + (uint32_t)1U, out, cipher, len);
+    return true;
+  }
+  return false;
+}
+
+void Hacl_AES_GCM_CT64_aes128_init(uint64_t *ctx, uint8_t *key)
+{
+  init(ctx, key, (uint32_t)4U, (uint32_t)10U);
+}
+
+void
+Hacl_AES_GCM_CT64_aes128_encrypt(
+  uint64_t *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint8_t *tag
+)
+{
+  encrypt(ctx, (uint32_t)10U, len, out, text, aad_len, aad, iv_len, iv, tag);
+}
+
+bool
+Hacl_AES_GCM_CT64_aes128_decrypt(
+  uint64_t *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint8_t *tag
+)
+{
+  return decrypt(ctx, (uint32_t)10U, len, out, cipher, aad_len, aad, iv_len, iv, tag);
+}
+
+void Hacl_AES_GCM_CT64_aes256_init(uint64_t *ctx, uint8_t *key)
+{
+  init(ctx, key, (uint32_t)8U, (uint32_t)14U);
+}
+
+void
+Hacl_AES_GCM_CT64_aes256_encrypt(
+  uint64_t *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint8_t *tag
+)
+{
+  encrypt(ctx, (uint32_t)14U, len, out, text, aad_len, aad, iv_len, iv, tag);
+}
+
+bool
+Hacl_AES_GCM_CT64_aes256_decrypt(
+  uint64_t *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint8_t *tag
+)
+{
+  return decrypt(ctx, (uint32_t)14U, len, out, cipher, aad_len, aad, iv_len, iv, tag);
+}
+
@@ -0,0 +1,120 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __Hacl_AES_GCM_CT64_H
+#define __Hacl_AES_GCM_CT64_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Lib_Memzero0.h"
+#include "evercrypt_targetconfig.h"
+/**
+Portable AES-GCM, for platforms without AES-NI and PCLMULQDQ.
+
+  AES is bitsliced over 64-bit words, four blocks at a time, and GHASH uses integer
+  multiplications instead of tables, so that neither depends on secret data for its
+  memory accesses or branches. Contexts hold the bitsliced round keys and the hash key:
+  they are `Hacl_AES_GCM_CT64_aes128_ctx_len` (resp. `aes256_ctx_len`) 64-bit words long.
+*/
+#define Hacl_AES_GCM_CT64_aes128_ctx_len ((uint32_t)90U)
+
+#define Hacl_AES_GCM_CT64_aes256_ctx_len ((uint32_t)122U)
+
+void Hacl_AES_GCM_CT64_aes128_init(uint64_t *ctx, uint8_t *key);
+
+/**
+Encrypt `len` bytes of `text` into `out` and write the 16-byte tag into `tag`. `iv_len`
+must be positive.
+*/
+void
+Hacl_AES_GCM_CT64_aes128_encrypt(
+  uint64_t *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint8_t *tag
+);
+
+/**
+Check the 16-byte `tag` in constant time and, only if it is valid, decrypt `len` bytes of
+`cipher` into `out`.
+*/
+bool
+Hacl_AES_GCM_CT64_aes128_decrypt(
+  uint64_t *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint8_t *tag
+);
+
+void Hacl_AES_GCM_CT64_aes256_init(uint64_t *ctx, uint8_t *key);
+
+void
+Hacl_AES_GCM_CT64_aes256_encrypt(
+  uint64_t *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint8_t *tag
+);
+
+bool
+Hacl_AES_GCM_CT64_aes256_decrypt(
+  uint64_t *ctx,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint32_t aad_len,
+  uint8_t *aad,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint8_t *tag
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AES_GCM_CT64_H_DEFINED
+#endif
@@ -1151,6 +1151,43 @@ Hacl_Chacha20Poly1305_256_aead_encrypt(
   poly1305_do_256(key, aadlen, aad, mlen, cipher, mac);
 }
 
+/**
+Encrypt and authenticate 8 independent messages, interleaving their ChaCha20
+key streams across the vector lanes.
+
+  The arguments are arrays of 8 elements; the i-th record is processed exactly as
+  `aead_encrypt(k[i], n[i], aadlen[i], aad[i], mlen[i], m[i], cipher[i], mac[i])`.
+*/
+void
+Hacl_Chacha20Poly1305_256_aead_encrypt_8(
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **mac
+)
+{
+  Hacl_Chacha20_Vec256_chacha20_encrypt_8(mlen, cipher, m, k, n, (uint32_t)1U);
+  uint8_t tmp[512U] = { 0U };
+  uint32_t tmp_len[8U] = { 0U };
+  uint8_t *tmp_b[8U] = { 0U };
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    tmp_len[i] = (uint32_t)32U;
+    tmp_b[i] = tmp + i * (uint32_t)64U;);
+  Hacl_Chacha20_Vec256_chacha20_encrypt_8(tmp_len, tmp_b, tmp_b, k, n, (uint32_t)0U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint8_t *key = tmp_b[i];
+    poly1305_do_256(key, aadlen[i], aad[i], mlen[i], cipher[i], mac[i]);
+  }
+}
+
 uint32_t
 Hacl_Chacha20Poly1305_256_aead_decrypt(
   uint8_t *k,
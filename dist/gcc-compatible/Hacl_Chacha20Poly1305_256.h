@@ -51,6 +51,25 @@ Hacl_Chacha20Poly1305_256_aead_encrypt(
   uint8_t *mac
 );
 
+/**
+Encrypt and authenticate 8 independent messages, interleaving their ChaCha20
+key streams across the vector lanes.
+
+  The arguments are arrays of 8 elements; the i-th record is processed exactly as
+  `aead_encrypt(k[i], n[i], aadlen[i], aad[i], mlen[i], m[i], cipher[i], mac[i])`.
+*/
+void
+Hacl_Chacha20Poly1305_256_aead_encrypt_8(
+  uint8_t **k,
+  uint8_t **n,
+  uint32_t *aadlen,
+  uint8_t **aad,
+  uint32_t *mlen,
+  uint8_t **m,
+  uint8_t **cipher,
+  uint8_t **mac
+);
+
 uint32_t
 Hacl_Chacha20Poly1305_256_aead_decrypt(
   uint8_t *k,
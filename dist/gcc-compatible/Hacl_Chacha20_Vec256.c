@@ -1207,3 +1207,195 @@ Hacl_Chacha20_Vec256_chacha20_decrypt_256(
   }
 }
 
+
+static inline void transpose_8x8_32_256(Lib_IntVector_Intrinsics_vec256 *v)
+{
+  Lib_IntVector_Intrinsics_vec256 v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v[0U], v[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v[0U], v[1U]);
+  Lib_IntVector_Intrinsics_vec256 v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v[2U], v[3U]);
+  Lib_IntVector_Intrinsics_vec256
+  v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v[2U], v[3U]);
+  Lib_IntVector_Intrinsics_vec256 v4_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v[4U], v[5U]);
+  Lib_IntVector_Intrinsics_vec256
+  v5_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v[4U], v[5U]);
+  Lib_IntVector_Intrinsics_vec256 v6_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v[6U], v[7U]);
+  Lib_IntVector_Intrinsics_vec256
+  v7_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v[6U], v[7U]);
+  Lib_IntVector_Intrinsics_vec256 v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v2_);
+  Lib_IntVector_Intrinsics_vec256 v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v2_);
+  Lib_IntVector_Intrinsics_vec256 v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_, v3_);
+  Lib_IntVector_Intrinsics_vec256 v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_, v3_);
+  Lib_IntVector_Intrinsics_vec256 v4_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_, v6_);
+  Lib_IntVector_Intrinsics_vec256 v6_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_, v6_);
+  Lib_IntVector_Intrinsics_vec256 v5_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_, v7_);
+  Lib_IntVector_Intrinsics_vec256 v7_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_, v7_);
+  v[0U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v4_1);
+  v[4U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v4_1);
+  v[2U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v5_1);
+  v[6U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v5_1);
+  v[1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2_1, v6_1);
+  v[5U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2_1, v6_1);
+  v[3U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3_1, v7_1);
+  v[7U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3_1, v7_1);
+}
+
+/* Lane i of the state holds the ChaCha20 state of the i-th independent stream. */
+static inline void
+chacha20_init_8(Lib_IntVector_Intrinsics_vec256 *ctx, uint8_t **k, uint8_t **n, uint32_t ctr)
+{
+  uint32_t ctx1[128U] = { 0U };
+  KRML_MAYBE_FOR8(l,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    uint32_t *ctx_l = ctx1 + l * (uint32_t)16U;
+    KRML_MAYBE_FOR4(i,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      uint32_t *os = ctx_l;
+      uint32_t x = Hacl_Impl_Chacha20_Vec_chacha20_constants[i];
+      os[i] = x;);
+    KRML_MAYBE_FOR8(i,
+      (uint32_t)0U,
+      (uint32_t)8U,
+      (uint32_t)1U,
+      uint32_t *os = ctx_l + (uint32_t)4U;
+      uint8_t *bj = k[l] + i * (uint32_t)4U;
+      uint32_t u = load32_le(bj);
+      uint32_t r = u;
+      uint32_t x = r;
+      os[i] = x;);
+    ctx_l[12U] = ctr;
+    KRML_MAYBE_FOR3(i,
+      (uint32_t)0U,
+      (uint32_t)3U,
+      (uint32_t)1U,
+      uint32_t *os = ctx_l + (uint32_t)13U;
+      uint8_t *bj = n[l] + i * (uint32_t)4U;
+      uint32_t u = load32_le(bj);
+      uint32_t r = u;
+      uint32_t x = r;
+      os[i] = x;););
+  KRML_MAYBE_FOR16(i,
+    (uint32_t)0U,
+    (uint32_t)16U,
+    (uint32_t)1U,
+    Lib_IntVector_Intrinsics_vec256 *os = ctx;
+    Lib_IntVector_Intrinsics_vec256
+    x =
+      Lib_IntVector_Intrinsics_vec256_load32s(ctx1[i],
+        ctx1[(uint32_t)16U + i],
+        ctx1[(uint32_t)32U + i],
+        ctx1[(uint32_t)48U + i],
+        ctx1[(uint32_t)64U + i],
+        ctx1[(uint32_t)80U + i],
+        ctx1[(uint32_t)96U + i],
+        ctx1[(uint32_t)112U + i]);
+    os[i] = x;);
+}
+
+static inline void
+chacha20_core_8(
+  Lib_IntVector_Intrinsics_vec256 *k,
+  Lib_IntVector_Intrinsics_vec256 *ctx,
+  uint32_t ctr
+)
+{
+  memcpy(k, ctx, (uint32_t)16U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  Lib_IntVector_Intrinsics_vec256 cv = Lib_IntVector_Intrinsics_vec256_load32(ctr);
+  k[12U] = Lib_IntVector_Intrinsics_vec256_add32(k[12U], cv);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  double_round_256(k);
+  KRML_MAYBE_FOR16(i,
+    (uint32_t)0U,
+    (uint32_t)16U,
+    (uint32_t)1U,
+    Lib_IntVector_Intrinsics_vec256 *os = k;
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_add32(k[i], ctx[i]);
+    os[i] = x;);
+  k[12U] = Lib_IntVector_Intrinsics_vec256_add32(k[12U], cv);
+  transpose_8x8_32_256(k);
+  transpose_8x8_32_256(k + (uint32_t)8U);
+}
+
+/**
+Encrypt 8 independent messages with ChaCha20, one message per vector lane.
+
+  The i-th message `text[i]` of `len[i]` bytes is encrypted into `out[i]` under the
+  key `key[i]` (32 bytes) and nonce `n[i]` (12 bytes), starting at block counter `ctr`.
+  The messages may have different lengths; shorter messages simply stop
+  consuming key stream early.
+*/
+void
+Hacl_Chacha20_Vec256_chacha20_encrypt_8(
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **text,
+  uint8_t **key,
+  uint8_t **n,
+  uint32_t ctr
+)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ctx[16U] KRML_POST_ALIGN(32) = { 0U };
+  chacha20_init_8(ctx, key, n, ctr);
+  uint32_t max_len = (uint32_t)0U;
+  KRML_MAYBE_FOR8(l,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    if (len[l] > max_len)
+    {
+      max_len = len[l];
+    });
+  uint32_t nb = (max_len + (uint32_t)63U) / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 k[16U] KRML_POST_ALIGN(32) = { 0U };
+    chacha20_core_8(k, ctx, i);
+    uint32_t off = i * (uint32_t)64U;
+    for (uint32_t l = (uint32_t)0U; l < (uint32_t)8U; l++)
+    {
+      if (off < len[l])
+      {
+        uint32_t rem = len[l] - off;
+        uint8_t *o = out[l] + off;
+        uint8_t *t = text[l] + off;
+        if (rem >= (uint32_t)64U)
+        {
+          Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_load32_le(t);
+          Lib_IntVector_Intrinsics_vec256
+          x1 = Lib_IntVector_Intrinsics_vec256_load32_le(t + (uint32_t)32U);
+          Lib_IntVector_Intrinsics_vec256 y0 = Lib_IntVector_Intrinsics_vec256_xor(x0, k[l]);
+          Lib_IntVector_Intrinsics_vec256
+          y1 = Lib_IntVector_Intrinsics_vec256_xor(x1, k[(uint32_t)8U + l]);
+          Lib_IntVector_Intrinsics_vec256_store32_le(o, y0);
+          Lib_IntVector_Intrinsics_vec256_store32_le(o + (uint32_t)32U, y1);
+        }
+        else
+        {
+          uint8_t plain[64U] = { 0U };
+          memcpy(plain, t, rem * sizeof (uint8_t));
+          Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_load32_le(plain);
+          Lib_IntVector_Intrinsics_vec256
+          x1 = Lib_IntVector_Intrinsics_vec256_load32_le(plain + (uint32_t)32U);
+          Lib_IntVector_Intrinsics_vec256 y0 = Lib_IntVector_Intrinsics_vec256_xor(x0, k[l]);
+          Lib_IntVector_Intrinsics_vec256
+          y1 = Lib_IntVector_Intrinsics_vec256_xor(x1, k[(uint32_t)8U + l]);
+          Lib_IntVector_Intrinsics_vec256_store32_le(plain, y0);
+          Lib_IntVector_Intrinsics_vec256_store32_le(plain + (uint32_t)32U, y1);
+          memcpy(o, plain, rem * sizeof (uint8_t));
+        }
+      }
+    }
+  }
+}
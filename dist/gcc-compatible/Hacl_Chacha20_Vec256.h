@@ -57,6 +57,24 @@ Hacl_Chacha20_Vec256_chacha20_decrypt_256(
   uint32_t ctr
 );
 
+/**
+Encrypt 8 independent messages with ChaCha20, one message per vector lane.
+
+  The i-th message `text[i]` of `len[i]` bytes is encrypted into `out[i]` under the
+  key `key[i]` (32 bytes) and nonce `n[i]` (12 bytes), starting at block counter `ctr`.
+  The messages may have different lengths; shorter messages simply stop
+  consuming key stream early.
+*/
+void
+Hacl_Chacha20_Vec256_chacha20_encrypt_8(
+  uint32_t *len,
+  uint8_t **out,
+  uint8_t **text,
+  uint8_t **key,
+  uint8_t **n,
+  uint32_t ctr
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -27,6 +27,7 @@
 #include "internal/Hacl_Krmllib.h"
 #include "internal/Hacl_Hash_SHA2.h"
 #include "internal/Hacl_Curve25519_51.h"
+#include "internal/Hacl_Ed25519_PrecompTable.h"
 
 static inline void fsum(uint64_t *out, uint64_t *a, uint64_t *b)
 {
@@ -1373,34 +1374,64 @@ void Hacl_Impl_Ed25519_Ladder_point_mul(uint64_t *result, uint8_t *scalar, uint6
   }
 }
 
+static inline void
+precomp_get_consttime(const uint64_t *table, uint64_t bits_l, uint64_t *tmp)
+{
+  memcpy(tmp, (uint64_t *)table, (uint32_t)20U * sizeof (uint64_t));
+  KRML_MAYBE_FOR15(i0,
+    (uint32_t)0U,
+    (uint32_t)15U,
+    (uint32_t)1U,
+    uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i0 + (uint32_t)1U));
+    const uint64_t *res_j = table + (i0 + (uint32_t)1U) * (uint32_t)20U;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)20U; i++)
+    {
+      uint64_t *os = tmp;
+      uint64_t x = (c & res_j[i]) | (~c & tmp[i]);
+      os[i] = x;
+    });
+}
+
+/* Fixed-base scalar multiplication with the precomputed tables of
+   [i]G, [i * 2^64]G, [i * 2^128]G and [i * 2^192]G (0 <= i < 16): the scalar is
+   split into four 64-bit chunks that are processed simultaneously with 4-bit
+   windows, so only 64 point doublings are needed instead of 256. */
 static inline void point_mul_g(uint64_t *result, uint8_t *scalar)
 {
-  uint64_t g[20U] = { 0U };
-  uint64_t *gx = g;
-  uint64_t *gy = g + (uint32_t)5U;
-  uint64_t *gz = g + (uint32_t)10U;
-  uint64_t *gt = g + (uint32_t)15U;
-  gx[0U] = (uint64_t)0x00062d608f25d51aU;
-  gx[1U] = (uint64_t)0x000412a4b4f6592aU;
-  gx[2U] = (uint64_t)0x00075b7171a4b31dU;
-  gx[3U] = (uint64_t)0x0001ff60527118feU;
-  gx[4U] = (uint64_t)0x000216936d3cd6e5U;
-  gy[0U] = (uint64_t)0x0006666666666658U;
-  gy[1U] = (uint64_t)0x0004ccccccccccccU;
-  gy[2U] = (uint64_t)0x0001999999999999U;
-  gy[3U] = (uint64_t)0x0003333333333333U;
-  gy[4U] = (uint64_t)0x0006666666666666U;
-  gz[0U] = (uint64_t)1U;
-  gz[1U] = (uint64_t)0U;
-  gz[2U] = (uint64_t)0U;
-  gz[3U] = (uint64_t)0U;
-  gz[4U] = (uint64_t)0U;
-  gt[0U] = (uint64_t)0x00068ab3a5b7dda3U;
-  gt[1U] = (uint64_t)0x00000eea2a5eadbbU;
-  gt[2U] = (uint64_t)0x0002af8df483c27eU;
-  gt[3U] = (uint64_t)0x000332b375274732U;
-  gt[4U] = (uint64_t)0x00067875f0fd78b7U;
-  Hacl_Impl_Ed25519_Ladder_point_mul(result, scalar, g);
+  uint64_t bscalar[4U] = { 0U };
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    uint64_t *os = bscalar;
+    uint8_t *bj = scalar + i * (uint32_t)8U;
+    uint64_t u = load64_le(bj);
+    uint64_t r = u;
+    uint64_t x = r;
+    os[i] = x;);
+  uint64_t tmp[20U] = { 0U };
+  Hacl_Impl_Ed25519_Ladder_make_point_inf(result);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    KRML_MAYBE_FOR4(i0,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      Hacl_Impl_Ed25519_PointDouble_point_double(result, result););
+    uint32_t k = (uint32_t)60U - (uint32_t)4U * i;
+    uint64_t bits_l3 = bscalar[3U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_Ed25519_PrecompTable_precomp_g_pow2_192_table_w4, bits_l3, tmp);
+    Hacl_Impl_Ed25519_PointAdd_point_add(result, result, tmp);
+    uint64_t bits_l2 = bscalar[2U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_Ed25519_PrecompTable_precomp_g_pow2_128_table_w4, bits_l2, tmp);
+    Hacl_Impl_Ed25519_PointAdd_point_add(result, result, tmp);
+    uint64_t bits_l1 = bscalar[1U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_Ed25519_PrecompTable_precomp_g_pow2_64_table_w4, bits_l1, tmp);
+    Hacl_Impl_Ed25519_PointAdd_point_add(result, result, tmp);
+    uint64_t bits_l0 = bscalar[0U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w4, bits_l0, tmp);
+    Hacl_Impl_Ed25519_PointAdd_point_add(result, result, tmp);
+  }
 }
 
 static inline void
@@ -1747,6 +1778,307 @@ static inline void secret_expand(uint8_t *expanded, uint8_t *secret)
   h_low[31U] = (h_low31 & (uint8_t)127U) | (uint8_t)64U;
 }
 
+static inline uint32_t msm_window_bits(uint32_t len)
+{
+  uint32_t c = (uint32_t)0U;
+  uint32_t n = len;
+  while (n > (uint32_t)1U)
+  {
+    n = n >> (uint32_t)1U;
+    c++;
+  }
+  if (c < (uint32_t)5U)
+  {
+    return (uint32_t)2U;
+  }
+  if (c > (uint32_t)18U)
+  {
+    return (uint32_t)15U;
+  }
+  return c - (uint32_t)3U;
+}
+
+static inline uint32_t msm_scalar_digit(uint64_t *scalar, uint32_t pos, uint32_t c)
+{
+  uint32_t i = pos / (uint32_t)64U;
+  uint32_t j = pos % (uint32_t)64U;
+  uint64_t w = scalar[i] >> j;
+  if (i + (uint32_t)1U < (uint32_t)4U && j + c > (uint32_t)64U)
+  {
+    w = w | scalar[i + (uint32_t)1U] << ((uint32_t)64U - j);
+  }
+  return (uint32_t)(w & (((uint64_t)1U << c) - (uint64_t)1U));
+}
+
+/* Variable-time multi-scalar multiplication (Pippenger's bucket method):
+   result = sum_i [scalars_i] points_i, where each scalar is a 4-limb integer
+   below 2^253 and each point is in extended coordinates.
+   Only called on public data (signature verification). */
+static bool
+msm_vartime(uint64_t *result, uint32_t len, uint64_t *scalars, uint64_t *points)
+{
+  uint32_t c = msm_window_bits(len);
+  uint32_t nbuckets = ((uint32_t)1U << c) - (uint32_t)1U;
+  uint64_t *buckets = (uint64_t *)KRML_HOST_CALLOC(nbuckets * (uint32_t)20U, sizeof (uint64_t));
+  bool *used = (bool *)KRML_HOST_CALLOC(nbuckets, sizeof (bool));
+  if (buckets == NULL || used == NULL)
+  {
+    KRML_HOST_FREE(buckets);
+    KRML_HOST_FREE(used);
+    return false;
+  }
+  uint64_t running[20U] = { 0U };
+  uint64_t acc[20U] = { 0U };
+  uint32_t nwindows = ((uint32_t)253U + c - (uint32_t)1U) / c;
+  Hacl_Impl_Ed25519_Ladder_make_point_inf(result);
+  for (uint32_t w = nwindows; w > (uint32_t)0U; w--)
+  {
+    uint32_t pos = (w - (uint32_t)1U) * c;
+    if (w < nwindows)
+    {
+      for (uint32_t i = (uint32_t)0U; i < c; i++)
+      {
+        Hacl_Impl_Ed25519_PointDouble_point_double(result, result);
+      }
+    }
+    memset(used, 0U, nbuckets * sizeof (bool));
+    for (uint32_t i = (uint32_t)0U; i < len; i++)
+    {
+      uint32_t d = msm_scalar_digit(scalars + i * (uint32_t)4U, pos, c);
+      if (d != (uint32_t)0U)
+      {
+        uint64_t *b = buckets + (d - (uint32_t)1U) * (uint32_t)20U;
+        uint64_t *p = points + i * (uint32_t)20U;
+        if (used[d - (uint32_t)1U])
+        {
+          Hacl_Impl_Ed25519_PointAdd_point_add(b, b, p);
+        }
+        else
+        {
+          memcpy(b, p, (uint32_t)20U * sizeof (uint64_t));
+          used[d - (uint32_t)1U] = true;
+        }
+      }
+    }
+    bool running_set = false;
+    bool acc_set = false;
+    for (uint32_t j = nbuckets; j > (uint32_t)0U; j--)
+    {
+      if (used[j - (uint32_t)1U])
+      {
+        uint64_t *b = buckets + (j - (uint32_t)1U) * (uint32_t)20U;
+        if (running_set)
+        {
+          Hacl_Impl_Ed25519_PointAdd_point_add(running, running, b);
+        }
+        else
+        {
+          memcpy(running, b, (uint32_t)20U * sizeof (uint64_t));
+          running_set = true;
+        }
+      }
+      if (running_set)
+      {
+        if (acc_set)
+        {
+          Hacl_Impl_Ed25519_PointAdd_point_add(acc, acc, running);
+        }
+        else
+        {
+          memcpy(acc, running, (uint32_t)20U * sizeof (uint64_t));
+          acc_set = true;
+        }
+      }
+    }
+    if (acc_set)
+    {
+      Hacl_Impl_Ed25519_PointAdd_point_add(result, result, acc);
+    }
+  }
+  KRML_HOST_FREE(buckets);
+  KRML_HOST_FREE(used);
+  return true;
+}
+
+static inline void load_scalar_64(uint64_t *out, uint8_t *b)
+{
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    uint64_t *os = out;
+    uint8_t *bj = b + i * (uint32_t)8U;
+    uint64_t u = load64_le(bj);
+    uint64_t r = u;
+    uint64_t x = r;
+    os[i] = x;);
+}
+
+static inline void make_g(uint64_t *g)
+{
+  uint64_t *gx = g;
+  uint64_t *gy = g + (uint32_t)5U;
+  uint64_t *gz = g + (uint32_t)10U;
+  uint64_t *gt = g + (uint32_t)15U;
+  gx[0U] = (uint64_t)0x00062d608f25d51aU;
+  gx[1U] = (uint64_t)0x000412a4b4f6592aU;
+  gx[2U] = (uint64_t)0x00075b7171a4b31dU;
+  gx[3U] = (uint64_t)0x0001ff60527118feU;
+  gx[4U] = (uint64_t)0x000216936d3cd6e5U;
+  gy[0U] = (uint64_t)0x0006666666666658U;
+  gy[1U] = (uint64_t)0x0004ccccccccccccU;
+  gy[2U] = (uint64_t)0x0001999999999999U;
+  gy[3U] = (uint64_t)0x0003333333333333U;
+  gy[4U] = (uint64_t)0x0006666666666666U;
+  gz[0U] = (uint64_t)1U;
+  gz[1U] = (uint64_t)0U;
+  gz[2U] = (uint64_t)0U;
+  gz[3U] = (uint64_t)0U;
+  gz[4U] = (uint64_t)0U;
+  gt[0U] = (uint64_t)0x00068ab3a5b7dda3U;
+  gt[1U] = (uint64_t)0x00000eea2a5eadbbU;
+  gt[2U] = (uint64_t)0x0002af8df483c27eU;
+  gt[3U] = (uint64_t)0x000332b375274732U;
+  gt[4U] = (uint64_t)0x00067875f0fd78b7U;
+}
+
+/* Checks  [8]([sum z_i s_i]G + sum [z_i h_i](-A_i) + sum [z_i](-R_i)) = O
+   over the entries i with valid[i] set. The coefficients z_i are 128-bit values
+   derived deterministically (Fiat-Shamir) from a SHA-512 transcript of every
+   (signature, public key, h_i) in the batch, so they cannot be chosen before the
+   inputs are fixed. */
+static bool
+verify_batch_combined(
+  uint32_t len,
+  uint8_t **public_keys,
+  uint8_t **signatures,
+  bool *valid,
+  uint64_t *a_pts,
+  uint64_t *r_pts,
+  uint64_t *hq
+)
+{
+  uint8_t buf[128U] = { 0U };
+  uint64_t block_state[8U] = { 0U };
+  Hacl_Streaming_SHA2_state_sha2_384
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
+  Hacl_Streaming_SHA2_state_sha2_384 p = s;
+  Hacl_Hash_Core_SHA2_init_512(block_state);
+  Hacl_Streaming_SHA2_state_sha2_384 *st = &p;
+  uint32_t npoints = (uint32_t)1U;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    if (valid[i])
+    {
+      uint8_t hb[32U] = { 0U };
+      store_56(hb, hq + i * (uint32_t)5U);
+      Hacl_Streaming_SHA2_update_512(st, signatures[i], (uint32_t)64U);
+      Hacl_Streaming_SHA2_update_512(st, public_keys[i], (uint32_t)32U);
+      Hacl_Streaming_SHA2_update_512(st, hb, (uint32_t)32U);
+      npoints = npoints + (uint32_t)2U;
+    }
+  }
+  uint8_t seed[64U] = { 0U };
+  Hacl_Streaming_SHA2_finish_512(st, seed);
+  uint64_t
+  *points = (uint64_t *)KRML_HOST_CALLOC((size_t)npoints * (size_t)20U, sizeof (uint64_t));
+  uint64_t
+  *scalars = (uint64_t *)KRML_HOST_CALLOC((size_t)npoints * (size_t)4U, sizeof (uint64_t));
+  if (points == NULL || scalars == NULL)
+  {
+    KRML_HOST_FREE(points);
+    KRML_HOST_FREE(scalars);
+    return false;
+  }
+  uint64_t sacc[5U] = { 0U };
+  uint32_t k = (uint32_t)1U;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    if (valid[i])
+    {
+      uint8_t idx[4U] = { 0U };
+      uint8_t zh[64U] = { 0U };
+      uint8_t zb[32U] = { 0U };
+      uint8_t tb[32U] = { 0U };
+      uint64_t zq[5U] = { 0U };
+      uint64_t sq[5U] = { 0U };
+      uint64_t tq[5U] = { 0U };
+      store32_le(idx, i);
+      sha512_pre_msg(zh, seed, (uint32_t)4U, idx);
+      memcpy(zb, zh, (uint32_t)16U * sizeof (uint8_t));
+      load_32_bytes(zq, zb);
+      load_32_bytes(sq, signatures[i] + (uint32_t)32U);
+      mul_modq(sq, zq, sq);
+      add_modq(sacc, sacc, sq);
+      mul_modq(tq, zq, hq + i * (uint32_t)5U);
+      store_56(tb, tq);
+      load_scalar_64(scalars + k * (uint32_t)4U, tb);
+      Hacl_Impl_Ed25519_PointNegate_point_negate(a_pts + i * (uint32_t)20U,
+        points + k * (uint32_t)20U);
+      load_scalar_64(scalars + (k + (uint32_t)1U) * (uint32_t)4U, zb);
+      Hacl_Impl_Ed25519_PointNegate_point_negate(r_pts + i * (uint32_t)20U,
+        points + (k + (uint32_t)1U) * (uint32_t)20U);
+      k = k + (uint32_t)2U;
+    }
+  }
+  uint8_t sb[32U] = { 0U };
+  store_56(sb, sacc);
+  load_scalar_64(scalars, sb);
+  make_g(points);
+  uint64_t res[20U] = { 0U };
+  uint64_t inf[20U] = { 0U };
+  bool b = msm_vartime(res, npoints, scalars, points);
+  KRML_HOST_FREE(points);
+  KRML_HOST_FREE(scalars);
+  if (!b)
+  {
+    return false;
+  }
+  Hacl_Impl_Ed25519_PointDouble_point_double(res, res);
+  Hacl_Impl_Ed25519_PointDouble_point_double(res, res);
+  Hacl_Impl_Ed25519_PointDouble_point_double(res, res);
+  Hacl_Impl_Ed25519_Ladder_make_point_inf(inf);
+  return Hacl_Impl_Ed25519_PointEqual_point_equal(res, inf);
+}
+
+/* Checks the cofactored equation [8]([s]G - [h]A - R) = O for one signature: this
+   is the per-signature counterpart of verify_batch_combined, so that the result
+   for a signature does not depend on whether its batch falls back. */
+static bool
+verify_cofactored(uint8_t *public_key, uint32_t msg_len, uint8_t *msg, uint8_t *signature)
+{
+  uint64_t a_[20U] = { 0U };
+  uint64_t r_[20U] = { 0U };
+  uint8_t *rs = signature;
+  uint8_t *sb = signature + (uint32_t)32U;
+  uint64_t tmp[5U] = { 0U };
+  load_32_bytes(tmp, sb);
+  if
+  (
+    gte_q(tmp)
+    || !Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_, public_key)
+    || !Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_, rs)
+  )
+  {
+    return false;
+  }
+  uint8_t hb[32U] = { 0U };
+  uint64_t hq[5U] = { 0U };
+  sha512_modq_pre_pre2(hq, rs, public_key, msg_len, msg);
+  store_56(hb, hq);
+  uint64_t exp_d[20U] = { 0U };
+  uint64_t neg_r[20U] = { 0U };
+  uint64_t inf[20U] = { 0U };
+  point_negate_mul_double_g_vartime(exp_d, sb, hb, a_);
+  Hacl_Impl_Ed25519_PointNegate_point_negate(r_, neg_r);
+  Hacl_Impl_Ed25519_PointAdd_point_add(exp_d, exp_d, neg_r);
+  Hacl_Impl_Ed25519_PointDouble_point_double(exp_d, exp_d);
+  Hacl_Impl_Ed25519_PointDouble_point_double(exp_d, exp_d);
+  Hacl_Impl_Ed25519_PointDouble_point_double(exp_d, exp_d);
+  Hacl_Impl_Ed25519_Ladder_make_point_inf(inf);
+  return Hacl_Impl_Ed25519_PointEqual_point_equal(exp_d, inf);
+}
+
 /********************************************************************************
   Verified C library for EdDSA signing and verification on the edwards25519 curve.
 ********************************************************************************/
@@ -1888,3 +2220,99 @@ Hacl_Ed25519_verify(uint8_t *public_key, uint32_t msg_len, uint8_t *msg, uint8_t
   return false;
 }
 
+/**
+Verify a batch of Ed25519 signatures.
+
+  The function returns `true` if all signatures are valid and `false` otherwise.
+  In both cases, `results[i]` is set to the validity of the i-th signature.
+
+  The argument `len` is the number of signatures in the batch.
+  The argument `public_keys` points to `len` pointers to 32 bytes of valid memory.
+  The argument `msg_lens` points to `len` message lengths, i.e., uint32_t[len].
+  The argument `msgs` points to `len` pointers, `msgs[i]` pointing to `msg_lens[i]` bytes.
+  The argument `signatures` points to `len` pointers to 64 bytes of valid memory.
+  The outparam `results` points to `len` booleans, i.e., bool[len].
+
+  The whole batch is first checked with a single multi-scalar multiplication, whose
+  128-bit coefficients are derived deterministically (Fiat-Shamir) from a SHA-512 hash
+  of every signature and public key of the batch; only when this check fails does the
+  function check each signature on its own to find out which ones are invalid.
+  Batches of more than 2^26 signatures are always checked one signature at a time.
+
+  NOTE: both checks use the cofactored verification equation
+  [8]([S]B - [h]A - R) = O, so that `results[i]` only depends on the i-th signature,
+  public key and message, and not on the rest of the batch. Every signature accepted
+  by `verify` is accepted here, but a signature crafted with small-order components
+  may be accepted here while being rejected by the cofactorless `verify`.
+*/
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t len,
+  uint8_t **public_keys,
+  uint32_t *msg_lens,
+  uint8_t **msgs,
+  uint8_t **signatures,
+  bool *results
+)
+{
+  if (len == (uint32_t)0U)
+  {
+    return true;
+  }
+  if (len == (uint32_t)1U)
+  {
+    bool b = verify_cofactored(public_keys[0U], msg_lens[0U], msgs[0U], signatures[0U]);
+    results[0U] = b;
+    return b;
+  }
+  /* The combined check holds up to 2 * len + 1 points of 20 limbs, indexed with
+     32-bit offsets: larger batches would overflow them. */
+  uint64_t *a_pts = NULL;
+  uint64_t *r_pts = NULL;
+  uint64_t *hq = NULL;
+  if (len <= (uint32_t)0x4000000U)
+  {
+    a_pts = (uint64_t *)KRML_HOST_CALLOC((size_t)len * (size_t)20U, sizeof (uint64_t));
+    r_pts = (uint64_t *)KRML_HOST_CALLOC((size_t)len * (size_t)20U, sizeof (uint64_t));
+    hq = (uint64_t *)KRML_HOST_CALLOC((size_t)len * (size_t)5U, sizeof (uint64_t));
+  }
+  bool ok = true;
+  bool batched = false;
+  if (a_pts != NULL && r_pts != NULL && hq != NULL)
+  {
+    for (uint32_t i = (uint32_t)0U; i < len; i++)
+    {
+      uint8_t *rs = signatures[i];
+      uint8_t *sb = signatures[i] + (uint32_t)32U;
+      uint64_t tmp[5U] = { 0U };
+      load_32_bytes(tmp, sb);
+      bool b =
+        !gte_q(tmp)
+        && Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_pts + i * (uint32_t)20U,
+          public_keys[i])
+        && Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_pts + i * (uint32_t)20U, rs);
+      if (b)
+      {
+        sha512_modq_pre_pre2(hq + i * (uint32_t)5U, rs, public_keys[i], msg_lens[i], msgs[i]);
+      }
+      results[i] = b;
+      ok = ok && b;
+    }
+    batched = verify_batch_combined(len, public_keys, signatures, results, a_pts, r_pts, hq);
+  }
+  KRML_HOST_FREE(a_pts);
+  KRML_HOST_FREE(r_pts);
+  KRML_HOST_FREE(hq);
+  if (batched)
+  {
+    return ok;
+  }
+  ok = true;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    bool b = verify_cofactored(public_keys[i], msg_lens[i], msgs[i], signatures[i]);
+    results[i] = b;
+    ok = ok && b;
+  }
+  return ok;
+}
@@ -111,6 +111,41 @@ Verify an Ed25519 signature.
 bool
 Hacl_Ed25519_verify(uint8_t *public_key, uint32_t msg_len, uint8_t *msg, uint8_t *signature);
 
+/**
+Verify a batch of Ed25519 signatures.
+
+  The function returns `true` if all signatures are valid and `false` otherwise.
+  In both cases, `results[i]` is set to the validity of the i-th signature.
+
+  The argument `len` is the number of signatures in the batch.
+  The argument `public_keys` points to `len` pointers to 32 bytes of valid memory.
+  The argument `msg_lens` points to `len` message lengths, i.e., uint32_t[len].
+  The argument `msgs` points to `len` pointers, `msgs[i]` pointing to `msg_lens[i]` bytes.
+  The argument `signatures` points to `len` pointers to 64 bytes of valid memory.
+  The outparam `results` points to `len` booleans, i.e., bool[len].
+
+  The whole batch is first checked with a single multi-scalar multiplication, whose
+  128-bit coefficients are derived deterministically (Fiat-Shamir) from a SHA-512 hash
+  of every signature and public key of the batch; only when this check fails does the
+  function check each signature on its own to find out which ones are invalid.
+  Batches of more than 2^26 signatures are always checked one signature at a time.
+
+  NOTE: both checks use the cofactored verification equation
+  [8]([S]B - [h]A - R) = O, so that `results[i]` only depends on the i-th signature,
+  public key and message, and not on the rest of the batch. Every signature accepted
+  by `verify` is accepted here, but a signature crafted with small-order components
+  may be accepted here while being rejected by the cofactorless `verify`.
+*/
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t len,
+  uint8_t **public_keys,
+  uint32_t *msg_lens,
+  uint8_t **msgs,
+  uint8_t **signatures,
+  bool *results
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -847,3 +847,697 @@ Hacl_HMAC_compute_blake2b_32(
   Hacl_Hash_Core_Blake2_finish_blake2b_32(s0, ev11, dst);
 }
 
+/* Computes the chaining values after the inner and outer padded key blocks. */
+static void hmac_sha2_256_key(uint32_t *inner, uint32_t *outer, uint8_t *key, uint32_t key_len)
+{
+  uint8_t key_block[64U] = { 0U };
+  uint8_t ipad[64U] = { 0U };
+  uint8_t opad[64U] = { 0U };
+  if (key_len <= (uint32_t)64U)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    Hacl_Hash_SHA2_hash_256(key, key_len, key_block);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    ipad[i] = (uint8_t)0x36U ^ key_block[i];
+    opad[i] = (uint8_t)0x5cU ^ key_block[i];
+  }
+  Hacl_Hash_Core_SHA2_init_256(inner);
+  Hacl_Hash_SHA2_update_multi_256(inner, ipad, (uint32_t)1U);
+  Hacl_Hash_Core_SHA2_init_256(outer);
+  Hacl_Hash_SHA2_update_multi_256(outer, opad, (uint32_t)1U);
+}
+
+/* Given the final inner chaining value s, overwrites s and writes the MAC. */
+static void hmac_sha2_256_finish_outer(uint32_t *outer, uint32_t *s, uint8_t *dst)
+{
+  uint8_t hash1[32U] = { 0U };
+  Hacl_Hash_Core_SHA2_finish_256(s, hash1);
+  memcpy(s, outer, (uint32_t)8U * sizeof (uint32_t));
+  Hacl_Hash_SHA2_update_last_256(s, (uint64_t)(uint32_t)64U, hash1, (uint32_t)32U);
+  Hacl_Hash_Core_SHA2_finish_256(s, dst);
+}
+
+Hacl_HMAC_SHA2_256_state *Hacl_HMAC_SHA2_256_create_in(uint8_t *key, uint32_t key_len)
+{
+  uint32_t *inner = (uint32_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint32_t));
+  uint32_t *outer = (uint32_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint32_t));
+  uint32_t *block_state = (uint32_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint32_t));
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint8_t));
+  Hacl_HMAC_SHA2_256_state
+  s =
+    {
+      .inner = inner,
+      .outer = outer,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = (uint64_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_HMAC_SHA2_256_state), (uint32_t)1U);
+  Hacl_HMAC_SHA2_256_state
+  *p = (Hacl_HMAC_SHA2_256_state *)KRML_HOST_MALLOC(sizeof (Hacl_HMAC_SHA2_256_state));
+  p[0U] = s;
+  Hacl_HMAC_SHA2_256_init(key, key_len, p);
+  return p;
+}
+
+void Hacl_HMAC_SHA2_256_init(uint8_t *key, uint32_t key_len, Hacl_HMAC_SHA2_256_state *s)
+{
+  hmac_sha2_256_key(s->inner, s->outer, key, key_len);
+  Hacl_HMAC_SHA2_256_reset(s);
+}
+
+void Hacl_HMAC_SHA2_256_reset(Hacl_HMAC_SHA2_256_state *s)
+{
+  memcpy(s->block_state, s->inner, (uint32_t)8U * sizeof (uint32_t));
+  s->total_len = (uint64_t)0U;
+}
+
+void Hacl_HMAC_SHA2_256_update(Hacl_HMAC_SHA2_256_state *s, uint8_t *data, uint32_t len)
+{
+  uint64_t total_len = s->total_len;
+  uint8_t *buf = s->buf;
+  /* As in Hacl_Streaming, a full buffer is only processed once more data comes in,
+     so that finish always has a non-empty last block unless the message is empty. */
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)64U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)64U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)64U);
+  }
+  s->total_len = total_len + (uint64_t)len;
+  if (len <= (uint32_t)64U - sz)
+  {
+    memcpy(buf + sz, data, len * sizeof (uint8_t));
+    return;
+  }
+  uint32_t diff = (uint32_t)64U - sz;
+  memcpy(buf + sz, data, diff * sizeof (uint8_t));
+  Hacl_Hash_SHA2_update_multi_256(s->block_state, buf, (uint32_t)1U);
+  uint8_t *data1 = data + diff;
+  uint32_t len1 = len - diff;
+  uint32_t ite;
+  if (len1 % (uint32_t)64U == (uint32_t)0U)
+  {
+    ite = (uint32_t)64U;
+  }
+  else
+  {
+    ite = len1 % (uint32_t)64U;
+  }
+  uint32_t n_blocks = (len1 - ite) / (uint32_t)64U;
+  Hacl_Hash_SHA2_update_multi_256(s->block_state, data1, n_blocks);
+  memcpy(buf, data1 + n_blocks * (uint32_t)64U, ite * sizeof (uint8_t));
+}
+
+void Hacl_HMAC_SHA2_256_finish(Hacl_HMAC_SHA2_256_state *s, uint8_t *dst)
+{
+  uint64_t total_len = s->total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)64U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)64U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)64U);
+  }
+  uint32_t tmp_block_state[8U] = { 0U };
+  memcpy(tmp_block_state, s->block_state, (uint32_t)8U * sizeof (uint32_t));
+  Hacl_Hash_SHA2_update_last_256(tmp_block_state,
+    (uint64_t)(uint32_t)64U + total_len - (uint64_t)r,
+    s->buf,
+    r);
+  hmac_sha2_256_finish_outer(s->outer, tmp_block_state, dst);
+}
+
+void
+Hacl_HMAC_SHA2_256_compute(
+  uint8_t *dst,
+  Hacl_HMAC_SHA2_256_state *s,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  uint32_t st[8U] = { 0U };
+  memcpy(st, s->inner, (uint32_t)8U * sizeof (uint32_t));
+  uint32_t n_blocks = data_len / (uint32_t)64U;
+  if (n_blocks > (uint32_t)0U && data_len % (uint32_t)64U == (uint32_t)0U)
+  {
+    n_blocks = n_blocks - (uint32_t)1U;
+  }
+  uint32_t full_blocks_len = n_blocks * (uint32_t)64U;
+  Hacl_Hash_SHA2_update_multi_256(st, data, n_blocks);
+  Hacl_Hash_SHA2_update_last_256(st,
+    (uint64_t)(uint32_t)64U + (uint64_t)full_blocks_len,
+    data + full_blocks_len,
+    data_len - full_blocks_len);
+  hmac_sha2_256_finish_outer(s->outer, st, dst);
+}
+
+Hacl_HMAC_SHA2_256_state *Hacl_HMAC_SHA2_256_copy(Hacl_HMAC_SHA2_256_state *s)
+{
+  uint32_t *inner = (uint32_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint32_t));
+  uint32_t *outer = (uint32_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint32_t));
+  uint32_t *block_state = (uint32_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint32_t));
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint8_t));
+  memcpy(inner, s->inner, (uint32_t)8U * sizeof (uint32_t));
+  memcpy(outer, s->outer, (uint32_t)8U * sizeof (uint32_t));
+  memcpy(block_state, s->block_state, (uint32_t)8U * sizeof (uint32_t));
+  memcpy(buf, s->buf, (uint32_t)64U * sizeof (uint8_t));
+  Hacl_HMAC_SHA2_256_state
+  s1 =
+    {
+      .inner = inner,
+      .outer = outer,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = s->total_len
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_HMAC_SHA2_256_state), (uint32_t)1U);
+  Hacl_HMAC_SHA2_256_state
+  *p = (Hacl_HMAC_SHA2_256_state *)KRML_HOST_MALLOC(sizeof (Hacl_HMAC_SHA2_256_state));
+  p[0U] = s1;
+  return p;
+}
+
+void Hacl_HMAC_SHA2_256_free(Hacl_HMAC_SHA2_256_state *s)
+{
+  Lib_Memzero0_memzero(s->inner, (uint32_t)8U * sizeof (s->inner[0U]));
+  Lib_Memzero0_memzero(s->outer, (uint32_t)8U * sizeof (s->outer[0U]));
+  Lib_Memzero0_memzero(s->block_state, (uint32_t)8U * sizeof (s->block_state[0U]));
+  Lib_Memzero0_memzero(s->buf, (uint32_t)64U * sizeof (s->buf[0U]));
+  KRML_HOST_FREE(s->inner);
+  KRML_HOST_FREE(s->outer);
+  KRML_HOST_FREE(s->block_state);
+  KRML_HOST_FREE(s->buf);
+  KRML_HOST_FREE(s);
+}
+
+void
+Hacl_HMAC_SHA2_256_iterate(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+)
+{
+  uint32_t inner[8U] = { 0U };
+  uint32_t outer[8U] = { 0U };
+  uint32_t st[8U] = { 0U };
+  hmac_sha2_256_key(inner, outer, key, key_len);
+  uint32_t max = dst_len / (uint32_t)32U;
+  for (uint32_t i = (uint32_t)0U; i < max; i++)
+  {
+    memcpy(st, inner, (uint32_t)8U * sizeof (uint32_t));
+    Hacl_Hash_SHA2_update_last_256(st, (uint64_t)(uint32_t)64U, v, (uint32_t)32U);
+    hmac_sha2_256_finish_outer(outer, st, v);
+    memcpy(dst + i * (uint32_t)32U, v, (uint32_t)32U * sizeof (uint8_t));
+  }
+  if (max * (uint32_t)32U < dst_len)
+  {
+    memcpy(st, inner, (uint32_t)8U * sizeof (uint32_t));
+    Hacl_Hash_SHA2_update_last_256(st, (uint64_t)(uint32_t)64U, v, (uint32_t)32U);
+    hmac_sha2_256_finish_outer(outer, st, v);
+    memcpy(dst + max * (uint32_t)32U, v, (dst_len - max * (uint32_t)32U) * sizeof (uint8_t));
+  }
+}
+
+/* Computes the chaining values after the inner and outer padded key blocks. */
+static void hmac_sha2_384_key(uint64_t *inner, uint64_t *outer, uint8_t *key, uint32_t key_len)
+{
+  uint8_t key_block[128U] = { 0U };
+  uint8_t ipad[128U] = { 0U };
+  uint8_t opad[128U] = { 0U };
+  if (key_len <= (uint32_t)128U)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    Hacl_Hash_SHA2_hash_384(key, key_len, key_block);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+  {
+    ipad[i] = (uint8_t)0x36U ^ key_block[i];
+    opad[i] = (uint8_t)0x5cU ^ key_block[i];
+  }
+  Hacl_Hash_Core_SHA2_init_384(inner);
+  Hacl_Hash_SHA2_update_multi_384(inner, ipad, (uint32_t)1U);
+  Hacl_Hash_Core_SHA2_init_384(outer);
+  Hacl_Hash_SHA2_update_multi_384(outer, opad, (uint32_t)1U);
+}
+
+/* Given the final inner chaining value s, overwrites s and writes the MAC. */
+static void hmac_sha2_384_finish_outer(uint64_t *outer, uint64_t *s, uint8_t *dst)
+{
+  uint8_t hash1[48U] = { 0U };
+  Hacl_Hash_Core_SHA2_finish_384(s, hash1);
+  memcpy(s, outer, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_SHA2_update_last_384(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+    hash1,
+    (uint32_t)48U);
+  Hacl_Hash_Core_SHA2_finish_384(s, dst);
+}
+
+Hacl_HMAC_SHA2_384_state *Hacl_HMAC_SHA2_384_create_in(uint8_t *key, uint32_t key_len)
+{
+  uint64_t *inner = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint64_t *outer = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint64_t *block_state = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC((uint32_t)128U, sizeof (uint8_t));
+  Hacl_HMAC_SHA2_384_state
+  s =
+    {
+      .inner = inner,
+      .outer = outer,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = (uint64_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_HMAC_SHA2_384_state), (uint32_t)1U);
+  Hacl_HMAC_SHA2_384_state
+  *p = (Hacl_HMAC_SHA2_384_state *)KRML_HOST_MALLOC(sizeof (Hacl_HMAC_SHA2_384_state));
+  p[0U] = s;
+  Hacl_HMAC_SHA2_384_init(key, key_len, p);
+  return p;
+}
+
+void Hacl_HMAC_SHA2_384_init(uint8_t *key, uint32_t key_len, Hacl_HMAC_SHA2_384_state *s)
+{
+  hmac_sha2_384_key(s->inner, s->outer, key, key_len);
+  Hacl_HMAC_SHA2_384_reset(s);
+}
+
+void Hacl_HMAC_SHA2_384_reset(Hacl_HMAC_SHA2_384_state *s)
+{
+  memcpy(s->block_state, s->inner, (uint32_t)8U * sizeof (uint64_t));
+  s->total_len = (uint64_t)0U;
+}
+
+void Hacl_HMAC_SHA2_384_update(Hacl_HMAC_SHA2_384_state *s, uint8_t *data, uint32_t len)
+{
+  uint64_t total_len = s->total_len;
+  uint8_t *buf = s->buf;
+  /* As in Hacl_Streaming, a full buffer is only processed once more data comes in,
+     so that finish always has a non-empty last block unless the message is empty. */
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)128U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)128U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)128U);
+  }
+  s->total_len = total_len + (uint64_t)len;
+  if (len <= (uint32_t)128U - sz)
+  {
+    memcpy(buf + sz, data, len * sizeof (uint8_t));
+    return;
+  }
+  uint32_t diff = (uint32_t)128U - sz;
+  memcpy(buf + sz, data, diff * sizeof (uint8_t));
+  Hacl_Hash_SHA2_update_multi_384(s->block_state, buf, (uint32_t)1U);
+  uint8_t *data1 = data + diff;
+  uint32_t len1 = len - diff;
+  uint32_t ite;
+  if (len1 % (uint32_t)128U == (uint32_t)0U)
+  {
+    ite = (uint32_t)128U;
+  }
+  else
+  {
+    ite = len1 % (uint32_t)128U;
+  }
+  uint32_t n_blocks = (len1 - ite) / (uint32_t)128U;
+  Hacl_Hash_SHA2_update_multi_384(s->block_state, data1, n_blocks);
+  memcpy(buf, data1 + n_blocks * (uint32_t)128U, ite * sizeof (uint8_t));
+}
+
+void Hacl_HMAC_SHA2_384_finish(Hacl_HMAC_SHA2_384_state *s, uint8_t *dst)
+{
+  uint64_t total_len = s->total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)128U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)128U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)128U);
+  }
+  uint64_t tmp_block_state[8U] = { 0U };
+  memcpy(tmp_block_state, s->block_state, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_SHA2_update_last_384(tmp_block_state,
+    FStar_UInt128_add(FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+      FStar_UInt128_uint64_to_uint128(total_len - (uint64_t)r)),
+    s->buf,
+    r);
+  hmac_sha2_384_finish_outer(s->outer, tmp_block_state, dst);
+}
+
+void
+Hacl_HMAC_SHA2_384_compute(
+  uint8_t *dst,
+  Hacl_HMAC_SHA2_384_state *s,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  uint64_t st[8U] = { 0U };
+  memcpy(st, s->inner, (uint32_t)8U * sizeof (uint64_t));
+  uint32_t n_blocks = data_len / (uint32_t)128U;
+  if (n_blocks > (uint32_t)0U && data_len % (uint32_t)128U == (uint32_t)0U)
+  {
+    n_blocks = n_blocks - (uint32_t)1U;
+  }
+  uint32_t full_blocks_len = n_blocks * (uint32_t)128U;
+  Hacl_Hash_SHA2_update_multi_384(st, data, n_blocks);
+  Hacl_Hash_SHA2_update_last_384(st,
+    FStar_UInt128_add(FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+      FStar_UInt128_uint64_to_uint128((uint64_t)full_blocks_len)),
+    data + full_blocks_len,
+    data_len - full_blocks_len);
+  hmac_sha2_384_finish_outer(s->outer, st, dst);
+}
+
+Hacl_HMAC_SHA2_384_state *Hacl_HMAC_SHA2_384_copy(Hacl_HMAC_SHA2_384_state *s)
+{
+  uint64_t *inner = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint64_t *outer = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint64_t *block_state = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC((uint32_t)128U, sizeof (uint8_t));
+  memcpy(inner, s->inner, (uint32_t)8U * sizeof (uint64_t));
+  memcpy(outer, s->outer, (uint32_t)8U * sizeof (uint64_t));
+  memcpy(block_state, s->block_state, (uint32_t)8U * sizeof (uint64_t));
+  memcpy(buf, s->buf, (uint32_t)128U * sizeof (uint8_t));
+  Hacl_HMAC_SHA2_384_state
+  s1 =
+    {
+      .inner = inner,
+      .outer = outer,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = s->total_len
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_HMAC_SHA2_384_state), (uint32_t)1U);
+  Hacl_HMAC_SHA2_384_state
+  *p = (Hacl_HMAC_SHA2_384_state *)KRML_HOST_MALLOC(sizeof (Hacl_HMAC_SHA2_384_state));
+  p[0U] = s1;
+  return p;
+}
+
+void Hacl_HMAC_SHA2_384_free(Hacl_HMAC_SHA2_384_state *s)
+{
+  Lib_Memzero0_memzero(s->inner, (uint32_t)8U * sizeof (s->inner[0U]));
+  Lib_Memzero0_memzero(s->outer, (uint32_t)8U * sizeof (s->outer[0U]));
+  Lib_Memzero0_memzero(s->block_state, (uint32_t)8U * sizeof (s->block_state[0U]));
+  Lib_Memzero0_memzero(s->buf, (uint32_t)128U * sizeof (s->buf[0U]));
+  KRML_HOST_FREE(s->inner);
+  KRML_HOST_FREE(s->outer);
+  KRML_HOST_FREE(s->block_state);
+  KRML_HOST_FREE(s->buf);
+  KRML_HOST_FREE(s);
+}
+
+void
+Hacl_HMAC_SHA2_384_iterate(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+)
+{
+  uint64_t inner[8U] = { 0U };
+  uint64_t outer[8U] = { 0U };
+  uint64_t st[8U] = { 0U };
+  hmac_sha2_384_key(inner, outer, key, key_len);
+  uint32_t max = dst_len / (uint32_t)48U;
+  for (uint32_t i = (uint32_t)0U; i < max; i++)
+  {
+    memcpy(st, inner, (uint32_t)8U * sizeof (uint64_t));
+    Hacl_Hash_SHA2_update_last_384(st,
+      FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+      v,
+      (uint32_t)48U);
+    hmac_sha2_384_finish_outer(outer, st, v);
+    memcpy(dst + i * (uint32_t)48U, v, (uint32_t)48U * sizeof (uint8_t));
+  }
+  if (max * (uint32_t)48U < dst_len)
+  {
+    memcpy(st, inner, (uint32_t)8U * sizeof (uint64_t));
+    Hacl_Hash_SHA2_update_last_384(st,
+      FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+      v,
+      (uint32_t)48U);
+    hmac_sha2_384_finish_outer(outer, st, v);
+    memcpy(dst + max * (uint32_t)48U, v, (dst_len - max * (uint32_t)48U) * sizeof (uint8_t));
+  }
+}
+
+/* Computes the chaining values after the inner and outer padded key blocks. */
+static void hmac_sha2_512_key(uint64_t *inner, uint64_t *outer, uint8_t *key, uint32_t key_len)
+{
+  uint8_t key_block[128U] = { 0U };
+  uint8_t ipad[128U] = { 0U };
+  uint8_t opad[128U] = { 0U };
+  if (key_len <= (uint32_t)128U)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    Hacl_Hash_SHA2_hash_512(key, key_len, key_block);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+  {
+    ipad[i] = (uint8_t)0x36U ^ key_block[i];
+    opad[i] = (uint8_t)0x5cU ^ key_block[i];
+  }
+  Hacl_Hash_Core_SHA2_init_512(inner);
+  Hacl_Hash_SHA2_update_multi_512(inner, ipad, (uint32_t)1U);
+  Hacl_Hash_Core_SHA2_init_512(outer);
+  Hacl_Hash_SHA2_update_multi_512(outer, opad, (uint32_t)1U);
+}
+
+/* Given the final inner chaining value s, overwrites s and writes the MAC. */
+static void hmac_sha2_512_finish_outer(uint64_t *outer, uint64_t *s, uint8_t *dst)
+{
+  uint8_t hash1[64U] = { 0U };
+  Hacl_Hash_Core_SHA2_finish_512(s, hash1);
+  memcpy(s, outer, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_SHA2_update_last_512(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+    hash1,
+    (uint32_t)64U);
+  Hacl_Hash_Core_SHA2_finish_512(s, dst);
+}
+
+Hacl_HMAC_SHA2_512_state *Hacl_HMAC_SHA2_512_create_in(uint8_t *key, uint32_t key_len)
+{
+  uint64_t *inner = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint64_t *outer = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint64_t *block_state = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC((uint32_t)128U, sizeof (uint8_t));
+  Hacl_HMAC_SHA2_512_state
+  s =
+    {
+      .inner = inner,
+      .outer = outer,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = (uint64_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_HMAC_SHA2_512_state), (uint32_t)1U);
+  Hacl_HMAC_SHA2_512_state
+  *p = (Hacl_HMAC_SHA2_512_state *)KRML_HOST_MALLOC(sizeof (Hacl_HMAC_SHA2_512_state));
+  p[0U] = s;
+  Hacl_HMAC_SHA2_512_init(key, key_len, p);
+  return p;
+}
+
+void Hacl_HMAC_SHA2_512_init(uint8_t *key, uint32_t key_len, Hacl_HMAC_SHA2_512_state *s)
+{
+  hmac_sha2_512_key(s->inner, s->outer, key, key_len);
+  Hacl_HMAC_SHA2_512_reset(s);
+}
+
+void Hacl_HMAC_SHA2_512_reset(Hacl_HMAC_SHA2_512_state *s)
+{
+  memcpy(s->block_state, s->inner, (uint32_t)8U * sizeof (uint64_t));
+  s->total_len = (uint64_t)0U;
+}
+
+void Hacl_HMAC_SHA2_512_update(Hacl_HMAC_SHA2_512_state *s, uint8_t *data, uint32_t len)
+{
+  uint64_t total_len = s->total_len;
+  uint8_t *buf = s->buf;
+  /* As in Hacl_Streaming, a full buffer is only processed once more data comes in,
+     so that finish always has a non-empty last block unless the message is empty. */
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)128U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)128U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)128U);
+  }
+  s->total_len = total_len + (uint64_t)len;
+  if (len <= (uint32_t)128U - sz)
+  {
+    memcpy(buf + sz, data, len * sizeof (uint8_t));
+    return;
+  }
+  uint32_t diff = (uint32_t)128U - sz;
+  memcpy(buf + sz, data, diff * sizeof (uint8_t));
+  Hacl_Hash_SHA2_update_multi_512(s->block_state, buf, (uint32_t)1U);
+  uint8_t *data1 = data + diff;
+  uint32_t len1 = len - diff;
+  uint32_t ite;
+  if (len1 % (uint32_t)128U == (uint32_t)0U)
+  {
+    ite = (uint32_t)128U;
+  }
+  else
+  {
+    ite = len1 % (uint32_t)128U;
+  }
+  uint32_t n_blocks = (len1 - ite) / (uint32_t)128U;
+  Hacl_Hash_SHA2_update_multi_512(s->block_state, data1, n_blocks);
+  memcpy(buf, data1 + n_blocks * (uint32_t)128U, ite * sizeof (uint8_t));
+}
+
+void Hacl_HMAC_SHA2_512_finish(Hacl_HMAC_SHA2_512_state *s, uint8_t *dst)
+{
+  uint64_t total_len = s->total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)128U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)128U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)128U);
+  }
+  uint64_t tmp_block_state[8U] = { 0U };
+  memcpy(tmp_block_state, s->block_state, (uint32_t)8U * sizeof (uint64_t));
+  Hacl_Hash_SHA2_update_last_512(tmp_block_state,
+    FStar_UInt128_add(FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+      FStar_UInt128_uint64_to_uint128(total_len - (uint64_t)r)),
+    s->buf,
+    r);
+  hmac_sha2_512_finish_outer(s->outer, tmp_block_state, dst);
+}
+
+void
+Hacl_HMAC_SHA2_512_compute(
+  uint8_t *dst,
+  Hacl_HMAC_SHA2_512_state *s,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  uint64_t st[8U] = { 0U };
+  memcpy(st, s->inner, (uint32_t)8U * sizeof (uint64_t));
+  uint32_t n_blocks = data_len / (uint32_t)128U;
+  if (n_blocks > (uint32_t)0U && data_len % (uint32_t)128U == (uint32_t)0U)
+  {
+    n_blocks = n_blocks - (uint32_t)1U;
+  }
+  uint32_t full_blocks_len = n_blocks * (uint32_t)128U;
+  Hacl_Hash_SHA2_update_multi_512(st, data, n_blocks);
+  Hacl_Hash_SHA2_update_last_512(st,
+    FStar_UInt128_add(FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+      FStar_UInt128_uint64_to_uint128((uint64_t)full_blocks_len)),
+    data + full_blocks_len,
+    data_len - full_blocks_len);
+  hmac_sha2_512_finish_outer(s->outer, st, dst);
+}
+
+Hacl_HMAC_SHA2_512_state *Hacl_HMAC_SHA2_512_copy(Hacl_HMAC_SHA2_512_state *s)
+{
+  uint64_t *inner = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint64_t *outer = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint64_t *block_state = (uint64_t *)KRML_HOST_CALLOC((uint32_t)8U, sizeof (uint64_t));
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC((uint32_t)128U, sizeof (uint8_t));
+  memcpy(inner, s->inner, (uint32_t)8U * sizeof (uint64_t));
+  memcpy(outer, s->outer, (uint32_t)8U * sizeof (uint64_t));
+  memcpy(block_state, s->block_state, (uint32_t)8U * sizeof (uint64_t));
+  memcpy(buf, s->buf, (uint32_t)128U * sizeof (uint8_t));
+  Hacl_HMAC_SHA2_512_state
+  s1 =
+    {
+      .inner = inner,
+      .outer = outer,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = s->total_len
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_HMAC_SHA2_512_state), (uint32_t)1U);
+  Hacl_HMAC_SHA2_512_state
+  *p = (Hacl_HMAC_SHA2_512_state *)KRML_HOST_MALLOC(sizeof (Hacl_HMAC_SHA2_512_state));
+  p[0U] = s1;
+  return p;
+}
+
+void Hacl_HMAC_SHA2_512_free(Hacl_HMAC_SHA2_512_state *s)
+{
+  Lib_Memzero0_memzero(s->inner, (uint32_t)8U * sizeof (s->inner[0U]));
+  Lib_Memzero0_memzero(s->outer, (uint32_t)8U * sizeof (s->outer[0U]));
+  Lib_Memzero0_memzero(s->block_state, (uint32_t)8U * sizeof (s->block_state[0U]));
+  Lib_Memzero0_memzero(s->buf, (uint32_t)128U * sizeof (s->buf[0U]));
+  KRML_HOST_FREE(s->inner);
+  KRML_HOST_FREE(s->outer);
+  KRML_HOST_FREE(s->block_state);
+  KRML_HOST_FREE(s->buf);
+  KRML_HOST_FREE(s);
+}
+
+void
+Hacl_HMAC_SHA2_512_iterate(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+)
+{
+  uint64_t inner[8U] = { 0U };
+  uint64_t outer[8U] = { 0U };
+  uint64_t st[8U] = { 0U };
+  hmac_sha2_512_key(inner, outer, key, key_len);
+  uint32_t max = dst_len / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < max; i++)
+  {
+    memcpy(st, inner, (uint32_t)8U * sizeof (uint64_t));
+    Hacl_Hash_SHA2_update_last_512(st,
+      FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+      v,
+      (uint32_t)64U);
+    hmac_sha2_512_finish_outer(outer, st, v);
+    memcpy(dst + i * (uint32_t)64U, v, (uint32_t)64U * sizeof (uint8_t));
+  }
+  if (max * (uint32_t)64U < dst_len)
+  {
+    memcpy(st, inner, (uint32_t)8U * sizeof (uint64_t));
+    Hacl_Hash_SHA2_update_last_512(st,
+      FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+      v,
+      (uint32_t)64U);
+    hmac_sha2_512_finish_outer(outer, st, v);
+    memcpy(dst + max * (uint32_t)64U, v, (dst_len - max * (uint32_t)64U) * sizeof (uint8_t));
+  }
+}
+
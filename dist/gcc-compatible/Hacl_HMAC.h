@@ -40,6 +40,36 @@ extern "C" {
 #include "Hacl_Hash_SHA2.h"
 #include "Hacl_Hash_SHA1.h"
 #include "evercrypt_targetconfig.h"
+typedef struct Hacl_HMAC_SHA2_256_state_s
+{
+  uint32_t *inner;
+  uint32_t *outer;
+  uint32_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+Hacl_HMAC_SHA2_256_state;
+
+typedef struct Hacl_HMAC_SHA2_384_state_s
+{
+  uint64_t *inner;
+  uint64_t *outer;
+  uint64_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+Hacl_HMAC_SHA2_384_state;
+
+typedef struct Hacl_HMAC_SHA2_512_state_s
+{
+  uint64_t *inner;
+  uint64_t *outer;
+  uint64_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+Hacl_HMAC_SHA2_512_state;
+
 void
 Hacl_HMAC_legacy_compute_sha1(
   uint8_t *dst,
@@ -94,6 +124,210 @@ Hacl_HMAC_compute_blake2b_32(
   uint32_t data_len
 );
 
+/**
+Allocate an HMAC-SHA2-256 state for the key `key` of length `key_len`.
+
+  The key-dependent part of HMAC, i.e. hashing the key if it is longer than a block and
+  compressing the inner and outer padded keys, is done once here and cached in the state,
+  so that every MAC computed from the state saves two compression-function calls. The state
+  serves both one-shot MACs (`compute`) and MACs of streamed messages (`update`, `finish`).
+*/
+Hacl_HMAC_SHA2_256_state *Hacl_HMAC_SHA2_256_create_in(uint8_t *key, uint32_t key_len);
+
+/**
+Re-key the state `s` with `key` and reset its streamed message to the empty message.
+*/
+void Hacl_HMAC_SHA2_256_init(uint8_t *key, uint32_t key_len, Hacl_HMAC_SHA2_256_state *s);
+
+/**
+Reset the streamed message of the state `s` to the empty message, keeping its key.
+*/
+void Hacl_HMAC_SHA2_256_reset(Hacl_HMAC_SHA2_256_state *s);
+
+/**
+Append `len` bytes of `data` to the streamed message of the state `s`.
+*/
+void Hacl_HMAC_SHA2_256_update(Hacl_HMAC_SHA2_256_state *s, uint8_t *data, uint32_t len);
+
+/**
+Write the MAC of the streamed message of the state `s` into `dst` (32 bytes).
+
+  The state is not modified, so that the message can be extended further.
+*/
+void Hacl_HMAC_SHA2_256_finish(Hacl_HMAC_SHA2_256_state *s, uint8_t *dst);
+
+/**
+Write the MAC of `data` under the key of the state `s` into `dst` (32 bytes).
+
+  The streamed message of the state is neither used nor modified.
+*/
+void
+Hacl_HMAC_SHA2_256_compute(
+  uint8_t *dst,
+  Hacl_HMAC_SHA2_256_state *s,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+/**
+Allocate a copy of the state `s`, key and streamed message included.
+*/
+Hacl_HMAC_SHA2_256_state *Hacl_HMAC_SHA2_256_copy(Hacl_HMAC_SHA2_256_state *s);
+
+void Hacl_HMAC_SHA2_256_free(Hacl_HMAC_SHA2_256_state *s);
+
+/**
+Replace `v` (32 bytes) with HMAC-SHA2-256(key, v) as many times as needed to fill `dst`
+with the successive values of `v`, the last one possibly truncated.
+
+  This is the output loop of HMAC-DRBG. The padded keys are compressed once for all
+  blocks, so that each block costs two compression-function calls instead of four.
+*/
+void
+Hacl_HMAC_SHA2_256_iterate(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+);
+
+/**
+Allocate an HMAC-SHA2-384 state for the key `key` of length `key_len`.
+
+  The key-dependent part of HMAC, i.e. hashing the key if it is longer than a block and
+  compressing the inner and outer padded keys, is done once here and cached in the state,
+  so that every MAC computed from the state saves two compression-function calls. The state
+  serves both one-shot MACs (`compute`) and MACs of streamed messages (`update`, `finish`).
+*/
+Hacl_HMAC_SHA2_384_state *Hacl_HMAC_SHA2_384_create_in(uint8_t *key, uint32_t key_len);
+
+/**
+Re-key the state `s` with `key` and reset its streamed message to the empty message.
+*/
+void Hacl_HMAC_SHA2_384_init(uint8_t *key, uint32_t key_len, Hacl_HMAC_SHA2_384_state *s);
+
+/**
+Reset the streamed message of the state `s` to the empty message, keeping its key.
+*/
+void Hacl_HMAC_SHA2_384_reset(Hacl_HMAC_SHA2_384_state *s);
+
+/**
+Append `len` bytes of `data` to the streamed message of the state `s`.
+*/
+void Hacl_HMAC_SHA2_384_update(Hacl_HMAC_SHA2_384_state *s, uint8_t *data, uint32_t len);
+
+/**
+Write the MAC of the streamed message of the state `s` into `dst` (48 bytes).
+
+  The state is not modified, so that the message can be extended further.
+*/
+void Hacl_HMAC_SHA2_384_finish(Hacl_HMAC_SHA2_384_state *s, uint8_t *dst);
+
+/**
+Write the MAC of `data` under the key of the state `s` into `dst` (48 bytes).
+
+  The streamed message of the state is neither used nor modified.
+*/
+void
+Hacl_HMAC_SHA2_384_compute(
+  uint8_t *dst,
+  Hacl_HMAC_SHA2_384_state *s,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+/**
+Allocate a copy of the state `s`, key and streamed message included.
+*/
+Hacl_HMAC_SHA2_384_state *Hacl_HMAC_SHA2_384_copy(Hacl_HMAC_SHA2_384_state *s);
+
+void Hacl_HMAC_SHA2_384_free(Hacl_HMAC_SHA2_384_state *s);
+
+/**
+Replace `v` (48 bytes) with HMAC-SHA2-384(key, v) as many times as needed to fill `dst`
+with the successive values of `v`, the last one possibly truncated.
+
+  This is the output loop of HMAC-DRBG. The padded keys are compressed once for all
+  blocks, so that each block costs two compression-function calls instead of four.
+*/
+void
+Hacl_HMAC_SHA2_384_iterate(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+);
+
+/**
+Allocate an HMAC-SHA2-512 state for the key `key` of length `key_len`.
+
+  The key-dependent part of HMAC, i.e. hashing the key if it is longer than a block and
+  compressing the inner and outer padded keys, is done once here and cached in the state,
+  so that every MAC computed from the state saves two compression-function calls. The state
+  serves both one-shot MACs (`compute`) and MACs of streamed messages (`update`, `finish`).
+*/
+Hacl_HMAC_SHA2_512_state *Hacl_HMAC_SHA2_512_create_in(uint8_t *key, uint32_t key_len);
+
+/**
+Re-key the state `s` with `key` and reset its streamed message to the empty message.
+*/
+void Hacl_HMAC_SHA2_512_init(uint8_t *key, uint32_t key_len, Hacl_HMAC_SHA2_512_state *s);
+
+/**
+Reset the streamed message of the state `s` to the empty message, keeping its key.
+*/
+void Hacl_HMAC_SHA2_512_reset(Hacl_HMAC_SHA2_512_state *s);
+
+/**
+Append `len` bytes of `data` to the streamed message of the state `s`.
+*/
+void Hacl_HMAC_SHA2_512_update(Hacl_HMAC_SHA2_512_state *s, uint8_t *data, uint32_t len);
+
+/**
+Write the MAC of the streamed message of the state `s` into `dst` (64 bytes).
+
+  The state is not modified, so that the message can be extended further.
+*/
+void Hacl_HMAC_SHA2_512_finish(Hacl_HMAC_SHA2_512_state *s, uint8_t *dst);
+
+/**
+Write the MAC of `data` under the key of the state `s` into `dst` (64 bytes).
+
+  The streamed message of the state is neither used nor modified.
+*/
+void
+Hacl_HMAC_SHA2_512_compute(
+  uint8_t *dst,
+  Hacl_HMAC_SHA2_512_state *s,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+/**
+Allocate a copy of the state `s`, key and streamed message included.
+*/
+Hacl_HMAC_SHA2_512_state *Hacl_HMAC_SHA2_512_copy(Hacl_HMAC_SHA2_512_state *s);
+
+void Hacl_HMAC_SHA2_512_free(Hacl_HMAC_SHA2_512_state *s);
+
+/**
+Replace `v` (64 bytes) with HMAC-SHA2-512(key, v) as many times as needed to fill `dst`
+with the successive values of `v`, the last one possibly truncated.
+
+  This is the output loop of HMAC-DRBG. The padded keys are compressed once for all
+  blocks, so that each block costs two compression-function calls instead of four.
+*/
+void
+Hacl_HMAC_SHA2_512_iterate(
+  uint8_t *dst,
+  uint32_t dst_len,
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *v
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -787,19 +787,7 @@ Hacl_HMAC_DRBG_generate(
           }
         }
         uint8_t *output1 = output;
-        uint32_t max = n / (uint32_t)32U;
-        uint8_t *out = output1;
-        for (uint32_t i = (uint32_t)0U; i < max; i++)
-        {
-          Hacl_HMAC_compute_sha2_256(v, k, (uint32_t)32U, v, (uint32_t)32U);
-          memcpy(out + i * (uint32_t)32U, v, (uint32_t)32U * sizeof (uint8_t));
-        }
-        if (max * (uint32_t)32U < n)
-        {
-          uint8_t *block = output1 + max * (uint32_t)32U;
-          Hacl_HMAC_compute_sha2_256(v, k, (uint32_t)32U, v, (uint32_t)32U);
-          memcpy(block, v, (n - max * (uint32_t)32U) * sizeof (uint8_t));
-        }
+        Hacl_HMAC_SHA2_256_iterate(output1, n, k, (uint32_t)32U, v);
         uint32_t input_len = (uint32_t)33U + additional_input_len;
         KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
         uint8_t input0[input_len];
@@ -885,19 +873,7 @@ Hacl_HMAC_DRBG_generate(
           }
         }
         uint8_t *output1 = output;
-        uint32_t max = n / (uint32_t)48U;
-        uint8_t *out = output1;
-        for (uint32_t i = (uint32_t)0U; i < max; i++)
-        {
-          Hacl_HMAC_compute_sha2_384(v, k, (uint32_t)48U, v, (uint32_t)48U);
-          memcpy(out + i * (uint32_t)48U, v, (uint32_t)48U * sizeof (uint8_t));
-        }
-        if (max * (uint32_t)48U < n)
-        {
-          uint8_t *block = output1 + max * (uint32_t)48U;
-          Hacl_HMAC_compute_sha2_384(v, k, (uint32_t)48U, v, (uint32_t)48U);
-          memcpy(block, v, (n - max * (uint32_t)48U) * sizeof (uint8_t));
-        }
+        Hacl_HMAC_SHA2_384_iterate(output1, n, k, (uint32_t)48U, v);
         uint32_t input_len = (uint32_t)49U + additional_input_len;
         KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
         uint8_t input0[input_len];
@@ -983,19 +959,7 @@ Hacl_HMAC_DRBG_generate(
           }
         }
         uint8_t *output1 = output;
-        uint32_t max = n / (uint32_t)64U;
-        uint8_t *out = output1;
-        for (uint32_t i = (uint32_t)0U; i < max; i++)
-        {
-          Hacl_HMAC_compute_sha2_512(v, k, (uint32_t)64U, v, (uint32_t)64U);
-          memcpy(out + i * (uint32_t)64U, v, (uint32_t)64U * sizeof (uint8_t));
-        }
-        if (max * (uint32_t)64U < n)
-        {
-          uint8_t *block = output1 + max * (uint32_t)64U;
-          Hacl_HMAC_compute_sha2_512(v, k, (uint32_t)64U, v, (uint32_t)64U);
-          memcpy(block, v, (n - max * (uint32_t)64U) * sizeof (uint8_t));
-        }
+        Hacl_HMAC_SHA2_512_iterate(output1, n, k, (uint32_t)64U, v);
         uint32_t input_len = (uint32_t)65U + additional_input_len;
         KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
         uint8_t input0[input_len];
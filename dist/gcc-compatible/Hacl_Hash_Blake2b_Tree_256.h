@@ -0,0 +1,77 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_Hash_Blake2b_Tree_256_H
+#define __Hacl_Hash_Blake2b_Tree_256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Hacl_Krmllib.h"
+#include "Hacl_Hash_Blake2b_256.h"
+#include "Hacl_Impl_Blake2_Constants.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/**
+  Write the BLAKE2b tree digest of message `d` into `output`, hashing its leaves with up to
+  `n_threads` threads.
+
+  The message is cut into leaves of `chunk_len` bytes (the last one may be shorter), each hashed
+  as a BLAKE2b leaf node with node offset i, and the root node hashes the concatenation of their
+  64-byte digests. The tree uses unlimited fanout, depth 2, leaf length `chunk_len` and inner
+  length 64, so the digest only depends on `chunk_len`, not on the number of threads. `d` may
+  be a memory-mapped file.
+
+  @param nn Length of the digest, between 1 and 64.
+  @param output Pointer to `nn` bytes of memory where the digest is written to.
+  @param ll Length of the input message.
+  @param d Pointer to `ll` bytes of memory where the input message is read from.
+  @param chunk_len Length of the leaves, a non-zero multiple of 128.
+  @param n_threads Maximum number of threads, including the calling one.
+  @return false if `nn` or `chunk_len` is out of range, in which case nothing is written.
+*/
+bool
+Hacl_Blake2b_Tree_256_hash(
+  uint32_t nn,
+  uint8_t *output,
+  uint64_t ll,
+  uint8_t *d,
+  uint32_t chunk_len,
+  uint32_t n_threads
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Hash_Blake2b_Tree_256_H_DEFINED
+#endif
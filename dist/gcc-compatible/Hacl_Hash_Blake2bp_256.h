@@ -0,0 +1,115 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_Hash_Blake2bp_256_H
+#define __Hacl_Hash_Blake2bp_256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "Lib_Memzero0.h"
+#include "Hacl_Krmllib.h"
+#include "Hacl_Impl_Blake2_Constants.h"
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+/**
+  Streaming BLAKE2bp state. Word j of the chaining value of leaf i is in lane i of `hash[j]`.
+  The buffer holds up to two stripes of four leaf blocks; `leaf_len` is the number of bytes
+  compressed so far by each leaf.
+*/
+typedef struct Hacl_Blake2bp_256_state_s
+{
+  Lib_IntVector_Intrinsics_vec256 *hash;
+  uint8_t *buf;
+  uint32_t buf_len;
+  uint64_t leaf_len;
+  uint8_t key[64U];
+  uint32_t key_len;
+  uint32_t digest_len;
+}
+Hacl_Blake2bp_256_state;
+
+/**
+  Write the BLAKE2bp digest of message `d` using key `k` into `output`.
+
+  BLAKE2bp hashes the message as four interleaved BLAKE2b leaves of 128-byte blocks, computed
+  side by side in the lanes of 256-bit vectors, and a root node over the leaf digests.
+
+  @param nn Length of the digest, between 1 and 64.
+  @param output Pointer to `nn` bytes of memory where the digest is written to.
+  @param ll Length of the input message.
+  @param d Pointer to `ll` bytes of memory where the input message is read from.
+  @param kk Length of the key, at most 64.
+  @param k Pointer to `kk` bytes of memory where the key is read from.
+*/
+void
+Hacl_Blake2bp_256_blake2bp(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t kk,
+  uint8_t *k
+);
+
+/**
+  State allocation function; returns NULL if `key_len` or `digest_len` is out of range.
+*/
+Hacl_Blake2bp_256_state
+*Hacl_Blake2bp_256_create_in(uint8_t *key, uint32_t key_len, uint32_t digest_len);
+
+/**
+  (Re-)initialization function
+*/
+void Hacl_Blake2bp_256_init(Hacl_Blake2bp_256_state *s);
+
+/**
+  Update function
+*/
+void Hacl_Blake2bp_256_update(Hacl_Blake2bp_256_state *s, uint8_t *data, uint32_t len);
+
+/**
+  Finish function; writes `digest_len` bytes to `dst` and leaves the state unchanged.
+*/
+void Hacl_Blake2bp_256_finish(Hacl_Blake2bp_256_state *s, uint8_t *dst);
+
+/**
+  Free state function
+*/
+void Hacl_Blake2bp_256_free(Hacl_Blake2bp_256_state *s);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Hash_Blake2bp_256_H_DEFINED
+#endif
@@ -0,0 +1,288 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Hash_Blake2s_Tree_128.h"
+
+#if !(defined(_WIN32) || defined(_WIN64))
+#include <pthread.h>
+#endif
+
+/* The leaves are independent BLAKE2s nodes, hashed by the 128-bit kernels; contiguous ranges of
+   leaves are handed to the threads, and the calling thread hashes the root once they are done. */
+
+/* Initializes `hash` for the node at offset `offset` and depth `depth`: the parameter block has
+   the digest length, no key, unlimited fanout, depth 2, the leaf length, the 48-bit node offset,
+   the node depth and an inner length of 32. */
+static void
+init_node(
+  Lib_IntVector_Intrinsics_vec128 *hash,
+  uint32_t nn,
+  uint32_t chunk_len,
+  uint64_t offset,
+  uint32_t depth
+)
+{
+  const uint32_t *iv = Hacl_Impl_Blake2_Constants_ivTable_S;
+  Hacl_Blake2s_128_blake2s_init(hash, (uint32_t)0U, nn);
+  hash[0U] =
+    Lib_IntVector_Intrinsics_vec128_load32s(iv[0U] ^ (nn ^ (uint32_t)2U << (uint32_t)24U),
+      iv[1U] ^ chunk_len,
+      iv[2U] ^ (uint32_t)offset,
+      iv[3U]
+      ^
+        ((uint32_t)(offset >> (uint32_t)32U)
+        ^ (depth << (uint32_t)16U ^ (uint32_t)32U << (uint32_t)24U)));
+}
+
+/* Compresses the last block with the last-node flag set, i.e. with the last word of the IV
+   complemented. */
+static void
+update_last_node(
+  Lib_IntVector_Intrinsics_vec128 *wv,
+  Lib_IntVector_Intrinsics_vec128 *hash,
+  uint64_t prev,
+  uint32_t rem,
+  uint8_t *d
+)
+{
+  hash[3U] =
+    Lib_IntVector_Intrinsics_vec128_xor(hash[3U],
+      Lib_IntVector_Intrinsics_vec128_load32s((uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)0U,
+        (uint32_t)0xFFFFFFFFU));
+  Hacl_Blake2s_128_blake2s_update_last(rem, wv, hash, prev, rem, d);
+}
+
+typedef struct leaves_task_s
+{
+  uint8_t *d;
+  uint64_t ll;
+  uint32_t chunk_len;
+  uint64_t first;
+  uint64_t count;
+  uint64_t n_leaves;
+  uint8_t *out;
+}
+leaves_task;
+
+/* Writes the digests of leaves first to first + count - 1 to out. */
+static void hash_leaves(leaves_task *t)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 b[4U] KRML_POST_ALIGN(16) = { 0U };
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 wv[4U] KRML_POST_ALIGN(16) = { 0U };
+  for (uint64_t i = t->first; i < t->first + t->count; i++)
+  {
+    uint64_t off = i * (uint64_t)t->chunk_len;
+    uint32_t len;
+    if (t->ll - off < (uint64_t)t->chunk_len)
+    {
+      len = (uint32_t)(t->ll - off);
+    }
+    else
+    {
+      len = t->chunk_len;
+    }
+    uint8_t *leaf = t->d + off;
+    uint32_t nb;
+    if (len == (uint32_t)0U)
+    {
+      nb = (uint32_t)0U;
+    }
+    else
+    {
+      nb = (len - (uint32_t)1U) / (uint32_t)64U;
+    }
+    uint32_t rem = len - nb * (uint32_t)64U;
+    uint64_t prev = (uint64_t)(nb * (uint32_t)64U);
+    init_node(b, (uint32_t)32U, t->chunk_len, i, (uint32_t)0U);
+    Hacl_Blake2s_128_blake2s_update_multi(len,
+      wv,
+      b,
+      (uint64_t)0U,
+      leaf,
+      nb);
+    if (i == t->n_leaves - (uint64_t)1U)
+    {
+      update_last_node(wv, b, prev, rem, leaf + nb * (uint32_t)64U);
+    }
+    else
+    {
+      Hacl_Blake2s_128_blake2s_update_last(rem, wv, b, prev, rem, leaf + nb * (uint32_t)64U);
+    }
+    Hacl_Blake2s_128_blake2s_finish((uint32_t)32U, t->out + (i - t->first) * (uint64_t)32U, b);
+  }
+  Lib_Memzero0_memzero(b, (uint32_t)4U * sizeof (b[0U]));
+  Lib_Memzero0_memzero(wv, (uint32_t)4U * sizeof (wv[0U]));
+}
+
+#if !(defined(_WIN32) || defined(_WIN64))
+
+static void *hash_leaves_thread(void *t)
+{
+  hash_leaves((leaves_task *)t);
+  return NULL;
+}
+
+#endif
+
+static void hash_leaves_par(leaves_task t, uint32_t workers)
+{
+  uint64_t nw = (uint64_t)workers;
+  if (nw > t.count)
+  {
+    nw = t.count;
+  }
+  #if !(defined(_WIN32) || defined(_WIN64))
+  if (nw > (uint64_t)1U)
+  {
+    KRML_CHECK_SIZE(sizeof (leaves_task), nw);
+    leaves_task *ts = KRML_HOST_MALLOC(sizeof (leaves_task) * nw);
+    KRML_CHECK_SIZE(sizeof (pthread_t), nw);
+    pthread_t *ths = KRML_HOST_MALLOC(sizeof (pthread_t) * nw);
+    uint64_t chunk = (t.count + nw - (uint64_t)1U) / nw;
+    uint64_t started = (uint64_t)0U;
+    for (uint64_t w = (uint64_t)0U; w < nw; w++)
+    {
+      uint64_t first = w * chunk;
+      ts[w] = t;
+      ts[w].first = t.first + first;
+      ts[w].count = first >= t.count ? (uint64_t)0U : (t.count - first < chunk ? t.count - first : chunk);
+      ts[w].out = t.out + first * (uint64_t)32U;
+      /* The calling thread hashes the first range itself. */
+      if (w > (uint64_t)0U)
+      {
+        if (pthread_create(ths + w, NULL, hash_leaves_thread, ts + w) != 0)
+        {
+          break;
+        }
+        started++;
+      }
+    }
+    hash_leaves(ts);
+    for (uint64_t w = (uint64_t)1U; w < nw; w++)
+    {
+      if (w <= started)
+      {
+        pthread_join(ths[w], NULL);
+      }
+      else
+      {
+        hash_leaves(ts + w);
+      }
+    }
+    KRML_HOST_FREE(ths);
+    KRML_HOST_FREE(ts);
+    return;
+  }
+  #endif
+  hash_leaves(&t);
+}
+
+/* Blocks of leaf digests passed to each call to the kernel, so that block offsets fit in 32
+   bits. */
+#define ROOT_BLOCKS 0x100000U
+
+/**
+  Write the BLAKE2s tree digest of message `d` into `output`, hashing its leaves with up to
+  `n_threads` threads.
+
+  The message is cut into leaves of `chunk_len` bytes (the last one may be shorter), each hashed
+  as a BLAKE2s leaf node with node offset i, and the root node hashes the concatenation of their
+  32-byte digests. The tree uses unlimited fanout, depth 2, leaf length `chunk_len` and inner
+  length 32, so the digest only depends on `chunk_len`, not on the number of threads. `d` may
+  be a memory-mapped file.
+
+  @param nn Length of the digest, between 1 and 32.
+  @param output Pointer to `nn` bytes of memory where the digest is written to.
+  @param ll Length of the input message.
+  @param d Pointer to `ll` bytes of memory where the input message is read from.
+  @param chunk_len Length of the leaves, a non-zero multiple of 64.
+  @param n_threads Maximum number of threads, including the calling one.
+  @return false if `nn` or `chunk_len` is out of range, in which case nothing is written.
+*/
+bool
+Hacl_Blake2s_Tree_128_hash(
+  uint32_t nn,
+  uint8_t *output,
+  uint64_t ll,
+  uint8_t *d,
+  uint32_t chunk_len,
+  uint32_t n_threads
+)
+{
+  if
+  (
+    nn == (uint32_t)0U || nn > (uint32_t)32U || chunk_len == (uint32_t)0U
+    || chunk_len % (uint32_t)64U != (uint32_t)0U
+  )
+  {
+    return false;
+  }
+  /* The empty message is hashed as a single empty leaf. */
+  uint64_t n_leaves = ll / (uint64_t)chunk_len;
+  if (n_leaves == (uint64_t)0U || ll % (uint64_t)chunk_len != (uint64_t)0U)
+  {
+    n_leaves++;
+  }
+  uint64_t digests_len = n_leaves * (uint64_t)32U;
+  KRML_CHECK_SIZE(sizeof (uint8_t), digests_len);
+  uint8_t *digests = KRML_HOST_MALLOC((size_t)digests_len);
+  leaves_task
+  t =
+    {
+      .d = d, .ll = ll, .chunk_len = chunk_len, .first = (uint64_t)0U, .count = n_leaves,
+      .n_leaves = n_leaves, .out = digests
+    };
+  hash_leaves_par(t, n_threads == (uint32_t)0U ? (uint32_t)1U : n_threads);
+  /* The root node has depth 1 and is the last node of its level. Leaf digests are fed to the
+     kernel a bounded number of blocks at a time; the last block is always left for
+     update_last_node. */
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 b[4U] KRML_POST_ALIGN(16) = { 0U };
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 wv[4U] KRML_POST_ALIGN(16) = { 0U };
+  init_node(b, nn, chunk_len, (uint64_t)0U, (uint32_t)1U);
+  uint64_t nb = (digests_len - (uint64_t)1U) / (uint64_t)64U;
+  for (uint64_t i = (uint64_t)0U; i < nb; i = i + (uint64_t)ROOT_BLOCKS)
+  {
+    uint32_t n = nb - i < (uint64_t)ROOT_BLOCKS ? (uint32_t)(nb - i) : ROOT_BLOCKS;
+    Hacl_Blake2s_128_blake2s_update_multi(n * (uint32_t)64U,
+      wv,
+      b,
+      i * (uint64_t)64U,
+      digests + i * (uint64_t)64U,
+      n);
+  }
+  uint32_t rem = (uint32_t)(digests_len - nb * (uint64_t)64U);
+  update_last_node(wv,
+    b,
+    nb * (uint64_t)64U,
+    rem,
+    digests + nb * (uint64_t)64U);
+  Hacl_Blake2s_128_blake2s_finish(nn, output, b);
+  Lib_Memzero0_memzero(b, (uint32_t)4U * sizeof (b[0U]));
+  Lib_Memzero0_memzero(wv, (uint32_t)4U * sizeof (wv[0U]));
+  KRML_HOST_FREE(digests);
+  return true;
+}
+
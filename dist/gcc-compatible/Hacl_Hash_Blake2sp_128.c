@@ -0,0 +1,471 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_Hash_Blake2sp_128.h"
+
+/* Eight BLAKE2s leaves are hashed four at a time: lane l of every vector in group g belongs
+   to leaf 4 * g + l, and the message is split into stripes of eight 64-byte blocks, block i
+   of a stripe going to leaf i. */
+
+static inline void
+g(
+  Lib_IntVector_Intrinsics_vec128 *v,
+  uint32_t a,
+  uint32_t b,
+  uint32_t c,
+  uint32_t d,
+  Lib_IntVector_Intrinsics_vec128 x,
+  Lib_IntVector_Intrinsics_vec128 y
+)
+{
+  v[a] = Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(v[a], v[b]), x);
+  v[d] = Lib_IntVector_Intrinsics_vec128_rotate_right32(Lib_IntVector_Intrinsics_vec128_xor(v[d], v[a]),
+      (uint32_t)16U);
+  v[c] = Lib_IntVector_Intrinsics_vec128_add32(v[c], v[d]);
+  v[b] = Lib_IntVector_Intrinsics_vec128_rotate_right32(Lib_IntVector_Intrinsics_vec128_xor(v[b], v[c]),
+      (uint32_t)12U);
+  v[a] = Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(v[a], v[b]), y);
+  v[d] = Lib_IntVector_Intrinsics_vec128_rotate_right32(Lib_IntVector_Intrinsics_vec128_xor(v[d], v[a]),
+      (uint32_t)8U);
+  v[c] = Lib_IntVector_Intrinsics_vec128_add32(v[c], v[d]);
+  v[b] = Lib_IntVector_Intrinsics_vec128_rotate_right32(Lib_IntVector_Intrinsics_vec128_xor(v[b], v[c]),
+      (uint32_t)7U);
+}
+
+/* Compress block m[l] into lane l of the group of four leaves `h`. `t` holds the byte counter
+   of each leaf after the block; `f0` and `f1` the last-block and last-node flags. */
+static void
+compress4(
+  Lib_IntVector_Intrinsics_vec128 *h,
+  uint8_t **m,
+  uint64_t *t,
+  Lib_IntVector_Intrinsics_vec128 f0,
+  Lib_IntVector_Intrinsics_vec128 f1
+)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 w[16U] KRML_POST_ALIGN(16);
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 v[16U] KRML_POST_ALIGN(16);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    w[i] =
+      Lib_IntVector_Intrinsics_vec128_load32s(load32_le(m[0U] + (uint32_t)4U * i),
+        load32_le(m[1U] + (uint32_t)4U * i),
+        load32_le(m[2U] + (uint32_t)4U * i),
+        load32_le(m[3U] + (uint32_t)4U * i));
+  }
+  memcpy(v, h, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec128));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    v[(uint32_t)8U + i] = Lib_IntVector_Intrinsics_vec128_load32(Hacl_Impl_Blake2_Constants_ivTable_S[i]);
+  }
+  v[12U] =
+    Lib_IntVector_Intrinsics_vec128_xor(v[12U],
+      Lib_IntVector_Intrinsics_vec128_load32s((uint32_t)t[0U],
+        (uint32_t)t[1U],
+        (uint32_t)t[2U],
+        (uint32_t)t[3U]));
+  v[13U] =
+    Lib_IntVector_Intrinsics_vec128_xor(v[13U],
+      Lib_IntVector_Intrinsics_vec128_load32s((uint32_t)(t[0U] >> (uint32_t)32U),
+        (uint32_t)(t[1U] >> (uint32_t)32U),
+        (uint32_t)(t[2U] >> (uint32_t)32U),
+        (uint32_t)(t[3U] >> (uint32_t)32U)));
+  v[14U] = Lib_IntVector_Intrinsics_vec128_xor(v[14U], f0);
+  v[15U] = Lib_IntVector_Intrinsics_vec128_xor(v[15U], f1);
+  for (uint32_t r = (uint32_t)0U; r < (uint32_t)10U; r++)
+  {
+    const uint32_t *s = Hacl_Impl_Blake2_Constants_sigmaTable + (uint32_t)16U * r;
+    g(v, (uint32_t)0U, (uint32_t)4U, (uint32_t)8U, (uint32_t)12U, w[s[0U]], w[s[1U]]);
+    g(v, (uint32_t)1U, (uint32_t)5U, (uint32_t)9U, (uint32_t)13U, w[s[2U]], w[s[3U]]);
+    g(v, (uint32_t)2U, (uint32_t)6U, (uint32_t)10U, (uint32_t)14U, w[s[4U]], w[s[5U]]);
+    g(v, (uint32_t)3U, (uint32_t)7U, (uint32_t)11U, (uint32_t)15U, w[s[6U]], w[s[7U]]);
+    g(v, (uint32_t)0U, (uint32_t)5U, (uint32_t)10U, (uint32_t)15U, w[s[8U]], w[s[9U]]);
+    g(v, (uint32_t)1U, (uint32_t)6U, (uint32_t)11U, (uint32_t)12U, w[s[10U]], w[s[11U]]);
+    g(v, (uint32_t)2U, (uint32_t)7U, (uint32_t)8U, (uint32_t)13U, w[s[12U]], w[s[13U]]);
+    g(v, (uint32_t)3U, (uint32_t)4U, (uint32_t)9U, (uint32_t)14U, w[s[14U]], w[s[15U]]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    h[i] =
+      Lib_IntVector_Intrinsics_vec128_xor(h[i],
+        Lib_IntVector_Intrinsics_vec128_xor(v[i], v[(uint32_t)8U + i]));
+  }
+}
+
+/* First word of the parameter block: digest length, key length, fanout 8 and depth 2. */
+static inline uint32_t param0(uint32_t kk, uint32_t nn)
+{
+  return nn ^ (kk << (uint32_t)8U ^ ((uint32_t)8U << (uint32_t)16U ^ (uint32_t)2U << (uint32_t)24U));
+}
+
+static void reset(Hacl_Blake2sp_128_state *s)
+{
+  const uint32_t *iv = Hacl_Impl_Blake2_Constants_ivTable_S;
+  for (uint32_t grp = (uint32_t)0U; grp < (uint32_t)2U; grp++)
+  {
+    Lib_IntVector_Intrinsics_vec128 *h = s->hash + (uint32_t)8U * grp;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      h[i] = Lib_IntVector_Intrinsics_vec128_load32(iv[i]);
+    }
+    /* Leaf i has node offset i, node depth 0 and an inner length of 32. */
+    uint32_t o = (uint32_t)4U * grp;
+    h[0U] = Lib_IntVector_Intrinsics_vec128_load32(iv[0U] ^ param0(s->key_len, s->digest_len));
+    h[2U] =
+      Lib_IntVector_Intrinsics_vec128_load32s(iv[2U] ^ o,
+        iv[2U] ^ (o + (uint32_t)1U),
+        iv[2U] ^ (o + (uint32_t)2U),
+        iv[2U] ^ (o + (uint32_t)3U));
+    h[3U] = Lib_IntVector_Intrinsics_vec128_load32(iv[3U] ^ (uint32_t)32U << (uint32_t)24U);
+  }
+  s->leaf_len = (uint64_t)0U;
+  memset(s->buf, 0U, (uint32_t)1024U * sizeof (uint8_t));
+  if (s->key_len == (uint32_t)0U)
+  {
+    s->buf_len = (uint32_t)0U;
+  }
+  else
+  {
+    /* Each leaf starts with the zero-padded key block, i.e. the message is prefixed with a
+       stripe of eight key blocks. */
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      memcpy(s->buf + (uint32_t)64U * i, s->key, s->key_len * sizeof (uint8_t));
+    }
+    s->buf_len = (uint32_t)512U;
+  }
+}
+
+static void compress_stripe(Hacl_Blake2sp_128_state *s, uint8_t *stripe)
+{
+  s->leaf_len = s->leaf_len + (uint64_t)64U;
+  uint64_t t[4U] = { s->leaf_len, s->leaf_len, s->leaf_len, s->leaf_len };
+  Lib_IntVector_Intrinsics_vec128 zero = Lib_IntVector_Intrinsics_vec128_zero;
+  for (uint32_t grp = (uint32_t)0U; grp < (uint32_t)2U; grp++)
+  {
+    uint8_t *b = stripe + (uint32_t)256U * grp;
+    uint8_t *m[4U] = { b, b + (uint32_t)64U, b + (uint32_t)128U, b + (uint32_t)192U };
+    compress4(s->hash + (uint32_t)8U * grp, m, t, zero, zero);
+  }
+}
+
+static void update(Hacl_Blake2sp_128_state *s, uint8_t *data, uint32_t len)
+{
+  /* A stripe is compressed only once more than seven blocks of data follow it, so that the
+     last block of every leaf remains buffered for the finish function. The buffer then never
+     holds more than 512 + 448 bytes. */
+  uint32_t n = (uint32_t)0U;
+  while (true)
+  {
+    uint32_t rest = len - n;
+    if (s->buf_len >= (uint32_t)512U && s->buf_len - (uint32_t)512U + rest > (uint32_t)448U)
+    {
+      compress_stripe(s, s->buf);
+      memmove(s->buf, s->buf + (uint32_t)512U, (s->buf_len - (uint32_t)512U) * sizeof (uint8_t));
+      s->buf_len = s->buf_len - (uint32_t)512U;
+    }
+    else if (s->buf_len == (uint32_t)0U && rest > (uint32_t)960U)
+    {
+      compress_stripe(s, data + n);
+      n = n + (uint32_t)512U;
+    }
+    else
+    {
+      uint32_t cap;
+      if (s->buf_len < (uint32_t)512U)
+      {
+        cap = (uint32_t)512U - s->buf_len;
+      }
+      else
+      {
+        cap = (uint32_t)960U - s->buf_len;
+      }
+      uint32_t c = rest < cap ? rest : cap;
+      if (c == (uint32_t)0U)
+      {
+        return;
+      }
+      memcpy(s->buf + s->buf_len, data + n, c * sizeof (uint8_t));
+      s->buf_len = s->buf_len + c;
+      n = n + c;
+    }
+  }
+}
+
+static inline uint32_t clamp_block(uint32_t r, uint32_t off)
+{
+  if (r <= off)
+  {
+    return (uint32_t)0U;
+  }
+  if (r - off >= (uint32_t)64U)
+  {
+    return (uint32_t)64U;
+  }
+  return r - off;
+}
+
+static void finish(Hacl_Blake2sp_128_state *s, uint8_t *dst)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 h[16U] KRML_POST_ALIGN(16);
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 h0[8U] KRML_POST_ALIGN(16);
+  uint8_t b[1024U] = { 0U };
+  uint8_t leaves[256U] = { 0U };
+  uint8_t tmp[128U] = { 0U };
+  memcpy(h, s->hash, (uint32_t)16U * sizeof (Lib_IntVector_Intrinsics_vec128));
+  memcpy(b, s->buf, s->buf_len * sizeof (uint8_t));
+  uint32_t r = s->buf_len;
+  uint64_t l = s->leaf_len;
+  uint32_t len1[8U];
+  uint32_t len2[8U];
+  uint32_t last[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    len1[i] = clamp_block(r, (uint32_t)64U * i);
+    len2[i] = clamp_block(r, (uint32_t)512U + (uint32_t)64U * i);
+    last[i] = (uint32_t)0U - (uint32_t)(len2[i] == (uint32_t)0U);
+  }
+  Lib_IntVector_Intrinsics_vec128 ones = Lib_IntVector_Intrinsics_vec128_load32((uint32_t)0xFFFFFFFFU);
+  for (uint32_t grp = (uint32_t)0U; grp < (uint32_t)2U; grp++)
+  {
+    Lib_IntVector_Intrinsics_vec128 *hg = h + (uint32_t)8U * grp;
+    uint32_t o = (uint32_t)4U * grp;
+    uint32_t f1_3 = grp == (uint32_t)1U ? last[7U] : (uint32_t)0U;
+    /* The buffered blocks of the first stripe; final for the leaves with nothing after them.
+       A leaf that received no data at all compresses an empty final block. */
+    uint8_t
+    *m1[4U] =
+      {
+        b + (uint32_t)64U * o,
+        b + (uint32_t)64U * (o + (uint32_t)1U),
+        b + (uint32_t)64U * (o + (uint32_t)2U),
+        b + (uint32_t)64U * (o + (uint32_t)3U)
+      };
+    uint64_t
+    t1[4U] =
+      {
+        l + (uint64_t)len1[o],
+        l + (uint64_t)len1[o + (uint32_t)1U],
+        l + (uint64_t)len1[o + (uint32_t)2U],
+        l + (uint64_t)len1[o + (uint32_t)3U]
+      };
+    compress4(hg,
+      m1,
+      t1,
+      Lib_IntVector_Intrinsics_vec128_load32s(last[o],
+        last[o + (uint32_t)1U],
+        last[o + (uint32_t)2U],
+        last[o + (uint32_t)3U]),
+      Lib_IntVector_Intrinsics_vec128_load32s((uint32_t)0U, (uint32_t)0U, (uint32_t)0U, f1_3));
+    if (len2[o] > (uint32_t)0U)
+    {
+      /* The final blocks in the second stripe; the other leaves keep their finalized state. */
+      uint8_t
+      *m2[4U] =
+        {
+          b + (uint32_t)512U + (uint32_t)64U * o,
+          b + (uint32_t)512U + (uint32_t)64U * (o + (uint32_t)1U),
+          b + (uint32_t)512U + (uint32_t)64U * (o + (uint32_t)2U),
+          b + (uint32_t)512U + (uint32_t)64U * (o + (uint32_t)3U)
+        };
+      uint64_t
+      t2[4U] =
+        {
+          l + (uint64_t)64U + (uint64_t)len2[o],
+          l + (uint64_t)64U + (uint64_t)len2[o + (uint32_t)1U],
+          l + (uint64_t)64U + (uint64_t)len2[o + (uint32_t)2U],
+          l + (uint64_t)64U + (uint64_t)len2[o + (uint32_t)3U]
+        };
+      Lib_IntVector_Intrinsics_vec128
+      keep =
+        Lib_IntVector_Intrinsics_vec128_load32s(last[o],
+          last[o + (uint32_t)1U],
+          last[o + (uint32_t)2U],
+          last[o + (uint32_t)3U]);
+      memcpy(h0, hg, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec128));
+      compress4(hg,
+        m2,
+        t2,
+        ones,
+        Lib_IntVector_Intrinsics_vec128_load32s((uint32_t)0U,
+          (uint32_t)0U,
+          (uint32_t)0U,
+          grp == (uint32_t)1U ? (uint32_t)0xFFFFFFFFU : (uint32_t)0U));
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+      {
+        hg[j] =
+          Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_and(h0[j], keep),
+            Lib_IntVector_Intrinsics_vec128_and(hg[j], Lib_IntVector_Intrinsics_vec128_lognot(keep)));
+      }
+    }
+    /* Leaf 4 * grp + l's 32-byte digest is lane l of the group's chaining value. */
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      Lib_IntVector_Intrinsics_vec128_store32_le(tmp + (uint32_t)16U * j, hg[j]);
+    }
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+      {
+        memcpy(leaves + (uint32_t)32U * (o + i) + (uint32_t)4U * j,
+          tmp + (uint32_t)16U * j + (uint32_t)4U * i,
+          (uint32_t)4U * sizeof (uint8_t));
+      }
+    }
+  }
+  /* The root node (node depth 1, last node) hashes the eight leaf digests; it is computed
+     identically in all lanes. */
+  const uint32_t *iv = Hacl_Impl_Blake2_Constants_ivTable_S;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    h[i] = Lib_IntVector_Intrinsics_vec128_load32(iv[i]);
+  }
+  h[0U] = Lib_IntVector_Intrinsics_vec128_load32(iv[0U] ^ param0(s->key_len, s->digest_len));
+  h[3U] =
+    Lib_IntVector_Intrinsics_vec128_load32(iv[3U]
+      ^ ((uint32_t)1U << (uint32_t)16U ^ (uint32_t)32U << (uint32_t)24U));
+  Lib_IntVector_Intrinsics_vec128 zero = Lib_IntVector_Intrinsics_vec128_zero;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *blk = leaves + (uint32_t)64U * i;
+    uint8_t *m[4U] = { blk, blk, blk, blk };
+    uint64_t c = (uint64_t)64U * (uint64_t)(i + (uint32_t)1U);
+    uint64_t t[4U] = { c, c, c, c };
+    if (i == (uint32_t)3U)
+    {
+      compress4(h, m, t, ones, ones);
+    }
+    else
+    {
+      compress4(h, m, t, zero, zero);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store32_le(tmp + (uint32_t)16U * j, h[j]);
+    memcpy(leaves + (uint32_t)4U * j, tmp + (uint32_t)16U * j, (uint32_t)4U * sizeof (uint8_t));
+  }
+  memcpy(dst, leaves, s->digest_len * sizeof (uint8_t));
+  Lib_Memzero0_memzero(h, (uint32_t)16U * sizeof (h[0U]));
+  Lib_Memzero0_memzero(h0, (uint32_t)8U * sizeof (h0[0U]));
+  Lib_Memzero0_memzero(b, (uint32_t)1024U * sizeof (b[0U]));
+  Lib_Memzero0_memzero(leaves, (uint32_t)256U * sizeof (leaves[0U]));
+  Lib_Memzero0_memzero(tmp, (uint32_t)128U * sizeof (tmp[0U]));
+}
+
+/**
+  Write the BLAKE2sp digest of message `d` using key `k` into `output`.
+
+  BLAKE2sp hashes the message as eight interleaved BLAKE2s leaves of 64-byte blocks, computed
+  four at a time in the lanes of 128-bit vectors, and a root node over the leaf digests.
+
+  @param nn Length of the digest, between 1 and 32.
+  @param output Pointer to `nn` bytes of memory where the digest is written to.
+  @param ll Length of the input message.
+  @param d Pointer to `ll` bytes of memory where the input message is read from.
+  @param kk Length of the key, at most 32.
+  @param k Pointer to `kk` bytes of memory where the key is read from.
+*/
+void
+Hacl_Blake2sp_128_blake2sp(
+  uint32_t nn,
+  uint8_t *output,
+  uint32_t ll,
+  uint8_t *d,
+  uint32_t kk,
+  uint8_t *k
+)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 hash[16U] KRML_POST_ALIGN(16);
+  uint8_t buf[1024U];
+  Hacl_Blake2sp_128_state s = { .hash = hash, .buf = buf, .key_len = kk, .digest_len = nn };
+  memcpy(s.key, k, kk * sizeof (uint8_t));
+  reset(&s);
+  update(&s, d, ll);
+  finish(&s, output);
+  Lib_Memzero0_memzero(hash, (uint32_t)16U * sizeof (hash[0U]));
+  Lib_Memzero0_memzero(buf, (uint32_t)1024U * sizeof (buf[0U]));
+  Lib_Memzero0_memzero(s.key, (uint32_t)32U * sizeof (s.key[0U]));
+}
+
+/**
+  State allocation function; returns NULL if `key_len` or `digest_len` is out of range.
+*/
+Hacl_Blake2sp_128_state
+*Hacl_Blake2sp_128_create_in(uint8_t *key, uint32_t key_len, uint32_t digest_len)
+{
+  if (key_len > (uint32_t)32U || digest_len == (uint32_t)0U || digest_len > (uint32_t)32U)
+  {
+    return NULL;
+  }
+  Hacl_Blake2sp_128_state *s = KRML_HOST_CALLOC((uint32_t)1U, sizeof (Hacl_Blake2sp_128_state));
+  Lib_IntVector_Intrinsics_vec128
+  *hash = KRML_ALIGNED_MALLOC(16, sizeof (Lib_IntVector_Intrinsics_vec128) * (uint32_t)16U);
+  s->hash = hash;
+  s->buf = KRML_HOST_CALLOC((uint32_t)1024U, sizeof (uint8_t));
+  memcpy(s->key, key, key_len * sizeof (uint8_t));
+  s->key_len = key_len;
+  s->digest_len = digest_len;
+  reset(s);
+  return s;
+}
+
+/**
+  (Re-)initialization function
+*/
+void Hacl_Blake2sp_128_init(Hacl_Blake2sp_128_state *s)
+{
+  reset(s);
+}
+
+/**
+  Update function
+*/
+void Hacl_Blake2sp_128_update(Hacl_Blake2sp_128_state *s, uint8_t *data, uint32_t len)
+{
+  update(s, data, len);
+}
+
+/**
+  Finish function; writes `digest_len` bytes to `dst` and leaves the state unchanged.
+*/
+void Hacl_Blake2sp_128_finish(Hacl_Blake2sp_128_state *s, uint8_t *dst)
+{
+  finish(s, dst);
+}
+
+/**
+  Free state function
+*/
+void Hacl_Blake2sp_128_free(Hacl_Blake2sp_128_state *s)
+{
+  Lib_Memzero0_memzero(s->hash, (uint32_t)16U * sizeof (s->hash[0U]));
+  Lib_Memzero0_memzero(s->buf, (uint32_t)1024U * sizeof (s->buf[0U]));
+  Lib_Memzero0_memzero(s->key, (uint32_t)32U * sizeof (s->key[0U]));
+  KRML_ALIGNED_FREE(s->hash);
+  KRML_HOST_FREE(s->buf);
+  KRML_HOST_FREE(s);
+}
+
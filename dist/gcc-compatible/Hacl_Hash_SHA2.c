@@ -513,7 +513,7 @@ static void pad_384(FStar_UInt128_uint128 len, uint8_t *dst)
   store128_be(dst3, len_);
 }
 
-static void pad_512(FStar_UInt128_uint128 len, uint8_t *dst)
+void Hacl_Hash_Core_SHA2_pad_512(FStar_UInt128_uint128 len, uint8_t *dst)
 {
   uint8_t *dst1 = dst;
   dst1[0U] = (uint8_t)0x80U;
@@ -759,7 +759,7 @@ Hacl_Hash_SHA2_update_last_512(
   uint8_t *tmp_rest = tmp;
   uint8_t *tmp_pad = tmp + rest_len;
   memcpy(tmp_rest, rest, rest_len * sizeof (uint8_t));
-  pad_512(total_input_len, tmp_pad);
+  Hacl_Hash_Core_SHA2_pad_512(total_input_len, tmp_pad);
   Hacl_Hash_SHA2_update_multi_512(s, tmp, tmp_len / (uint32_t)128U);
 }
 
@@ -25,6 +25,8 @@
 #include "internal/Hacl_K256_ECDSA.h"
 
 #include "internal/Hacl_Krmllib.h"
+#include "internal/Hacl_K256_PrecompTable.h"
+#include "Hacl_Streaming_SHA2.h"
 
 static inline uint64_t
 bn_add(uint32_t aLen, uint64_t *a, uint32_t bLen, uint64_t *b, uint64_t *res)
@@ -989,146 +991,282 @@ void Hacl_Impl_K256_PointMul_point_mul(uint64_t *out, uint64_t *scalar, uint64_t
 }
 
 static inline void
-point_mul_double_vartime(
-  uint64_t *out,
-  uint64_t *scalar1,
-  uint64_t *q1,
-  uint64_t *scalar2,
-  uint64_t *q2
-)
+precomp_get_consttime(const uint64_t *table, uint64_t bits_l, uint64_t *tmp)
 {
-  uint64_t table1[240U] = { 0U };
-  uint64_t tmp0[15U] = { 0U };
-  uint64_t *t00 = table1;
-  uint64_t *t10 = table1 + (uint32_t)15U;
-  Hacl_Impl_K256_PointMul_make_point_at_inf(t00);
-  memcpy(t10, q1, (uint32_t)15U * sizeof (uint64_t));
-  KRML_MAYBE_FOR7(i,
+  memcpy(tmp, (uint64_t *)table, (uint32_t)15U * sizeof (uint64_t));
+  KRML_MAYBE_FOR15(i0,
     (uint32_t)0U,
-    (uint32_t)7U,
+    (uint32_t)15U,
     (uint32_t)1U,
-    uint64_t *t11 = table1 + (i + (uint32_t)1U) * (uint32_t)15U;
-    Hacl_Impl_K256_PointDouble_point_double(tmp0, t11);
-    memcpy(table1 + ((uint32_t)2U * i + (uint32_t)2U) * (uint32_t)15U,
-      tmp0,
-      (uint32_t)15U * sizeof (uint64_t));
-    uint64_t *t2 = table1 + ((uint32_t)2U * i + (uint32_t)2U) * (uint32_t)15U;
-    Hacl_Impl_K256_PointAdd_point_add(tmp0, q1, t2);
-    memcpy(table1 + ((uint32_t)2U * i + (uint32_t)3U) * (uint32_t)15U,
-      tmp0,
-      (uint32_t)15U * sizeof (uint64_t)););
-  uint64_t table2[240U] = { 0U };
+    uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i0 + (uint32_t)1U));
+    const uint64_t *res_j = table + (i0 + (uint32_t)1U) * (uint32_t)15U;
+    KRML_MAYBE_FOR15(i,
+      (uint32_t)0U,
+      (uint32_t)15U,
+      (uint32_t)1U,
+      uint64_t *os = tmp;
+      uint64_t x = (c & res_j[i]) | (~c & tmp[i]);
+      os[i] = x;););
+}
+
+/* Fixed-base scalar multiplication with the precomputed tables of
+   [i]G, [i * 2^64]G, [i * 2^128]G and [i * 2^192]G (0 <= i < 16). The scalar
+   is split into four 64-bit chunks that are processed simultaneously with
+   4-bit windows, so only 64 doublings are needed. The table lookups are
+   constant-time and point_add is complete, so the whole computation is
+   constant-time in the scalar. */
+static inline void point_mul_g(uint64_t *out, uint64_t *scalar)
+{
   uint64_t tmp[15U] = { 0U };
-  uint64_t *t0 = table2;
-  uint64_t *t1 = table2 + (uint32_t)15U;
-  Hacl_Impl_K256_PointMul_make_point_at_inf(t0);
-  memcpy(t1, q2, (uint32_t)15U * sizeof (uint64_t));
-  KRML_MAYBE_FOR7(i,
-    (uint32_t)0U,
-    (uint32_t)7U,
-    (uint32_t)1U,
-    uint64_t *t11 = table2 + (i + (uint32_t)1U) * (uint32_t)15U;
-    Hacl_Impl_K256_PointDouble_point_double(tmp, t11);
-    memcpy(table2 + ((uint32_t)2U * i + (uint32_t)2U) * (uint32_t)15U,
-      tmp,
-      (uint32_t)15U * sizeof (uint64_t));
-    uint64_t *t2 = table2 + ((uint32_t)2U * i + (uint32_t)2U) * (uint32_t)15U;
-    Hacl_Impl_K256_PointAdd_point_add(tmp, q2, t2);
-    memcpy(table2 + ((uint32_t)2U * i + (uint32_t)3U) * (uint32_t)15U,
-      tmp,
-      (uint32_t)15U * sizeof (uint64_t)););
   Hacl_Impl_K256_PointMul_make_point_at_inf(out);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
   {
     KRML_MAYBE_FOR4(i0,
       (uint32_t)0U,
       (uint32_t)4U,
       (uint32_t)1U,
       Hacl_Impl_K256_PointDouble_point_double(out, out););
-    uint32_t bk = (uint32_t)256U;
-    uint64_t mask_l0 = (uint64_t)15U;
-    uint32_t i10 = (bk - (uint32_t)4U * i - (uint32_t)4U) / (uint32_t)64U;
-    uint32_t j0 = (bk - (uint32_t)4U * i - (uint32_t)4U) % (uint32_t)64U;
-    uint64_t p10 = scalar2[i10] >> j0;
-    uint64_t ite0;
-    if (i10 + (uint32_t)1U < (uint32_t)4U && (uint32_t)0U < j0)
+    uint32_t k = (uint32_t)60U - (uint32_t)4U * i;
+    uint64_t bits_l3 = scalar[3U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_K256_PrecompTable_precomp_g_pow2_192_table_w4, bits_l3, tmp);
+    Hacl_Impl_K256_PointAdd_point_add(out, out, tmp);
+    uint64_t bits_l2 = scalar[2U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_K256_PrecompTable_precomp_g_pow2_128_table_w4, bits_l2, tmp);
+    Hacl_Impl_K256_PointAdd_point_add(out, out, tmp);
+    uint64_t bits_l1 = scalar[1U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_K256_PrecompTable_precomp_g_pow2_64_table_w4, bits_l1, tmp);
+    Hacl_Impl_K256_PointAdd_point_add(out, out, tmp);
+    uint64_t bits_l0 = scalar[0U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_K256_PrecompTable_precomp_basepoint_table_w4, bits_l0, tmp);
+    Hacl_Impl_K256_PointAdd_point_add(out, out, tmp);
+  }
+}
+
+/* The endomorphism lambda * (x, y) = (beta * x, y) of secp256k1. It also
+   applies to projective points, since it only rescales x. */
+static inline void point_mul_lambda(uint64_t *out, uint64_t *p)
+{
+  uint64_t beta[5U] = { 0U };
+  beta[0U] = (uint64_t)0x96c28719501eeU;
+  beta[1U] = (uint64_t)0x7512f58995c13U;
+  beta[2U] = (uint64_t)0xc3434e99cf049U;
+  beta[3U] = (uint64_t)0x7106e64479eaU;
+  beta[4U] = (uint64_t)0x7ae96a2b657cU;
+  Hacl_K256_Field_fmul(out, p, beta);
+  memcpy(out + (uint32_t)5U, p + (uint32_t)5U, (uint32_t)10U * sizeof (uint64_t));
+}
+
+/* out = round(a * b / 2^384) */
+static inline void qmul_shift_384(uint64_t *out, uint64_t *a, uint64_t *b)
+{
+  uint64_t l[8U] = { 0U };
+  mul4(a, b, l);
+  uint64_t rnd = l[5U] >> (uint32_t)63U;
+  uint64_t c = Lib_IntTypes_Intrinsics_add_carry_u64((uint64_t)0U, l[6U], rnd, out);
+  uint64_t
+  c1 = Lib_IntTypes_Intrinsics_add_carry_u64(c, l[7U], (uint64_t)0U, out + (uint32_t)1U);
+  out[2U] = c1;
+  out[3U] = (uint64_t)0U;
+}
+
+/* Splits k into r1 + r2 * lambda = k (mod q) with |r1|, |r2| < 2^128, using
+   the lattice basis and rounding constants g1 = round(2^384 * b2 / q) and
+   g2 = round(2^384 * (-b1) / q) of the secp256k1 GLV decomposition. */
+static inline void scalar_split_lambda(uint64_t *r1, uint64_t *r2, uint64_t *k)
+{
+  uint64_t tmp1[4U] = { 0U };
+  uint64_t tmp2[4U] = { 0U };
+  tmp1[0U] = (uint64_t)0xe893209a45dbb031U;
+  tmp1[1U] = (uint64_t)0x3daa8a1471e8ca7fU;
+  tmp1[2U] = (uint64_t)0xe86c90e49284eb15U;
+  tmp1[3U] = (uint64_t)0x3086d221a7d46bcdU;
+  tmp2[0U] = (uint64_t)0x1571b4ae8ac47f71U;
+  tmp2[1U] = (uint64_t)0x221208ac9df506c6U;
+  tmp2[2U] = (uint64_t)0x6f547fa90abfe4c4U;
+  tmp2[3U] = (uint64_t)0xe4437ed6010e8828U;
+  qmul_shift_384(r1, k, tmp1);
+  qmul_shift_384(r2, k, tmp2);
+  tmp1[0U] = (uint64_t)0x6f547fa90abfe4c3U;
+  tmp1[1U] = (uint64_t)0xe4437ed6010e8828U;
+  tmp1[2U] = (uint64_t)0x0U;
+  tmp1[3U] = (uint64_t)0x0U;
+  tmp2[0U] = (uint64_t)0xd765cda83db1562cU;
+  tmp2[1U] = (uint64_t)0x8a280ac50774346dU;
+  tmp2[2U] = (uint64_t)0xfffffffffffffffeU;
+  tmp2[3U] = (uint64_t)0xffffffffffffffffU;
+  qmul(r1, r1, tmp1);
+  qmul(r2, r2, tmp2);
+  qadd(r2, r1, r2);
+  tmp1[0U] = (uint64_t)0xe0cfc810b51283cfU;
+  tmp1[1U] = (uint64_t)0xa880b9fc8ec739c2U;
+  tmp1[2U] = (uint64_t)0x5ad9e3fd77ed9ba4U;
+  tmp1[3U] = (uint64_t)0xac9c52b33fa3cf1fU;
+  qmul(r1, r2, tmp1);
+  qadd(r1, k, r1);
+}
+
+/* Replaces a split component by its absolute value, returning whether it was
+   negative (i.e. larger than q / 2). */
+static inline bool qabs_vartime(uint64_t *f)
+{
+  bool is_high = !is_qelem_le_q_halved_vartime(f);
+  qnegate_conditional_vartime(f, is_high);
+  return is_high;
+}
+
+/* Computes the width-w non-adjacent form of a scalar s < 2^129: every non-zero
+   digit is odd and less than 2^(w - 1) in absolute value. The digits are
+   negated if is_negate is set. Returns the number of digits (at most 130). */
+static inline uint32_t
+wnaf_vartime(int32_t *wnaf, uint64_t *s, uint32_t w, bool is_negate)
+{
+  uint32_t len = (uint32_t)130U;
+  uint32_t res = (uint32_t)0U;
+  uint32_t carry = (uint32_t)0U;
+  uint32_t bit = (uint32_t)0U;
+  memset(wnaf, 0U, len * sizeof (int32_t));
+  while (bit < len)
+  {
+    uint32_t i = bit / (uint32_t)64U;
+    uint32_t j = bit % (uint32_t)64U;
+    uint64_t word = s[i] >> j;
+    if (j > (uint32_t)0U && i + (uint32_t)1U < (uint32_t)4U)
     {
-      ite0 = p10 | scalar2[i10 + (uint32_t)1U] << ((uint32_t)64U - j0);
+      word = word | s[i + (uint32_t)1U] << ((uint32_t)64U - j);
     }
-    else
+    if ((uint32_t)(word & (uint64_t)1U) == carry)
     {
-      ite0 = p10;
+      bit++;
+      continue;
     }
-    uint64_t bits_l = ite0 & mask_l0;
-    uint64_t a_bits_l0[15U] = { 0U };
-    uint32_t bits_l320 = (uint32_t)bits_l;
-    uint64_t *a_bits_l1 = table2 + bits_l320 * (uint32_t)15U;
-    memcpy(a_bits_l0, a_bits_l1, (uint32_t)15U * sizeof (uint64_t));
-    Hacl_Impl_K256_PointAdd_point_add(out, out, a_bits_l0);
-    uint32_t bk0 = (uint32_t)256U;
-    uint64_t mask_l = (uint64_t)15U;
-    uint32_t i1 = (bk0 - (uint32_t)4U * i - (uint32_t)4U) / (uint32_t)64U;
-    uint32_t j = (bk0 - (uint32_t)4U * i - (uint32_t)4U) % (uint32_t)64U;
-    uint64_t p1 = scalar1[i1] >> j;
-    uint64_t ite;
-    if (i1 + (uint32_t)1U < (uint32_t)4U && (uint32_t)0U < j)
+    uint32_t now = w;
+    if (now > len - bit)
     {
-      ite = p1 | scalar1[i1 + (uint32_t)1U] << ((uint32_t)64U - j);
+      now = len - bit;
     }
-    else
+    int32_t d = (int32_t)(word & (((uint64_t)1U << now) - (uint64_t)1U)) + (int32_t)carry;
+    carry = (uint32_t)(d >> (w - (uint32_t)1U)) & (uint32_t)1U;
+    d = d - (int32_t)(carry << w);
+    if (is_negate)
     {
-      ite = p1;
+      d = -d;
     }
-    uint64_t bits_l0 = ite & mask_l;
-    uint64_t a_bits_l[15U] = { 0U };
-    uint32_t bits_l32 = (uint32_t)bits_l0;
-    uint64_t *a_bits_l10 = table1 + bits_l32 * (uint32_t)15U;
-    memcpy(a_bits_l, a_bits_l10, (uint32_t)15U * sizeof (uint64_t));
-    Hacl_Impl_K256_PointAdd_point_add(out, out, a_bits_l);
+    wnaf[bit] = d;
+    res = bit + (uint32_t)1U;
+    bit = bit + now;
   }
+  return res;
 }
 
-static inline void point_mul_g(uint64_t *out, uint64_t *scalar)
+static inline void point_add_wnaf_digit(uint64_t *out, const uint64_t *table, int32_t d)
 {
-  uint64_t g[15U] = { 0U };
-  uint64_t *gx = g;
-  uint64_t *gy = g + (uint32_t)5U;
-  uint64_t *gz = g + (uint32_t)10U;
-  gx[0U] = (uint64_t)0x2815b16f81798U;
-  gx[1U] = (uint64_t)0xdb2dce28d959fU;
-  gx[2U] = (uint64_t)0xe870b07029bfcU;
-  gx[3U] = (uint64_t)0xbbac55a06295cU;
-  gx[4U] = (uint64_t)0x79be667ef9dcU;
-  gy[0U] = (uint64_t)0x7d08ffb10d4b8U;
-  gy[1U] = (uint64_t)0x48a68554199c4U;
-  gy[2U] = (uint64_t)0xe1108a8fd17b4U;
-  gy[3U] = (uint64_t)0xc4655da4fbfc0U;
-  gy[4U] = (uint64_t)0x483ada7726a3U;
-  memset(gz, 0U, (uint32_t)5U * sizeof (uint64_t));
-  gz[0U] = (uint64_t)1U;
-  Hacl_Impl_K256_PointMul_point_mul(out, scalar, g);
+  if (d > (int32_t)0)
+  {
+    uint64_t *p = (uint64_t *)table + (uint32_t)(d / (int32_t)2) * (uint32_t)15U;
+    Hacl_Impl_K256_PointAdd_point_add(out, out, p);
+  }
+  else if (d < (int32_t)0)
+  {
+    uint64_t tmp[15U] = { 0U };
+    uint64_t *p = (uint64_t *)table + (uint32_t)(-d / (int32_t)2) * (uint32_t)15U;
+    Hacl_Impl_K256_Point_point_negate(tmp, p);
+    Hacl_Impl_K256_PointAdd_point_add(out, out, tmp);
+  }
+}
+
+/* Fills table with [1]Q, [3]Q, ..., [15]Q and table_lambda with their images
+   under the endomorphism. */
+static inline void precomp_odd_table_w5(uint64_t *table, uint64_t *table_lambda, uint64_t *q)
+{
+  uint64_t q_double[15U] = { 0U };
+  memcpy(table, q, (uint32_t)15U * sizeof (uint64_t));
+  Hacl_Impl_K256_PointDouble_point_double(q_double, q);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    Hacl_Impl_K256_PointAdd_point_add(table + i * (uint32_t)15U,
+      table + (i - (uint32_t)1U) * (uint32_t)15U,
+      q_double);
+  }
+  if (table_lambda != NULL)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      point_mul_lambda(table_lambda + i * (uint32_t)15U, table + i * (uint32_t)15U);
+    }
+  }
 }
 
+/* Splits k with the GLV endomorphism and computes the width-w NAFs of both
+   halves. Returns the number of digits of the longer one. */
+static inline uint32_t
+wnaf_split_lambda_vartime(int32_t *wnaf1, int32_t *wnaf2, uint64_t *k, uint32_t w)
+{
+  uint64_t r1[4U] = { 0U };
+  uint64_t r2[4U] = { 0U };
+  scalar_split_lambda(r1, r2, k);
+  bool is_high1 = qabs_vartime(r1);
+  bool is_high2 = qabs_vartime(r2);
+  uint32_t len1 = wnaf_vartime(wnaf1, r1, w, is_high1);
+  uint32_t len2 = wnaf_vartime(wnaf2, r2, w, is_high2);
+  if (len1 > len2)
+  {
+    return len1;
+  }
+  return len2;
+}
+
+/* out = [scalar1]G + [scalar2]Q (variable time, for public scalars only),
+   given the tables of odd multiples of Q and lambda(Q) built by
+   precomp_odd_table_w5. Both scalars are split with the GLV endomorphism into
+   four ~128-bit halves that share a single chain of ~129 doublings. The halves
+   multiplying G and lambda(G) use width-7 NAFs over the static tables of odd
+   multiples; the halves multiplying Q and lambda(Q) use width-5 NAFs. */
 static inline void
-point_mul_g_double_vartime(uint64_t *out, uint64_t *scalar1, uint64_t *scalar2, uint64_t *q2)
-{
-  uint64_t g[15U] = { 0U };
-  uint64_t *gx = g;
-  uint64_t *gy = g + (uint32_t)5U;
-  uint64_t *gz = g + (uint32_t)10U;
-  gx[0U] = (uint64_t)0x2815b16f81798U;
-  gx[1U] = (uint64_t)0xdb2dce28d959fU;
-  gx[2U] = (uint64_t)0xe870b07029bfcU;
-  gx[3U] = (uint64_t)0xbbac55a06295cU;
-  gx[4U] = (uint64_t)0x79be667ef9dcU;
-  gy[0U] = (uint64_t)0x7d08ffb10d4b8U;
-  gy[1U] = (uint64_t)0x48a68554199c4U;
-  gy[2U] = (uint64_t)0xe1108a8fd17b4U;
-  gy[3U] = (uint64_t)0xc4655da4fbfc0U;
-  gy[4U] = (uint64_t)0x483ada7726a3U;
-  memset(gz, 0U, (uint32_t)5U * sizeof (uint64_t));
-  gz[0U] = (uint64_t)1U;
-  point_mul_double_vartime(out, scalar1, g, scalar2, q2);
+point_mul_g_double_split_lambda_table(
+  uint64_t *out,
+  uint64_t *scalar1,
+  uint64_t *scalar2,
+  uint64_t *table2,
+  uint64_t *table2_lambda
+)
+{
+  int32_t wnaf11[130U] = { 0U };
+  int32_t wnaf12[130U] = { 0U };
+  int32_t wnaf21[130U] = { 0U };
+  int32_t wnaf22[130U] = { 0U };
+  uint32_t len1 = wnaf_split_lambda_vartime(wnaf11, wnaf12, scalar1, (uint32_t)7U);
+  uint32_t len2 = wnaf_split_lambda_vartime(wnaf21, wnaf22, scalar2, (uint32_t)5U);
+  uint32_t len = len1;
+  if (len2 > len)
+  {
+    len = len2;
+  }
+  Hacl_Impl_K256_PointMul_make_point_at_inf(out);
+  for (uint32_t i = len; i > (uint32_t)0U; i--)
+  {
+    uint32_t k = i - (uint32_t)1U;
+    Hacl_Impl_K256_PointDouble_point_double(out, out);
+    point_add_wnaf_digit(out, Hacl_K256_PrecompTable_precomp_basepoint_odd_table_w7, wnaf11[k]);
+    point_add_wnaf_digit(out,
+      Hacl_K256_PrecompTable_precomp_lambda_basepoint_odd_table_w7,
+      wnaf12[k]);
+    point_add_wnaf_digit(out, table2, wnaf21[k]);
+    point_add_wnaf_digit(out, table2_lambda, wnaf22[k]);
+  }
+}
+
+static inline void
+point_mul_g_double_split_lambda_vartime(
+  uint64_t *out,
+  uint64_t *scalar1,
+  uint64_t *scalar2,
+  uint64_t *q2
+)
+{
+  uint64_t table2[120U] = { 0U };
+  uint64_t table2_lambda[120U] = { 0U };
+  precomp_odd_table_w5(table2, table2_lambda, q2);
+  point_mul_g_double_split_lambda_table(out, scalar1, scalar2, table2, table2_lambda);
 }
 
 static inline bool load_public_key(uint8_t *pk, uint64_t *fpk_x, uint64_t *fpk_y)
@@ -1169,6 +1307,46 @@ static inline bool fmul_eq_vartime(uint64_t *r, uint64_t *z, uint64_t *x)
   return b;
 }
 
+/* Checks that the affine x-coordinate of p (which must be [u1]G + [u2]Q) is r
+   modulo the order, without inverting the z-coordinate. */
+static inline bool ecdsa_verify_avoid_finv(uint64_t *res, uint64_t *r_q)
+{
+  uint64_t tmp[5U] = { 0U };
+  uint64_t *pz = res + (uint32_t)10U;
+  Hacl_K256_Field_fnormalize(tmp, pz);
+  bool b = Hacl_K256_Field_is_felem_zero_vartime(tmp);
+  if (b)
+  {
+    return false;
+  }
+  uint64_t *x = res;
+  uint64_t *z1 = res + (uint32_t)10U;
+  uint8_t r_bytes[32U] = { 0U };
+  uint64_t r_fe[5U] = { 0U };
+  uint64_t tmp_q[5U] = { 0U };
+  uint64_t tmp_x[5U] = { 0U };
+  store_qelem(r_bytes, r_q);
+  Hacl_K256_Field_load_felem(r_fe, r_bytes);
+  Hacl_K256_Field_fnormalize(tmp_x, x);
+  bool is_rz_x = fmul_eq_vartime(r_fe, z1, tmp_x);
+  if (!is_rz_x)
+  {
+    bool is_r_lt_p_m_q = Hacl_K256_Field_is_felem_lt_prime_minus_order_vartime(r_fe);
+    if (is_r_lt_p_m_q)
+    {
+      tmp_q[0U] = (uint64_t)0x25e8cd0364141U;
+      tmp_q[1U] = (uint64_t)0xe6af48a03bbfdU;
+      tmp_q[2U] = (uint64_t)0xffffffebaaedcU;
+      tmp_q[3U] = (uint64_t)0xfffffffffffffU;
+      tmp_q[4U] = (uint64_t)0xffffffffffffU;
+      Hacl_K256_Field_fadd(tmp_q, r_fe, tmp_q);
+      return fmul_eq_vartime(tmp_q, z1, tmp_x);
+    }
+    return false;
+  }
+  return true;
+}
+
 /*******************************************************************************
   Verified C library for ECDSA signing and verification on the secp256k1 curve.
 
@@ -1318,41 +1496,9 @@ Hacl_K256_ECDSA_ecdsa_verify_hashed_msg(uint8_t *m, uint8_t *public_key, uint8_t
   qinv(sinv, s_q);
   qmul(u1, z, sinv);
   qmul(u2, r_q, sinv);
-  point_mul_g_double_vartime(res, u1, u2, p);
-  uint64_t tmp[5U] = { 0U };
-  uint64_t *pz = res + (uint32_t)10U;
-  Hacl_K256_Field_fnormalize(tmp, pz);
-  bool b = Hacl_K256_Field_is_felem_zero_vartime(tmp);
-  if (b)
-  {
-    return false;
-  }
-  uint64_t *x = res;
-  uint64_t *z1 = res + (uint32_t)10U;
-  uint8_t r_bytes[32U] = { 0U };
-  uint64_t r_fe[5U] = { 0U };
-  uint64_t tmp_q[5U] = { 0U };
-  uint64_t tmp_x[5U] = { 0U };
-  store_qelem(r_bytes, r_q);
-  Hacl_K256_Field_load_felem(r_fe, r_bytes);
-  Hacl_K256_Field_fnormalize(tmp_x, x);
-  bool is_rz_x = fmul_eq_vartime(r_fe, z1, tmp_x);
-  if (!is_rz_x)
-  {
-    bool is_r_lt_p_m_q = Hacl_K256_Field_is_felem_lt_prime_minus_order_vartime(r_fe);
-    if (is_r_lt_p_m_q)
-    {
-      tmp_q[0U] = (uint64_t)0x25e8cd0364141U;
-      tmp_q[1U] = (uint64_t)0xe6af48a03bbfdU;
-      tmp_q[2U] = (uint64_t)0xffffffebaaedcU;
-      tmp_q[3U] = (uint64_t)0xfffffffffffffU;
-      tmp_q[4U] = (uint64_t)0xffffffffffffU;
-      Hacl_K256_Field_fadd(tmp_q, r_fe, tmp_q);
-      return fmul_eq_vartime(tmp_q, z1, tmp_x);
-    }
-    return false;
-  }
-  return true;
+  point_mul_g_double_split_lambda_vartime(res, u1, u2, p);
+  bool b = ecdsa_verify_avoid_finv(res, r_q);
+  return b;
 }
 
 /**
@@ -1381,6 +1527,470 @@ Hacl_K256_ECDSA_ecdsa_verify_sha256(
   return b;
 }
 
+/* Montgomery's trick: replaces each of the n non-zero scalars of a (4 limbs
+   each) by its inverse, with a single call to qinv and 3 (n - 1) qmul. */
+static void qinv_batch(uint32_t n, uint64_t *a)
+{
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * n);
+  uint64_t acc[(uint32_t)4U * n];
+  memset(acc, 0U, (uint32_t)4U * n * sizeof (uint64_t));
+  uint64_t inv[4U] = { 0U };
+  uint64_t tmp[4U] = { 0U };
+  memcpy(acc, a, (uint32_t)4U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)1U; i < n; i++)
+  {
+    qmul(acc + (uint32_t)4U * i, acc + (uint32_t)4U * (i - (uint32_t)1U), a + (uint32_t)4U * i);
+  }
+  qinv(inv, acc + (uint32_t)4U * (n - (uint32_t)1U));
+  for (uint32_t i = n - (uint32_t)1U; i > (uint32_t)0U; i--)
+  {
+    qmul(tmp, inv, acc + (uint32_t)4U * (i - (uint32_t)1U));
+    qmul(inv, inv, a + (uint32_t)4U * i);
+    memcpy(a + (uint32_t)4U * i, tmp, (uint32_t)4U * sizeof (uint64_t));
+  }
+  memcpy(a, inv, (uint32_t)4U * sizeof (uint64_t));
+}
+
+static inline void load_aff_point(uint64_t *p, uint64_t *x, uint64_t *y)
+{
+  uint64_t *px = p;
+  uint64_t *py = p + (uint32_t)5U;
+  uint64_t *pz = p + (uint32_t)10U;
+  memcpy(px, x, (uint32_t)5U * sizeof (uint64_t));
+  memcpy(py, y, (uint32_t)5U * sizeof (uint64_t));
+  memset(pz, 0U, (uint32_t)5U * sizeof (uint64_t));
+  pz[0U] = (uint64_t)1U;
+}
+
+static inline bool is_same_public_key(uint8_t *pk1, uint8_t *pk2)
+{
+  return pk2 != NULL && (pk1 == pk2 || memcmp(pk1, pk2, (uint32_t)64U) == 0);
+}
+
+/* Verifies up to 64 signatures given as (R || S), sharing one inversion for all
+   S values and, for consecutive identical public keys, the key validation and
+   its table. Each key is decoded and validated once, in the first pass, which
+   keeps its coordinates in pks at the index pk_at[i] for the second. */
+static bool
+verify_batch_chunk(
+  uint32_t len,
+  uint8_t **msgHashes,
+  uint8_t **public_keys,
+  uint8_t **signatures,
+  bool *results
+)
+{
+  uint64_t r_q[256U] = { 0U };
+  uint64_t sinv[256U] = { 0U };
+  uint64_t pks[640U] = { 0U };
+  uint32_t pk_at[64U] = { 0U };
+  uint32_t pk_last = (uint32_t)0U;
+  uint8_t *pk_prev = NULL;
+  bool is_pk_valid = false;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    uint64_t *s_q = sinv + (uint32_t)4U * i;
+    if (!is_same_public_key(public_keys[i], pk_prev))
+    {
+      uint64_t *pk_x = pks + (uint32_t)10U * i;
+      is_pk_valid = load_public_key(public_keys[i], pk_x, pk_x + (uint32_t)5U);
+      pk_prev = public_keys[i];
+      pk_last = i;
+    }
+    pk_at[i] = pk_last;
+    bool is_r_valid = load_qelem_vartime(r_q + (uint32_t)4U * i, signatures[i]);
+    bool is_s_valid = load_qelem_vartime(s_q, signatures[i] + (uint32_t)32U);
+    results[i] = is_pk_valid && is_r_valid && is_s_valid;
+    if (!results[i])
+    {
+      memset(s_q, 0U, (uint32_t)4U * sizeof (uint64_t));
+      s_q[0U] = (uint64_t)1U;
+    }
+  }
+  qinv_batch(len, sinv);
+  uint64_t table[120U] = { 0U };
+  uint64_t table_lambda[120U] = { 0U };
+  uint64_t p[15U] = { 0U };
+  uint64_t z[4U] = { 0U };
+  uint64_t u1[4U] = { 0U };
+  uint64_t u2[4U] = { 0U };
+  bool ok = true;
+  pk_prev = NULL;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    uint64_t *ri = r_q + (uint32_t)4U * i;
+    uint64_t *si = sinv + (uint32_t)4U * i;
+    if (results[i])
+    {
+      if (!is_same_public_key(public_keys[i], pk_prev))
+      {
+        uint64_t *pk_i = pks + (uint32_t)10U * pk_at[i];
+        load_aff_point(p, pk_i, pk_i + (uint32_t)5U);
+        precomp_odd_table_w5(table, table_lambda, p);
+        pk_prev = public_keys[i];
+      }
+      load_qelem_modq(z, msgHashes[i]);
+      qmul(u1, z, si);
+      qmul(u2, ri, si);
+      point_mul_g_double_split_lambda_table(p, u1, u2, table, table_lambda);
+      results[i] = ecdsa_verify_avoid_finv(p, ri);
+    }
+    ok = ok && results[i];
+  }
+  return ok;
+}
+
+/**
+Verify a batch of ECDSA signatures.
+
+  The function returns `true` if all signatures are valid and `false` otherwise.
+  In both cases, `results[i]` is set to the validity of the i-th signature, as
+  computed by `ecdsa_verify_hashed_msg`.
+
+  The argument `len` is the number of signatures in the batch.
+  The argument `msgHashes` points to `len` pointers to 32 bytes of valid memory.
+  The arguments `public_keys` (x || y) and `signatures` (R || S) point to `len` pointers to 64 bytes of valid memory.
+  The outparam `results` points to `len` booleans, i.e., bool[len].
+
+  The inverses of the S values are computed with a single modular inversion per group
+  of 64 signatures. Consecutive signatures under the same public key share the
+  validation of the key and its precomputed table, so callers should group
+  signatures by key when possible.
+*/
+bool
+Hacl_K256_ECDSA_ecdsa_verify_batch_hashed_msg(
+  uint32_t len,
+  uint8_t **msgHashes,
+  uint8_t **public_keys,
+  uint8_t **signatures,
+  bool *results
+)
+{
+  bool ok = true;
+  for (uint32_t i = (uint32_t)0U; i < len; i = i + (uint32_t)64U)
+  {
+    uint32_t n = len - i;
+    if (n > (uint32_t)64U)
+    {
+      n = (uint32_t)64U;
+    }
+    bool
+    b = verify_batch_chunk(n, msgHashes + i, public_keys + i, signatures + i, results + i);
+    ok = ok && b;
+  }
+  return ok;
+}
+
+/* Recovers the point R of a signature from its x-coordinate R and the recovery
+   id v: bit 0 of v is the parity of y, bit 1 says that x = R + order. */
+static inline bool recover_r_point(uint64_t *p, uint8_t *sgnt, uint8_t v)
+{
+  uint8_t c[33U] = { 0U };
+  uint64_t x[5U] = { 0U };
+  uint64_t y[5U] = { 0U };
+  if (v > (uint8_t)3U)
+  {
+    return false;
+  }
+  c[0U] = (uint8_t)0x02U + (v & (uint8_t)1U);
+  if ((v & (uint8_t)2U) == (uint8_t)0U)
+  {
+    memcpy(c + (uint32_t)1U, sgnt, (uint32_t)32U * sizeof (uint8_t));
+  }
+  else
+  {
+    uint64_t r_fe[5U] = { 0U };
+    uint64_t tmp_q[5U] = { 0U };
+    Hacl_K256_Field_load_felem(r_fe, sgnt);
+    if (!Hacl_K256_Field_is_felem_lt_prime_minus_order_vartime(r_fe))
+    {
+      return false;
+    }
+    tmp_q[0U] = (uint64_t)0x25e8cd0364141U;
+    tmp_q[1U] = (uint64_t)0xe6af48a03bbfdU;
+    tmp_q[2U] = (uint64_t)0xffffffebaaedcU;
+    tmp_q[3U] = (uint64_t)0xfffffffffffffU;
+    tmp_q[4U] = (uint64_t)0xffffffffffffU;
+    Hacl_K256_Field_fadd(tmp_q, r_fe, tmp_q);
+    Hacl_K256_Field_fnormalize(tmp_q, tmp_q);
+    Hacl_K256_Field_store_felem(c + (uint32_t)1U, tmp_q);
+  }
+  bool b = Hacl_Impl_K256_Point_aff_point_decompress_vartime(x, y, c);
+  if (b)
+  {
+    load_aff_point(p, x, y);
+  }
+  return b;
+}
+
+/* Checks sum_i a_i ([u1_i]G + [u2_i]Q_i - R_i) = O over the m entries listed
+   in idx, as a single multi-scalar multiplication sharing ~129 doublings. The
+   128-bit coefficients a_i are derived from a SHA2-256 transcript of every
+   (message hash, public key, signature) in the group, so they cannot be chosen
+   before the inputs are fixed. The scalars of consecutive entries under the
+   same public key are merged. tables holds, for every entry, 360 limbs whose
+   last 120 start with the point R_i. pks holds, for every entry, the decoded
+   coordinates (x || y) of its public key. */
+static bool
+verify_batch_recoverable_combined(
+  uint32_t m,
+  uint32_t *idx,
+  uint8_t **msgHashes,
+  uint8_t **public_keys,
+  uint8_t **signatures,
+  uint64_t *r_q,
+  uint64_t *sinv,
+  uint64_t *pks,
+  uint64_t *tables,
+  int32_t *wnafs
+)
+{
+  Hacl_Streaming_SHA2_state_sha2_224 *st = Hacl_Streaming_SHA2_create_in_256();
+  for (uint32_t j = (uint32_t)0U; j < m; j++)
+  {
+    uint32_t i = idx[j];
+    Hacl_Streaming_SHA2_update_256(st, msgHashes[i], (uint32_t)32U);
+    Hacl_Streaming_SHA2_update_256(st, public_keys[i], (uint32_t)64U);
+    Hacl_Streaming_SHA2_update_256(st, signatures[i], (uint32_t)65U);
+  }
+  uint8_t seed[36U] = { 0U };
+  Hacl_Streaming_SHA2_finish_256(st, seed);
+  Hacl_Streaming_SHA2_free_256(st);
+  qinv_batch(m, sinv);
+  uint64_t q_scalar[256U] = { 0U };
+  uint64_t g_scalar[4U] = { 0U };
+  uint64_t a[4U] = { 0U };
+  uint64_t z[4U] = { 0U };
+  uint64_t u[4U] = { 0U };
+  uint64_t p[15U] = { 0U };
+  int32_t wnaf_g1[130U] = { 0U };
+  int32_t wnaf_g2[130U] = { 0U };
+  uint8_t *pk_prev = NULL;
+  uint32_t nq = (uint32_t)0U;
+  uint32_t len = (uint32_t)0U;
+  for (uint32_t j = (uint32_t)0U; j < m; j++)
+  {
+    uint32_t i = idx[j];
+    uint64_t *sj = sinv + (uint32_t)4U * j;
+    uint8_t ah[32U] = { 0U };
+    store32_le(seed + (uint32_t)32U, j);
+    Hacl_Hash_SHA2_hash_256(seed, (uint32_t)36U, ah);
+    a[0U] = load64_le(ah) | (uint64_t)1U;
+    a[1U] = load64_le(ah + (uint32_t)8U);
+    load_qelem_modq(z, msgHashes[i]);
+    qmul(u, z, sj);
+    qmul(u, a, u);
+    qadd(g_scalar, g_scalar, u);
+    qmul(u, r_q + (uint32_t)4U * j, sj);
+    qmul(u, a, u);
+    if (!is_same_public_key(public_keys[i], pk_prev))
+    {
+      uint64_t *table_q = tables + (uint32_t)360U * nq;
+      uint64_t *pk_j = pks + (uint32_t)10U * j;
+      load_aff_point(p, pk_j, pk_j + (uint32_t)5U);
+      precomp_odd_table_w5(table_q, table_q + (uint32_t)120U, p);
+      memcpy(q_scalar + (uint32_t)4U * nq, u, (uint32_t)4U * sizeof (uint64_t));
+      nq++;
+      pk_prev = public_keys[i];
+    }
+    else
+    {
+      uint64_t *q_prev = q_scalar + (uint32_t)4U * (nq - (uint32_t)1U);
+      qadd(q_prev, q_prev, u);
+    }
+    uint64_t *table_r = tables + (uint32_t)360U * j + (uint32_t)240U;
+    memcpy(p, table_r, (uint32_t)15U * sizeof (uint64_t));
+    precomp_odd_table_w5(table_r, NULL, p);
+    uint32_t
+    len_r = wnaf_vartime(wnafs + (uint32_t)390U * j + (uint32_t)260U, a, (uint32_t)5U, true);
+    if (len_r > len)
+    {
+      len = len_r;
+    }
+  }
+  for (uint32_t t = (uint32_t)0U; t < nq; t++)
+  {
+    uint32_t
+    len_q =
+      wnaf_split_lambda_vartime(wnafs + (uint32_t)390U * t,
+        wnafs + (uint32_t)390U * t + (uint32_t)130U,
+        q_scalar + (uint32_t)4U * t,
+        (uint32_t)5U);
+    if (len_q > len)
+    {
+      len = len_q;
+    }
+  }
+  uint32_t len_g = wnaf_split_lambda_vartime(wnaf_g1, wnaf_g2, g_scalar, (uint32_t)7U);
+  if (len_g > len)
+  {
+    len = len_g;
+  }
+  Hacl_Impl_K256_PointMul_make_point_at_inf(p);
+  for (uint32_t k0 = len; k0 > (uint32_t)0U; k0--)
+  {
+    uint32_t k = k0 - (uint32_t)1U;
+    Hacl_Impl_K256_PointDouble_point_double(p, p);
+    point_add_wnaf_digit(p, Hacl_K256_PrecompTable_precomp_basepoint_odd_table_w7, wnaf_g1[k]);
+    point_add_wnaf_digit(p,
+      Hacl_K256_PrecompTable_precomp_lambda_basepoint_odd_table_w7,
+      wnaf_g2[k]);
+    for (uint32_t t = (uint32_t)0U; t < nq; t++)
+    {
+      uint64_t *table_q = tables + (uint32_t)360U * t;
+      int32_t *wnaf_q = wnafs + (uint32_t)390U * t;
+      point_add_wnaf_digit(p, table_q, wnaf_q[k]);
+      point_add_wnaf_digit(p, table_q + (uint32_t)120U, wnaf_q[(uint32_t)130U + k]);
+    }
+    for (uint32_t j = (uint32_t)0U; j < m; j++)
+    {
+      point_add_wnaf_digit(p,
+        tables + (uint32_t)360U * j + (uint32_t)240U,
+        wnafs[(uint32_t)390U * j + (uint32_t)260U + k]);
+    }
+  }
+  uint64_t tmp[5U] = { 0U };
+  Hacl_K256_Field_fnormalize(tmp, p + (uint32_t)10U);
+  return Hacl_K256_Field_is_felem_zero_vartime(tmp);
+}
+
+/* Verifies up to 64 signatures with recovery ids. The entries whose point R can
+   be recovered go through verify_batch_recoverable_combined; the others, and
+   all of them if the combined check fails, through verify_batch_chunk. */
+static bool
+verify_batch_recoverable_chunk(
+  uint32_t len,
+  uint8_t **msgHashes,
+  uint8_t **public_keys,
+  uint8_t **signatures,
+  bool *results
+)
+{
+  uint64_t r_q[256U] = { 0U };
+  uint64_t sinv[256U] = { 0U };
+  uint32_t idx[64U] = { 0U };
+  uint64_t pks[640U] = { 0U };
+  uint64_t pk_x[5U] = { 0U };
+  uint64_t pk_y[5U] = { 0U };
+  uint64_t *tables = (uint64_t *)KRML_HOST_CALLOC((uint32_t)360U * len, sizeof (uint64_t));
+  int32_t *wnafs = (int32_t *)KRML_HOST_CALLOC((uint32_t)390U * len, sizeof (int32_t));
+  uint8_t *pk_prev = NULL;
+  bool is_pk_valid = false;
+  bool batched = false;
+  uint32_t m = (uint32_t)0U;
+  if (tables != NULL && wnafs != NULL)
+  {
+    for (uint32_t i = (uint32_t)0U; i < len; i++)
+    {
+      uint8_t *sgnt = signatures[i];
+      if (!is_same_public_key(public_keys[i], pk_prev))
+      {
+        is_pk_valid = load_public_key(public_keys[i], pk_x, pk_y);
+        pk_prev = public_keys[i];
+      }
+      bool
+      b =
+        is_pk_valid
+        && load_qelem_vartime(r_q + (uint32_t)4U * m, sgnt)
+        && load_qelem_vartime(sinv + (uint32_t)4U * m, sgnt + (uint32_t)32U)
+        && recover_r_point(tables + (uint32_t)360U * m + (uint32_t)240U, sgnt, sgnt[64U]);
+      results[i] = b;
+      if (b)
+      {
+        memcpy(pks + (uint32_t)10U * m, pk_x, (uint32_t)5U * sizeof (uint64_t));
+        memcpy(pks + (uint32_t)10U * m + (uint32_t)5U, pk_y, (uint32_t)5U * sizeof (uint64_t));
+        idx[m] = i;
+        m++;
+      }
+    }
+    batched =
+      m > (uint32_t)0U
+      &&
+        verify_batch_recoverable_combined(m,
+          idx,
+          msgHashes,
+          public_keys,
+          signatures,
+          r_q,
+          sinv,
+          pks,
+          tables,
+          wnafs);
+  }
+  KRML_HOST_FREE(tables);
+  KRML_HOST_FREE(wnafs);
+  if (batched && m == len)
+  {
+    return true;
+  }
+  bool ok = true;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    if (!(batched && results[i]))
+    {
+      bool
+      b =
+        verify_batch_chunk((uint32_t)1U,
+          msgHashes + i,
+          public_keys + i,
+          signatures + i,
+          results + i);
+      ok = ok && b;
+    }
+  }
+  return ok;
+}
+
+/**
+Verify a batch of ECDSA signatures carrying recovery ids.
+
+  The function returns `true` if all signatures are valid and `false` otherwise.
+  In both cases, `results[i]` is set to the validity of the i-th signature, as
+  computed by `ecdsa_verify_hashed_msg` on its first 64 bytes (R || S).
+
+  The argument `len` is the number of signatures in the batch.
+  The argument `msgHashes` points to `len` pointers to 32 bytes of valid memory.
+  The argument `public_keys` (x || y) points to `len` pointers to 64 bytes of valid memory.
+  The argument `signatures` (R || S || v) points to `len` pointers to 65 bytes of valid memory.
+  The outparam `results` points to `len` booleans, i.e., bool[len].
+
+  The recovery id v is 0, 1, 2 or 3: bit 0 is the parity of the y-coordinate of the
+  point R, and bit 1 is set if its x-coordinate is R + order. Knowing the full points,
+  the signatures are checked 64 at a time with a single multi-scalar multiplication,
+  whose 128-bit coefficients are derived deterministically (Fiat-Shamir) from a SHA2-256
+  hash of every message hash, public key and signature of the group. The recovery id
+  is only a hint: signatures whose point cannot be recovered, and every signature of a
+  group whose combined check fails, are verified one by one.
+*/
+bool
+Hacl_K256_ECDSA_ecdsa_verify_batch_recoverable_hashed_msg(
+  uint32_t len,
+  uint8_t **msgHashes,
+  uint8_t **public_keys,
+  uint8_t **signatures,
+  bool *results
+)
+{
+  bool ok = true;
+  for (uint32_t i = (uint32_t)0U; i < len; i = i + (uint32_t)64U)
+  {
+    uint32_t n = len - i;
+    if (n > (uint32_t)64U)
+    {
+      n = (uint32_t)64U;
+    }
+    bool
+    b =
+      verify_batch_recoverable_chunk(n,
+        msgHashes + i,
+        public_keys + i,
+        signatures + i,
+        results + i);
+    ok = ok && b;
+  }
+  return ok;
+}
+
 /**
 Compute canonical lowest S value for `signature` (R || S).
 
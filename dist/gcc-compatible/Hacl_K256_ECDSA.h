@@ -136,6 +136,62 @@ Hacl_K256_ECDSA_ecdsa_verify_sha256(
   uint8_t *signature
 );
 
+/**
+Verify a batch of ECDSA signatures.
+
+  The function returns `true` if all signatures are valid and `false` otherwise.
+  In both cases, `results[i]` is set to the validity of the i-th signature, as
+  computed by `ecdsa_verify_hashed_msg`.
+
+  The argument `len` is the number of signatures in the batch.
+  The argument `msgHashes` points to `len` pointers to 32 bytes of valid memory.
+  The arguments `public_keys` (x || y) and `signatures` (R || S) point to `len` pointers to 64 bytes of valid memory.
+  The outparam `results` points to `len` booleans, i.e., bool[len].
+
+  The inverses of the S values are computed with a single modular inversion per group
+  of 64 signatures. Consecutive signatures under the same public key share the
+  validation of the key and its precomputed table, so callers should group
+  signatures by key when possible.
+*/
+bool
+Hacl_K256_ECDSA_ecdsa_verify_batch_hashed_msg(
+  uint32_t len,
+  uint8_t **msgHashes,
+  uint8_t **public_keys,
+  uint8_t **signatures,
+  bool *results
+);
+
+/**
+Verify a batch of ECDSA signatures carrying recovery ids.
+
+  The function returns `true` if all signatures are valid and `false` otherwise.
+  In both cases, `results[i]` is set to the validity of the i-th signature, as
+  computed by `ecdsa_verify_hashed_msg` on its first 64 bytes (R || S).
+
+  The argument `len` is the number of signatures in the batch.
+  The argument `msgHashes` points to `len` pointers to 32 bytes of valid memory.
+  The argument `public_keys` (x || y) points to `len` pointers to 64 bytes of valid memory.
+  The argument `signatures` (R || S || v) points to `len` pointers to 65 bytes of valid memory.
+  The outparam `results` points to `len` booleans, i.e., bool[len].
+
+  The recovery id v is 0, 1, 2 or 3: bit 0 is the parity of the y-coordinate of the
+  point R, and bit 1 is set if its x-coordinate is R + order. Knowing the full points,
+  the signatures are checked 64 at a time with a single multi-scalar multiplication,
+  whose 128-bit coefficients are derived deterministically (Fiat-Shamir) from a SHA2-256
+  hash of every message hash, public key and signature of the group. The recovery id
+  is only a hint: signatures whose point cannot be recovered, and every signature of a
+  group whose combined check fails, are verified one by one.
+*/
+bool
+Hacl_K256_ECDSA_ecdsa_verify_batch_recoverable_hashed_msg(
+  uint32_t len,
+  uint8_t **msgHashes,
+  uint8_t **public_keys,
+  uint8_t **signatures,
+  bool *results
+);
+
 /**
 Compute canonical lowest S value for `signature` (R || S).
 
@@ -27,6 +27,7 @@
 #include "internal/Hacl_Spec.h"
 #include "internal/Hacl_Krmllib.h"
 #include "lib_intrinsics.h"
+#include "internal/Hacl_P256_PrecompTable.h"
 static uint64_t isZero_uint64_CT(uint64_t *f)
 {
   uint64_t a0 = f[0U];
@@ -1362,22 +1363,6 @@ scalarMultiplicationC(
   norm(q, result, buff);
 }
 
-static void uploadBasePoint(uint64_t *p)
-{
-  p[0U] = (uint64_t)8784043285714375740U;
-  p[1U] = (uint64_t)8483257759279461889U;
-  p[2U] = (uint64_t)8789745728267363600U;
-  p[3U] = (uint64_t)1770019616739251654U;
-  p[4U] = (uint64_t)15992936863339206154U;
-  p[5U] = (uint64_t)10037038012062884956U;
-  p[6U] = (uint64_t)15197544864945402661U;
-  p[7U] = (uint64_t)9615747158586711429U;
-  p[8U] = (uint64_t)1U;
-  p[9U] = (uint64_t)18446744069414584320U;
-  p[10U] = (uint64_t)18446744073709551615U;
-  p[11U] = (uint64_t)4294967294U;
-}
-
 static void
 scalarMultiplicationWithoutNorm(
   uint64_t *p,
@@ -1404,46 +1389,102 @@ scalarMultiplicationWithoutNorm(
   copy_point(q, result);
 }
 
+static inline void
+precomp_get_consttime(const uint64_t *table, uint64_t bits_l, uint64_t *tmp)
+{
+  memcpy(tmp, (uint64_t *)table, (uint32_t)12U * sizeof (uint64_t));
+  KRML_MAYBE_FOR15(i0,
+    (uint32_t)0U,
+    (uint32_t)15U,
+    (uint32_t)1U,
+    uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i0 + (uint32_t)1U));
+    const uint64_t *res_j = table + (i0 + (uint32_t)1U) * (uint32_t)12U;
+    KRML_MAYBE_FOR12(i,
+      (uint32_t)0U,
+      (uint32_t)12U,
+      (uint32_t)1U,
+      uint64_t *os = tmp;
+      uint64_t x = (c & res_j[i]) | (~c & tmp[i]);
+      os[i] = x;););
+}
+
+/* The Jacobian addition formula of point_add degenerates (to the point at
+   infinity) when both arguments are the same point. This variant also computes
+   the doubling and selects it, in constant time, in that case. */
+static void
+point_add_or_double(uint64_t *p, uint64_t *q, uint64_t *result, uint64_t *tempBuffer)
+{
+  uint64_t pDouble[12U] = { 0U };
+  uint64_t pNotInf = ~Hacl_Impl_P256_Core_isPointAtInfinityPrivate(p);
+  uint64_t qNotInf = ~Hacl_Impl_P256_Core_isPointAtInfinityPrivate(q);
+  point_double(p, pDouble, tempBuffer);
+  point_add(p, q, result, tempBuffer);
+  /* point_add leaves h = u2 - u1 and r = s2 - s1 in tempBuffer */
+  uint64_t *h = tempBuffer + (uint32_t)32U;
+  uint64_t *r = tempBuffer + (uint32_t)36U;
+  uint64_t mask = ((isZero_uint64_CT(h) & isZero_uint64_CT(r)) & pNotInf) & qNotInf;
+  copy_conditional(result, pDouble, mask);
+  copy_conditional(result + (uint32_t)4U, pDouble + (uint32_t)4U, mask);
+  copy_conditional(result + (uint32_t)8U, pDouble + (uint32_t)8U, mask);
+}
+
+/* Fixed-base scalar multiplication with the precomputed tables of
+   [i]G, [i * 2^64]G, [i * 2^128]G and [i * 2^192]G (0 <= i < 16), in the
+   Montgomery domain. The (big-endian) scalar is split into four 64-bit chunks
+   that are processed simultaneously with 4-bit windows. The result is not
+   normalized. */
+static void point_mul_g(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
+{
+  uint64_t bscalar[4U] = { 0U };
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    uint64_t *os = bscalar;
+    uint8_t *bj = scalar + ((uint32_t)3U - i) * (uint32_t)8U;
+    uint64_t u = load64_be(bj);
+    uint64_t r = u;
+    uint64_t x = r;
+    os[i] = x;);
+  uint64_t tmp[12U] = { 0U };
+  zero_buffer(result);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    KRML_MAYBE_FOR4(i0,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      point_double(result, result, tempBuffer););
+    uint32_t k = (uint32_t)60U - (uint32_t)4U * i;
+    uint64_t bits_l3 = bscalar[3U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_P256_PrecompTable_precomp_g_pow2_192_table_w4, bits_l3, tmp);
+    point_add_or_double(result, tmp, result, tempBuffer);
+    uint64_t bits_l2 = bscalar[2U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_P256_PrecompTable_precomp_g_pow2_128_table_w4, bits_l2, tmp);
+    point_add_or_double(result, tmp, result, tempBuffer);
+    uint64_t bits_l1 = bscalar[1U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_P256_PrecompTable_precomp_g_pow2_64_table_w4, bits_l1, tmp);
+    point_add_or_double(result, tmp, result, tempBuffer);
+    uint64_t bits_l0 = bscalar[0U] >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_P256_PrecompTable_precomp_basepoint_table_w4, bits_l0, tmp);
+    point_add_or_double(result, tmp, result, tempBuffer);
+  }
+}
+
 void
 Hacl_Impl_P256_Core_secretToPublic(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
 {
-  uint64_t basePoint[12U] = { 0U };
-  uploadBasePoint(basePoint);
   uint64_t *q = tempBuffer;
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  zero_buffer(q);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
-  {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, basePoint);
-    point_add(q, basePoint, basePoint, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, basePoint);
-  }
+  point_mul_g(q, scalar, buff);
   norm(q, result, buff);
 }
 
 static void secretToPublicWithoutNorm(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
 {
-  uint64_t basePoint[12U] = { 0U };
-  uploadBasePoint(basePoint);
   uint64_t *q = tempBuffer;
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  zero_buffer(q);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
-  {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, basePoint);
-    point_add(q, basePoint, basePoint, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, basePoint);
-  }
+  point_mul_g(q, scalar, buff);
   copy_point(q, result);
 }
 
@@ -2625,6 +2666,375 @@ Hacl_P256_ecdsa_verif_without_hash(
   return result;
 }
 
+/* Montgomery's trick: replaces each of the n non-zero elements of a by
+   montgomery_ladder_exponent of it, with a single call to
+   montgomery_ladder_exponent and 3 (n - 1) montgomery_multiplication_ecdsa_module. */
+static void montgomery_ladder_exponent_batch(uint32_t n, uint64_t *a)
+{
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)4U * n);
+  uint64_t acc[(uint32_t)4U * n];
+  memset(acc, 0U, (uint32_t)4U * n * sizeof (uint64_t));
+  uint64_t inv[4U] = { 0U };
+  uint64_t tmp[4U] = { 0U };
+  memcpy(acc, a, (uint32_t)4U * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)1U; i < n; i++)
+  {
+    montgomery_multiplication_ecdsa_module(acc + (uint32_t)4U * (i - (uint32_t)1U),
+      a + (uint32_t)4U * i,
+      acc + (uint32_t)4U * i);
+  }
+  memcpy(inv, acc + (uint32_t)4U * (n - (uint32_t)1U), (uint32_t)4U * sizeof (uint64_t));
+  montgomery_ladder_exponent(inv);
+  for (uint32_t i = n - (uint32_t)1U; i > (uint32_t)0U; i--)
+  {
+    montgomery_multiplication_ecdsa_module(inv, acc + (uint32_t)4U * (i - (uint32_t)1U), tmp);
+    montgomery_multiplication_ecdsa_module(inv, a + (uint32_t)4U * i, inv);
+    memcpy(a + (uint32_t)4U * i, tmp, (uint32_t)4U * sizeof (uint64_t));
+  }
+  memcpy(a, inv, (uint32_t)4U * sizeof (uint64_t));
+}
+
+/**
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+*/
+static void
+point_add_or_double_vartime(uint64_t *p, uint64_t *q, uint64_t *result, uint64_t *tempBuffer)
+{
+  uint64_t pCopy[12U] = { 0U };
+  bool pInf = isPointAtInfinityPublic(p);
+  bool qInf = isPointAtInfinityPublic(q);
+  copy_point(p, pCopy);
+  point_add(p, q, result, tempBuffer);
+  uint64_t *h = tempBuffer + (uint32_t)32U;
+  uint64_t *r = tempBuffer + (uint32_t)36U;
+  if (!pInf && !qInf && isZero_uint64_CT(h) != (uint64_t)0U && isZero_uint64_CT(r) != (uint64_t)0U)
+  {
+    point_double(pCopy, result, tempBuffer);
+  }
+}
+
+/* Width-5 non-adjacent form of the (public) scalar s < 2^256: s is the sum of
+   wnaf[i] 2^i, every non-zero digit is odd and in [-15, 15], and any 5
+   consecutive digits hold at most one non-zero digit. Returns the number of
+   digits up to the last non-zero one. */
+static uint32_t wnaf_w5_vartime(int32_t *wnaf, uint64_t *s)
+{
+  uint32_t len = (uint32_t)257U;
+  uint32_t res = (uint32_t)0U;
+  uint32_t carry = (uint32_t)0U;
+  uint32_t bit = (uint32_t)0U;
+  memset(wnaf, 0U, len * sizeof (int32_t));
+  while (bit < len)
+  {
+    uint32_t i = bit / (uint32_t)64U;
+    uint32_t j = bit % (uint32_t)64U;
+    uint64_t word = (uint64_t)0U;
+    if (i < (uint32_t)4U)
+    {
+      word = s[i] >> j;
+      if (j > (uint32_t)0U && i + (uint32_t)1U < (uint32_t)4U)
+      {
+        word = word | s[i + (uint32_t)1U] << ((uint32_t)64U - j);
+      }
+    }
+    if ((uint32_t)(word & (uint64_t)1U) == carry)
+    {
+      bit++;
+      continue;
+    }
+    int32_t d = (int32_t)(word & (uint64_t)31U) + (int32_t)carry;
+    carry = (uint32_t)(d >> (uint32_t)4U) & (uint32_t)1U;
+    d = d - (int32_t)(carry << (uint32_t)5U);
+    wnaf[bit] = d;
+    res = bit + (uint32_t)1U;
+    bit = bit + (uint32_t)5U;
+  }
+  return res;
+}
+
+/* Fills table with [1]Q, [3]Q, ..., [15]Q, for Q in the Montgomery domain. */
+static void precomp_odd_table_w5(uint64_t *table, uint64_t *q, uint64_t *tempBuffer)
+{
+  uint64_t qDouble[12U] = { 0U };
+  copy_point(q, table);
+  point_double(q, qDouble, tempBuffer);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    point_add_or_double_vartime(table + (i - (uint32_t)1U) * (uint32_t)12U,
+      qDouble,
+      table + i * (uint32_t)12U,
+      tempBuffer);
+  }
+}
+
+/**
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+
+   Computes [u1]G + [u2]Q, where table holds the odd multiples of Q. The
+   additions of the comb used by point_mul_g share the last 64 doublings of the
+   width-5 wNAF evaluation of [u2]Q.
+*/
+static void
+point_mul_g_double_vartime(
+  uint64_t *result,
+  uint64_t *u1,
+  uint64_t *u2,
+  uint64_t *table,
+  uint64_t *tempBuffer
+)
+{
+  int32_t wnaf[257U] = { 0U };
+  uint64_t tmp[12U] = { 0U };
+  uint64_t zero[4U] = { 0U };
+  uint32_t len = wnaf_w5_vartime(wnaf, u2);
+  if (len < (uint32_t)64U)
+  {
+    len = (uint32_t)64U;
+  }
+  zero_buffer(result);
+  for (uint32_t k0 = len; k0 > (uint32_t)0U; k0--)
+  {
+    uint32_t k = k0 - (uint32_t)1U;
+    point_double(result, result, tempBuffer);
+    int32_t d = wnaf[k];
+    if (d > (int32_t)0)
+    {
+      point_add_or_double_vartime(result,
+        table + (uint32_t)(d / (int32_t)2) * (uint32_t)12U,
+        result,
+        tempBuffer);
+    }
+    else if (d < (int32_t)0)
+    {
+      copy_point(table + (uint32_t)(-d / (int32_t)2) * (uint32_t)12U, tmp);
+      p256_sub(zero, tmp + (uint32_t)4U, tmp + (uint32_t)4U);
+      point_add_or_double_vartime(result, tmp, result, tempBuffer);
+    }
+    if (k < (uint32_t)64U && k % (uint32_t)4U == (uint32_t)0U)
+    {
+      uint64_t bits_l3 = u1[3U] >> k & (uint64_t)15U;
+      uint64_t bits_l2 = u1[2U] >> k & (uint64_t)15U;
+      uint64_t bits_l1 = u1[1U] >> k & (uint64_t)15U;
+      uint64_t bits_l0 = u1[0U] >> k & (uint64_t)15U;
+      if (bits_l3 != (uint64_t)0U)
+      {
+        copy_point((uint64_t *)Hacl_P256_PrecompTable_precomp_g_pow2_192_table_w4
+          + (uint32_t)bits_l3 * (uint32_t)12U,
+          tmp);
+        point_add_or_double_vartime(result, tmp, result, tempBuffer);
+      }
+      if (bits_l2 != (uint64_t)0U)
+      {
+        copy_point((uint64_t *)Hacl_P256_PrecompTable_precomp_g_pow2_128_table_w4
+          + (uint32_t)bits_l2 * (uint32_t)12U,
+          tmp);
+        point_add_or_double_vartime(result, tmp, result, tempBuffer);
+      }
+      if (bits_l1 != (uint64_t)0U)
+      {
+        copy_point((uint64_t *)Hacl_P256_PrecompTable_precomp_g_pow2_64_table_w4
+          + (uint32_t)bits_l1 * (uint32_t)12U,
+          tmp);
+        point_add_or_double_vartime(result, tmp, result, tempBuffer);
+      }
+      if (bits_l0 != (uint64_t)0U)
+      {
+        copy_point((uint64_t *)Hacl_P256_PrecompTable_precomp_basepoint_table_w4
+          + (uint32_t)bits_l0 * (uint32_t)12U,
+          tmp);
+        point_add_or_double_vartime(result, tmp, result, tempBuffer);
+      }
+    }
+  }
+}
+
+/**
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+
+   Checks that the x-coordinate of the (Jacobian, Montgomery domain) point p is
+   congruent to r modulo the order, without normalizing p: X = r Z^2 or, when
+   r + order < prime, X = (r + order) Z^2.
+*/
+static bool ecdsa_verify_avoid_finv(uint64_t *p, uint64_t *r)
+{
+  uint64_t *x = p;
+  uint64_t *z = p + (uint32_t)8U;
+  if (isPointAtInfinityPublic(p))
+  {
+    return false;
+  }
+  uint64_t zSquare[4U] = { 0U };
+  uint64_t rDomain[4U] = { 0U };
+  uint64_t multBuffer[8U] = { 0U };
+  montgomery_square_buffer(z, zSquare);
+  shift_256_impl(r, multBuffer);
+  solinas_reduction_impl(multBuffer, rDomain);
+  montgomery_multiplication_buffer(rDomain, zSquare, rDomain);
+  if (compare_felem_bool(x, rDomain))
+  {
+    return true;
+  }
+  /* prime - order = 0x4319055358e8617b0c46353d039cdaae */
+  bool
+  isRLessThanPMinusQ =
+    r[3U] == (uint64_t)0U
+    && r[2U] == (uint64_t)0U
+    &&
+      (r[1U] < (uint64_t)0x4319055358e8617bU
+      || (r[1U] == (uint64_t)0x4319055358e8617bU && r[0U] < (uint64_t)0x0c46353d039cdaaeU));
+  if (!isRLessThanPMinusQ)
+  {
+    return false;
+  }
+  uint64_t order[4U] = { 0U };
+  uint64_t rPlusQ[4U] = { 0U };
+  uint64_t multBuffer0[8U] = { 0U };
+  memcpy(order, prime256order_buffer, (uint32_t)4U * sizeof (uint64_t));
+  uint64_t uu____0 = add4(r, order, rPlusQ);
+  shift_256_impl(rPlusQ, multBuffer0);
+  solinas_reduction_impl(multBuffer0, rDomain);
+  montgomery_multiplication_buffer(rDomain, zSquare, rDomain);
+  return compare_felem_bool(x, rDomain);
+}
+
+static inline bool is_same_public_key(uint8_t *pk1, uint8_t *pk2)
+{
+  return pk2 != NULL && (pk1 == pk2 || memcmp(pk1, pk2, (uint32_t)64U) == 0);
+}
+
+/* Verifies up to 64 signatures, sharing one inversion for all s values and, for
+   consecutive identical public keys, the key validation and its table. */
+static bool
+ecdsa_verification_batch_chunk(
+  uint32_t len,
+  uint8_t **m,
+  uint8_t **pubKeys,
+  uint8_t **r,
+  uint8_t **s,
+  bool *results
+)
+{
+  uint64_t tempBuffer[100U] = { 0U };
+  uint64_t rs[256U] = { 0U };
+  uint64_t inverseS[256U] = { 0U };
+  uint64_t publicKeyBuffer[12U] = { 0U };
+  uint8_t *pubKeyPrev = NULL;
+  bool publicKeyCorrect = false;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    uint64_t *ri = rs + (uint32_t)4U * i;
+    uint64_t *si = inverseS + (uint32_t)4U * i;
+    uint64_t sAsFelem[4U] = { 0U };
+    if (!is_same_public_key(pubKeys[i], pubKeyPrev))
+    {
+      uint64_t publicKeyAsFelem[8U] = { 0U };
+      Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(pubKeys[i], publicKeyAsFelem);
+      Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(pubKeys[i] + (uint32_t)32U,
+        publicKeyAsFelem + (uint32_t)4U);
+      bufferToJac(publicKeyAsFelem, publicKeyBuffer);
+      publicKeyCorrect = verifyQValidCurvePoint(publicKeyBuffer, tempBuffer);
+      pubKeyPrev = pubKeys[i];
+    }
+    Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(r[i], ri);
+    Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(s[i], sAsFelem);
+    bool isRCorrect = isMoreThanZeroLessThanOrderMinusOne(ri);
+    bool isSCorrect = isMoreThanZeroLessThanOrderMinusOne(sAsFelem);
+    results[i] = publicKeyCorrect && isRCorrect && isSCorrect;
+    if (results[i])
+    {
+      fromDomainImpl(sAsFelem, si);
+    }
+    else
+    {
+      si[0U] = (uint64_t)1U;
+    }
+  }
+  montgomery_ladder_exponent_batch(len, inverseS);
+  uint64_t table[96U] = { 0U };
+  uint64_t hashAsFelem[4U] = { 0U };
+  uint64_t u1[4U] = { 0U };
+  uint64_t u2[4U] = { 0U };
+  uint64_t pointSum[12U] = { 0U };
+  bool ok = true;
+  pubKeyPrev = NULL;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    uint64_t *ri = rs + (uint32_t)4U * i;
+    if (results[i])
+    {
+      if (!is_same_public_key(pubKeys[i], pubKeyPrev))
+      {
+        uint64_t publicKeyAsFelem[8U] = { 0U };
+        uint64_t publicKeyDomain[12U] = { 0U };
+        Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(pubKeys[i], publicKeyAsFelem);
+        Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(pubKeys[i] + (uint32_t)32U,
+          publicKeyAsFelem + (uint32_t)4U);
+        bufferToJac(publicKeyAsFelem, publicKeyBuffer);
+        pointToDomain(publicKeyBuffer, publicKeyDomain);
+        precomp_odd_table_w5(table, publicKeyDomain, tempBuffer);
+        pubKeyPrev = pubKeys[i];
+      }
+      Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(m[i], hashAsFelem);
+      reduction_prime_2prime_order(hashAsFelem, hashAsFelem);
+      multPowerPartial(inverseS + (uint32_t)4U * i, hashAsFelem, u1);
+      multPowerPartial(inverseS + (uint32_t)4U * i, ri, u2);
+      point_mul_g_double_vartime(pointSum, u1, u2, table, tempBuffer);
+      results[i] = ecdsa_verify_avoid_finv(pointSum, ri);
+    }
+    ok = ok && results[i];
+  }
+  return ok;
+}
+
+/**
+Verify a batch of ECDSA signatures without hashing the messages.
+
+  The input of the function is considered to be public,
+  thus this code is not secret independent with respect to the operations done over the input.
+
+  The function returns `true` if all signatures are valid and `false` otherwise.
+  In both cases, `results[i]` is set to the validity of the i-th signature, as
+  computed by `ecdsa_verif_without_hash` with a 32-byte message.
+
+ Input: len: the number of signatures in the batch,
+ m: `len` pointers to uint8[32], the hashes of the messages,
+ pubKeys: `len` pointers to uint8[64],
+ r: `len` pointers to uint8[32],
+ s: `len` pointers to uint8[32],
+ results: bool[len].
+
+  The inverses of the s values are computed with a single modular inversion per group
+  of 64 signatures, and no field inversion is needed. Consecutive signatures under the
+  same public key share the validation of the key and its precomputed table, so callers
+  should group signatures by key when possible.
+*/
+bool
+Hacl_P256_ecdsa_verif_batch_without_hash(
+  uint32_t len,
+  uint8_t **m,
+  uint8_t **pubKeys,
+  uint8_t **r,
+  uint8_t **s,
+  bool *results
+)
+{
+  bool ok = true;
+  for (uint32_t i = (uint32_t)0U; i < len; i = i + (uint32_t)64U)
+  {
+    uint32_t n = len - i;
+    if (n > (uint32_t)64U)
+    {
+      n = (uint32_t)64U;
+    }
+    bool b = ecdsa_verification_batch_chunk(n, m + i, pubKeys + i, r + i, s + i, results + i);
+    ok = ok && b;
+  }
+  return ok;
+}
+
 
 /******************/
 /* Key validation */
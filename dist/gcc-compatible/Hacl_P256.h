@@ -248,6 +248,38 @@ Hacl_P256_ecdsa_verif_without_hash(
   uint8_t *s
 );
 
+/**
+Verify a batch of ECDSA signatures without hashing the messages.
+
+  The input of the function is considered to be public,
+  thus this code is not secret independent with respect to the operations done over the input.
+
+  The function returns `true` if all signatures are valid and `false` otherwise.
+  In both cases, `results[i]` is set to the validity of the i-th signature, as
+  computed by `ecdsa_verif_without_hash` with a 32-byte message.
+
+ Input: len: the number of signatures in the batch,
+ m: `len` pointers to uint8[32], the hashes of the messages,
+ pubKeys: `len` pointers to uint8[64],
+ r: `len` pointers to uint8[32],
+ s: `len` pointers to uint8[32],
+ results: bool[len].
+
+  The inverses of the s values are computed with a single modular inversion per group
+  of 64 signatures, and no field inversion is needed. Consecutive signatures under the
+  same public key share the validation of the key and its precomputed table, so callers
+  should group signatures by key when possible.
+*/
+bool
+Hacl_P256_ecdsa_verif_batch_without_hash(
+  uint32_t len,
+  uint8_t **m,
+  uint8_t **pubKeys,
+  uint8_t **r,
+  uint8_t **s,
+  bool *results
+);
+
 
 /******************/
 /* Key validation */
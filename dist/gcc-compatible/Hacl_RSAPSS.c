@@ -26,6 +26,8 @@
 
 #include "internal/Hacl_Krmllib.h"
 #include "internal/Hacl_Bignum.h"
+#include "Hacl_Bignum64.h"
+#include "Lib_Memzero0.h"
 
 static inline uint32_t hash_len(Spec_Hash_Definitions_hash_alg a)
 {
@@ -818,3 +820,271 @@ Hacl_RSAPSS_rsapss_pkey_verify(
   return false;
 }
 
+
+/*
+  p and q live in the cached Montgomery contexts ctx_p and ctx_q; dp, dq and qinv are
+  pqBits-bit bignums.
+*/
+struct Hacl_RSAPSS_crt_skey_s
+{
+  uint32_t modBits;
+  uint32_t eBits;
+  uint32_t pqBits;
+  uint64_t *pkey;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *ctx_p;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *ctx_q;
+  uint64_t *dp;
+  uint64_t *dq;
+  uint64_t *qinv;
+};
+
+Hacl_RSAPSS_crt_skey
+*Hacl_RSAPSS_new_rsapss_load_crt_skey(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t pqBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb
+)
+{
+  if (!((uint32_t)1U < pqBits && pqBits <= (uint32_t)0xffffffffU - (uint32_t)64U))
+  {
+    return NULL;
+  }
+  uint32_t pqLen = (pqBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pqbLen = (pqBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  if
+  (
+    !((uint32_t)1U
+    < modBits
+    && pqLen <= (uint32_t)16777215U
+    && (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U <= pqLen + pqLen)
+  )
+  {
+    return NULL;
+  }
+  uint64_t *pkey = Hacl_RSAPSS_new_rsapss_load_pkey(modBits, eBits, nb, eb);
+  if (pkey == NULL)
+  {
+    return NULL;
+  }
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint64_t *n = pkey;
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t p[pqLen];
+  memset(p, 0U, pqLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t q[pqLen];
+  memset(q, 0U, pqLen * sizeof (uint64_t));
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pqbLen, pb, p);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pqbLen, qb, q);
+  uint64_t m0 = Hacl_Bignum_Montgomery_bn_check_modulus_u64(pqLen, p);
+  uint64_t m1 = Hacl_Bignum_Montgomery_bn_check_modulus_u64(pqLen, q);
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen + pqLen);
+  uint64_t pq[pqLen + pqLen];
+  memset(pq, 0U, (pqLen + pqLen) * sizeof (uint64_t));
+  Hacl_Bignum64_mul(pqLen, p, q, pq);
+  uint64_t m2 = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  for (uint32_t i = (uint32_t)0U; i < pqLen + pqLen; i++)
+  {
+    uint64_t ni;
+    if (i < nLen)
+    {
+      ni = n[i];
+    }
+    else
+    {
+      ni = (uint64_t)0U;
+    }
+    uint64_t uu____0 = FStar_UInt64_eq_mask(pq[i], ni);
+    m2 = uu____0 & m2;
+  }
+  Hacl_RSAPSS_crt_skey *skey = NULL;
+  if ((m0 & m1 & m2) == (uint64_t)0xFFFFFFFFFFFFFFFFU)
+  {
+    skey = (Hacl_RSAPSS_crt_skey *)KRML_HOST_MALLOC(sizeof (Hacl_RSAPSS_crt_skey));
+  }
+  uint64_t *ds = NULL;
+  if (skey != NULL)
+  {
+    KRML_CHECK_SIZE(sizeof (uint64_t), (uint32_t)3U * pqLen);
+    ds = (uint64_t *)KRML_HOST_CALLOC((uint32_t)3U * pqLen, sizeof (uint64_t));
+  }
+  if (ds == NULL)
+  {
+    Lib_Memzero0_memzero(p, pqLen * sizeof (p[0U]));
+    Lib_Memzero0_memzero(q, pqLen * sizeof (q[0U]));
+    KRML_HOST_FREE(skey);
+    KRML_HOST_FREE(pkey);
+    return NULL;
+  }
+  uint64_t *dp = ds;
+  uint64_t *dq = ds + pqLen;
+  uint64_t *qinv = ds + pqLen + pqLen;
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pqbLen, dpb, dp);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pqbLen, dqb, dq);
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(pqbLen, qinvb, qinv);
+  uint64_t m3 = check_num_bits_u64(pqBits, dp) & check_num_bits_u64(pqBits, dq);
+  skey[0U]
+  =
+    (
+      (Hacl_RSAPSS_crt_skey){
+        .modBits = modBits,
+        .eBits = eBits,
+        .pqBits = pqBits,
+        .pkey = pkey,
+        .ctx_p = Hacl_Bignum64_mont_ctx_init(pqLen, p),
+        .ctx_q = Hacl_Bignum64_mont_ctx_init(pqLen, q),
+        .dp = dp,
+        .dq = dq,
+        .qinv = qinv
+      }
+    );
+  Lib_Memzero0_memzero(p, pqLen * sizeof (p[0U]));
+  Lib_Memzero0_memzero(q, pqLen * sizeof (q[0U]));
+  if (m3 != (uint64_t)0xFFFFFFFFFFFFFFFFU)
+  {
+    Hacl_RSAPSS_free_crt_skey(skey);
+    return NULL;
+  }
+  return skey;
+}
+
+static void mont_ctx_clear_free(Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k)
+{
+  Lib_Memzero0_memzero(k->n, k->len * sizeof (k->n[0U]));
+  Lib_Memzero0_memzero(k->r2, k->len * sizeof (k->r2[0U]));
+  Hacl_Bignum64_mont_ctx_free(k);
+}
+
+void Hacl_RSAPSS_free_crt_skey(Hacl_RSAPSS_crt_skey *skey)
+{
+  uint32_t pqLen = (skey->pqBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  Lib_Memzero0_memzero(skey->dp, (uint32_t)3U * pqLen * sizeof (skey->dp[0U]));
+  KRML_HOST_FREE(skey->dp);
+  mont_ctx_clear_free(skey->ctx_p);
+  mont_ctx_clear_free(skey->ctx_q);
+  KRML_HOST_FREE(skey->pkey);
+  KRML_HOST_FREE(skey);
+}
+
+bool
+Hacl_RSAPSS_rsapss_crt_sign(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSAPSS_crt_skey *skey,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+)
+{
+  uint32_t modBits = skey->modBits;
+  uint32_t hLen = hash_len(a);
+  bool
+  b =
+    saltLen
+    <= (uint32_t)0xffffffffU - hLen - (uint32_t)8U
+    &&
+      saltLen
+      + hLen
+      + (uint32_t)2U
+      <= (modBits - (uint32_t)1U - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  if (!b)
+  {
+    return false;
+  }
+  uint32_t nLen = (modBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t pqLen = (skey->pqBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  uint32_t k = (modBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t emBits = modBits - (uint32_t)1U;
+  uint32_t emLen = (emBits - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint8_t), emLen);
+  uint8_t em[emLen];
+  memset(em, 0U, emLen * sizeof (uint8_t));
+  pss_encode(a, saltLen, salt, msgLen, msg, emBits, em);
+  /* m is loaded into twice the size of p and q, which is at least nLen. */
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen + pqLen);
+  uint64_t m[pqLen + pqLen];
+  memset(m, 0U, (pqLen + pqLen) * sizeof (uint64_t));
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(emLen, em, m);
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t mp[pqLen];
+  memset(mp, 0U, pqLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t mq[pqLen];
+  memset(mq, 0U, pqLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen);
+  uint64_t sp[pqLen];
+  memset(sp, 0U, pqLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen + pqLen);
+  uint64_t sq[pqLen + pqLen];
+  memset(sq, 0U, (pqLen + pqLen) * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen + pqLen);
+  uint64_t tmp[pqLen + pqLen];
+  memset(tmp, 0U, (pqLen + pqLen) * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), pqLen + pqLen);
+  uint64_t s[pqLen + pqLen];
+  memset(s, 0U, (pqLen + pqLen) * sizeof (uint64_t));
+  /* sp = m^dp mod p and sq = m^dq mod q */
+  Hacl_Bignum64_mod_precomp(skey->ctx_p, m, mp);
+  Hacl_Bignum64_mod_precomp(skey->ctx_q, m, mq);
+  Hacl_Bignum64_mod_exp_consttime_precomp(skey->ctx_p, mp, skey->pqBits, skey->dp, sp);
+  Hacl_Bignum64_mod_exp_consttime_precomp(skey->ctx_q, mq, skey->pqBits, skey->dq, sq);
+  /* h = qinv * (sp - sq) mod p, stored in mp */
+  Hacl_Bignum64_mod_precomp(skey->ctx_p, sq, mq);
+  Hacl_Bignum64_sub_mod(pqLen, skey->ctx_p->n, sp, mq, mp);
+  Hacl_Bignum64_mul(pqLen, mp, skey->qinv, tmp);
+  Hacl_Bignum64_mod_precomp(skey->ctx_p, tmp, mp);
+  /* s = sq + q * h < n */
+  Hacl_Bignum64_mul(pqLen, skey->ctx_q->n, mp, tmp);
+  uint64_t c = Hacl_Bignum64_add(pqLen + pqLen, tmp, sq, s);
+  /* Check s^e mod n = m before releasing s, as a fault in either half would
+     otherwise leak a factor of n. */
+  uint64_t *n = skey->pkey;
+  uint64_t *r2 = skey->pkey + nLen;
+  uint64_t *e = skey->pkey + nLen + nLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t m_[nLen];
+  memset(m_, 0U, nLen * sizeof (uint64_t));
+  uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(n[0U]);
+  Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64(nLen,
+    n,
+    mu,
+    r2,
+    s,
+    skey->eBits,
+    e,
+    m_);
+  uint64_t mask = FStar_UInt64_eq_mask(c, (uint64_t)0U);
+  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+  {
+    uint64_t uu____0 = FStar_UInt64_eq_mask(m[i], m_[i]);
+    mask = uu____0 & mask;
+  }
+  for (uint32_t i = nLen; i < pqLen + pqLen; i++)
+  {
+    uint64_t uu____1 = FStar_UInt64_eq_mask(s[i], (uint64_t)0U);
+    mask = uu____1 & mask;
+  }
+  uint64_t eq_m = mask;
+  for (uint32_t i = (uint32_t)0U; i < nLen; i++)
+  {
+    uint64_t *os = s;
+    uint64_t x = s[i];
+    uint64_t x0 = eq_m & x;
+    os[i] = x0;
+  }
+  Hacl_Bignum_Convert_bn_to_bytes_be_uint64(k, s, sgnt);
+  Lib_Memzero0_memzero(mp, pqLen * sizeof (mp[0U]));
+  Lib_Memzero0_memzero(mq, pqLen * sizeof (mq[0U]));
+  Lib_Memzero0_memzero(sp, pqLen * sizeof (sp[0U]));
+  Lib_Memzero0_memzero(sq, (pqLen + pqLen) * sizeof (sq[0U]));
+  Lib_Memzero0_memzero(tmp, (pqLen + pqLen) * sizeof (tmp[0U]));
+  return eq_m == (uint64_t)0xFFFFFFFFFFFFFFFFU;
+}
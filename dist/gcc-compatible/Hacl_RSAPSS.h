@@ -109,6 +109,63 @@ Hacl_RSAPSS_rsapss_pkey_verify(
   uint8_t *msg
 );
 
+/**
+A private key in Chinese Remainder Theorem form.
+
+  The type is opaque: use Hacl_RSAPSS_new_rsapss_load_crt_skey to create a key and
+  Hacl_RSAPSS_free_crt_skey to release it.
+*/
+typedef struct Hacl_RSAPSS_crt_skey_s Hacl_RSAPSS_crt_skey;
+
+/**
+Load a private key in CRT form.
+
+  nb and eb are as for Hacl_RSAPSS_new_rsapss_load_pkey. pb, qb, dpb, dqb and qinvb are
+  the big-endian encodings of p, q, d mod (p - 1), d mod (q - 1) and q^(-1) mod p, each
+  (pqBits - 1) / 8 + 1 bytes long, where pqBits is an upper bound on the number of bits
+  of p and q (modBits / 2 for the usual balanced keys).
+
+  The function returns NULL if an allocation fails, if p or q is not odd and greater
+  than 1, if p * q != n, or if dp or dq has more than pqBits bits. Otherwise, the caller
+  must eventually call Hacl_RSAPSS_free_crt_skey on the result.
+*/
+Hacl_RSAPSS_crt_skey
+*Hacl_RSAPSS_new_rsapss_load_crt_skey(
+  uint32_t modBits,
+  uint32_t eBits,
+  uint32_t pqBits,
+  uint8_t *nb,
+  uint8_t *eb,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb
+);
+
+/**
+Zero out and deallocate a key obtained through Hacl_RSAPSS_new_rsapss_load_crt_skey.
+*/
+void Hacl_RSAPSS_free_crt_skey(Hacl_RSAPSS_crt_skey *skey);
+
+/**
+Sign a message as Hacl_RSAPSS_rsapss_sign does, using two constant-time
+  exponentiations modulo p and q instead of one modulo n.
+
+  The signature is checked against the public exponent before it is released: on
+  failure, the function returns false and sgnt is zeroed.
+*/
+bool
+Hacl_RSAPSS_rsapss_crt_sign(
+  Spec_Hash_Definitions_hash_alg a,
+  Hacl_RSAPSS_crt_skey *skey,
+  uint32_t saltLen,
+  uint8_t *salt,
+  uint32_t msgLen,
+  uint8_t *msg,
+  uint8_t *sgnt
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -25,6 +25,7 @@
 #include "Hacl_SHA2_Vec256.h"
 
 #include "internal/Hacl_SHA2_Types.h"
+#include "Hacl_Hash_SHA2.h"
 #include "libintvector.h"
 static inline void
 sha224_update8(Hacl_Impl_SHA2_Types_uint8_8p block, Lib_IntVector_Intrinsics_vec256 *hash)
@@ -751,11 +752,111 @@ Hacl_SHA2_Vec256_sha224_8(
 }
 
 static inline void
-sha256_update8(Hacl_Impl_SHA2_Types_uint8_8p block, Lib_IntVector_Intrinsics_vec256 *hash)
+sha256_update8_ws(Lib_IntVector_Intrinsics_vec256 *ws, Lib_IntVector_Intrinsics_vec256 *hash)
 {
   KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 hash_old[8U] KRML_POST_ALIGN(32) = { 0U };
-  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ws[16U] KRML_POST_ALIGN(32) = { 0U };
   memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  KRML_MAYBE_FOR4(i0,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    KRML_MAYBE_FOR16(i,
+      (uint32_t)0U,
+      (uint32_t)16U,
+      (uint32_t)1U,
+      uint32_t k_t = Hacl_Impl_SHA2_Generic_k224_256[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec256 k_e_t = Lib_IntVector_Intrinsics_vec256_load32(k_t);
+      Lib_IntVector_Intrinsics_vec256
+      t1 =
+        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(h02,
+                Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0,
+                    (uint32_t)6U),
+                  Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0,
+                      (uint32_t)11U),
+                    Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)25U)))),
+              Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0),
+                Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0))),
+            k_e_t),
+          ws_t);
+      Lib_IntVector_Intrinsics_vec256
+      t2 =
+        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0,
+              (uint32_t)2U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0,
+                (uint32_t)13U),
+              Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)22U))),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0),
+              Lib_IntVector_Intrinsics_vec256_and(b0, c0))));
+      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_add32(t1, t2);
+      Lib_IntVector_Intrinsics_vec256 b1 = a0;
+      Lib_IntVector_Intrinsics_vec256 c1 = b0;
+      Lib_IntVector_Intrinsics_vec256 d1 = c0;
+      Lib_IntVector_Intrinsics_vec256 e1 = Lib_IntVector_Intrinsics_vec256_add32(d0, t1);
+      Lib_IntVector_Intrinsics_vec256 f1 = e0;
+      Lib_IntVector_Intrinsics_vec256 g1 = f0;
+      Lib_IntVector_Intrinsics_vec256 h12 = g0;
+      hash[0U] = a1;
+      hash[1U] = b1;
+      hash[2U] = c1;
+      hash[3U] = d1;
+      hash[4U] = e1;
+      hash[5U] = f1;
+      hash[6U] = g1;
+      hash[7U] = h12;);
+    if (i0 < (uint32_t)3U)
+    {
+      KRML_MAYBE_FOR16(i,
+        (uint32_t)0U,
+        (uint32_t)16U,
+        (uint32_t)1U,
+        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256
+        s1 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2,
+              (uint32_t)17U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2,
+                (uint32_t)19U),
+              Lib_IntVector_Intrinsics_vec256_shift_right32(t2, (uint32_t)10U)));
+        Lib_IntVector_Intrinsics_vec256
+        s0 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15,
+              (uint32_t)7U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15,
+                (uint32_t)18U),
+              Lib_IntVector_Intrinsics_vec256_shift_right32(t15, (uint32_t)3U)));
+        ws[i] =
+          Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(s1,
+                t7),
+              s0),
+            t16););
+    });
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    Lib_IntVector_Intrinsics_vec256 *os = hash;
+    Lib_IntVector_Intrinsics_vec256
+    x = Lib_IntVector_Intrinsics_vec256_add32(hash[i], hash_old[i]);
+    os[i] = x;);
+}
+
+static inline void
+sha256_update8(Hacl_Impl_SHA2_Types_uint8_8p block, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ws[16U] KRML_POST_ALIGN(32) = { 0U };
   uint8_t *b7 = block.snd.snd.snd.snd.snd.snd.snd;
   uint8_t *b6 = block.snd.snd.snd.snd.snd.snd.fst;
   uint8_t *b5 = block.snd.snd.snd.snd.snd.fst;
@@ -988,101 +1089,7 @@ sha256_update8(Hacl_Impl_SHA2_Types_uint8_8p block, Lib_IntVector_Intrinsics_vec
   ws[13U] = ws13;
   ws[14U] = ws14;
   ws[15U] = ws15;
-  KRML_MAYBE_FOR4(i0,
-    (uint32_t)0U,
-    (uint32_t)4U,
-    (uint32_t)1U,
-    KRML_MAYBE_FOR16(i,
-      (uint32_t)0U,
-      (uint32_t)16U,
-      (uint32_t)1U,
-      uint32_t k_t = Hacl_Impl_SHA2_Generic_k224_256[(uint32_t)16U * i0 + i];
-      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
-      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
-      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
-      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
-      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
-      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
-      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
-      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
-      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
-      Lib_IntVector_Intrinsics_vec256 k_e_t = Lib_IntVector_Intrinsics_vec256_load32(k_t);
-      Lib_IntVector_Intrinsics_vec256
-      t1 =
-        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(h02,
-                Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0,
-                    (uint32_t)6U),
-                  Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0,
-                      (uint32_t)11U),
-                    Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)25U)))),
-              Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0),
-                Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0))),
-            k_e_t),
-          ws_t);
-      Lib_IntVector_Intrinsics_vec256
-      t2 =
-        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0,
-              (uint32_t)2U),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0,
-                (uint32_t)13U),
-              Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)22U))),
-          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0),
-              Lib_IntVector_Intrinsics_vec256_and(b0, c0))));
-      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_add32(t1, t2);
-      Lib_IntVector_Intrinsics_vec256 b1 = a0;
-      Lib_IntVector_Intrinsics_vec256 c1 = b0;
-      Lib_IntVector_Intrinsics_vec256 d1 = c0;
-      Lib_IntVector_Intrinsics_vec256 e1 = Lib_IntVector_Intrinsics_vec256_add32(d0, t1);
-      Lib_IntVector_Intrinsics_vec256 f1 = e0;
-      Lib_IntVector_Intrinsics_vec256 g1 = f0;
-      Lib_IntVector_Intrinsics_vec256 h12 = g0;
-      hash[0U] = a1;
-      hash[1U] = b1;
-      hash[2U] = c1;
-      hash[3U] = d1;
-      hash[4U] = e1;
-      hash[5U] = f1;
-      hash[6U] = g1;
-      hash[7U] = h12;);
-    if (i0 < (uint32_t)3U)
-    {
-      KRML_MAYBE_FOR16(i,
-        (uint32_t)0U,
-        (uint32_t)16U,
-        (uint32_t)1U,
-        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
-        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
-        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
-        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
-        Lib_IntVector_Intrinsics_vec256
-        s1 =
-          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2,
-              (uint32_t)17U),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2,
-                (uint32_t)19U),
-              Lib_IntVector_Intrinsics_vec256_shift_right32(t2, (uint32_t)10U)));
-        Lib_IntVector_Intrinsics_vec256
-        s0 =
-          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15,
-              (uint32_t)7U),
-            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15,
-                (uint32_t)18U),
-              Lib_IntVector_Intrinsics_vec256_shift_right32(t15, (uint32_t)3U)));
-        ws[i] =
-          Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(s1,
-                t7),
-              s0),
-            t16););
-    });
-  KRML_MAYBE_FOR8(i,
-    (uint32_t)0U,
-    (uint32_t)8U,
-    (uint32_t)1U,
-    Lib_IntVector_Intrinsics_vec256 *os = hash;
-    Lib_IntVector_Intrinsics_vec256
-    x = Lib_IntVector_Intrinsics_vec256_add32(hash[i], hash_old[i]);
-    os[i] = x;);
+  sha256_update8_ws(ws, hash);
 }
 
 void
@@ -1902,143 +1909,10 @@ Hacl_SHA2_Vec256_sha384_4(
 }
 
 static inline void
-sha512_update4(Hacl_Impl_SHA2_Types_uint8_4p block, Lib_IntVector_Intrinsics_vec256 *hash)
+sha512_update4_ws(Lib_IntVector_Intrinsics_vec256 *ws, Lib_IntVector_Intrinsics_vec256 *hash)
 {
   KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 hash_old[8U] KRML_POST_ALIGN(32) = { 0U };
-  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ws[16U] KRML_POST_ALIGN(32) = { 0U };
   memcpy(hash_old, hash, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
-  uint8_t *b3 = block.snd.snd.snd;
-  uint8_t *b2 = block.snd.snd.fst;
-  uint8_t *b10 = block.snd.fst;
-  uint8_t *b00 = block.fst;
-  ws[0U] = Lib_IntVector_Intrinsics_vec256_load64_be(b00);
-  ws[1U] = Lib_IntVector_Intrinsics_vec256_load64_be(b10);
-  ws[2U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2);
-  ws[3U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3);
-  ws[4U] = Lib_IntVector_Intrinsics_vec256_load64_be(b00 + (uint32_t)32U);
-  ws[5U] = Lib_IntVector_Intrinsics_vec256_load64_be(b10 + (uint32_t)32U);
-  ws[6U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)32U);
-  ws[7U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)32U);
-  ws[8U] = Lib_IntVector_Intrinsics_vec256_load64_be(b00 + (uint32_t)64U);
-  ws[9U] = Lib_IntVector_Intrinsics_vec256_load64_be(b10 + (uint32_t)64U);
-  ws[10U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)64U);
-  ws[11U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)64U);
-  ws[12U] = Lib_IntVector_Intrinsics_vec256_load64_be(b00 + (uint32_t)96U);
-  ws[13U] = Lib_IntVector_Intrinsics_vec256_load64_be(b10 + (uint32_t)96U);
-  ws[14U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)96U);
-  ws[15U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)96U);
-  Lib_IntVector_Intrinsics_vec256 v00 = ws[0U];
-  Lib_IntVector_Intrinsics_vec256 v10 = ws[1U];
-  Lib_IntVector_Intrinsics_vec256 v20 = ws[2U];
-  Lib_IntVector_Intrinsics_vec256 v30 = ws[3U];
-  Lib_IntVector_Intrinsics_vec256
-  v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v00, v10);
-  Lib_IntVector_Intrinsics_vec256
-  v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v00, v10);
-  Lib_IntVector_Intrinsics_vec256
-  v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v20, v30);
-  Lib_IntVector_Intrinsics_vec256
-  v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v20, v30);
-  Lib_IntVector_Intrinsics_vec256
-  v0__ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_, v2_);
-  Lib_IntVector_Intrinsics_vec256
-  v1__ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_, v2_);
-  Lib_IntVector_Intrinsics_vec256
-  v2__ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_, v3_);
-  Lib_IntVector_Intrinsics_vec256
-  v3__ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_, v3_);
-  Lib_IntVector_Intrinsics_vec256 ws0 = v0__;
-  Lib_IntVector_Intrinsics_vec256 ws1 = v2__;
-  Lib_IntVector_Intrinsics_vec256 ws2 = v1__;
-  Lib_IntVector_Intrinsics_vec256 ws3 = v3__;
-  Lib_IntVector_Intrinsics_vec256 v01 = ws[4U];
-  Lib_IntVector_Intrinsics_vec256 v11 = ws[5U];
-  Lib_IntVector_Intrinsics_vec256 v21 = ws[6U];
-  Lib_IntVector_Intrinsics_vec256 v31 = ws[7U];
-  Lib_IntVector_Intrinsics_vec256
-  v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v01, v11);
-  Lib_IntVector_Intrinsics_vec256
-  v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v01, v11);
-  Lib_IntVector_Intrinsics_vec256
-  v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v21, v31);
-  Lib_IntVector_Intrinsics_vec256
-  v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v21, v31);
-  Lib_IntVector_Intrinsics_vec256
-  v0__0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
-  Lib_IntVector_Intrinsics_vec256
-  v1__0 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
-  Lib_IntVector_Intrinsics_vec256
-  v2__0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
-  Lib_IntVector_Intrinsics_vec256
-  v3__0 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
-  Lib_IntVector_Intrinsics_vec256 ws4 = v0__0;
-  Lib_IntVector_Intrinsics_vec256 ws5 = v2__0;
-  Lib_IntVector_Intrinsics_vec256 ws6 = v1__0;
-  Lib_IntVector_Intrinsics_vec256 ws7 = v3__0;
-  Lib_IntVector_Intrinsics_vec256 v02 = ws[8U];
-  Lib_IntVector_Intrinsics_vec256 v12 = ws[9U];
-  Lib_IntVector_Intrinsics_vec256 v22 = ws[10U];
-  Lib_IntVector_Intrinsics_vec256 v32 = ws[11U];
-  Lib_IntVector_Intrinsics_vec256
-  v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v02, v12);
-  Lib_IntVector_Intrinsics_vec256
-  v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v02, v12);
-  Lib_IntVector_Intrinsics_vec256
-  v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v22, v32);
-  Lib_IntVector_Intrinsics_vec256
-  v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v22, v32);
-  Lib_IntVector_Intrinsics_vec256
-  v0__1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v2_1);
-  Lib_IntVector_Intrinsics_vec256
-  v1__1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v2_1);
-  Lib_IntVector_Intrinsics_vec256
-  v2__1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v3_1);
-  Lib_IntVector_Intrinsics_vec256
-  v3__1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v3_1);
-  Lib_IntVector_Intrinsics_vec256 ws8 = v0__1;
-  Lib_IntVector_Intrinsics_vec256 ws9 = v2__1;
-  Lib_IntVector_Intrinsics_vec256 ws10 = v1__1;
-  Lib_IntVector_Intrinsics_vec256 ws11 = v3__1;
-  Lib_IntVector_Intrinsics_vec256 v0 = ws[12U];
-  Lib_IntVector_Intrinsics_vec256 v1 = ws[13U];
-  Lib_IntVector_Intrinsics_vec256 v2 = ws[14U];
-  Lib_IntVector_Intrinsics_vec256 v3 = ws[15U];
-  Lib_IntVector_Intrinsics_vec256
-  v0_2 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0, v1);
-  Lib_IntVector_Intrinsics_vec256
-  v1_2 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0, v1);
-  Lib_IntVector_Intrinsics_vec256
-  v2_2 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2, v3);
-  Lib_IntVector_Intrinsics_vec256
-  v3_2 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2, v3);
-  Lib_IntVector_Intrinsics_vec256
-  v0__2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_2, v2_2);
-  Lib_IntVector_Intrinsics_vec256
-  v1__2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_2, v2_2);
-  Lib_IntVector_Intrinsics_vec256
-  v2__2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_2, v3_2);
-  Lib_IntVector_Intrinsics_vec256
-  v3__2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_2, v3_2);
-  Lib_IntVector_Intrinsics_vec256 ws12 = v0__2;
-  Lib_IntVector_Intrinsics_vec256 ws13 = v2__2;
-  Lib_IntVector_Intrinsics_vec256 ws14 = v1__2;
-  Lib_IntVector_Intrinsics_vec256 ws15 = v3__2;
-  ws[0U] = ws0;
-  ws[1U] = ws1;
-  ws[2U] = ws2;
-  ws[3U] = ws3;
-  ws[4U] = ws4;
-  ws[5U] = ws5;
-  ws[6U] = ws6;
-  ws[7U] = ws7;
-  ws[8U] = ws8;
-  ws[9U] = ws9;
-  ws[10U] = ws10;
-  ws[11U] = ws11;
-  ws[12U] = ws12;
-  ws[13U] = ws13;
-  ws[14U] = ws14;
-  ws[15U] = ws15;
   KRML_MAYBE_FOR5(i0,
     (uint32_t)0U,
     (uint32_t)5U,
@@ -2136,6 +2010,145 @@ sha512_update4(Hacl_Impl_SHA2_Types_uint8_4p block, Lib_IntVector_Intrinsics_vec
     os[i] = x;);
 }
 
+static inline void
+sha512_update4(Hacl_Impl_SHA2_Types_uint8_4p block, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ws[16U] KRML_POST_ALIGN(32) = { 0U };
+  uint8_t *b3 = block.snd.snd.snd;
+  uint8_t *b2 = block.snd.snd.fst;
+  uint8_t *b10 = block.snd.fst;
+  uint8_t *b00 = block.fst;
+  ws[0U] = Lib_IntVector_Intrinsics_vec256_load64_be(b00);
+  ws[1U] = Lib_IntVector_Intrinsics_vec256_load64_be(b10);
+  ws[2U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2);
+  ws[3U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3);
+  ws[4U] = Lib_IntVector_Intrinsics_vec256_load64_be(b00 + (uint32_t)32U);
+  ws[5U] = Lib_IntVector_Intrinsics_vec256_load64_be(b10 + (uint32_t)32U);
+  ws[6U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)32U);
+  ws[7U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)32U);
+  ws[8U] = Lib_IntVector_Intrinsics_vec256_load64_be(b00 + (uint32_t)64U);
+  ws[9U] = Lib_IntVector_Intrinsics_vec256_load64_be(b10 + (uint32_t)64U);
+  ws[10U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)64U);
+  ws[11U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)64U);
+  ws[12U] = Lib_IntVector_Intrinsics_vec256_load64_be(b00 + (uint32_t)96U);
+  ws[13U] = Lib_IntVector_Intrinsics_vec256_load64_be(b10 + (uint32_t)96U);
+  ws[14U] = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + (uint32_t)96U);
+  ws[15U] = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + (uint32_t)96U);
+  Lib_IntVector_Intrinsics_vec256 v00 = ws[0U];
+  Lib_IntVector_Intrinsics_vec256 v10 = ws[1U];
+  Lib_IntVector_Intrinsics_vec256 v20 = ws[2U];
+  Lib_IntVector_Intrinsics_vec256 v30 = ws[3U];
+  Lib_IntVector_Intrinsics_vec256
+  v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v00, v10);
+  Lib_IntVector_Intrinsics_vec256
+  v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v00, v10);
+  Lib_IntVector_Intrinsics_vec256
+  v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v20, v30);
+  Lib_IntVector_Intrinsics_vec256
+  v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v20, v30);
+  Lib_IntVector_Intrinsics_vec256
+  v0__ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_, v2_);
+  Lib_IntVector_Intrinsics_vec256
+  v1__ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_, v2_);
+  Lib_IntVector_Intrinsics_vec256
+  v2__ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_, v3_);
+  Lib_IntVector_Intrinsics_vec256
+  v3__ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_, v3_);
+  Lib_IntVector_Intrinsics_vec256 ws0 = v0__;
+  Lib_IntVector_Intrinsics_vec256 ws1 = v2__;
+  Lib_IntVector_Intrinsics_vec256 ws2 = v1__;
+  Lib_IntVector_Intrinsics_vec256 ws3 = v3__;
+  Lib_IntVector_Intrinsics_vec256 v01 = ws[4U];
+  Lib_IntVector_Intrinsics_vec256 v11 = ws[5U];
+  Lib_IntVector_Intrinsics_vec256 v21 = ws[6U];
+  Lib_IntVector_Intrinsics_vec256 v31 = ws[7U];
+  Lib_IntVector_Intrinsics_vec256
+  v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v01, v11);
+  Lib_IntVector_Intrinsics_vec256
+  v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v01, v11);
+  Lib_IntVector_Intrinsics_vec256
+  v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v21, v31);
+  Lib_IntVector_Intrinsics_vec256
+  v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v21, v31);
+  Lib_IntVector_Intrinsics_vec256
+  v0__0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_0, v2_0);
+  Lib_IntVector_Intrinsics_vec256
+  v1__0 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_0, v2_0);
+  Lib_IntVector_Intrinsics_vec256
+  v2__0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_0, v3_0);
+  Lib_IntVector_Intrinsics_vec256
+  v3__0 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_0, v3_0);
+  Lib_IntVector_Intrinsics_vec256 ws4 = v0__0;
+  Lib_IntVector_Intrinsics_vec256 ws5 = v2__0;
+  Lib_IntVector_Intrinsics_vec256 ws6 = v1__0;
+  Lib_IntVector_Intrinsics_vec256 ws7 = v3__0;
+  Lib_IntVector_Intrinsics_vec256 v02 = ws[8U];
+  Lib_IntVector_Intrinsics_vec256 v12 = ws[9U];
+  Lib_IntVector_Intrinsics_vec256 v22 = ws[10U];
+  Lib_IntVector_Intrinsics_vec256 v32 = ws[11U];
+  Lib_IntVector_Intrinsics_vec256
+  v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v02, v12);
+  Lib_IntVector_Intrinsics_vec256
+  v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v02, v12);
+  Lib_IntVector_Intrinsics_vec256
+  v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v22, v32);
+  Lib_IntVector_Intrinsics_vec256
+  v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v22, v32);
+  Lib_IntVector_Intrinsics_vec256
+  v0__1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v2_1);
+  Lib_IntVector_Intrinsics_vec256
+  v1__1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v2_1);
+  Lib_IntVector_Intrinsics_vec256
+  v2__1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v3_1);
+  Lib_IntVector_Intrinsics_vec256
+  v3__1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v3_1);
+  Lib_IntVector_Intrinsics_vec256 ws8 = v0__1;
+  Lib_IntVector_Intrinsics_vec256 ws9 = v2__1;
+  Lib_IntVector_Intrinsics_vec256 ws10 = v1__1;
+  Lib_IntVector_Intrinsics_vec256 ws11 = v3__1;
+  Lib_IntVector_Intrinsics_vec256 v0 = ws[12U];
+  Lib_IntVector_Intrinsics_vec256 v1 = ws[13U];
+  Lib_IntVector_Intrinsics_vec256 v2 = ws[14U];
+  Lib_IntVector_Intrinsics_vec256 v3 = ws[15U];
+  Lib_IntVector_Intrinsics_vec256
+  v0_2 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0, v1);
+  Lib_IntVector_Intrinsics_vec256
+  v1_2 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0, v1);
+  Lib_IntVector_Intrinsics_vec256
+  v2_2 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2, v3);
+  Lib_IntVector_Intrinsics_vec256
+  v3_2 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2, v3);
+  Lib_IntVector_Intrinsics_vec256
+  v0__2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_2, v2_2);
+  Lib_IntVector_Intrinsics_vec256
+  v1__2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_2, v2_2);
+  Lib_IntVector_Intrinsics_vec256
+  v2__2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_2, v3_2);
+  Lib_IntVector_Intrinsics_vec256
+  v3__2 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_2, v3_2);
+  Lib_IntVector_Intrinsics_vec256 ws12 = v0__2;
+  Lib_IntVector_Intrinsics_vec256 ws13 = v2__2;
+  Lib_IntVector_Intrinsics_vec256 ws14 = v1__2;
+  Lib_IntVector_Intrinsics_vec256 ws15 = v3__2;
+  ws[0U] = ws0;
+  ws[1U] = ws1;
+  ws[2U] = ws2;
+  ws[3U] = ws3;
+  ws[4U] = ws4;
+  ws[5U] = ws5;
+  ws[6U] = ws6;
+  ws[7U] = ws7;
+  ws[8U] = ws8;
+  ws[9U] = ws9;
+  ws[10U] = ws10;
+  ws[11U] = ws11;
+  ws[12U] = ws12;
+  ws[13U] = ws13;
+  ws[14U] = ws14;
+  ws[15U] = ws15;
+  sha512_update4_ws(ws, hash);
+}
+
 void
 Hacl_SHA2_Vec256_sha512_4(
   uint8_t *dst0,
@@ -2328,3 +2341,575 @@ Hacl_SHA2_Vec256_sha512_4(
   memcpy(b31, hbuf + (uint32_t)192U, (uint32_t)64U * sizeof (uint8_t));
 }
 
+/* Multi-lane HMAC and PBKDF2. The chaining values of the lanes are kept transposed, one
+   vector per word, as in the hash functions above. */
+
+static inline Hacl_Impl_SHA2_Types_uint8_8p lanes8(uint8_t **b, uint32_t off)
+{
+  Hacl_Impl_SHA2_Types_uint8_8p
+  lb =
+    {
+      .fst = b[0U] + off,
+      .snd = {
+        .fst = b[1U] + off,
+        .snd = {
+          .fst = b[2U] + off,
+          .snd = {
+            .fst = b[3U] + off,
+            .snd = {
+              .fst = b[4U] + off,
+              .snd = { .fst = b[5U] + off, .snd = { .fst = b[6U] + off, .snd = b[7U] + off } }
+            }
+          }
+        }
+      }
+    };
+  return lb;
+}
+
+static inline void
+hmac_sha256_keys8(
+  uint8_t **key,
+  uint32_t *key_len,
+  Lib_IntVector_Intrinsics_vec256 *ist,
+  Lib_IntVector_Intrinsics_vec256 *ost
+)
+{
+  uint8_t ipad[512U] = { 0U };
+  uint8_t opad[512U] = { 0U };
+  uint8_t *ip[8U];
+  uint8_t *op[8U];
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    ip[i] = ipad + i * (uint32_t)64U;
+    op[i] = opad + i * (uint32_t)64U;
+    if (key_len[i] <= (uint32_t)64U)
+    {
+      memcpy(ip[i], key[i], key_len[i] * sizeof (uint8_t));
+    }
+    else
+    {
+      Hacl_Hash_SHA2_hash_256(key[i], key_len[i], ip[i]);
+    });
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)512U; i++)
+  {
+    uint8_t k = ipad[i];
+    ipad[i] = (uint8_t)0x36U ^ k;
+    opad[i] = (uint8_t)0x5cU ^ k;
+  }
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    uint32_t hi = Hacl_Impl_SHA2_Generic_h256[i];
+    ist[i] = Lib_IntVector_Intrinsics_vec256_load32(hi);
+    ost[i] = Lib_IntVector_Intrinsics_vec256_load32(hi););
+  sha256_update8(lanes8(ip, (uint32_t)0U), ist);
+  sha256_update8(lanes8(op, (uint32_t)0U), ost);
+}
+
+/* Hashes data || suffix into st, which holds the chaining values after the inner padded
+   keys. The data of all lanes have the same length, and suffix_len is at most 4. */
+static inline void
+hmac_sha256_inner8(
+  Lib_IntVector_Intrinsics_vec256 *st,
+  uint8_t **data,
+  uint32_t data_len,
+  uint8_t *suffix,
+  uint32_t suffix_len
+)
+{
+  uint32_t blocks0 = data_len / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < blocks0; i++)
+  {
+    sha256_update8(lanes8(data, i * (uint32_t)64U), st);
+  }
+  uint32_t rem = data_len % (uint32_t)64U;
+  uint32_t len = rem + suffix_len;
+  uint32_t blocks;
+  if (len + (uint32_t)8U + (uint32_t)1U <= (uint32_t)64U)
+  {
+    blocks = (uint32_t)1U;
+  }
+  else
+  {
+    blocks = (uint32_t)2U;
+  }
+  uint32_t fin = blocks * (uint32_t)64U;
+  uint8_t last[1024U] = { 0U };
+  uint8_t *lp[8U];
+  uint8_t totlen_buf[8U] = { 0U };
+  store64_be(totlen_buf, ((uint64_t)64U + (uint64_t)data_len + (uint64_t)suffix_len) << (uint32_t)3U);
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    uint8_t *l = last + i * (uint32_t)128U;
+    memcpy(l, data[i] + data_len - rem, rem * sizeof (uint8_t));
+    memcpy(l + rem, suffix, suffix_len * sizeof (uint8_t));
+    l[len] = (uint8_t)0x80U;
+    memcpy(l + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+    lp[i] = l;);
+  sha256_update8(lanes8(lp, (uint32_t)0U), st);
+  if (blocks > (uint32_t)1U)
+  {
+    sha256_update8(lanes8(lp, (uint32_t)64U), st);
+  }
+}
+
+/* st := the compression of the digests h, padded as the end of a 96-byte message, from
+   the chaining values st0. This is both the outer hash of HMAC and the inner hash of
+   HMAC over a digest. The digests stay transposed, so no byte conversion is needed. */
+static inline void
+hmac_sha256_step8(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  Lib_IntVector_Intrinsics_vec256 *st0,
+  Lib_IntVector_Intrinsics_vec256 *st
+)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ws[16U] KRML_POST_ALIGN(32) = { 0U };
+  memcpy(ws, h, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  ws[8U] = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)0x80000000U);
+  ws[15U] = Lib_IntVector_Intrinsics_vec256_load32((uint32_t)768U);
+  memcpy(st, st0, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  sha256_update8_ws(ws, st);
+}
+
+static inline void store_lanes8(Lib_IntVector_Intrinsics_vec256 *st, uint8_t *hbuf)
+{
+  uint8_t tmp[32U] = { 0U };
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    Lib_IntVector_Intrinsics_vec256_store32_le(tmp, st[i]);
+    KRML_MAYBE_FOR8(j,
+      (uint32_t)0U,
+      (uint32_t)8U,
+      (uint32_t)1U,
+      store32_be(hbuf + j * (uint32_t)32U + i * (uint32_t)4U, load32_le(tmp + j * (uint32_t)4U));););
+}
+
+void
+Hacl_SHA2_Vec256_hmac_sha256_8(
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t data_len
+)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ist[8U] KRML_POST_ALIGN(32) = { 0U };
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ost[8U] KRML_POST_ALIGN(32) = { 0U };
+  uint8_t suffix[4U] = { 0U };
+  uint8_t hbuf[256U] = { 0U };
+  hmac_sha256_keys8(key, key_len, ist, ost);
+  hmac_sha256_inner8(ist, data, data_len, suffix, (uint32_t)0U);
+  hmac_sha256_step8(ist, ost, ist);
+  store_lanes8(ist, hbuf);
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    memcpy(dst[i], hbuf + i * (uint32_t)32U, (uint32_t)32U * sizeof (uint8_t)););
+}
+
+void
+Hacl_SHA2_Vec256_pbkdf2_sha256_8(
+  uint8_t **dst,
+  uint32_t dst_len,
+  uint8_t **password,
+  uint32_t *password_len,
+  uint8_t **salt,
+  uint32_t salt_len,
+  uint32_t iterations
+)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ist[8U] KRML_POST_ALIGN(32) = { 0U };
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ost[8U] KRML_POST_ALIGN(32) = { 0U };
+  hmac_sha256_keys8(password, password_len, ist, ost);
+  uint32_t n = (dst_len + (uint32_t)31U) / (uint32_t)32U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 h[8U] KRML_POST_ALIGN(32) = { 0U };
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 u[8U] KRML_POST_ALIGN(32) = { 0U };
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 t[8U] KRML_POST_ALIGN(32) = { 0U };
+    uint8_t ctr[4U] = { 0U };
+    store32_be(ctr, i + (uint32_t)1U);
+    memcpy(h, ist, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    hmac_sha256_inner8(h, salt, salt_len, ctr, (uint32_t)4U);
+    hmac_sha256_step8(h, ost, u);
+    memcpy(t, u, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    for (uint32_t j = (uint32_t)1U; j < iterations; j++)
+    {
+      hmac_sha256_step8(u, ist, h);
+      hmac_sha256_step8(h, ost, u);
+      KRML_MAYBE_FOR8(k,
+        (uint32_t)0U,
+        (uint32_t)8U,
+        (uint32_t)1U,
+        t[k] = Lib_IntVector_Intrinsics_vec256_xor(t[k], u[k]););
+    }
+    uint8_t hbuf[256U] = { 0U };
+    store_lanes8(t, hbuf);
+    uint32_t len = dst_len - i * (uint32_t)32U;
+    if (len > (uint32_t)32U)
+    {
+      len = (uint32_t)32U;
+    }
+    KRML_MAYBE_FOR8(k,
+      (uint32_t)0U,
+      (uint32_t)8U,
+      (uint32_t)1U,
+      memcpy(dst[k] + i * (uint32_t)32U, hbuf + k * (uint32_t)32U, len * sizeof (uint8_t)););
+  }
+}
+
+static inline Hacl_Impl_SHA2_Types_uint8_4p lanes4(uint8_t **b, uint32_t off)
+{
+  Hacl_Impl_SHA2_Types_uint8_4p
+  lb =
+    {
+      .fst = b[0U] + off,
+      .snd = { .fst = b[1U] + off, .snd = { .fst = b[2U] + off, .snd = b[3U] + off } }
+    };
+  return lb;
+}
+
+static inline void
+hmac_sha512_keys4(
+  uint8_t **key,
+  uint32_t *key_len,
+  Lib_IntVector_Intrinsics_vec256 *ist,
+  Lib_IntVector_Intrinsics_vec256 *ost
+)
+{
+  uint8_t ipad[512U] = { 0U };
+  uint8_t opad[512U] = { 0U };
+  uint8_t *ip[4U];
+  uint8_t *op[4U];
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    ip[i] = ipad + i * (uint32_t)128U;
+    op[i] = opad + i * (uint32_t)128U;
+    if (key_len[i] <= (uint32_t)128U)
+    {
+      memcpy(ip[i], key[i], key_len[i] * sizeof (uint8_t));
+    }
+    else
+    {
+      Hacl_Hash_SHA2_hash_512(key[i], key_len[i], ip[i]);
+    });
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)512U; i++)
+  {
+    uint8_t k = ipad[i];
+    ipad[i] = (uint8_t)0x36U ^ k;
+    opad[i] = (uint8_t)0x5cU ^ k;
+  }
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    uint64_t hi = Hacl_Impl_SHA2_Generic_h512[i];
+    ist[i] = Lib_IntVector_Intrinsics_vec256_load64(hi);
+    ost[i] = Lib_IntVector_Intrinsics_vec256_load64(hi););
+  sha512_update4(lanes4(ip, (uint32_t)0U), ist);
+  sha512_update4(lanes4(op, (uint32_t)0U), ost);
+}
+
+/* As hmac_sha256_inner8, with four lanes of SHA2-512 */
+static inline void
+hmac_sha512_inner4(
+  Lib_IntVector_Intrinsics_vec256 *st,
+  uint8_t **data,
+  uint32_t data_len,
+  uint8_t *suffix,
+  uint32_t suffix_len
+)
+{
+  uint32_t blocks0 = data_len / (uint32_t)128U;
+  for (uint32_t i = (uint32_t)0U; i < blocks0; i++)
+  {
+    sha512_update4(lanes4(data, i * (uint32_t)128U), st);
+  }
+  uint32_t rem = data_len % (uint32_t)128U;
+  uint32_t len = rem + suffix_len;
+  uint32_t blocks;
+  if (len + (uint32_t)16U + (uint32_t)1U <= (uint32_t)128U)
+  {
+    blocks = (uint32_t)1U;
+  }
+  else
+  {
+    blocks = (uint32_t)2U;
+  }
+  uint32_t fin = blocks * (uint32_t)128U;
+  uint8_t last[1024U] = { 0U };
+  uint8_t *lp[4U];
+  uint8_t totlen_buf[8U] = { 0U };
+  store64_be(totlen_buf,
+    ((uint64_t)128U + (uint64_t)data_len + (uint64_t)suffix_len) << (uint32_t)3U);
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    uint8_t *l = last + i * (uint32_t)256U;
+    memcpy(l, data[i] + data_len - rem, rem * sizeof (uint8_t));
+    memcpy(l + rem, suffix, suffix_len * sizeof (uint8_t));
+    l[len] = (uint8_t)0x80U;
+    memcpy(l + fin - (uint32_t)8U, totlen_buf, (uint32_t)8U * sizeof (uint8_t));
+    lp[i] = l;);
+  sha512_update4(lanes4(lp, (uint32_t)0U), st);
+  if (blocks > (uint32_t)1U)
+  {
+    sha512_update4(lanes4(lp, (uint32_t)128U), st);
+  }
+}
+
+/* As hmac_sha256_step8, for digests at the end of a 192-byte message */
+static inline void
+hmac_sha512_step4(
+  Lib_IntVector_Intrinsics_vec256 *h,
+  Lib_IntVector_Intrinsics_vec256 *st0,
+  Lib_IntVector_Intrinsics_vec256 *st
+)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ws[16U] KRML_POST_ALIGN(32) = { 0U };
+  memcpy(ws, h, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  ws[8U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x8000000000000000U);
+  ws[15U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)1536U);
+  memcpy(st, st0, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  sha512_update4_ws(ws, st);
+}
+
+static inline void store_lanes4(Lib_IntVector_Intrinsics_vec256 *st, uint8_t *hbuf)
+{
+  uint8_t tmp[32U] = { 0U };
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    Lib_IntVector_Intrinsics_vec256_store64_le(tmp, st[i]);
+    KRML_MAYBE_FOR4(j,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      store64_be(hbuf + j * (uint32_t)64U + i * (uint32_t)8U, load64_le(tmp + j * (uint32_t)8U));););
+}
+
+void
+Hacl_SHA2_Vec256_hmac_sha512_4(
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t data_len
+)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ist[8U] KRML_POST_ALIGN(32) = { 0U };
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ost[8U] KRML_POST_ALIGN(32) = { 0U };
+  uint8_t suffix[4U] = { 0U };
+  uint8_t hbuf[256U] = { 0U };
+  hmac_sha512_keys4(key, key_len, ist, ost);
+  hmac_sha512_inner4(ist, data, data_len, suffix, (uint32_t)0U);
+  hmac_sha512_step4(ist, ost, ist);
+  store_lanes4(ist, hbuf);
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    memcpy(dst[i], hbuf + i * (uint32_t)64U, (uint32_t)64U * sizeof (uint8_t)););
+}
+
+void
+Hacl_SHA2_Vec256_pbkdf2_sha512_4(
+  uint8_t **dst,
+  uint32_t dst_len,
+  uint8_t **password,
+  uint32_t *password_len,
+  uint8_t **salt,
+  uint32_t salt_len,
+  uint32_t iterations
+)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ist[8U] KRML_POST_ALIGN(32) = { 0U };
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ost[8U] KRML_POST_ALIGN(32) = { 0U };
+  hmac_sha512_keys4(password, password_len, ist, ost);
+  uint32_t n = (dst_len + (uint32_t)63U) / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 h[8U] KRML_POST_ALIGN(32) = { 0U };
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 u[8U] KRML_POST_ALIGN(32) = { 0U };
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 t[8U] KRML_POST_ALIGN(32) = { 0U };
+    uint8_t ctr[4U] = { 0U };
+    store32_be(ctr, i + (uint32_t)1U);
+    memcpy(h, ist, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    hmac_sha512_inner4(h, salt, salt_len, ctr, (uint32_t)4U);
+    hmac_sha512_step4(h, ost, u);
+    memcpy(t, u, (uint32_t)8U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    for (uint32_t j = (uint32_t)1U; j < iterations; j++)
+    {
+      hmac_sha512_step4(u, ist, h);
+      hmac_sha512_step4(h, ost, u);
+      KRML_MAYBE_FOR8(k,
+        (uint32_t)0U,
+        (uint32_t)8U,
+        (uint32_t)1U,
+        t[k] = Lib_IntVector_Intrinsics_vec256_xor(t[k], u[k]););
+    }
+    uint8_t hbuf[256U] = { 0U };
+    store_lanes4(t, hbuf);
+    uint32_t len = dst_len - i * (uint32_t)64U;
+    if (len > (uint32_t)64U)
+    {
+      len = (uint32_t)64U;
+    }
+    KRML_MAYBE_FOR4(k,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      memcpy(dst[k] + i * (uint32_t)64U, hbuf + k * (uint32_t)64U, len * sizeof (uint8_t)););
+  }
+}
+
+
+/* Single-stream SHA2-384/512. The message schedules of up to four consecutive blocks are
+   computed side by side, one block per lane, and the rounds then run in scalar code over the
+   precomputed words. */
+
+static inline void
+sha512_schedule4(uint8_t *b0, uint8_t *b1, uint8_t *b2, uint8_t *b3, uint8_t *wk)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ws[16U] KRML_POST_ALIGN(32) = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t off = i * (uint32_t)32U;
+    Lib_IntVector_Intrinsics_vec256 v0 = Lib_IntVector_Intrinsics_vec256_load64_be(b0 + off);
+    Lib_IntVector_Intrinsics_vec256 v1 = Lib_IntVector_Intrinsics_vec256_load64_be(b1 + off);
+    Lib_IntVector_Intrinsics_vec256 v2 = Lib_IntVector_Intrinsics_vec256_load64_be(b2 + off);
+    Lib_IntVector_Intrinsics_vec256 v3 = Lib_IntVector_Intrinsics_vec256_load64_be(b3 + off);
+    Lib_IntVector_Intrinsics_vec256
+    v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0, v1);
+    Lib_IntVector_Intrinsics_vec256
+    v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0, v1);
+    Lib_IntVector_Intrinsics_vec256
+    v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2, v3);
+    Lib_IntVector_Intrinsics_vec256
+    v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2, v3);
+    ws[(uint32_t)4U * i] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_, v2_);
+    ws[(uint32_t)4U * i + (uint32_t)1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_, v3_);
+    ws[(uint32_t)4U * i + (uint32_t)2U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_, v2_);
+    ws[(uint32_t)4U * i + (uint32_t)3U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_, v3_);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)80U; i++)
+  {
+    uint32_t j = i % (uint32_t)16U;
+    if (i >= (uint32_t)16U)
+    {
+      Lib_IntVector_Intrinsics_vec256 t16 = ws[j];
+      Lib_IntVector_Intrinsics_vec256 t15 = ws[(j + (uint32_t)1U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec256 t7 = ws[(j + (uint32_t)9U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec256 t2 = ws[(j + (uint32_t)14U) % (uint32_t)16U];
+      Lib_IntVector_Intrinsics_vec256
+      s1 =
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2,
+            (uint32_t)19U),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2,
+              (uint32_t)61U),
+            Lib_IntVector_Intrinsics_vec256_shift_right64(t2, (uint32_t)6U)));
+      Lib_IntVector_Intrinsics_vec256
+      s0 =
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15,
+            (uint32_t)1U),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15,
+              (uint32_t)8U),
+            Lib_IntVector_Intrinsics_vec256_shift_right64(t15, (uint32_t)7U)));
+      ws[j] =
+        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(s1,
+              t7),
+            s0),
+          t16);
+    }
+    /* Word i of lane l, plus the round constant, is at offset 8 * (4 * i + l). */
+    Lib_IntVector_Intrinsics_vec256_store64_le(wk + i * (uint32_t)32U,
+      Lib_IntVector_Intrinsics_vec256_add64(ws[j],
+        Lib_IntVector_Intrinsics_vec256_load64(Hacl_Impl_SHA2_Generic_k384_512[i])));
+  }
+}
+
+static inline void sha512_rounds(uint64_t *hash, uint8_t *wk, uint32_t lane)
+{
+  uint64_t a = hash[0U];
+  uint64_t b = hash[1U];
+  uint64_t c = hash[2U];
+  uint64_t d = hash[3U];
+  uint64_t e = hash[4U];
+  uint64_t f = hash[5U];
+  uint64_t g = hash[6U];
+  uint64_t h = hash[7U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)80U; i++)
+  {
+    uint64_t w = load64_le(wk + ((uint32_t)4U * i + lane) * (uint32_t)8U);
+    uint64_t
+    t1 =
+      h
+      +
+        ((e >> (uint32_t)14U | e << (uint32_t)50U)
+        ^ ((e >> (uint32_t)18U | e << (uint32_t)46U) ^ (e >> (uint32_t)41U | e << (uint32_t)23U)))
+      + ((e & f) ^ (~e & g))
+      + w;
+    uint64_t
+    t2 =
+      ((a >> (uint32_t)28U | a << (uint32_t)36U)
+      ^ ((a >> (uint32_t)34U | a << (uint32_t)30U) ^ (a >> (uint32_t)39U | a << (uint32_t)25U)))
+      + ((a & b) ^ ((a & c) ^ (b & c)));
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+  hash[0U] = hash[0U] + a;
+  hash[1U] = hash[1U] + b;
+  hash[2U] = hash[2U] + c;
+  hash[3U] = hash[3U] + d;
+  hash[4U] = hash[4U] + e;
+  hash[5U] = hash[5U] + f;
+  hash[6U] = hash[6U] + g;
+  hash[7U] = hash[7U] + h;
+}
+
+/**
+Process `n_blocks` consecutive 128-byte blocks of a single SHA2-384 or SHA2-512 message;
+  a drop-in replacement for `Hacl_Hash_SHA2_update_multi_512`.
+
+  The message schedules of four blocks at a time are computed in the lanes of 256-bit
+  vectors, and the rounds run in scalar code.
+*/
+void Hacl_SHA2_Vec256_sha512_update_multi(uint64_t *s, uint8_t *blocks, uint32_t n_blocks)
+{
+  /* Every word is written by sha512_schedule4 before it is read. */
+  KRML_PRE_ALIGN(32) uint8_t wk[2560U] KRML_POST_ALIGN(32);
+  for (uint32_t i = (uint32_t)0U; i < n_blocks; i = i + (uint32_t)4U)
+  {
+    uint32_t n = n_blocks - i < (uint32_t)4U ? n_blocks - i : (uint32_t)4U;
+    /* Missing lanes of the last group repeat its last block; their words are not used. */
+    uint8_t *b0 = blocks + i * (uint32_t)128U;
+    uint8_t *b1 = b0 + (n > (uint32_t)1U ? (uint32_t)128U : (uint32_t)0U);
+    uint8_t *b2 = b0 + (n > (uint32_t)2U ? (uint32_t)256U : (n - (uint32_t)1U) * (uint32_t)128U);
+    uint8_t *b3 = b0 + (n - (uint32_t)1U) * (uint32_t)128U;
+    sha512_schedule4(b0, b1, b2, b3, wk);
+    for (uint32_t l = (uint32_t)0U; l < n; l++)
+    {
+      sha512_rounds(s, wk, l);
+    }
+  }
+}
+
@@ -106,6 +106,77 @@ Hacl_SHA2_Vec256_sha512_4(
   uint8_t *input3
 );
 
+/**
+Compute HMAC-SHA2-256 in eight independent lanes.
+
+  Lane `i` writes the 32-byte MAC of `data[i]` under the key `key[i]` of length
+  `key_len[i]` to `dst[i]`. The messages of all lanes have the same length `data_len`.
+  The caller must check that the CPU supports AVX2.
+*/
+void
+Hacl_SHA2_Vec256_hmac_sha256_8(
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t data_len
+);
+
+/**
+Compute PBKDF2-HMAC-SHA2-256 for eight independent passwords.
+
+  Lane `i` writes `dst_len` bytes derived from the password `password[i]` of length
+  `password_len[i]` and the salt `salt[i]` to `dst[i]`, with `iterations` iterations,
+  which must be at least 1. The salts of all lanes have the same length `salt_len`.
+  The caller must check that the CPU supports AVX2.
+*/
+void
+Hacl_SHA2_Vec256_pbkdf2_sha256_8(
+  uint8_t **dst,
+  uint32_t dst_len,
+  uint8_t **password,
+  uint32_t *password_len,
+  uint8_t **salt,
+  uint32_t salt_len,
+  uint32_t iterations
+);
+
+/**
+Compute HMAC-SHA2-512 in four independent lanes, as `Hacl_SHA2_Vec256_hmac_sha256_8`.
+*/
+void
+Hacl_SHA2_Vec256_hmac_sha512_4(
+  uint8_t **dst,
+  uint8_t **key,
+  uint32_t *key_len,
+  uint8_t **data,
+  uint32_t data_len
+);
+
+/**
+Compute PBKDF2-HMAC-SHA2-512 for four independent passwords, as
+`Hacl_SHA2_Vec256_pbkdf2_sha256_8`.
+*/
+void
+Hacl_SHA2_Vec256_pbkdf2_sha512_4(
+  uint8_t **dst,
+  uint32_t dst_len,
+  uint8_t **password,
+  uint32_t *password_len,
+  uint8_t **salt,
+  uint32_t salt_len,
+  uint32_t iterations
+);
+
+/**
+Process `n_blocks` consecutive 128-byte blocks of a single SHA2-384 or SHA2-512 message;
+  a drop-in replacement for `Hacl_Hash_SHA2_update_multi_512`.
+
+  The message schedules of four blocks at a time are computed in the lanes of 256-bit
+  vectors, and the rounds run in scalar code.
+*/
+void Hacl_SHA2_Vec256_sha512_update_multi(uint64_t *s, uint8_t *blocks, uint32_t n_blocks);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -572,3 +572,115 @@ Hacl_Streaming_Blake2b_256_blake2b_256_no_key_free(
   KRML_HOST_FREE(s);
 }
 
+/* Set up the parameter block and buffer the zero-padded key as the first block of input,
+   so that the unkeyed streaming functions process it like message data: it is compressed
+   lazily, and flagged as the last block when no data follows. */
+static void blake2b_256_keyed_reset(Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state *s)
+{
+  Hacl_Streaming_Blake2b_256_blake2b_256_state *st = s->state;
+  Hacl_Blake2b_256_blake2b_init(st->block_state.snd, s->key_len, s->digest_len);
+  Lib_IntVector_Intrinsics_vec256 *r1 = st->block_state.snd + (uint32_t)1U;
+  r1[0U] =
+    Lib_IntVector_Intrinsics_vec256_xor(r1[0U],
+      Lib_IntVector_Intrinsics_vec256_load64s(load64_le(s->salt),
+        load64_le(s->salt + (uint32_t)8U),
+        load64_le(s->personal),
+        load64_le(s->personal + (uint32_t)8U)));
+  memset(st->buf, 0U, (uint32_t)128U * sizeof (uint8_t));
+  memcpy(st->buf, s->key, s->key_len * sizeof (uint8_t));
+  if (s->key_len == (uint32_t)0U)
+  {
+    st->total_len = (uint64_t)0U;
+  }
+  else
+  {
+    st->total_len = (uint64_t)(uint32_t)128U;
+  }
+}
+
+/**
+  State allocation function for keyed and parameterized BLAKE2b.
+
+  @param key Pointer to `key_len` bytes of key; may be NULL when `key_len` is 0.
+  @param key_len Length of the key, at most 64. A zero-length key means unkeyed hashing.
+  @param salt Pointer to 16 bytes of salt, or NULL for an all-zero salt.
+  @param personal Pointer to 16 bytes of personalization, or NULL for all zeroes.
+  @param digest_len Length of the digest produced by `finish`, between 1 and 64.
+
+  Returns NULL if `key_len` or `digest_len` is out of range.
+*/
+Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state
+*Hacl_Streaming_Blake2b_256_blake2b_256_keyed_create_in(
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *salt,
+  uint8_t *personal,
+  uint32_t digest_len
+)
+{
+  if (key_len > (uint32_t)64U || digest_len == (uint32_t)0U || digest_len > (uint32_t)64U)
+  {
+    return NULL;
+  }
+  Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state
+  *s = KRML_HOST_CALLOC((uint32_t)1U, sizeof (Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state));
+  s->state = Hacl_Streaming_Blake2b_256_blake2b_256_no_key_create_in();
+  memcpy(s->key, key, key_len * sizeof (uint8_t));
+  s->key_len = key_len;
+  if (salt != NULL)
+  {
+    memcpy(s->salt, salt, (uint32_t)16U * sizeof (uint8_t));
+  }
+  if (personal != NULL)
+  {
+    memcpy(s->personal, personal, (uint32_t)16U * sizeof (uint8_t));
+  }
+  s->digest_len = digest_len;
+  blake2b_256_keyed_reset(s);
+  return s;
+}
+
+/**
+  (Re-)initialization function with the key and parameters given at allocation
+*/
+void Hacl_Streaming_Blake2b_256_blake2b_256_keyed_init(Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state *s)
+{
+  blake2b_256_keyed_reset(s);
+}
+
+/**
+  Update function for keyed and parameterized states
+*/
+void
+Hacl_Streaming_Blake2b_256_blake2b_256_keyed_update(
+  Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state *s,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_Blake2b_256_blake2b_256_no_key_update(s->state, data, len);
+}
+
+/**
+  Finish function for keyed and parameterized states; writes `digest_len` bytes to `dst`.
+*/
+void Hacl_Streaming_Blake2b_256_blake2b_256_keyed_finish(Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state *s, uint8_t *dst)
+{
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Streaming_Blake2b_256_blake2b_256_no_key_finish(s->state, tmp);
+  memcpy(dst, tmp, s->digest_len * sizeof (uint8_t));
+  Lib_Memzero0_memzero(tmp, (uint32_t)64U * sizeof (tmp[0U]));
+}
+
+/**
+  Free state function for keyed and parameterized states; zeroes the key material.
+*/
+void Hacl_Streaming_Blake2b_256_blake2b_256_keyed_free(Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state *s)
+{
+  Hacl_Streaming_Blake2b_256_blake2b_256_state *st = s->state;
+  Lib_Memzero0_memzero(st->buf, (uint32_t)128U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(st->block_state.snd, (uint32_t)4U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  Hacl_Streaming_Blake2b_256_blake2b_256_no_key_free(st);
+  Lib_Memzero0_memzero(s->key, (uint32_t)64U * sizeof (uint8_t));
+  KRML_HOST_FREE(s);
+}
@@ -97,6 +97,62 @@ Hacl_Streaming_Blake2b_256_blake2b_256_no_key_free(
   Hacl_Streaming_Blake2b_256_blake2b_256_state *s
 );
 
+typedef struct Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state_s
+{
+  Hacl_Streaming_Blake2b_256_blake2b_256_state *state;
+  uint8_t key[64U];
+  uint32_t key_len;
+  uint8_t salt[16U];
+  uint8_t personal[16U];
+  uint32_t digest_len;
+}
+Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state;
+
+/**
+  State allocation function for keyed and parameterized BLAKE2b.
+
+  @param key Pointer to `key_len` bytes of key; may be NULL when `key_len` is 0.
+  @param key_len Length of the key, at most 64. A zero-length key means unkeyed hashing.
+  @param salt Pointer to 16 bytes of salt, or NULL for an all-zero salt.
+  @param personal Pointer to 16 bytes of personalization, or NULL for all zeroes.
+  @param digest_len Length of the digest produced by `finish`, between 1 and 64.
+
+  Returns NULL if `key_len` or `digest_len` is out of range.
+*/
+Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state
+*Hacl_Streaming_Blake2b_256_blake2b_256_keyed_create_in(
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *salt,
+  uint8_t *personal,
+  uint32_t digest_len
+);
+
+/**
+  (Re-)initialization function with the key and parameters given at allocation
+*/
+void Hacl_Streaming_Blake2b_256_blake2b_256_keyed_init(Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state *s);
+
+/**
+  Update function for keyed and parameterized states
+*/
+void
+Hacl_Streaming_Blake2b_256_blake2b_256_keyed_update(
+  Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state *s,
+  uint8_t *data,
+  uint32_t len
+);
+
+/**
+  Finish function for keyed and parameterized states; writes `digest_len` bytes to `dst`.
+*/
+void Hacl_Streaming_Blake2b_256_blake2b_256_keyed_finish(Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state *s, uint8_t *dst);
+
+/**
+  Free state function for keyed and parameterized states; zeroes the key material.
+*/
+void Hacl_Streaming_Blake2b_256_blake2b_256_keyed_free(Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state *s);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -96,6 +96,62 @@ Hacl_Streaming_Blake2s_128_blake2s_128_no_key_free(
   Hacl_Streaming_Blake2s_128_blake2s_128_state *s
 );
 
+typedef struct Hacl_Streaming_Blake2s_128_blake2s_128_keyed_state_s
+{
+  Hacl_Streaming_Blake2s_128_blake2s_128_state *state;
+  uint8_t key[32U];
+  uint32_t key_len;
+  uint8_t salt[8U];
+  uint8_t personal[8U];
+  uint32_t digest_len;
+}
+Hacl_Streaming_Blake2s_128_blake2s_128_keyed_state;
+
+/**
+  State allocation function for keyed and parameterized BLAKE2s.
+
+  @param key Pointer to `key_len` bytes of key; may be NULL when `key_len` is 0.
+  @param key_len Length of the key, at most 32. A zero-length key means unkeyed hashing.
+  @param salt Pointer to 8 bytes of salt, or NULL for an all-zero salt.
+  @param personal Pointer to 8 bytes of personalization, or NULL for all zeroes.
+  @param digest_len Length of the digest produced by `finish`, between 1 and 32.
+
+  Returns NULL if `key_len` or `digest_len` is out of range.
+*/
+Hacl_Streaming_Blake2s_128_blake2s_128_keyed_state
+*Hacl_Streaming_Blake2s_128_blake2s_128_keyed_create_in(
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *salt,
+  uint8_t *personal,
+  uint32_t digest_len
+);
+
+/**
+  (Re-)initialization function with the key and parameters given at allocation
+*/
+void Hacl_Streaming_Blake2s_128_blake2s_128_keyed_init(Hacl_Streaming_Blake2s_128_blake2s_128_keyed_state *s);
+
+/**
+  Update function for keyed and parameterized states
+*/
+void
+Hacl_Streaming_Blake2s_128_blake2s_128_keyed_update(
+  Hacl_Streaming_Blake2s_128_blake2s_128_keyed_state *s,
+  uint8_t *data,
+  uint32_t len
+);
+
+/**
+  Finish function for keyed and parameterized states; writes `digest_len` bytes to `dst`.
+*/
+void Hacl_Streaming_Blake2s_128_blake2s_128_keyed_finish(Hacl_Streaming_Blake2s_128_blake2s_128_keyed_state *s, uint8_t *dst);
+
+/**
+  Free state function for keyed and parameterized states; zeroes the key material.
+*/
+void Hacl_Streaming_Blake2s_128_blake2s_128_keyed_free(Hacl_Streaming_Blake2s_128_blake2s_128_keyed_state *s);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -322,3 +322,429 @@ void Hacl_Streaming_SHA3_free_256(Hacl_Streaming_SHA2_state_sha2_384 *s)
   KRML_HOST_FREE(s);
 }
 
+
+/* left_encode and right_encode (NIST SP 800-185, 2.3.1): the shortest big-endian encoding of x
+   (at least one byte), preceded (left) or followed (right) by its length in bytes. Both write at
+   most 9 bytes to dst and return the number of bytes written. */
+static uint32_t left_encode(uint64_t x, uint8_t *dst)
+{
+  uint8_t b[8U] = { 0U };
+  store64_be(b, x);
+  uint32_t i = (uint32_t)0U;
+  while (i < (uint32_t)7U && b[i] == (uint8_t)0U)
+  {
+    i++;
+  }
+  uint32_t n = (uint32_t)8U - i;
+  dst[0U] = (uint8_t)n;
+  memcpy(dst + (uint32_t)1U, b + i, n * sizeof (uint8_t));
+  return n + (uint32_t)1U;
+}
+
+static uint32_t right_encode(uint64_t x, uint8_t *dst)
+{
+  uint8_t b[8U] = { 0U };
+  store64_be(b, x);
+  uint32_t i = (uint32_t)0U;
+  while (i < (uint32_t)7U && b[i] == (uint8_t)0U)
+  {
+    i++;
+  }
+  uint32_t n = (uint32_t)8U - i;
+  memcpy(dst, b + i, n * sizeof (uint8_t));
+  dst[n] = (uint8_t)n;
+  return n + (uint32_t)1U;
+}
+
+/* Absorbs len bytes: whole blocks go straight from data into the sponge, and buf keeps the
+   buf_len < rate bytes of the partial block. */
+static void xof_absorb(Hacl_Streaming_SHA3_xof_state *s, uint8_t *data, uint32_t len)
+{
+  uint32_t rate = s->rate;
+  if (len == (uint32_t)0U)
+  {
+    return;
+  }
+  if (s->buf_len > (uint32_t)0U)
+  {
+    uint32_t n = rate - s->buf_len < len ? rate - s->buf_len : len;
+    memcpy(s->buf + s->buf_len, data, n * sizeof (uint8_t));
+    s->buf_len = s->buf_len + n;
+    if (s->buf_len < rate)
+    {
+      return;
+    }
+    Hacl_Impl_SHA3_loadState(rate, s->buf, s->block_state);
+    Hacl_Impl_SHA3_state_permute(s->block_state);
+    s->buf_len = (uint32_t)0U;
+    data = data + n;
+    len = len - n;
+  }
+  while (len >= rate)
+  {
+    Hacl_Impl_SHA3_loadState(rate, data, s->block_state);
+    Hacl_Impl_SHA3_state_permute(s->block_state);
+    data = data + rate;
+    len = len - rate;
+  }
+  if (len > (uint32_t)0U)
+  {
+    memcpy(s->buf, data, len * sizeof (uint8_t));
+    s->buf_len = len;
+  }
+}
+
+/* encode_string(x) = left_encode(bit length of x) || x */
+static void xof_absorb_encode_string(Hacl_Streaming_SHA3_xof_state *s, uint8_t *x, uint32_t x_len)
+{
+  uint8_t e[9U] = { 0U };
+  uint32_t n = left_encode((uint64_t)x_len * (uint64_t)8U, e);
+  xof_absorb(s, e, n);
+  xof_absorb(s, x, x_len);
+}
+
+/* Starts a bytepad(_, rate) prefix; the prefixes are absorbed from the start of the sponge, so
+   xof_absorb_pad completes them by zero-filling the partial block. */
+static void xof_absorb_bytepad_start(Hacl_Streaming_SHA3_xof_state *s)
+{
+  uint8_t e[9U] = { 0U };
+  uint32_t n = left_encode((uint64_t)s->rate, e);
+  xof_absorb(s, e, n);
+}
+
+static void xof_absorb_pad(Hacl_Streaming_SHA3_xof_state *s)
+{
+  uint8_t zeroes[168U] = { 0U };
+  if (s->buf_len > (uint32_t)0U)
+  {
+    xof_absorb(s, zeroes, s->rate - s->buf_len);
+  }
+}
+
+/* Absorbs the cSHAKE prefix bytepad(encode_string(N) || encode_string(S), rate) and, for KMAC, the
+   key prefix bytepad(encode_string(K), rate), then saves the sponge for xof_init. The prefixes fill
+   whole blocks, so the saved sponge is all there is to restore. */
+static Hacl_Streaming_SHA3_xof_state
+*xof_create_in(
+  uint32_t rate,
+  uint8_t *n,
+  uint32_t n_len,
+  uint8_t *c,
+  uint32_t c_len,
+  bool keyed,
+  uint8_t *key,
+  uint32_t key_len,
+  bool encode_len
+)
+{
+  Hacl_Streaming_SHA3_xof_state
+  *s = KRML_HOST_CALLOC((uint32_t)1U, sizeof (Hacl_Streaming_SHA3_xof_state));
+  s->rate = rate;
+  s->encode_len = encode_len;
+  if (n_len == (uint32_t)0U && c_len == (uint32_t)0U)
+  {
+    s->suffix = (uint8_t)0x1FU;
+  }
+  else
+  {
+    s->suffix = (uint8_t)0x04U;
+    xof_absorb_bytepad_start(s);
+    xof_absorb_encode_string(s, n, n_len);
+    xof_absorb_encode_string(s, c, c_len);
+    xof_absorb_pad(s);
+  }
+  if (keyed)
+  {
+    xof_absorb_bytepad_start(s);
+    xof_absorb_encode_string(s, key, key_len);
+    xof_absorb_pad(s);
+    Lib_Memzero0_memzero(s->buf, (uint32_t)168U * sizeof (uint8_t));
+  }
+  memcpy(s->init_state, s->block_state, (uint32_t)25U * sizeof (uint64_t));
+  return s;
+}
+
+/* Ends absorption: for KMAC and TupleHash, absorbs right_encode(out_bits) (0 for the XOF variants),
+   then pads the partial block with the domain separation suffix and permutes. */
+static void xof_start_squeeze(Hacl_Streaming_SHA3_xof_state *s, uint64_t out_bits)
+{
+  if (s->encode_len)
+  {
+    uint8_t e[9U] = { 0U };
+    uint32_t n = right_encode(out_bits, e);
+    xof_absorb(s, e, n);
+  }
+  Hacl_Impl_SHA3_absorb(s->block_state, s->rate, s->buf_len, s->buf, s->suffix);
+  s->buf_len = (uint32_t)0U;
+  s->squeezing = true;
+}
+
+static uint8_t xof_kmac_name[4U] = { (uint8_t)'K', (uint8_t)'M', (uint8_t)'A', (uint8_t)'C' };
+
+static uint8_t
+xof_tuplehash_name[9U] =
+  {
+    (uint8_t)'T', (uint8_t)'u', (uint8_t)'p', (uint8_t)'l', (uint8_t)'e', (uint8_t)'H',
+    (uint8_t)'a', (uint8_t)'s', (uint8_t)'h'
+  };
+
+/**
+  State allocation function for SHAKE128, as an extendable-output function with streaming
+  absorb and streaming squeeze.
+*/
+Hacl_Streaming_SHA3_xof_state *Hacl_Streaming_SHA3_shake128_create_in(void)
+{
+  return
+    xof_create_in((uint32_t)168U,
+      NULL,
+      (uint32_t)0U,
+      NULL,
+      (uint32_t)0U,
+      false,
+      NULL,
+      (uint32_t)0U,
+      false);
+}
+
+/**
+  State allocation function for SHAKE256; see `Hacl_Streaming_SHA3_shake128_create_in`.
+*/
+Hacl_Streaming_SHA3_xof_state *Hacl_Streaming_SHA3_shake256_create_in(void)
+{
+  return
+    xof_create_in((uint32_t)136U,
+      NULL,
+      (uint32_t)0U,
+      NULL,
+      (uint32_t)0U,
+      false,
+      NULL,
+      (uint32_t)0U,
+      false);
+}
+
+/**
+  State allocation function for cSHAKE128 (NIST SP 800-185).
+
+  @param n Pointer to `n_len` bytes of function name; may be NULL when `n_len` is 0.
+  @param n_len Length of the function name.
+  @param s Pointer to `s_len` bytes of customization string; may be NULL when `s_len` is 0.
+  @param s_len Length of the customization string.
+
+  With an empty name and customization string, cSHAKE128 is SHAKE128.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_cshake128_create_in(uint8_t *n, uint32_t n_len, uint8_t *s, uint32_t s_len)
+{
+  return xof_create_in((uint32_t)168U, n, n_len, s, s_len, false, NULL, (uint32_t)0U, false);
+}
+
+/**
+  State allocation function for cSHAKE256; see `Hacl_Streaming_SHA3_cshake128_create_in`.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_cshake256_create_in(uint8_t *n, uint32_t n_len, uint8_t *s, uint32_t s_len)
+{
+  return xof_create_in((uint32_t)136U, n, n_len, s, s_len, false, NULL, (uint32_t)0U, false);
+}
+
+/**
+  State allocation function for KMAC128 (NIST SP 800-185).
+
+  @param key Pointer to `key_len` bytes of key.
+  @param key_len Length of the key.
+  @param s Pointer to `s_len` bytes of customization string; may be NULL when `s_len` is 0.
+  @param s_len Length of the customization string.
+
+  Message data is absorbed with `Hacl_Streaming_SHA3_xof_absorb`. `Hacl_Streaming_SHA3_xof_finish`
+  computes KMAC128, whose output depends on the requested length; `Hacl_Streaming_SHA3_xof_squeeze`
+  computes KMACXOF128.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_kmac128_create_in(
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *s,
+  uint32_t s_len
+)
+{
+  return
+    xof_create_in((uint32_t)168U,
+      xof_kmac_name,
+      (uint32_t)4U,
+      s,
+      s_len,
+      true,
+      key,
+      key_len,
+      true);
+}
+
+/**
+  State allocation function for KMAC256; see `Hacl_Streaming_SHA3_kmac128_create_in`.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_kmac256_create_in(
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *s,
+  uint32_t s_len
+)
+{
+  return
+    xof_create_in((uint32_t)136U,
+      xof_kmac_name,
+      (uint32_t)4U,
+      s,
+      s_len,
+      true,
+      key,
+      key_len,
+      true);
+}
+
+/**
+  State allocation function for TupleHash128 (NIST SP 800-185).
+
+  @param s Pointer to `s_len` bytes of customization string; may be NULL when `s_len` is 0.
+  @param s_len Length of the customization string.
+
+  Tuple elements are absorbed with `Hacl_Streaming_SHA3_tuplehash_update`, one call per element.
+  `Hacl_Streaming_SHA3_xof_finish` computes TupleHash128; `Hacl_Streaming_SHA3_xof_squeeze`
+  computes TupleHashXOF128.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_tuplehash128_create_in(uint8_t *s, uint32_t s_len)
+{
+  return
+    xof_create_in((uint32_t)168U,
+      xof_tuplehash_name,
+      (uint32_t)9U,
+      s,
+      s_len,
+      false,
+      NULL,
+      (uint32_t)0U,
+      true);
+}
+
+/**
+  State allocation function for TupleHash256; see `Hacl_Streaming_SHA3_tuplehash128_create_in`.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_tuplehash256_create_in(uint8_t *s, uint32_t s_len)
+{
+  return
+    xof_create_in((uint32_t)136U,
+      xof_tuplehash_name,
+      (uint32_t)9U,
+      s,
+      s_len,
+      false,
+      NULL,
+      (uint32_t)0U,
+      true);
+}
+
+/**
+  (Re-)initialization function, with the function name, customization string and key given at
+  allocation
+*/
+void Hacl_Streaming_SHA3_xof_init(Hacl_Streaming_SHA3_xof_state *s)
+{
+  memcpy(s->block_state, s->init_state, (uint32_t)25U * sizeof (uint64_t));
+  s->buf_len = (uint32_t)0U;
+  s->squeezing = false;
+}
+
+/**
+  Absorb function; may be called any number of times with inputs of any length.
+
+  Returns false, and absorbs nothing, once squeezing has started.
+*/
+bool Hacl_Streaming_SHA3_xof_absorb(Hacl_Streaming_SHA3_xof_state *s, uint8_t *data, uint32_t len)
+{
+  if (s->squeezing)
+  {
+    return false;
+  }
+  xof_absorb(s, data, len);
+  return true;
+}
+
+/**
+  Absorb function for one TupleHash tuple element.
+
+  Returns false, and absorbs nothing, once squeezing has started.
+*/
+bool
+Hacl_Streaming_SHA3_tuplehash_update(
+  Hacl_Streaming_SHA3_xof_state *s,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  if (s->squeezing)
+  {
+    return false;
+  }
+  xof_absorb_encode_string(s, data, len);
+  return true;
+}
+
+/**
+  Squeeze function; writes the next `len` bytes of output to `dst`.
+
+  The first call ends absorption. Later calls continue the output stream, so that squeezing
+  `a` then `b` bytes produces the same bytes as squeezing `a + b` bytes at once. For KMAC and
+  TupleHash states, this is the XOF variant of the function.
+*/
+void Hacl_Streaming_SHA3_xof_squeeze(Hacl_Streaming_SHA3_xof_state *s, uint8_t *dst, uint32_t len)
+{
+  if (!s->squeezing)
+  {
+    xof_start_squeeze(s, (uint64_t)0U);
+  }
+  /* During squeezing, buf holds the current output block, of which the last buf_len bytes have
+     not been output yet, and block_state is the sponge for the next block. */
+  uint32_t rate = s->rate;
+  uint32_t n = s->buf_len < len ? s->buf_len : len;
+  memcpy(dst, s->buf + rate - s->buf_len, n * sizeof (uint8_t));
+  s->buf_len = s->buf_len - n;
+  uint32_t rem = len - n;
+  uint32_t full = rem / rate * rate;
+  Hacl_Impl_SHA3_squeeze(s->block_state, rate, full, dst + n);
+  rem = rem - full;
+  if (rem > (uint32_t)0U)
+  {
+    Hacl_Impl_SHA3_storeState(rate, s->block_state, s->buf);
+    Hacl_Impl_SHA3_state_permute(s->block_state);
+    memcpy(dst + n + full, s->buf, rem * sizeof (uint8_t));
+    s->buf_len = rate - rem;
+  }
+}
+
+/**
+  Finish function; writes `len` bytes of output to `dst`.
+
+  For KMAC and TupleHash states, the output length is encoded into the input, as the fixed-length
+  functions require; otherwise this is the same as `Hacl_Streaming_SHA3_xof_squeeze`. Once
+  squeezing has started, this continues the output stream.
+*/
+void Hacl_Streaming_SHA3_xof_finish(Hacl_Streaming_SHA3_xof_state *s, uint8_t *dst, uint32_t len)
+{
+  if (!s->squeezing)
+  {
+    xof_start_squeeze(s, (uint64_t)len * (uint64_t)8U);
+  }
+  Hacl_Streaming_SHA3_xof_squeeze(s, dst, len);
+}
+
+/**
+  Free state function; zeroes the key material.
+*/
+void Hacl_Streaming_SHA3_xof_free(Hacl_Streaming_SHA3_xof_state *s)
+{
+  Lib_Memzero0_memzero(s, (uint32_t)1U * sizeof (Hacl_Streaming_SHA3_xof_state));
+  KRML_HOST_FREE(s);
+}
@@ -56,6 +56,147 @@ void Hacl_Streaming_SHA3_finish_256(Hacl_Streaming_SHA2_state_sha2_384 *p, uint8
 
 void Hacl_Streaming_SHA3_free_256(Hacl_Streaming_SHA2_state_sha2_384 *s);
 
+typedef struct Hacl_Streaming_SHA3_xof_state_s
+{
+  uint64_t block_state[25U];
+  uint64_t init_state[25U];
+  uint8_t buf[168U];
+  uint32_t rate;
+  uint32_t buf_len;
+  uint8_t suffix;
+  bool encode_len;
+  bool squeezing;
+}
+Hacl_Streaming_SHA3_xof_state;
+
+/**
+  State allocation function for SHAKE128, as an extendable-output function with streaming
+  absorb and streaming squeeze.
+*/
+Hacl_Streaming_SHA3_xof_state *Hacl_Streaming_SHA3_shake128_create_in(void);
+
+/**
+  State allocation function for SHAKE256; see `Hacl_Streaming_SHA3_shake128_create_in`.
+*/
+Hacl_Streaming_SHA3_xof_state *Hacl_Streaming_SHA3_shake256_create_in(void);
+
+/**
+  State allocation function for cSHAKE128 (NIST SP 800-185).
+
+  @param n Pointer to `n_len` bytes of function name; may be NULL when `n_len` is 0.
+  @param n_len Length of the function name.
+  @param s Pointer to `s_len` bytes of customization string; may be NULL when `s_len` is 0.
+  @param s_len Length of the customization string.
+
+  With an empty name and customization string, cSHAKE128 is SHAKE128.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_cshake128_create_in(uint8_t *n, uint32_t n_len, uint8_t *s, uint32_t s_len);
+
+/**
+  State allocation function for cSHAKE256; see `Hacl_Streaming_SHA3_cshake128_create_in`.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_cshake256_create_in(uint8_t *n, uint32_t n_len, uint8_t *s, uint32_t s_len);
+
+/**
+  State allocation function for KMAC128 (NIST SP 800-185).
+
+  @param key Pointer to `key_len` bytes of key.
+  @param key_len Length of the key.
+  @param s Pointer to `s_len` bytes of customization string; may be NULL when `s_len` is 0.
+  @param s_len Length of the customization string.
+
+  Message data is absorbed with `Hacl_Streaming_SHA3_xof_absorb`. `Hacl_Streaming_SHA3_xof_finish`
+  computes KMAC128, whose output depends on the requested length; `Hacl_Streaming_SHA3_xof_squeeze`
+  computes KMACXOF128.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_kmac128_create_in(
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *s,
+  uint32_t s_len
+);
+
+/**
+  State allocation function for KMAC256; see `Hacl_Streaming_SHA3_kmac128_create_in`.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_kmac256_create_in(
+  uint8_t *key,
+  uint32_t key_len,
+  uint8_t *s,
+  uint32_t s_len
+);
+
+/**
+  State allocation function for TupleHash128 (NIST SP 800-185).
+
+  @param s Pointer to `s_len` bytes of customization string; may be NULL when `s_len` is 0.
+  @param s_len Length of the customization string.
+
+  Tuple elements are absorbed with `Hacl_Streaming_SHA3_tuplehash_update`, one call per element.
+  `Hacl_Streaming_SHA3_xof_finish` computes TupleHash128; `Hacl_Streaming_SHA3_xof_squeeze`
+  computes TupleHashXOF128.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_tuplehash128_create_in(uint8_t *s, uint32_t s_len);
+
+/**
+  State allocation function for TupleHash256; see `Hacl_Streaming_SHA3_tuplehash128_create_in`.
+*/
+Hacl_Streaming_SHA3_xof_state
+*Hacl_Streaming_SHA3_tuplehash256_create_in(uint8_t *s, uint32_t s_len);
+
+/**
+  (Re-)initialization function, with the function name, customization string and key given at
+  allocation
+*/
+void Hacl_Streaming_SHA3_xof_init(Hacl_Streaming_SHA3_xof_state *s);
+
+/**
+  Absorb function; may be called any number of times with inputs of any length.
+
+  Returns false, and absorbs nothing, once squeezing has started.
+*/
+bool Hacl_Streaming_SHA3_xof_absorb(Hacl_Streaming_SHA3_xof_state *s, uint8_t *data, uint32_t len);
+
+/**
+  Absorb function for one TupleHash tuple element.
+
+  Returns false, and absorbs nothing, once squeezing has started.
+*/
+bool
+Hacl_Streaming_SHA3_tuplehash_update(
+  Hacl_Streaming_SHA3_xof_state *s,
+  uint8_t *data,
+  uint32_t len
+);
+
+/**
+  Squeeze function; writes the next `len` bytes of output to `dst`.
+
+  The first call ends absorption. Later calls continue the output stream, so that squeezing
+  `a` then `b` bytes produces the same bytes as squeezing `a + b` bytes at once. For KMAC and
+  TupleHash states, this is the XOF variant of the function.
+*/
+void Hacl_Streaming_SHA3_xof_squeeze(Hacl_Streaming_SHA3_xof_state *s, uint8_t *dst, uint32_t len);
+
+/**
+  Finish function; writes `len` bytes of output to `dst`.
+
+  For KMAC and TupleHash states, the output length is encoded into the input, as the fixed-length
+  functions require; otherwise this is the same as `Hacl_Streaming_SHA3_xof_squeeze`. Once
+  squeezing has started, this continues the output stream.
+*/
+void Hacl_Streaming_SHA3_xof_finish(Hacl_Streaming_SHA3_xof_state *s, uint8_t *dst, uint32_t len);
+
+/**
+  Free state function; zeroes the key material.
+*/
+void Hacl_Streaming_SHA3_xof_free(Hacl_Streaming_SHA3_xof_state *s);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -25,6 +25,17 @@
 #include "MerkleTree.h"
 
 #include "internal/Hacl_Krmllib.h"
+#include "Hacl_SHA2_Vec256.h"
+#include "Hacl_SHA2_Vec128.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#if !(defined(_WIN32) || defined(_WIN64))
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 static uint8_t *hash_r_alloc(uint32_t s)
 {
@@ -58,11 +69,243 @@ static MerkleTree_Low_Datastructures_hash_vec hash_vec_r_alloc(uint32_t hsz)
   return alloc_reserve___uint8_t_((uint32_t)1U, NULL);
 }
 
+typedef struct MerkleTree_Low_Datastructures_hash_file_s
+MerkleTree_Low_Datastructures_hash_file;
+
+/*
+  Contiguous storage: the hashes of level lv are stored back to back in arena[lv],
+  which holds cap * hsz bytes where cap is that of the level in hs. The arenas are
+  heap-allocated, or mapped segments of file when file is not NULL.
+*/
+struct MerkleTree_Low_Datastructures_hash_store_s
+{
+  uint32_t hsz;
+  uint8_t *arena[32U];
+  MerkleTree_Low_Datastructures_hash_file *file;
+};
+
+/*
+  File-backed storage: every level of the tree is a segment of the file, mapped
+  in memory and used as the arena of the level. A level that outgrows its
+  segment is moved to a new, larger segment at the end of the file. The header
+  (see write_header) is only rewritten by mt_sync_file. Hashes are updated in
+  place (flushing shifts a level to the start of its segment, retracting lets
+  later insertions overwrite it), so the file is only consistent after a
+  successful mt_sync_file: a crash in between can leave it corrupted.
+*/
+struct MerkleTree_Low_Datastructures_hash_file_s
+{
+  int fd;
+  uint64_t end;
+  uint64_t seg_off[32U];
+  uint64_t seg_len[32U];
+};
+
+#define MT_FILE_MAGIC "HACL-MT1"
+
+#define MT_FILE_CHECK_LEN 32U
+
+#define MT_FILE_HEADER_LEN (40U + 32U * 16U + MT_FILE_CHECK_LEN)
+
+#if !(defined(_WIN32) || defined(_WIN64))
+
+static uint64_t file_round(uint64_t n)
+{
+  uint64_t pg = (uint64_t)sysconf(_SC_PAGESIZE);
+  return (n + pg - (uint64_t)1U) / pg * pg;
+}
+
+/* Maps a new segment of len bytes at the end of the file for level lv. */
+static uint8_t
+*file_map(MerkleTree_Low_Datastructures_hash_store *st, uint32_t lv, uint64_t len)
+{
+  MerkleTree_Low_Datastructures_hash_file *f = st->file;
+  uint64_t off = f->end;
+  if (ftruncate(f->fd, (off_t)(off + len)) != 0)
+  {
+    return NULL;
+  }
+  void *p = mmap(NULL, (size_t)len, PROT_READ | PROT_WRITE, MAP_SHARED, f->fd, (off_t)off);
+  if (p == MAP_FAILED)
+  {
+    return NULL;
+  }
+  f->end = off + len;
+  st->arena[lv] = (uint8_t *)p;
+  f->seg_off[lv] = off;
+  f->seg_len[lv] = len;
+  return (uint8_t *)p;
+}
+
+/* Moves level lv to a new segment of at least ncap hashes; false if the file cannot grow. */
+static bool
+file_grow(
+  MerkleTree_Low_Datastructures_hash_store *st,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  uint32_t lv,
+  uint32_t ncap
+)
+{
+  MerkleTree_Low_Datastructures_hash_vec vec = hs.vs[lv];
+  uint8_t *old = st->arena[lv];
+  uint64_t old_len = st->file->seg_len[lv];
+  uint64_t len = file_round((uint64_t)ncap * (uint64_t)st->hsz);
+  uint8_t *buf = file_map(st, lv, len);
+  if (buf == NULL)
+  {
+    return false;
+  }
+  memcpy(buf, old, (size_t)vec.sz * (size_t)st->hsz);
+  munmap(old, (size_t)old_len);
+  hs.vs[lv]
+  =
+    (
+      (MerkleTree_Low_Datastructures_hash_vec){
+        .sz = vec.sz,
+        .cap = (uint32_t)(len / (uint64_t)st->hsz),
+        .vs = NULL
+      }
+    );
+  return true;
+}
+
+static void file_close(MerkleTree_Low_Datastructures_hash_store *st)
+{
+  MerkleTree_Low_Datastructures_hash_file *f = st->file;
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    if (st->arena[lv] != NULL)
+    {
+      munmap(st->arena[lv], (size_t)f->seg_len[lv]);
+    }
+  }
+  close(f->fd);
+  KRML_HOST_FREE(f);
+}
+
+#else
+
+static bool
+file_grow(
+  MerkleTree_Low_Datastructures_hash_store *st,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  uint32_t lv,
+  uint32_t ncap
+)
+{
+  return false;
+}
+
+static void file_close(MerkleTree_Low_Datastructures_hash_store *st)
+{
+}
+
+#endif
+
+/*
+  Grows level lv of a tree with contiguous storage so that it can hold n more hashes.
+  File-backed levels are not grown here, where failure cannot be reported: insertions
+  first call file_reserve_insert, after which they already have room.
+*/
+static MerkleTree_Low_Datastructures_hash_vec
+arena_reserve(
+  MerkleTree_Low_Datastructures_hash_store *st,
+  uint32_t lv,
+  MerkleTree_Low_Datastructures_hash_vec vec,
+  uint32_t n
+)
+{
+  if (vec.cap - vec.sz >= n || st->file != NULL)
+  {
+    return vec;
+  }
+  uint32_t ncap = vec.cap;
+  while (ncap - vec.sz < n)
+  {
+    ncap = LowStar_Vector_new_capacity(ncap);
+  }
+  KRML_CHECK_SIZE((size_t)st->hsz, ncap);
+  uint8_t *buf = KRML_HOST_MALLOC((size_t)ncap * (size_t)st->hsz);
+  if (vec.sz > (uint32_t)0U)
+  {
+    memcpy(buf, st->arena[lv], (size_t)vec.sz * (size_t)st->hsz);
+  }
+  KRML_HOST_FREE(st->arena[lv]);
+  st->arena[lv] = buf;
+  return ((MerkleTree_Low_Datastructures_hash_vec){ .sz = vec.sz, .cap = ncap, .vs = NULL });
+}
+
+/*
+  Grows the segments of a tree stored in a file so that n hashes can be inserted:
+  after inserting them, level lv holds the hashes from offset_of(i >> lv) to
+  (j + n) >> lv. Returns false, leaving the contents of the tree unchanged, if the
+  file cannot grow. Trees stored in memory need no reservation.
+*/
+static bool file_reserve_insert(const MerkleTree_Low_merkle_tree *mt, uint32_t n)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  MerkleTree_Low_Datastructures_hash_store *st = mtv.store;
+  if (st == NULL || st->file == NULL)
+  {
+    return true;
+  }
+  uint64_t j1 = (uint64_t)mtv.j + (uint64_t)n;
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    uint64_t need = (j1 >> lv) - (uint64_t)MerkleTree_Low_offset_of(mtv.i >> lv);
+    uint32_t ncap = mtv.hs.vs[lv].cap;
+    if ((uint64_t)ncap < need)
+    {
+      while ((uint64_t)ncap < need && ncap < MerkleTree_Low_uint32_32_max)
+      {
+        ncap = LowStar_Vector_new_capacity(ncap);
+      }
+      if ((uint64_t)ncap < need || !file_grow(st, mtv.hs, lv, ncap))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static void store_free(MerkleTree_Low_Datastructures_hash_store *st)
+{
+  if (st->file != NULL)
+  {
+    file_close(st);
+  }
+  else
+  {
+    for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+    {
+      KRML_HOST_FREE(st->arena[lv]);
+    }
+  }
+  KRML_HOST_FREE(st);
+}
+
 static uint8_t *index___uint8_t_(MerkleTree_Low_Datastructures_hash_vec vec, uint32_t i)
 {
   return vec.vs[i];
 }
 
+/* The i-th hash of level lv, wherever the tree stores it. */
+static uint8_t
+*level_index(
+  const MerkleTree_Low_Datastructures_hash_store *st,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  uint32_t lv,
+  uint32_t i
+)
+{
+  if (st != NULL)
+  {
+    return st->arena[lv] + (size_t)i * (size_t)st->hsz;
+  }
+  return hs.vs[lv].vs[i];
+}
+
 typedef struct regional__uint32_t__uint8_t__s
 {
   uint32_t state;
@@ -242,10 +485,114 @@ inline MerkleTree_Low_merkle_tree
   return MerkleTree_Low_mt_create_custom(hash_size, i, hash_fun);
 }
 
+/**
+  Construction with contiguous storage and custom hash functions
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree
+
+ Note: the hashes of each level of the tree are stored back to back in a single
+ growable buffer, instead of being allocated one by one. Paths obtained with
+ `mt_get_path` point into these buffers and are invalidated by any subsequent
+ insertion or flush.
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_create_custom_arena(
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low_mt_create_custom_arena(hash_size, i, hash_fun);
+}
+
+/**
+  Construction of a tree stored in a file, with custom hash functions
+
+  @param[in]  path      The file, which is created or truncated
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree, or NULL if the file cannot be created
+
+ Note: the storage is that of `mt_create_custom_arena`, except that every level
+ lives in a segment of the file mapped in memory: insertions write through to
+ the file, and only the header needs to be updated to persist the tree (see
+ `mt_sync_file`). The file is not crash-safe. Not available on Windows.
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_create_custom_file(
+  const char *path,
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low_mt_create_custom_file(path, hash_size, i, hash_fun);
+}
+
+/**
+  Opening of a tree stored in a file
+
+  @param[in]  path      A file written by a tree created with `mt_create_custom_file`
+                        or `mt_create_file`
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  hash_fun  The hash function of the tree
+
+  return The Merkle tree, or NULL if the file cannot be opened, is malformed, or
+  was written with another hash size or hash function
+
+ Note: the levels are mapped, not read, so that opening does not depend on the
+ size of the tree. The header is checked for consistency, but the hashes are
+ not: after a crash, the tree may have been corrupted (see `mt_sync_file`).
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_open_file(
+  const char *path,
+  uint32_t hash_size,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low_mt_open_file(path, hash_size, hash_fun);
+}
+
+/**
+  Persisting a tree stored in a file
+
+  @param[in]  mt  The Merkle tree
+
+  return false if the tree is not stored in a file or an I/O error occurred
+
+ Note: the hashes are flushed to disk before the header, but the update is not
+ atomic: the hashes are written in place as the tree changes, so a crash (or a
+ failed call) between two successful calls can leave the file corrupted.
+*/
+inline bool mt_sync_file(const MerkleTree_Low_merkle_tree *mt)
+{
+  return MerkleTree_Low_mt_sync_file(mt);
+}
+
+/**
+  Persisting and destruction of a tree stored in a file
+
+  @param[in]  mt  The Merkle tree
+
+  return The result of `mt_sync_file`; the tree is freed in any case
+*/
+inline bool mt_close_file(MerkleTree_Low_merkle_tree *mt)
+{
+  return MerkleTree_Low_mt_close_file(mt);
+}
+
 /**
   Destruction
 
   @param[in]  mt  The Merkle tree
+
+ Note: a tree stored in a file is synced first, ignoring errors; use
+ `mt_close_file` to check them.
 */
 inline void mt_free(MerkleTree_Low_merkle_tree *mt)
 {
@@ -267,12 +614,70 @@ inline void mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
 
 /**
   Precondition predicate for mt_insert
+
+ Note: for a tree stored in a file, this also grows the file so that the insertion
+ does not need to, and returns false if it cannot (for instance, if the disk is
+ full); `mt_insert` then leaves the tree unchanged.
 */
 inline bool mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v)
 {
   return MerkleTree_Low_mt_insert_pre(mt, v);
 }
 
+/**
+  Batch insertion
+
+  @param[in]  mt      The Merkle tree
+  @param[in]  leaves  `n` hashes stored back to back (`n * hash_size` bytes). The tree
+                      makes a copy of them; unlike `mt_insert`, the input is not modified.
+  @param[in]  n       The number of hashes to insert
+
+ Note: the resulting tree is the same as after inserting the hashes one at a time with
+ `mt_insert`. Internal nodes are computed one level at a time; for trees built with
+ `mt_create`, up to 8 node pairs are hashed with a single call to the multi-buffer
+ SHA-256 implementation.
+*/
+inline void mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n)
+{
+  MerkleTree_Low_mt_insert_batch(mt, leaves, n);
+}
+
+/**
+  Batch insertion using several threads
+
+  @param[in]  mt      The Merkle tree
+  @param[in]  leaves  As for `mt_insert_batch`
+  @param[in]  n       The number of hashes to insert
+  @param[in]  workers The maximal number of threads hashing a level, including the
+                      calling thread
+
+ Note: same precondition and result as `mt_insert_batch`. The pairs of each level
+ are split into contiguous ranges hashed by different threads (at least 4096 pairs
+ per thread), which are joined before moving to the next level. A custom hash
+ function must therefore be thread-safe. On Windows, this is `mt_insert_batch`.
+*/
+inline void
+mt_insert_batch_par(
+  MerkleTree_Low_merkle_tree *mt,
+  uint8_t *leaves,
+  uint32_t n,
+  uint32_t workers
+)
+{
+  MerkleTree_Low_mt_insert_batch_par(mt, leaves, n, workers);
+}
+
+/**
+  Precondition predicate for mt_insert_batch
+
+ Note: for a tree stored in a file, this also grows the file as for `mt_insert_pre`;
+ if it returns false, `mt_insert_batch` leaves the tree unchanged.
+*/
+inline bool mt_insert_batch_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n)
+{
+  return MerkleTree_Low_mt_insert_batch_pre(mt, leaves, n);
+}
+
 /**
   Getting the Merkle root
 
@@ -333,6 +738,57 @@ mt_get_path_pre(
   return MerkleTree_Low_mt_get_path_pre(mt, idx, path1, root);
 }
 
+/**
+  Getting several Merkle paths at once
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  n    The number of paths
+  @param[in]  idx  The indices of the target hashes, n elements
+  @param[out] buf  The resulting paths, stored one after the other, each as the
+                   leaf hash followed by the sibling hashes in the order of
+                   `mt_get_path`
+  @param[in]  len  The size of buf in bytes
+  @param[out] lens The number of hashes of each path, n elements
+  @param[out] root The Merkle root
+
+  return The number of elements in the tree
+
+  Notes:
+  - Unlike `mt_get_path`, the hashes are copied, so buf remains valid after
+    the tree is modified. n * 33 * hash_size bytes always suffice.
+  - The root is computed once for the whole batch.
+*/
+inline uint32_t
+mt_get_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint8_t *buf,
+  uint64_t len,
+  uint32_t *lens,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_get_paths(mt, n, idx, buf, len, lens, root);
+}
+
+/**
+  Precondition predicate for mt_get_paths
+*/
+inline bool
+mt_get_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint8_t *buf,
+  uint64_t len,
+  uint32_t *lens,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_get_paths_pre(mt, n, idx, buf, len, lens, root);
+}
+
 /**
   Flush the Merkle tree
 
@@ -431,6 +887,57 @@ mt_verify_pre(
   return MerkleTree_Low_mt_verify_pre(mt, tgt, max, path1, root);
 }
 
+/**
+  Client-side verification of several paths
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  n    The number of paths
+  @param[in]  idx  The indices of the target hashes, n elements
+  @param[in]  max  The maximum index + 1 of the tree when the paths were generated
+  @param[in]  buf  The paths, laid out as by `mt_get_paths`
+  @param[in]  lens The number of hashes of each path, n elements
+  @param[in]  root
+  @param[out] res  The verification result of each path, n elements
+
+  return true if all verifications succeeded, false otherwise
+
+  Note: a path that reaches the same node with the same hash as the previous
+  one, and shares the rest of its hashes, reuses its result instead of hashing
+  up to the root. Sorting idx maximizes this sharing.
+*/
+inline bool
+mt_verify_batch(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint64_t max,
+  const uint8_t *buf,
+  const uint32_t *lens,
+  uint8_t *root,
+  bool *res
+)
+{
+  return MerkleTree_Low_mt_verify_batch(mt, n, idx, max, buf, lens, root, res);
+}
+
+/**
+  Precondition predicate for mt_verify_batch
+*/
+inline bool
+mt_verify_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint64_t max,
+  const uint8_t *buf,
+  const uint32_t *lens,
+  uint8_t *root,
+  bool *res
+)
+{
+  return MerkleTree_Low_mt_verify_batch_pre(mt, n, idx, max, buf, lens, root, res);
+}
+
 /**
   Serialization size
 
@@ -520,11 +1027,7 @@ void mt_sha256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst)
   uint8_t cb[64U] = { 0U };
   memcpy(cb, src1, hash_size * sizeof (uint8_t));
   memcpy(cb + (uint32_t)32U, src2, hash_size * sizeof (uint8_t));
-  EverCrypt_Hash_state_s *st = EverCrypt_Hash_create_in(Spec_Hash_Definitions_SHA2_256);
-  EverCrypt_Hash_init(st);
-  EverCrypt_Hash_update2(st, (uint64_t)0U, cb);
-  EverCrypt_Hash_finish(st, dst);
-  EverCrypt_Hash_free(st);
+  EverCrypt_Hash_hash_256(cb, (uint32_t)64U, dst);
 }
 
 /**
@@ -537,6 +1040,29 @@ inline MerkleTree_Low_merkle_tree *mt_create(uint8_t *init)
   return MerkleTree_Low_mt_create_custom((uint32_t)32U, init, mt_sha256_compress);
 }
 
+/**
+  Construction wired to sha256 from EverCrypt, with contiguous storage (see
+  `mt_create_custom_arena`)
+
+  @param[in]  init   The initial hash
+*/
+inline MerkleTree_Low_merkle_tree *mt_create_arena(uint8_t *init)
+{
+  return MerkleTree_Low_mt_create_custom_arena((uint32_t)32U, init, mt_sha256_compress);
+}
+
+/**
+  Construction of a tree stored in a file, wired to sha256 from EverCrypt (see
+  `mt_create_custom_file`)
+
+  @param[in]  path   The file, which is created or truncated
+  @param[in]  init   The initial hash
+*/
+inline MerkleTree_Low_merkle_tree *mt_create_file(const char *path, uint8_t *init)
+{
+  return MerkleTree_Low_mt_create_custom_file(path, (uint32_t)32U, init, mt_sha256_compress);
+}
+
 uint32_t MerkleTree_Low_uint32_32_max = (uint32_t)4294967295U;
 
 uint64_t MerkleTree_Low_uint32_max = (uint64_t)4294967295U;
@@ -681,19 +1207,36 @@ alloc_rid___uint8_t__uint32_t(regional__uint32_t__uint8_t_ rg, uint32_t len)
 }
 
 static MerkleTree_Low_merkle_tree
-*create_empty_mt(uint32_t hsz, void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2))
+*create_empty_mt(
+  uint32_t hsz,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  bool arena
+)
 {
-  MerkleTree_Low_Datastructures_hash_vv
-  hs =
-    alloc_rid__LowStar_Vector_vector_str__uint8_t__uint32_t((
-        (regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec){
-          .state = hsz,
-          .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
-          .r_alloc = hash_vec_r_alloc,
-          .r_free = hash_vec_r_free
-        }
-      ),
-      (uint32_t)32U);
+  MerkleTree_Low_Datastructures_hash_store *st = NULL;
+  MerkleTree_Low_Datastructures_hash_vv hs;
+  if (arena)
+  {
+    KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Datastructures_hash_store), (uint32_t)1U);
+    st = KRML_HOST_CALLOC((uint32_t)1U, sizeof (MerkleTree_Low_Datastructures_hash_store));
+    st->hsz = hsz;
+    hs =
+      alloc_rid__LowStar_Vector_vector_str__uint8_t_((uint32_t)32U,
+        ((MerkleTree_Low_Datastructures_hash_vec){ .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }));
+  }
+  else
+  {
+    hs =
+      alloc_rid__LowStar_Vector_vector_str__uint8_t__uint32_t((
+          (regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec){
+            .state = hsz,
+            .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
+            .r_alloc = hash_vec_r_alloc,
+            .r_free = hash_vec_r_free
+          }
+        ),
+        (uint32_t)32U);
+  }
   MerkleTree_Low_Datastructures_hash_vec
   rhs =
     alloc_rid___uint8_t__uint32_t((
@@ -724,7 +1267,8 @@ static MerkleTree_Low_merkle_tree
         .rhs_ok = false,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .store = st
       }
     );
   return mt;
@@ -775,18 +1319,26 @@ free__LowStar_Vector_vector_str__uint8_t__uint32_t(
   free__LowStar_Vector_vector_str__uint8_t_(rv);
 }
 
-void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt)
+static void free_mt(MerkleTree_Low_merkle_tree *mt)
 {
   MerkleTree_Low_merkle_tree mtv = *mt;
-  free__LowStar_Vector_vector_str__uint8_t__uint32_t((
-      (regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec){
-        .state = mtv.hash_size,
-        .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
-        .r_alloc = hash_vec_r_alloc,
-        .r_free = hash_vec_r_free
-      }
-    ),
-    mtv.hs);
+  if (mtv.store != NULL)
+  {
+    free__LowStar_Vector_vector_str__uint8_t_(mtv.hs);
+    store_free(mtv.store);
+  }
+  else
+  {
+    free__LowStar_Vector_vector_str__uint8_t__uint32_t((
+        (regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec){
+          .state = mtv.hash_size,
+          .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
+          .r_alloc = hash_vec_r_alloc,
+          .r_free = hash_vec_r_free
+        }
+      ),
+      mtv.hs);
+  }
   free___uint8_t__uint32_t((
       (regional__uint32_t__uint8_t_){
         .state = mtv.hash_size,
@@ -804,6 +1356,23 @@ void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt)
   KRML_HOST_FREE(mt);
 }
 
+void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  if (mtv.store != NULL && mtv.store->file != NULL)
+  {
+    MerkleTree_Low_mt_sync_file(mt);
+  }
+  free_mt(mt);
+}
+
+bool MerkleTree_Low_mt_close_file(MerkleTree_Low_merkle_tree *mt)
+{
+  bool ok = MerkleTree_Low_mt_sync_file(mt);
+  free_mt(mt);
+  return ok;
+}
+
 static MerkleTree_Low_Datastructures_hash_vec
 insert___uint8_t__uint32_t(MerkleTree_Low_Datastructures_hash_vec rv, uint8_t *v)
 {
@@ -821,101 +1390,767 @@ insert_copy___uint8_t__uint32_t(
   uint8_t *v
 )
 {
-  uint8_t *nv = rg.r_alloc(rg.state);
-  cp(rg.state, v, nv);
-  return insert___uint8_t__uint32_t(rv, nv);
+  uint8_t *nv = rg.r_alloc(rg.state);
+  cp(rg.state, v, nv);
+  return insert___uint8_t__uint32_t(rv, nv);
+}
+
+static void
+assign__LowStar_Vector_vector_str__uint8_t__uint32_t(
+  MerkleTree_Low_Datastructures_hash_vv rv,
+  uint32_t i,
+  MerkleTree_Low_Datastructures_hash_vec v
+)
+{
+  assign__LowStar_Vector_vector_str__uint8_t_(rv, i, v);
+}
+
+static void
+insert_(
+  uint32_t hsz,
+  uint32_t lv,
+  uint32_t j,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_store *st,
+  uint8_t *acc,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_Datastructures_hash_vec
+  uu____0 = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
+  MerkleTree_Low_Datastructures_hash_vec ihv;
+  if (st != NULL)
+  {
+    ihv = arena_reserve(st, lv, uu____0, (uint32_t)1U);
+    hash_copy(hsz, acc, level_index(st, hs, lv, ihv.sz));
+    ihv.sz = ihv.sz + (uint32_t)1U;
+  }
+  else
+  {
+    ihv =
+      insert_copy___uint8_t__uint32_t((
+          (regional__uint32_t__uint8_t_){
+            .state = hsz,
+            .dummy = NULL,
+            .r_alloc = hash_r_alloc,
+            .r_free = hash_r_free
+          }
+        ),
+        hash_copy,
+        uu____0,
+        acc);
+  }
+  assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, ihv);
+  if (j % (uint32_t)2U == (uint32_t)1U)
+  {
+    MerkleTree_Low_Datastructures_hash_vec
+    lvhs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
+    hash_fun(level_index(st, hs, lv, lvhs.sz - (uint32_t)2U), acc, acc);
+    insert_(hsz, lv + (uint32_t)1U, j / (uint32_t)2U, hs, st, acc, hash_fun);
+    return;
+  }
+}
+
+bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v)
+{
+  MerkleTree_Low_merkle_tree mt1 = *(MerkleTree_Low_merkle_tree *)mt;
+  return
+    mt1.j
+    < MerkleTree_Low_uint32_32_max
+    && MerkleTree_Low_uint64_max - mt1.offset >= (uint64_t)(mt1.j + (uint32_t)1U)
+    && file_reserve_insert(mt, (uint32_t)1U);
+}
+
+void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
+{
+  if (!file_reserve_insert(mt, (uint32_t)1U))
+  {
+    return;
+  }
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
+  uint32_t hsz1 = mtv.hash_size;
+  insert_(hsz1, (uint32_t)0U, mtv.j, hs, mtv.store, v, mtv.hash_fun);
+  *mt
+  =
+    (
+      (MerkleTree_Low_merkle_tree){
+        .hash_size = mtv.hash_size,
+        .offset = mtv.offset,
+        .i = mtv.i,
+        .j = mtv.j + (uint32_t)1U,
+        .hs = mtv.hs,
+        .rhs_ok = false,
+        .rhs = mtv.rhs,
+        .mroot = mtv.mroot,
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
+      }
+    );
+}
+
+static void
+hash_pairs(
+  uint32_t hsz,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  uint32_t n,
+  uint8_t **src1,
+  uint8_t **src2,
+  uint8_t **dst
+)
+{
+  uint32_t k = (uint32_t)0U;
+  if (hash_fun == mt_sha256_compress)
+  {
+    /* With SHA extensions, one-at-a-time hashing is as fast as the multi-buffer code. */
+    bool shaext = EverCrypt_AutoConfig2_has_shaext();
+    uint8_t cb[512U] = { 0U };
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      memcpy(cb + i * (uint32_t)64U, src1[i], (uint32_t)32U * sizeof (uint8_t));
+      memcpy(cb + i * (uint32_t)64U + (uint32_t)32U,
+        src2[i],
+        (uint32_t)32U * sizeof (uint8_t));
+    }
+    #if HACL_CAN_COMPILE_VEC256
+    if (!shaext && n == (uint32_t)8U && EverCrypt_AutoConfig2_has_vec256())
+    {
+      Hacl_SHA2_Vec256_sha256_8(dst[0U],
+        dst[1U],
+        dst[2U],
+        dst[3U],
+        dst[4U],
+        dst[5U],
+        dst[6U],
+        dst[7U],
+        (uint32_t)64U,
+        cb,
+        cb + (uint32_t)64U,
+        cb + (uint32_t)128U,
+        cb + (uint32_t)192U,
+        cb + (uint32_t)256U,
+        cb + (uint32_t)320U,
+        cb + (uint32_t)384U,
+        cb + (uint32_t)448U);
+      return;
+    }
+    #endif
+    #if HACL_CAN_COMPILE_VEC128
+    if (!shaext && EverCrypt_AutoConfig2_has_vec128())
+    {
+      for (; k + (uint32_t)4U <= n; k = k + (uint32_t)4U)
+      {
+        Hacl_SHA2_Vec128_sha256_4(dst[k],
+          dst[k + (uint32_t)1U],
+          dst[k + (uint32_t)2U],
+          dst[k + (uint32_t)3U],
+          (uint32_t)64U,
+          cb + k * (uint32_t)64U,
+          cb + (k + (uint32_t)1U) * (uint32_t)64U,
+          cb + (k + (uint32_t)2U) * (uint32_t)64U,
+          cb + (k + (uint32_t)3U) * (uint32_t)64U);
+      }
+    }
+    #endif
+    for (; k < n; k++)
+    {
+      EverCrypt_Hash_hash_256(cb + k * (uint32_t)64U, (uint32_t)64U, dst[k]);
+    }
+    return;
+  }
+  for (; k < n; k++)
+  {
+    hash_fun(src1[k], src2[k], dst[k]);
+  }
+}
+
+bool
+MerkleTree_Low_mt_insert_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint8_t *leaves,
+  uint32_t n
+)
+{
+  MerkleTree_Low_merkle_tree mt1 = *(MerkleTree_Low_merkle_tree *)mt;
+  return
+    n
+    <= MerkleTree_Low_uint32_32_max - mt1.j
+    && MerkleTree_Low_uint64_max - mt1.offset >= (uint64_t)mt1.j + (uint64_t)n
+    && file_reserve_insert(mt, n);
+}
+
+/* Hashes count pairs of level lv, starting at position pos, into level lv + 1. */
+typedef struct hash_level_task_s
+{
+  uint32_t hsz;
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+  MerkleTree_Low_Datastructures_hash_vv hs;
+  MerkleTree_Low_Datastructures_hash_store *st;
+  uint32_t lv;
+  uint32_t pos;
+  uint32_t count;
+  uint32_t dst_pos;
+  uint8_t **out;
+}
+hash_level_task;
+
+static void hash_level(hash_level_task *t)
+{
+  for (uint32_t c0 = (uint32_t)0U; c0 < t->count; c0 = c0 + (uint32_t)8U)
+  {
+    uint8_t *src1[8U] = { 0U };
+    uint8_t *src2[8U] = { 0U };
+    uint8_t *dst[8U] = { 0U };
+    uint32_t c = (uint32_t)0U;
+    for (; c < (uint32_t)8U && c0 + c < t->count; c++)
+    {
+      uint32_t pos = t->pos + (uint32_t)2U * (c0 + c);
+      src1[c] = level_index(t->st, t->hs, t->lv, pos);
+      src2[c] = level_index(t->st, t->hs, t->lv, pos + (uint32_t)1U);
+      if (t->st != NULL)
+      {
+        /* Contiguous storage: hash in place, the size of the level is updated by the caller. */
+        dst[c] = level_index(t->st, t->hs, t->lv + (uint32_t)1U, t->dst_pos + c0 + c);
+      }
+      else
+      {
+        dst[c] = hash_r_alloc(t->hsz);
+        t->out[c0 + c] = dst[c];
+      }
+    }
+    hash_pairs(t->hsz, t->hash_fun, c, src1, src2, dst);
+  }
+}
+
+#if !(defined(_WIN32) || defined(_WIN64))
+
+static void *hash_level_thread(void *t)
+{
+  hash_level((hash_level_task *)t);
+  return NULL;
+}
+
+#endif
+
+/* Levels with fewer pairs than this per worker are hashed by the calling thread. */
+#define MT_PAIRS_PER_WORKER 4096U
+
+static void
+hash_level_par(hash_level_task t, uint32_t workers)
+{
+  uint32_t nw = t.count / MT_PAIRS_PER_WORKER;
+  if (nw > workers)
+  {
+    nw = workers;
+  }
+  #if !(defined(_WIN32) || defined(_WIN64))
+  if (nw > (uint32_t)1U)
+  {
+    KRML_CHECK_SIZE(sizeof (hash_level_task), nw);
+    hash_level_task *ts = KRML_HOST_MALLOC(sizeof (hash_level_task) * nw);
+    KRML_CHECK_SIZE(sizeof (pthread_t), nw);
+    pthread_t *ths = KRML_HOST_MALLOC(sizeof (pthread_t) * nw);
+    /* Chunks are multiples of 8 pairs, so that only the last one has a partial batch. */
+    uint32_t chunk = (t.count / nw + (uint32_t)7U) / (uint32_t)8U * (uint32_t)8U;
+    uint32_t started = (uint32_t)0U;
+    for (uint32_t w = (uint32_t)0U; w < nw; w++)
+    {
+      uint32_t first = w * chunk;
+      ts[w] = t;
+      ts[w].pos = t.pos + (uint32_t)2U * first;
+      ts[w].count = first >= t.count ? (uint32_t)0U : (t.count - first < chunk ? t.count - first : chunk);
+      ts[w].dst_pos = t.dst_pos + first;
+      ts[w].out = t.out == NULL ? NULL : t.out + first;
+      /* The calling thread hashes the first chunk itself. */
+      if (w > (uint32_t)0U)
+      {
+        if (pthread_create(ths + w, NULL, hash_level_thread, ts + w) != 0)
+        {
+          break;
+        }
+        started++;
+      }
+    }
+    hash_level(ts);
+    for (uint32_t w = (uint32_t)1U; w < nw; w++)
+    {
+      if (w <= started)
+      {
+        pthread_join(ths[w], NULL);
+      }
+      else
+      {
+        hash_level(ts + w);
+      }
+    }
+    KRML_HOST_FREE(ths);
+    KRML_HOST_FREE(ts);
+    return;
+  }
+  #endif
+  hash_level(&t);
+}
+
+static void
+insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n, uint32_t workers)
+{
+  if (!file_reserve_insert(mt, n))
+  {
+    return;
+  }
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
+  uint32_t hsz = mtv.hash_size;
+  regional__uint32_t__uint8_t_
+  rg = { .state = hsz, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
+  MerkleTree_Low_Datastructures_hash_store *st = mtv.store;
+  MerkleTree_Low_Datastructures_hash_vec lv0 = index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U);
+  if (st != NULL)
+  {
+    lv0 = arena_reserve(st, (uint32_t)0U, lv0, n);
+    memcpy(level_index(st, hs, (uint32_t)0U, lv0.sz), leaves, (size_t)n * (size_t)hsz);
+    lv0.sz = lv0.sz + n;
+  }
+  else
+  {
+    for (uint32_t k = (uint32_t)0U; k < n; k++)
+    {
+      lv0 = insert_copy___uint8_t__uint32_t(rg, hash_copy, lv0, leaves + k * hsz);
+    }
+  }
+  assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, (uint32_t)0U, lv0);
+  /* At level lv, the new nodes have indices [j0 >> lv, j1 >> lv); each new node with
+     an odd index completes a pair whose parent is a new node of level lv + 1. */
+  uint64_t j0 = (uint64_t)mtv.j;
+  uint64_t j1 = (uint64_t)mtv.j + (uint64_t)n;
+  uint32_t lv = (uint32_t)0U;
+  while (j0 >> (lv + (uint32_t)1U) < j1 >> (lv + (uint32_t)1U))
+  {
+    MerkleTree_Low_Datastructures_hash_vec lvhs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
+    MerkleTree_Low_Datastructures_hash_vec
+    nhs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv + (uint32_t)1U);
+    uint64_t last = j1 >> lv;
+    uint64_t m = j0 >> (lv + (uint32_t)1U);
+    uint32_t count = (uint32_t)((j1 >> (lv + (uint32_t)1U)) - m);
+    uint8_t **out = NULL;
+    if (st != NULL)
+    {
+      nhs = arena_reserve(st, lv + (uint32_t)1U, nhs, count);
+    }
+    else
+    {
+      KRML_CHECK_SIZE(sizeof (uint8_t *), count);
+      out = KRML_HOST_MALLOC(sizeof (uint8_t *) * count);
+    }
+    /* lvhs holds the nodes of level lv up to index last - 1. */
+    hash_level_par((
+        (hash_level_task){
+          .hsz = hsz,
+          .hash_fun = mtv.hash_fun,
+          .hs = hs,
+          .st = st,
+          .lv = lv,
+          .pos = lvhs.sz - (uint32_t)(last - (m + m)),
+          .count = count,
+          .dst_pos = nhs.sz,
+          .out = out
+        }
+      ),
+      workers);
+    if (st != NULL)
+    {
+      nhs.sz = nhs.sz + count;
+    }
+    else
+    {
+      for (uint32_t k = (uint32_t)0U; k < count; k++)
+      {
+        nhs = insert___uint8_t__uint32_t(nhs, out[k]);
+      }
+      KRML_HOST_FREE(out);
+    }
+    assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv + (uint32_t)1U, nhs);
+    lv++;
+  }
+  *mt
+  =
+    (
+      (MerkleTree_Low_merkle_tree){
+        .hash_size = mtv.hash_size,
+        .offset = mtv.offset,
+        .i = mtv.i,
+        .j = mtv.j + n,
+        .hs = mtv.hs,
+        .rhs_ok = false,
+        .rhs = mtv.rhs,
+        .mroot = mtv.mroot,
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
+      }
+    );
+}
+
+void MerkleTree_Low_mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n)
+{
+  insert_batch(mt, leaves, n, (uint32_t)1U);
+}
+
+void
+MerkleTree_Low_mt_insert_batch_par(
+  MerkleTree_Low_merkle_tree *mt,
+  uint8_t *leaves,
+  uint32_t n,
+  uint32_t workers
+)
+{
+  insert_batch(mt, leaves, n, workers);
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun, false);
+  MerkleTree_Low_mt_insert(mt, init);
+  return mt;
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom_arena(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun, true);
+  MerkleTree_Low_mt_insert(mt, init);
+  return mt;
+}
+
+#if !(defined(_WIN32) || defined(_WIN64))
+
+/* The storage of a tree backed by the open file fd, with no level mapped yet. */
+static MerkleTree_Low_Datastructures_hash_store *file_store(int fd, uint32_t hsz)
+{
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Datastructures_hash_store), (uint32_t)1U);
+  MerkleTree_Low_Datastructures_hash_store
+  *st = KRML_HOST_CALLOC((uint32_t)1U, sizeof (MerkleTree_Low_Datastructures_hash_store));
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Datastructures_hash_file), (uint32_t)1U);
+  MerkleTree_Low_Datastructures_hash_file
+  *f = KRML_HOST_CALLOC((uint32_t)1U, sizeof (MerkleTree_Low_Datastructures_hash_file));
+  f->fd = fd;
+  st->hsz = hsz;
+  st->file = f;
+  return st;
+}
+
+/* Whether [off, off + len) intersects the segment of one of the levels below lv. */
+static bool
+segment_overlaps(
+  MerkleTree_Low_Datastructures_hash_file *f,
+  uint32_t lv,
+  uint64_t off,
+  uint64_t len
+)
+{
+  for (uint32_t k = (uint32_t)0U; k < lv; k++)
+  {
+    if (off < f->seg_off[k] + f->seg_len[k] && f->seg_off[k] < off + len)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+static MerkleTree_Low_merkle_tree
+*file_mt(
+  MerkleTree_Low_Datastructures_hash_store *st,
+  uint32_t hsz,
+  uint64_t offset,
+  uint32_t i,
+  uint32_t j,
+  uint32_t *sz,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_Datastructures_hash_vv
+  hs =
+    alloc_rid__LowStar_Vector_vector_str__uint8_t_((uint32_t)32U,
+      ((MerkleTree_Low_Datastructures_hash_vec){ .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }));
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    assign__LowStar_Vector_vector_str__uint8_t_(hs,
+      lv,
+      (
+        (MerkleTree_Low_Datastructures_hash_vec){
+          .sz = sz[lv],
+          .cap = (uint32_t)(st->file->seg_len[lv] / (uint64_t)hsz),
+          .vs = NULL
+        }
+      ));
+  }
+  MerkleTree_Low_Datastructures_hash_vec
+  rhs =
+    alloc_rid___uint8_t__uint32_t((
+        (regional__uint32_t__uint8_t_){
+          .state = hsz,
+          .dummy = NULL,
+          .r_alloc = hash_r_alloc,
+          .r_free = hash_r_free
+        }
+      ),
+      (uint32_t)32U);
+  uint8_t *mroot = hash_r_alloc(hsz);
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_merkle_tree), (uint32_t)1U);
+  MerkleTree_Low_merkle_tree *mt = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_merkle_tree));
+  mt[0U]
+  =
+    (
+      (MerkleTree_Low_merkle_tree){
+        .hash_size = hsz,
+        .offset = offset,
+        .i = i,
+        .j = j,
+        .hs = hs,
+        .rhs_ok = false,
+        .rhs = rhs,
+        .mroot = mroot,
+        .hash_fun = hash_fun,
+        .store = st
+      }
+    );
+  return mt;
+}
+
+/*
+  The first (at most MT_FILE_CHECK_LEN) bytes of the hash of two zero hashes,
+  which identify the hash function of a tree in the header of its file.
+*/
+static void
+hash_check(
+  uint32_t hsz,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2),
+  uint8_t *dst
+)
+{
+  uint8_t *z0 = hash_r_alloc(hsz);
+  uint8_t *z1 = hash_r_alloc(hsz);
+  uint8_t *h = hash_r_alloc(hsz);
+  hash_fun(z0, z1, h);
+  memcpy(dst, h, (hsz < MT_FILE_CHECK_LEN ? hsz : MT_FILE_CHECK_LEN) * sizeof (uint8_t));
+  hash_r_free(hsz, z0);
+  hash_r_free(hsz, z1);
+  hash_r_free(hsz, h);
+}
+
+/*
+  Header layout (little-endian): magic (8 bytes), hash size, i, j, 0 (4 bytes
+  each), offset, end of file (8 bytes each), then for each of the 32 levels the
+  offset of its segment (8 bytes), its capacity and its number of hashes (4
+  bytes each), then the hash_check of the hash function (MT_FILE_CHECK_LEN
+  bytes, zero-padded).
+*/
+static bool write_header(const MerkleTree_Low_merkle_tree *mt)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  MerkleTree_Low_Datastructures_hash_file *f = mtv.store->file;
+  uint8_t hdr[MT_FILE_HEADER_LEN] = { 0U };
+  memcpy(hdr, MT_FILE_MAGIC, (uint32_t)8U * sizeof (uint8_t));
+  store32_le(hdr + (uint32_t)8U, mtv.hash_size);
+  store32_le(hdr + (uint32_t)12U, mtv.i);
+  store32_le(hdr + (uint32_t)16U, mtv.j);
+  store64_le(hdr + (uint32_t)24U, mtv.offset);
+  store64_le(hdr + (uint32_t)32U, f->end);
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    MerkleTree_Low_Datastructures_hash_vec vec = mtv.hs.vs[lv];
+    uint8_t *e = hdr + (uint32_t)40U + lv * (uint32_t)16U;
+    store64_le(e, f->seg_off[lv]);
+    store32_le(e + (uint32_t)8U, vec.cap);
+    store32_le(e + (uint32_t)12U, vec.sz);
+  }
+  hash_check(mtv.hash_size, mtv.hash_fun, hdr + (uint32_t)40U + (uint32_t)32U * (uint32_t)16U);
+  return pwrite(f->fd, hdr, sizeof (hdr), (off_t)0) == (ssize_t)sizeof (hdr);
 }
 
-static void
-assign__LowStar_Vector_vector_str__uint8_t__uint32_t(
-  MerkleTree_Low_Datastructures_hash_vv rv,
-  uint32_t i,
-  MerkleTree_Low_Datastructures_hash_vec v
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom_file(
+  const char *path,
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 )
 {
-  assign__LowStar_Vector_vector_str__uint8_t_(rv, i, v);
+  int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    return NULL;
+  }
+  MerkleTree_Low_Datastructures_hash_store *st = file_store(fd, hsz);
+  st->file->end = file_round((uint64_t)MT_FILE_HEADER_LEN);
+  uint32_t sz[32U] = { 0U };
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    if (file_map(st, lv, file_round((uint64_t)hsz)) == NULL)
+    {
+      store_free(st);
+      return NULL;
+    }
+  }
+  MerkleTree_Low_merkle_tree
+  *mt = file_mt(st, hsz, (uint64_t)0U, (uint32_t)0U, (uint32_t)0U, sz, hash_fun);
+  MerkleTree_Low_mt_insert(mt, init);
+  if (!MerkleTree_Low_mt_sync_file(mt))
+  {
+    free_mt(mt);
+    return NULL;
+  }
+  return mt;
 }
 
-static void
-insert_(
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_open_file(
+  const char *path,
   uint32_t hsz,
-  uint32_t lv,
-  uint32_t j,
-  MerkleTree_Low_Datastructures_hash_vv hs,
-  uint8_t *acc,
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 )
 {
-  MerkleTree_Low_Datastructures_hash_vec
-  uu____0 = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-  MerkleTree_Low_Datastructures_hash_vec
-  ihv =
-    insert_copy___uint8_t__uint32_t((
-        (regional__uint32_t__uint8_t_){
-          .state = hsz,
-          .dummy = NULL,
-          .r_alloc = hash_r_alloc,
-          .r_free = hash_r_free
-        }
-      ),
-      hash_copy,
-      uu____0,
-      acc);
-  assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, ihv);
-  if (j % (uint32_t)2U == (uint32_t)1U)
+  int fd = open(path, O_RDWR);
+  if (fd < 0)
   {
-    MerkleTree_Low_Datastructures_hash_vec
-    lvhs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-    hash_fun(index___uint8_t_(lvhs, lvhs.sz - (uint32_t)2U), acc, acc);
-    insert_(hsz, lv + (uint32_t)1U, j / (uint32_t)2U, hs, acc, hash_fun);
-    return;
+    return NULL;
+  }
+  uint8_t hdr[MT_FILE_HEADER_LEN] = { 0U };
+  struct stat fs;
+  if
+  (
+    pread(fd, hdr, sizeof (hdr), (off_t)0) != (ssize_t)sizeof (hdr)
+    || memcmp(hdr, MT_FILE_MAGIC, (uint32_t)8U * sizeof (uint8_t)) != 0
+    || fstat(fd, &fs) != 0
+  )
+  {
+    close(fd);
+    return NULL;
+  }
+  uint32_t i = load32_le(hdr + (uint32_t)12U);
+  uint32_t j = load32_le(hdr + (uint32_t)16U);
+  uint64_t offset = load64_le(hdr + (uint32_t)24U);
+  uint64_t end = load64_le(hdr + (uint32_t)32U);
+  uint8_t check[MT_FILE_CHECK_LEN] = { 0U };
+  if (hsz == (uint32_t)0U || load32_le(hdr + (uint32_t)8U) != hsz)
+  {
+    close(fd);
+    return NULL;
+  }
+  /* Only called once hsz is known to be that of the file. */
+  hash_check(hsz, hash_fun, check);
+  if
+  (
+    memcmp(hdr + (uint32_t)40U + (uint32_t)32U * (uint32_t)16U,
+      check,
+      MT_FILE_CHECK_LEN * sizeof (uint8_t))
+    != 0
+    || i > j
+    || MerkleTree_Low_uint64_max - offset < (uint64_t)j
+    || end > (uint64_t)fs.st_size
+  )
+  {
+    close(fd);
+    return NULL;
+  }
+  MerkleTree_Low_Datastructures_hash_store *st = file_store(fd, hsz);
+  MerkleTree_Low_Datastructures_hash_file *f = st->file;
+  f->end = end;
+  uint32_t sz[32U] = { 0U };
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    uint8_t *e = hdr + (uint32_t)40U + lv * (uint32_t)16U;
+    uint64_t off = load64_le(e);
+    uint32_t cap = load32_le(e + (uint32_t)8U);
+    uint64_t len = file_round((uint64_t)cap * (uint64_t)hsz);
+    sz[lv] = load32_le(e + (uint32_t)12U);
+    void *p = MAP_FAILED;
+    /* Level lv holds the hashes from offset_of(i >> lv) to j >> lv. */
+    if
+    (
+      sz[lv] == (j >> lv) - MerkleTree_Low_offset_of(i >> lv)
+      && sz[lv] <= cap
+      && cap > (uint32_t)0U
+      && off >= file_round((uint64_t)MT_FILE_HEADER_LEN)
+      && off <= end
+      && len <= end - off
+      && !segment_overlaps(f, lv, off, len)
+    )
+    {
+      p = mmap(NULL, (size_t)len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, (off_t)off);
+    }
+    if (p == MAP_FAILED)
+    {
+      store_free(st);
+      return NULL;
+    }
+    st->arena[lv] = (uint8_t *)p;
+    f->seg_off[lv] = off;
+    f->seg_len[lv] = len;
   }
+  return file_mt(st, hsz, offset, i, j, sz, hash_fun);
 }
 
-bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v)
+bool MerkleTree_Low_mt_sync_file(const MerkleTree_Low_merkle_tree *mt)
 {
-  MerkleTree_Low_merkle_tree mt1 = *(MerkleTree_Low_merkle_tree *)mt;
-  return
-    mt1.j
-    < MerkleTree_Low_uint32_32_max
-    && MerkleTree_Low_uint64_max - mt1.offset >= (uint64_t)(mt1.j + (uint32_t)1U);
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  MerkleTree_Low_Datastructures_hash_store *st = mtv.store;
+  if (st == NULL || st->file == NULL)
+  {
+    return false;
+  }
+  MerkleTree_Low_Datastructures_hash_file *f = st->file;
+  bool ok = true;
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    ok = ok && msync(st->arena[lv], (size_t)f->seg_len[lv], MS_SYNC) == 0;
+  }
+  /*
+    The header is written last, so that it does not refer to unmapped segments;
+    this does not make the update atomic, see MerkleTree_Low_Datastructures_hash_file_s.
+  */
+  return ok && write_header(mt) && fsync(f->fd) == 0;
 }
 
-void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
+#else
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom_file(
+  const char *path,
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
 {
-  MerkleTree_Low_merkle_tree mtv = *mt;
-  MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
-  uint32_t hsz1 = mtv.hash_size;
-  insert_(hsz1, (uint32_t)0U, mtv.j, hs, v, mtv.hash_fun);
-  *mt
-  =
-    (
-      (MerkleTree_Low_merkle_tree){
-        .hash_size = mtv.hash_size,
-        .offset = mtv.offset,
-        .i = mtv.i,
-        .j = mtv.j + (uint32_t)1U,
-        .hs = mtv.hs,
-        .rhs_ok = false,
-        .rhs = mtv.rhs,
-        .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
-      }
-    );
+  return NULL;
 }
 
 MerkleTree_Low_merkle_tree
-*MerkleTree_Low_mt_create_custom(
+*MerkleTree_Low_mt_open_file(
+  const char *path,
   uint32_t hsz,
-  uint8_t *init,
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 )
 {
-  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
-  MerkleTree_Low_mt_insert(mt, init);
-  return mt;
+  return NULL;
+}
+
+bool MerkleTree_Low_mt_sync_file(const MerkleTree_Low_merkle_tree *mt)
+{
+  return false;
 }
 
+#endif
+
 bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee)
 {
   return true;
@@ -984,6 +2219,7 @@ construct_rhs(
   uint32_t hsz,
   uint32_t lv,
   MerkleTree_Low_Datastructures_hash_vv hs,
+  const MerkleTree_Low_Datastructures_hash_store *st,
   MerkleTree_Low_Datastructures_hash_vec rhs,
   uint32_t i,
   uint32_t j,
@@ -1000,6 +2236,7 @@ construct_rhs(
       construct_rhs(hsz,
         lv + (uint32_t)1U,
         hs,
+        st,
         rhs,
         i / (uint32_t)2U,
         j / (uint32_t)2U,
@@ -1022,20 +2259,16 @@ construct_rhs(
         rhs,
         lv,
         acc);
-      hash_fun(index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
-          j - (uint32_t)1U - ofs),
-        acc,
-        acc);
+      hash_fun(level_index(st, hs, lv, j - (uint32_t)1U - ofs), acc, acc);
     }
     else
     {
-      hash_copy(hsz,
-        index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv), j - (uint32_t)1U - ofs),
-        acc);
+      hash_copy(hsz, level_index(st, hs, lv, j - (uint32_t)1U - ofs), acc);
     }
     construct_rhs(hsz,
       lv + (uint32_t)1U,
       hs,
+      st,
       rhs,
       i / (uint32_t)2U,
       j / (uint32_t)2U,
@@ -1070,7 +2303,7 @@ void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *r
     hash_copy(hash_size, mroot, rt);
     return;
   }
-  construct_rhs(hash_size, (uint32_t)0U, hs, rhs, i, j, rt, false, hash_fun);
+  construct_rhs(hash_size, (uint32_t)0U, hs, mtv.store, rhs, i, j, rt, false, hash_fun);
   hash_copy(hash_size, rt, mroot);
   *mt1
   =
@@ -1084,7 +2317,8 @@ void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *r
         .rhs_ok = true,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .store = mtv.store
       }
     );
 }
@@ -1153,6 +2387,7 @@ mt_get_path_(
   uint32_t hsz,
   uint32_t lv,
   MerkleTree_Low_Datastructures_hash_vv hs,
+  const MerkleTree_Low_Datastructures_hash_store *st,
   MerkleTree_Low_Datastructures_hash_vec rhs,
   uint32_t i,
   uint32_t j,
@@ -1168,10 +2403,7 @@ mt_get_path_(
     uint32_t ofs1 = MerkleTree_Low_offset_of(i);
     if (k % (uint32_t)2U == (uint32_t)1U)
     {
-      uint8_t
-      *uu____0 =
-        index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
-          k - (uint32_t)1U - ofs1);
+      uint8_t *uu____0 = level_index(st, hs, lv, k - (uint32_t)1U - ofs1);
       MerkleTree_Low_path pth1 = *p;
       MerkleTree_Low_Datastructures_hash_vec pv = pth1.hashes;
       MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, uu____0);
@@ -1192,10 +2424,7 @@ mt_get_path_(
       }
       else
       {
-        uint8_t
-        *uu____2 =
-          index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
-            k + (uint32_t)1U - ofs1);
+        uint8_t *uu____2 = level_index(st, hs, lv, k + (uint32_t)1U - ofs1);
         MerkleTree_Low_path pth1 = *p;
         MerkleTree_Low_Datastructures_hash_vec pv = pth1.hashes;
         MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, uu____2);
@@ -1214,6 +2443,7 @@ mt_get_path_(
     mt_get_path_(hsz,
       lv + (uint32_t)1U,
       hs,
+      st,
       rhs,
       i / (uint32_t)2U,
       j / (uint32_t)2U,
@@ -1266,23 +2496,123 @@ MerkleTree_Low_mt_get_path(
   uint32_t j = mtv.j;
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
   MerkleTree_Low_Datastructures_hash_vec rhs = mtv.rhs;
-  uint8_t
-  *ih =
-    index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U),
-      idx1 - ofs);
+  uint8_t *ih = level_index(mtv.store, hs, (uint32_t)0U, idx1 - ofs);
   MerkleTree_Low_path pth = *p;
   MerkleTree_Low_Datastructures_hash_vec pv = pth.hashes;
   MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, ih);
   *p = ((MerkleTree_Low_path){ .hash_size = hsz1, .hashes = ipv });
-  mt_get_path_(mtv.hash_size, (uint32_t)0U, hs, rhs, i, j, idx1, p, false);
+  mt_get_path_(mtv.hash_size, (uint32_t)0U, hs, mtv.store, rhs, i, j, idx1, p, false);
   return j;
 }
 
+bool
+MerkleTree_Low_mt_get_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint8_t *buf,
+  uint64_t len,
+  uint32_t *lens,
+  uint8_t *root
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  uint64_t need = (uint64_t)0U;
+  for (uint32_t t = (uint32_t)0U; t < n; t++)
+  {
+    uint64_t x = idx[t];
+    if
+    (
+      !(x
+      >= mtv.offset
+      && x - mtv.offset <= MerkleTree_Low_offset_range_limit
+      && mtv.i <= (uint32_t)(x - mtv.offset)
+      && (uint32_t)(x - mtv.offset) < mtv.j)
+    )
+    {
+      return false;
+    }
+    uint32_t
+    plen = (uint32_t)1U + mt_path_length((uint32_t)0U, (uint32_t)(x - mtv.offset), mtv.j, false);
+    need = need + (uint64_t)plen * (uint64_t)mtv.hash_size;
+  }
+  return need <= len;
+}
+
+uint32_t
+MerkleTree_Low_mt_get_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint8_t *buf,
+  uint64_t len,
+  uint32_t *lens,
+  uint8_t *root
+)
+{
+  MerkleTree_Low_merkle_tree *ncmt = (MerkleTree_Low_merkle_tree *)mt;
+  MerkleTree_Low_mt_get_root(mt, root);
+  MerkleTree_Low_merkle_tree mtv = *ncmt;
+  uint32_t hsz = mtv.hash_size;
+  MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
+  MerkleTree_Low_Datastructures_hash_vec rhs = mtv.rhs;
+  uint8_t *out = buf;
+  for (uint32_t t = (uint32_t)0U; t < n; t++)
+  {
+    uint32_t k = (uint32_t)(idx[t] - mtv.offset);
+    uint32_t i = mtv.i;
+    uint32_t j = mtv.j;
+    bool actd = false;
+    uint32_t cnt = (uint32_t)1U;
+    memcpy(out,
+      level_index(mtv.store, hs, (uint32_t)0U, k - MerkleTree_Low_offset_of(i)),
+      hsz * sizeof (uint8_t));
+    out = out + hsz;
+    /* Same walk as mt_get_path_, writing copies instead of pointers. */
+    for (uint32_t lv = (uint32_t)0U; !(j == (uint32_t)0U); lv++)
+    {
+      uint32_t ofs = MerkleTree_Low_offset_of(i);
+      uint8_t *sib = NULL;
+      if (k % (uint32_t)2U == (uint32_t)1U)
+      {
+        sib = level_index(mtv.store, hs, lv, k - (uint32_t)1U - ofs);
+      }
+      else if (!(k == j))
+      {
+        if (k + (uint32_t)1U == j)
+        {
+          if (actd)
+          {
+            sib = index___uint8_t_(rhs, lv);
+          }
+        }
+        else
+        {
+          sib = level_index(mtv.store, hs, lv, k + (uint32_t)1U - ofs);
+        }
+      }
+      if (sib != NULL)
+      {
+        memcpy(out, sib, hsz * sizeof (uint8_t));
+        out = out + hsz;
+        cnt++;
+      }
+      actd = actd || j % (uint32_t)2U == (uint32_t)1U;
+      i = i / (uint32_t)2U;
+      j = j / (uint32_t)2U;
+      k = k / (uint32_t)2U;
+    }
+    lens[t] = cnt;
+  }
+  return mtv.j;
+}
+
 static void
 mt_flush_to_(
   uint32_t hsz,
   uint32_t lv,
   MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_store *st,
   uint32_t pi,
   uint32_t i
 )
@@ -1294,7 +2624,7 @@ mt_flush_to_(
     uint32_t ofs = oi - opi;
     MerkleTree_Low_Datastructures_hash_vec
     hvec = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-    if (!(ofs == (uint32_t)0U))
+    if (!(ofs == (uint32_t)0U) && st == NULL)
     {
       free_elems___uint8_t__uint32_t((
           (regional__uint32_t__uint8_t_){
@@ -1323,6 +2653,16 @@ mt_flush_to_(
     {
       frv = hvec;
     }
+    else if (st != NULL)
+    {
+      uint32_t n_shifted = hvec.sz - ofs;
+      /* In place, also for a file-backed level: see mt_sync_file. */
+      memmove(st->arena[lv],
+        st->arena[lv] + (size_t)ofs * (size_t)hsz,
+        (size_t)n_shifted * (size_t)hsz);
+      frv =
+        ((MerkleTree_Low_Datastructures_hash_vec){ .sz = n_shifted, .cap = hvec.cap, .vs = NULL });
+    }
     else
     {
       uint32_t n_shifted = hvec.sz - ofs;
@@ -1342,7 +2682,7 @@ mt_flush_to_(
     }
     MerkleTree_Low_Datastructures_hash_vec flushed = frv;
     assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, flushed);
-    mt_flush_to_(hsz, lv + (uint32_t)1U, hs, pi / (uint32_t)2U, i / (uint32_t)2U);
+    mt_flush_to_(hsz, lv + (uint32_t)1U, hs, st, pi / (uint32_t)2U, i / (uint32_t)2U);
     return;
   }
 }
@@ -1365,7 +2705,7 @@ void MerkleTree_Low_mt_flush_to(MerkleTree_Low_merkle_tree *mt, uint64_t idx)
   uint32_t hsz = mtv.hash_size;
   uint32_t idx1 = (uint32_t)(idx - offset);
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
-  mt_flush_to_(hsz, (uint32_t)0U, hs, mtv.i, idx1);
+  mt_flush_to_(hsz, (uint32_t)0U, hs, mtv.store, mtv.i, idx1);
   *mt
   =
     (
@@ -1378,7 +2718,8 @@ void MerkleTree_Low_mt_flush_to(MerkleTree_Low_merkle_tree *mt, uint64_t idx)
         .rhs_ok = mtv.rhs_ok,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
       }
     );
 }
@@ -1419,7 +2760,13 @@ static MerkleTree_Low_Datastructures_hash_vec
 shrink___uint8_t_(MerkleTree_Low_Datastructures_hash_vec vec, uint32_t new_size)
 {
   return
-    ((MerkleTree_Low_Datastructures_hash_vec){ .sz = new_size, .cap = vec.cap, .vs = vec.vs });
+    (
+      (MerkleTree_Low_Datastructures_hash_vec){
+        .sz = new_size,
+        .cap = vec.cap,
+        .vs = vec.vs
+      }
+    );
 }
 
 static MerkleTree_Low_Datastructures_hash_vec
@@ -1443,6 +2790,7 @@ static void
 mt_retract_to_(
   uint32_t hsz,
   MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_store *st,
   uint32_t lv,
   uint32_t i,
   uint32_t s,
@@ -1455,23 +2803,31 @@ mt_retract_to_(
     hvec = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
     uint32_t old_len = j - MerkleTree_Low_offset_of(i);
     uint32_t new_len = s - MerkleTree_Low_offset_of(i);
-    MerkleTree_Low_Datastructures_hash_vec
-    retracted =
-      shrink___uint8_t__uint32_t((
-          (regional__uint32_t__uint8_t_){
-            .state = hsz,
-            .dummy = NULL,
-            .r_alloc = hash_r_alloc,
-            .r_free = hash_r_free
-          }
-        ),
-        hvec,
-        new_len);
+    MerkleTree_Low_Datastructures_hash_vec retracted;
+    if (st != NULL)
+    {
+      retracted = new_len >= hvec.sz ? hvec : shrink___uint8_t_(hvec, new_len);
+    }
+    else
+    {
+      retracted =
+        shrink___uint8_t__uint32_t((
+            (regional__uint32_t__uint8_t_){
+              .state = hsz,
+              .dummy = NULL,
+              .r_alloc = hash_r_alloc,
+              .r_free = hash_r_free
+            }
+          ),
+          hvec,
+          new_len);
+    }
     assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, retracted);
     if (lv + (uint32_t)1U < hs.sz)
     {
       mt_retract_to_(hsz,
         hs,
+        st,
         lv + (uint32_t)1U,
         i / (uint32_t)2U,
         s / (uint32_t)2U,
@@ -1499,7 +2855,7 @@ void MerkleTree_Low_mt_retract_to(MerkleTree_Low_merkle_tree *mt, uint64_t r)
   uint64_t offset = mtv.offset;
   uint32_t r1 = (uint32_t)(r - offset);
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
-  mt_retract_to_(mtv.hash_size, hs, (uint32_t)0U, mtv.i, r1 + (uint32_t)1U, mtv.j);
+  mt_retract_to_(mtv.hash_size, hs, mtv.store, (uint32_t)0U, mtv.i, r1 + (uint32_t)1U, mtv.j);
   *mt
   =
     (
@@ -1512,7 +2868,8 @@ void MerkleTree_Low_mt_retract_to(MerkleTree_Low_merkle_tree *mt, uint64_t r)
         .rhs_ok = false,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
       }
     );
 }
@@ -1632,6 +2989,184 @@ MerkleTree_Low_mt_verify(
   return r;
 }
 
+bool
+MerkleTree_Low_mt_verify_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint64_t j,
+  const uint8_t *buf,
+  const uint32_t *lens,
+  uint8_t *rt,
+  bool *res
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  if (!(j >= mtv.offset && j - mtv.offset <= MerkleTree_Low_offset_range_limit))
+  {
+    return false;
+  }
+  for (uint32_t t = (uint32_t)0U; t < n; t++)
+  {
+    uint64_t k = idx[t];
+    if
+    (
+      !(k
+      < j
+      && k >= mtv.offset
+      && k - mtv.offset <= MerkleTree_Low_offset_range_limit
+      &&
+        lens[t]
+        ==
+          (uint32_t)1U
+          +
+            mt_path_length((uint32_t)0U,
+              (uint32_t)(k - mtv.offset),
+              (uint32_t)(j - mtv.offset),
+              false))
+    )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Per-proof state kept by mt_verify_batch: the accumulator on entry to each
+   level and the position in the path of the hash consumed at that level. */
+typedef struct verify_trace_s
+{
+  uint8_t *accs;
+  uint32_t ppos[33U];
+  uint32_t nlv;
+  uint32_t k;
+  uint32_t len;
+  const uint8_t *path;
+  bool res;
+}
+verify_trace;
+
+bool
+MerkleTree_Low_mt_verify_batch(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint64_t j,
+  const uint8_t *buf,
+  const uint32_t *lens,
+  uint8_t *rt,
+  bool *res
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  uint32_t hsz = mtv.hash_size;
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2) = mtv.hash_fun;
+  uint32_t j1 = (uint32_t)(j - mtv.offset);
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)66U * hsz);
+  uint8_t *accs = (uint8_t *)KRML_HOST_CALLOC((uint32_t)66U * hsz, sizeof (uint8_t));
+  verify_trace tr[2U];
+  tr[0U].accs = accs;
+  tr[1U].accs = accs + (uint32_t)33U * hsz;
+  verify_trace *cur = &tr[0U];
+  verify_trace *prev = &tr[1U];
+  bool have_prev = false;
+  bool all = true;
+  const uint8_t *path = buf;
+  for (uint32_t t = (uint32_t)0U; t < n; t++)
+  {
+    uint32_t k = (uint32_t)(idx[t] - mtv.offset);
+    uint32_t len = lens[t];
+    cur->k = k;
+    cur->len = len;
+    cur->path = path;
+    memcpy(cur->accs, path, hsz * sizeof (uint8_t));
+    uint32_t kk = k;
+    uint32_t jj = j1;
+    uint32_t pp = (uint32_t)1U;
+    uint32_t lv = (uint32_t)0U;
+    bool actd = false;
+    bool tried = !have_prev;
+    bool shared = false;
+    while (!(jj == (uint32_t)0U))
+    {
+      cur->ppos[lv] = pp;
+      if (!tried && kk == prev->k >> lv)
+      {
+        /* Both proofs reach the same node here and the rest of the walk only
+           depends on that node's hash and the remaining path hashes. */
+        tried = true;
+        uint32_t rem = len - pp;
+        if
+        (
+          rem
+          == prev->len - prev->ppos[lv]
+          && memcmp(cur->accs + lv * hsz, prev->accs + lv * hsz, hsz * sizeof (uint8_t)) == 0
+          && memcmp(path + pp * hsz, prev->path + prev->ppos[lv] * hsz, rem * hsz * sizeof (uint8_t))
+          == 0
+        )
+        {
+          for (uint32_t l = lv; l < prev->nlv; l++)
+          {
+            cur->ppos[l] = prev->ppos[l] - prev->ppos[lv] + pp;
+          }
+          memcpy(cur->accs + (lv + (uint32_t)1U) * hsz,
+            prev->accs + (lv + (uint32_t)1U) * hsz,
+            (prev->nlv - lv) * hsz * sizeof (uint8_t));
+          cur->nlv = prev->nlv;
+          cur->res = prev->res;
+          shared = true;
+          break;
+        }
+      }
+      uint8_t *acc = cur->accs + lv * hsz;
+      uint8_t *nacc = acc + hsz;
+      bool nactd = actd || jj % (uint32_t)2U == (uint32_t)1U;
+      if (kk % (uint32_t)2U == (uint32_t)0U)
+      {
+        if (jj == kk || (jj == kk + (uint32_t)1U && !actd))
+        {
+          memcpy(nacc, acc, hsz * sizeof (uint8_t));
+        }
+        else
+        {
+          hash_fun(acc, (uint8_t *)path + pp * hsz, nacc);
+          pp++;
+        }
+      }
+      else
+      {
+        hash_fun((uint8_t *)path + pp * hsz, acc, nacc);
+        pp++;
+      }
+      actd = nactd;
+      kk = kk / (uint32_t)2U;
+      jj = jj / (uint32_t)2U;
+      lv++;
+    }
+    if (!shared)
+    {
+      cur->nlv = lv;
+      uint8_t *acc = cur->accs + lv * hsz;
+      uint8_t r = (uint8_t)255U;
+      for (uint32_t i = (uint32_t)0U; i < hsz; i++)
+      {
+        uint8_t uu____0 = FStar_UInt8_eq_mask(acc[i], rt[i]);
+        r = uu____0 & r;
+      }
+      cur->res = r == (uint8_t)255U;
+    }
+    res[t] = cur->res;
+    all = all && cur->res;
+    path = path + len * hsz;
+    verify_trace *tmp = prev;
+    prev = cur;
+    cur = tmp;
+    have_prev = true;
+  }
+  KRML_HOST_FREE(accs);
+  return all;
+}
+
 typedef struct __bool_uint32_t_s
 {
   bool fst;
@@ -1795,6 +3330,30 @@ serialize_hash_vec(
   return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
 }
 
+/* serialize_hash_vec for a level of n hashes stored back to back in arena. */
+static __bool_uint32_t
+serialize_hash_arena(
+  uint32_t hash_size,
+  bool ok,
+  uint32_t n,
+  uint8_t *arena,
+  uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos
+)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+  }
+  __bool_uint32_t scrut = serialize_uint32_t(ok, n, buf, sz, pos);
+  for (uint32_t i = (uint32_t)0U; i < n && scrut.fst; i++)
+  {
+    scrut = serialize_hash(hash_size, scrut.fst, arena + (size_t)i * (size_t)hash_size, buf, sz, scrut.snd);
+  }
+  return scrut;
+}
+
 static uint64_t
 hash_vv_bytes_i(uint32_t hash_size, MerkleTree_Low_Datastructures_hash_vv vv, uint32_t i)
 {
@@ -1826,6 +3385,7 @@ serialize_hash_vv_i(
   uint32_t hash_size,
   bool ok,
   MerkleTree_Low_Datastructures_hash_vv x,
+  const MerkleTree_Low_Datastructures_hash_store *st,
   uint8_t *buf,
   uint32_t sz,
   uint32_t pos,
@@ -1837,13 +3397,21 @@ serialize_hash_vv_i(
     return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
   }
   MerkleTree_Low_Datastructures_hash_vec vi = index__LowStar_Vector_vector_str__uint8_t_(x, i);
-  __bool_uint32_t scrut = serialize_hash_vec(hash_size, ok, vi, buf, sz, pos);
+  __bool_uint32_t scrut;
+  if (st != NULL)
+  {
+    scrut = serialize_hash_arena(hash_size, ok, vi.sz, st->arena[i], buf, sz, pos);
+  }
+  else
+  {
+    scrut = serialize_hash_vec(hash_size, ok, vi, buf, sz, pos);
+  }
   bool ok1 = scrut.fst;
   uint32_t pos1 = scrut.snd;
   uint32_t j = i + (uint32_t)1U;
   if (j < x.sz)
   {
-    return serialize_hash_vv_i(hash_size, ok1, x, buf, sz, pos1, j);
+    return serialize_hash_vv_i(hash_size, ok1, x, st, buf, sz, pos1, j);
   }
   return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
 }
@@ -1853,6 +3421,7 @@ serialize_hash_vv(
   uint32_t hash_size,
   bool ok,
   MerkleTree_Low_Datastructures_hash_vv x,
+  const MerkleTree_Low_Datastructures_hash_store *st,
   uint8_t *buf,
   uint32_t sz,
   uint32_t pos
@@ -1867,7 +3436,7 @@ serialize_hash_vv(
   uint32_t pos1 = scrut.snd;
   if (x.sz > (uint32_t)0U)
   {
-    return serialize_hash_vv_i(hash_size, ok1, x, buf, sz, pos1, (uint32_t)0U);
+    return serialize_hash_vv_i(hash_size, ok1, x, st, buf, sz, pos1, (uint32_t)0U);
   }
   return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
 }
@@ -2328,7 +3897,7 @@ MerkleTree_Low_Serialization_mt_serialize(
   __bool_uint32_t scrut3 = serialize_uint32_t(ok3, mtv.j, output, sz1, pos3);
   bool ok4 = scrut3.fst;
   uint32_t pos4 = scrut3.snd;
-  __bool_uint32_t scrut4 = serialize_hash_vv(mtv.hash_size, ok4, mtv.hs, output, sz1, pos4);
+  __bool_uint32_t scrut4 = serialize_hash_vv(mtv.hash_size, ok4, mtv.hs, mtv.store, output, sz1, pos4);
   bool ok5 = scrut4.fst;
   uint32_t pos5 = scrut4.snd;
   __bool_uint32_t scrut5 = serialize_bool(ok5, mtv.rhs_ok, output, sz1, pos5);
@@ -2424,7 +3993,8 @@ MerkleTree_Low_merkle_tree
         .rhs_ok = rhs_ok,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .store = NULL
       }
     );
   return buf;
@@ -75,6 +75,17 @@ typedef MerkleTree_Low_path *path_p;
 
 typedef const MerkleTree_Low_path *const_path_p;
 
+/*
+  Contiguous storage of the levels of a tree, see `mt_create_custom_arena` and
+  `mt_create_custom_file`.
+*/
+typedef struct MerkleTree_Low_Datastructures_hash_store_s
+MerkleTree_Low_Datastructures_hash_store;
+
+/*
+  When store is not NULL, the hashes of level lv are kept in store rather than in
+  hs.vs[lv].vs, which is NULL; only hs.vs[lv].sz and hs.vs[lv].cap are meaningful.
+*/
 typedef struct MerkleTree_Low_merkle_tree_s
 {
   uint32_t hash_size;
@@ -86,6 +97,7 @@ typedef struct MerkleTree_Low_merkle_tree_s
   MerkleTree_Low_Datastructures_hash_vec rhs;
   uint8_t *mroot;
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+  MerkleTree_Low_Datastructures_hash_store *store;
 }
 MerkleTree_Low_merkle_tree;
 
@@ -162,10 +174,99 @@ MerkleTree_Low_merkle_tree
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 );
 
+/**
+  Construction with contiguous storage and custom hash functions
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree
+
+ Note: the hashes of each level of the tree are stored back to back in a single
+ growable buffer, instead of being allocated one by one. Paths obtained with
+ `mt_get_path` point into these buffers and are invalidated by any subsequent
+ insertion or flush.
+*/
+MerkleTree_Low_merkle_tree
+*mt_create_custom_arena(
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+/**
+  Construction of a tree stored in a file, with custom hash functions
+
+  @param[in]  path      The file, which is created or truncated
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree, or NULL if the file cannot be created
+
+ Note: the storage is that of `mt_create_custom_arena`, except that every level
+ lives in a segment of the file mapped in memory: insertions write through to
+ the file, and only the header needs to be updated to persist the tree (see
+ `mt_sync_file`). The file is not crash-safe. Not available on Windows.
+*/
+MerkleTree_Low_merkle_tree
+*mt_create_custom_file(
+  const char *path,
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+/**
+  Opening of a tree stored in a file
+
+  @param[in]  path      A file written by a tree created with `mt_create_custom_file`
+                        or `mt_create_file`
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  hash_fun  The hash function of the tree
+
+  return The Merkle tree, or NULL if the file cannot be opened, is malformed, or
+  was written with another hash size or hash function
+
+ Note: the levels are mapped, not read, so that opening does not depend on the
+ size of the tree. The header is checked for consistency, but the hashes are
+ not: after a crash, the tree may have been corrupted (see `mt_sync_file`).
+*/
+MerkleTree_Low_merkle_tree
+*mt_open_file(
+  const char *path,
+  uint32_t hash_size,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+/**
+  Persisting a tree stored in a file
+
+  @param[in]  mt  The Merkle tree
+
+  return false if the tree is not stored in a file or an I/O error occurred
+
+ Note: the hashes are flushed to disk before the header, but the update is not
+ atomic: the hashes are written in place as the tree changes, so a crash (or a
+ failed call) between two successful calls can leave the file corrupted.
+*/
+bool mt_sync_file(const MerkleTree_Low_merkle_tree *mt);
+
+/**
+  Persisting and destruction of a tree stored in a file
+
+  @param[in]  mt  The Merkle tree
+
+  return The result of `mt_sync_file`; the tree is freed in any case
+*/
+bool mt_close_file(MerkleTree_Low_merkle_tree *mt);
+
 /**
   Destruction
 
   @param[in]  mt  The Merkle tree
+
+ Note: a tree stored in a file is synced first, ignoring errors; use
+ `mt_close_file` to check them.
 */
 void mt_free(MerkleTree_Low_merkle_tree *mt);
 
@@ -181,9 +282,58 @@ void mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
 /**
   Precondition predicate for mt_insert
+
+ Note: for a tree stored in a file, this also grows the file so that the insertion
+ does not need to, and returns false if it cannot (for instance, if the disk is
+ full); `mt_insert` then leaves the tree unchanged.
 */
 bool mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
+/**
+  Batch insertion
+
+  @param[in]  mt      The Merkle tree
+  @param[in]  leaves  `n` hashes stored back to back (`n * hash_size` bytes). The tree
+                      makes a copy of them; unlike `mt_insert`, the input is not modified.
+  @param[in]  n       The number of hashes to insert
+
+ Note: the resulting tree is the same as after inserting the hashes one at a time with
+ `mt_insert`. Internal nodes are computed one level at a time; for trees built with
+ `mt_create`, up to 8 node pairs are hashed with a single call to the multi-buffer
+ SHA-256 implementation.
+*/
+void mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n);
+
+/**
+  Batch insertion using several threads
+
+  @param[in]  mt      The Merkle tree
+  @param[in]  leaves  As for `mt_insert_batch`
+  @param[in]  n       The number of hashes to insert
+  @param[in]  workers The maximal number of threads hashing a level, including the
+                      calling thread
+
+ Note: same precondition and result as `mt_insert_batch`. The pairs of each level
+ are split into contiguous ranges hashed by different threads (at least 4096 pairs
+ per thread), which are joined before moving to the next level. A custom hash
+ function must therefore be thread-safe. On Windows, this is `mt_insert_batch`.
+*/
+void
+mt_insert_batch_par(
+  MerkleTree_Low_merkle_tree *mt,
+  uint8_t *leaves,
+  uint32_t n,
+  uint32_t workers
+);
+
+/**
+  Precondition predicate for mt_insert_batch
+
+ Note: for a tree stored in a file, this also grows the file as for `mt_insert_pre`;
+ if it returns false, `mt_insert_batch` leaves the tree unchanged.
+*/
+bool mt_insert_batch_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n);
+
 /**
   Getting the Merkle root
 
@@ -232,6 +382,51 @@ mt_get_path_pre(
   uint8_t *root
 );
 
+/**
+  Getting several Merkle paths at once
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  n    The number of paths
+  @param[in]  idx  The indices of the target hashes, n elements
+  @param[out] buf  The resulting paths, stored one after the other, each as the
+                   leaf hash followed by the sibling hashes in the order of
+                   `mt_get_path`
+  @param[in]  len  The size of buf in bytes
+  @param[out] lens The number of hashes of each path, n elements
+  @param[out] root The Merkle root
+
+  return The number of elements in the tree
+
+  Notes:
+  - Unlike `mt_get_path`, the hashes are copied, so buf remains valid after
+    the tree is modified. n * 33 * hash_size bytes always suffice.
+  - The root is computed once for the whole batch.
+*/
+uint32_t
+mt_get_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint8_t *buf,
+  uint64_t len,
+  uint32_t *lens,
+  uint8_t *root
+);
+
+/**
+  Precondition predicate for mt_get_paths
+*/
+bool
+mt_get_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint8_t *buf,
+  uint64_t len,
+  uint32_t *lens,
+  uint8_t *root
+);
+
 /**
   Flush the Merkle tree
 
@@ -306,6 +501,51 @@ mt_verify_pre(
   uint8_t *root
 );
 
+/**
+  Client-side verification of several paths
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  n    The number of paths
+  @param[in]  idx  The indices of the target hashes, n elements
+  @param[in]  max  The maximum index + 1 of the tree when the paths were generated
+  @param[in]  buf  The paths, laid out as by `mt_get_paths`
+  @param[in]  lens The number of hashes of each path, n elements
+  @param[in]  root
+  @param[out] res  The verification result of each path, n elements
+
+  return true if all verifications succeeded, false otherwise
+
+  Note: a path that reaches the same node with the same hash as the previous
+  one, and shares the rest of its hashes, reuses its result instead of hashing
+  up to the root. Sorting idx maximizes this sharing.
+*/
+bool
+mt_verify_batch(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint64_t max,
+  const uint8_t *buf,
+  const uint32_t *lens,
+  uint8_t *root,
+  bool *res
+);
+
+/**
+  Precondition predicate for mt_verify_batch
+*/
+bool
+mt_verify_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint64_t max,
+  const uint8_t *buf,
+  const uint32_t *lens,
+  uint8_t *root,
+  bool *res
+);
+
 /**
   Serialization size
 
@@ -383,6 +623,23 @@ void mt_sha256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst);
 */
 MerkleTree_Low_merkle_tree *mt_create(uint8_t *init);
 
+/**
+  Construction wired to sha256 from EverCrypt, with contiguous storage (see
+  `mt_create_custom_arena`)
+
+  @param[in]  init   The initial hash
+*/
+MerkleTree_Low_merkle_tree *mt_create_arena(uint8_t *init);
+
+/**
+  Construction of a tree stored in a file, wired to sha256 from EverCrypt (see
+  `mt_create_custom_file`)
+
+  @param[in]  path   The file, which is created or truncated
+  @param[in]  init   The initial hash
+*/
+MerkleTree_Low_merkle_tree *mt_create_file(const char *path, uint8_t *init);
+
 typedef uint32_t MerkleTree_Low_index_t;
 
 extern uint32_t MerkleTree_Low_uint32_32_max;
@@ -418,10 +675,29 @@ uint32_t MerkleTree_Low_offset_of(uint32_t i);
 
 void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt);
 
+bool MerkleTree_Low_mt_close_file(MerkleTree_Low_merkle_tree *mt);
+
 bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
 void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
+bool
+MerkleTree_Low_mt_insert_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint8_t *leaves,
+  uint32_t n
+);
+
+void MerkleTree_Low_mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n);
+
+void
+MerkleTree_Low_mt_insert_batch_par(
+  MerkleTree_Low_merkle_tree *mt,
+  uint8_t *leaves,
+  uint32_t n,
+  uint32_t workers
+);
+
 MerkleTree_Low_merkle_tree
 *MerkleTree_Low_mt_create_custom(
   uint32_t hsz,
@@ -429,6 +705,30 @@ MerkleTree_Low_merkle_tree
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 );
 
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom_arena(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom_file(
+  const char *path,
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_open_file(
+  const char *path,
+  uint32_t hsz,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+bool MerkleTree_Low_mt_sync_file(const MerkleTree_Low_merkle_tree *mt);
+
 bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee);
 
 typedef MerkleTree_Low_path *MerkleTree_Low_path_p;
@@ -469,6 +769,28 @@ MerkleTree_Low_mt_get_path(
   uint8_t *root
 );
 
+bool
+MerkleTree_Low_mt_get_paths_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint8_t *buf,
+  uint64_t len,
+  uint32_t *lens,
+  uint8_t *root
+);
+
+uint32_t
+MerkleTree_Low_mt_get_paths(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint8_t *buf,
+  uint64_t len,
+  uint32_t *lens,
+  uint8_t *root
+);
+
 bool MerkleTree_Low_mt_flush_to_pre(const MerkleTree_Low_merkle_tree *mt, uint64_t idx);
 
 void MerkleTree_Low_mt_flush_to(MerkleTree_Low_merkle_tree *mt, uint64_t idx);
@@ -499,6 +821,30 @@ MerkleTree_Low_mt_verify(
   uint8_t *rt
 );
 
+bool
+MerkleTree_Low_mt_verify_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint64_t j,
+  const uint8_t *buf,
+  const uint32_t *lens,
+  uint8_t *rt,
+  bool *res
+);
+
+bool
+MerkleTree_Low_mt_verify_batch(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idx,
+  uint64_t j,
+  const uint8_t *buf,
+  const uint32_t *lens,
+  uint8_t *rt,
+  bool *res
+);
+
 typedef uint8_t MerkleTree_Low_Serialization_uint8_t;
 
 typedef uint16_t MerkleTree_Low_Serialization_uint16_t;
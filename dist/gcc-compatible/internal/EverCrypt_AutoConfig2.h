@@ -0,0 +1,124 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_EverCrypt_AutoConfig2_H
+#define __internal_EverCrypt_AutoConfig2_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "../EverCrypt_AutoConfig2.h"
+#include "Hacl_Spec.h"
+#include "evercrypt_targetconfig.h"
+
+/**
+Implementations of the hot EverCrypt entry points, resolved from the CPU features
+by `EverCrypt_AutoConfig2_init` and again by every `disable_*` call. The EverCrypt
+wrappers call through this table instead of querying the features on each call.
+Before `init`, it holds the implementations that need no CPU detection.
+*/
+typedef struct EverCrypt_AutoConfig2_dispatch_s_s
+{
+  void
+  (*chacha20poly1305_encrypt)(
+    uint8_t *x0,
+    uint8_t *x1,
+    uint32_t x2,
+    uint8_t *x3,
+    uint32_t x4,
+    uint8_t *x5,
+    uint8_t *x6,
+    uint8_t *x7
+  );
+  uint32_t
+  (*chacha20poly1305_decrypt)(
+    uint8_t *x0,
+    uint8_t *x1,
+    uint32_t x2,
+    uint8_t *x3,
+    uint32_t x4,
+    uint8_t *x5,
+    uint8_t *x6,
+    uint8_t *x7
+  );
+  void (*poly1305_mac)(uint8_t *x0, uint32_t x1, uint8_t *x2, uint8_t *x3);
+  void
+  (*chacha20_encrypt)(
+    uint32_t x0,
+    uint8_t *x1,
+    uint8_t *x2,
+    uint8_t *x3,
+    uint8_t *x4,
+    uint32_t x5
+  );
+  void (*curve25519_secret_to_public)(uint8_t *x0, uint8_t *x1);
+  void (*curve25519_scalarmult)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+  bool (*curve25519_ecdh)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+  void (*sha256_update_multi)(uint32_t *x0, uint8_t *x1, uint32_t x2);
+  void (*sha1_update_multi)(uint32_t *x0, uint8_t *x1, uint32_t x2);
+  void (*sha512_update_multi)(uint64_t *x0, uint8_t *x1, uint32_t x2);
+  void (*blake2s_hash)(uint8_t *x0, uint32_t x1, uint8_t *x2);
+  void (*blake2b_hash)(uint8_t *x0, uint32_t x1, uint8_t *x2);
+  void
+  (*sha2_256_lanes_8)(Spec_Hash_Definitions_hash_alg x0, uint8_t **x1, uint32_t x2, uint8_t **x3);
+  void
+  (*sha2_256_lanes_4)(Spec_Hash_Definitions_hash_alg x0, uint8_t **x1, uint32_t x2, uint8_t **x3);
+  void
+  (*sha2_512_lanes_4)(Spec_Hash_Definitions_hash_alg x0, uint8_t **x1, uint32_t x2, uint8_t **x3);
+  void
+  (*chacha20poly1305_encrypt_8)(
+    uint8_t **x0,
+    uint8_t **x1,
+    uint32_t *x2,
+    uint8_t **x3,
+    uint32_t *x4,
+    uint8_t **x5,
+    uint8_t **x6,
+    uint8_t **x7
+  );
+}
+EverCrypt_AutoConfig2_dispatch_s;
+
+/**
+Return the dispatch table currently in use.
+
+  Tables are never modified once published: `init` and the `disable_*` calls build
+  a new table and swap it in atomically, so a caller that loaded a table may keep
+  using it while the configuration changes.
+*/
+const EverCrypt_AutoConfig2_dispatch_s *EverCrypt_AutoConfig2_get_dispatch();
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_EverCrypt_AutoConfig2_H_DEFINED
+#endif
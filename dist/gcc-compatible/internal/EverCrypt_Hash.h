@@ -0,0 +1,74 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_EverCrypt_Hash_H
+#define __internal_EverCrypt_Hash_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "../EverCrypt_Hash.h"
+#include "evercrypt_targetconfig.h"
+
+void EverCrypt_Hash_update_multi_256_shaext(uint32_t *s, uint8_t *blocks, uint32_t n);
+
+void EverCrypt_Hash_update_multi_sha1_shaext(uint32_t *s, uint8_t *blocks, uint32_t n);
+
+void
+EverCrypt_Hash_sha2_256_lanes_8(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t **out,
+  uint32_t len,
+  uint8_t **in
+);
+
+void
+EverCrypt_Hash_sha2_256_lanes_4(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t **out,
+  uint32_t len,
+  uint8_t **in
+);
+
+void
+EverCrypt_Hash_sha2_512_lanes_4(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t **out,
+  uint32_t len,
+  uint8_t **in
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_EverCrypt_Hash_H_DEFINED
+#endif
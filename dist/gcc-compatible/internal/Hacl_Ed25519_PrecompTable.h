@@ -0,0 +1,496 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_Hacl_Ed25519_PrecompTable_H
+#define __internal_Hacl_Ed25519_PrecompTable_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "evercrypt_targetconfig.h"
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w4[320U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1738742601995546U,
+    (uint64_t)1146398526822698U, (uint64_t)2070867633025821U, (uint64_t)562264141797630U,
+    (uint64_t)587772402128613U, (uint64_t)1801439850948184U, (uint64_t)1351079888211148U,
+    (uint64_t)450359962737049U, (uint64_t)900719925474099U, (uint64_t)1801439850948198U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1841354044333475U,
+    (uint64_t)16398895984059U, (uint64_t)755974180946558U, (uint64_t)900171276175154U,
+    (uint64_t)1821297809914039U, (uint64_t)1584731938606606U, (uint64_t)178923850428536U,
+    (uint64_t)228280466683449U, (uint64_t)622454613327500U, (uint64_t)961744189650336U,
+    (uint64_t)2048039769908169U, (uint64_t)611908456202699U, (uint64_t)1838921828590653U,
+    (uint64_t)1373353662182500U, (uint64_t)604786679386674U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)632586093835265U, (uint64_t)343317749454563U,
+    (uint64_t)1142187722401459U, (uint64_t)1246910387029049U, (uint64_t)643809026290422U,
+    (uint64_t)642526368817756U, (uint64_t)897391692666252U, (uint64_t)962214031593056U,
+    (uint64_t)2151263124273695U, (uint64_t)1823994305194280U, (uint64_t)959085406434516U,
+    (uint64_t)823416103927896U, (uint64_t)169856804346800U, (uint64_t)1360991708301104U,
+    (uint64_t)323785187622630U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)291346836595738U, (uint64_t)421537610553791U, (uint64_t)1939901930052822U,
+    (uint64_t)712990200152534U, (uint64_t)744163847642585U, (uint64_t)745845847357552U,
+    (uint64_t)55498538281255U, (uint64_t)233662937943675U, (uint64_t)179502033034301U,
+    (uint64_t)567187168652543U, (uint64_t)188436492456239U, (uint64_t)1791404585917415U,
+    (uint64_t)938732500011168U, (uint64_t)827535094727360U, (uint64_t)1263401179066713U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)2008766715925336U,
+    (uint64_t)1080663717006321U, (uint64_t)546068614240140U, (uint64_t)851266986915171U,
+    (uint64_t)606396996224818U, (uint64_t)172349289591347U, (uint64_t)2014045392908840U,
+    (uint64_t)1326661600583783U, (uint64_t)1194063046802408U, (uint64_t)1301660503301685U,
+    (uint64_t)597601052707053U, (uint64_t)370708851696154U, (uint64_t)1769224146297019U,
+    (uint64_t)2031829141359172U, (uint64_t)1676215595929578U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)370247452852688U, (uint64_t)175926773542019U,
+    (uint64_t)1366829968581946U, (uint64_t)1871474830157891U, (uint64_t)2047038905238931U,
+    (uint64_t)690607081910845U, (uint64_t)85278329204487U, (uint64_t)1170597539714662U,
+    (uint64_t)15605081464942U, (uint64_t)1347423509652566U, (uint64_t)697987907550964U,
+    (uint64_t)231488761894970U, (uint64_t)1475501116163568U, (uint64_t)1214474405336062U,
+    (uint64_t)93313529186413U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1925007367139794U, (uint64_t)720797401577721U, (uint64_t)2145641378528840U,
+    (uint64_t)43711000824999U, (uint64_t)1059031511767718U, (uint64_t)1574616431476999U,
+    (uint64_t)1820233879956234U, (uint64_t)1255659963129895U, (uint64_t)1872970577808549U,
+    (uint64_t)357789706735435U, (uint64_t)1342184246764216U, (uint64_t)245145966977624U,
+    (uint64_t)1366370960941229U, (uint64_t)729817606665326U, (uint64_t)875581666407549U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1483611988028699U,
+    (uint64_t)1481949820256791U, (uint64_t)2065891370619276U, (uint64_t)1985503051571908U,
+    (uint64_t)309956969615717U, (uint64_t)2249308877718728U, (uint64_t)2093526803490672U,
+    (uint64_t)346613787454233U, (uint64_t)240935905963644U, (uint64_t)1816591146253687U,
+    (uint64_t)2071110476085684U, (uint64_t)2124547928253381U, (uint64_t)611114757251315U,
+    (uint64_t)488970596615347U, (uint64_t)595043560496727U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1957245925085631U, (uint64_t)1590484463955447U,
+    (uint64_t)790988240438073U, (uint64_t)1531117259804060U, (uint64_t)779509163810686U,
+    (uint64_t)38510044475740U, (uint64_t)991526491691644U, (uint64_t)1777407289417785U,
+    (uint64_t)196322847846455U, (uint64_t)940961149255687U, (uint64_t)1764185014989248U,
+    (uint64_t)673372631865577U, (uint64_t)1067952015008320U, (uint64_t)1964111621420203U,
+    (uint64_t)2238409115184592U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)906476616086629U, (uint64_t)1159907563785095U, (uint64_t)1441690873155410U,
+    (uint64_t)1685472728012539U, (uint64_t)1626245419673724U, (uint64_t)1441606988724559U,
+    (uint64_t)522297534482578U, (uint64_t)829142841031225U, (uint64_t)1894055753221993U,
+    (uint64_t)1691906130250918U, (uint64_t)128301056686892U, (uint64_t)184426382784337U,
+    (uint64_t)671798326057626U, (uint64_t)628802307140196U, (uint64_t)1750421616435634U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)2054527727158846U,
+    (uint64_t)1854288320309372U, (uint64_t)1919051480946343U, (uint64_t)362032992387460U,
+    (uint64_t)965396763404085U, (uint64_t)2202051752555467U, (uint64_t)1786373445672933U,
+    (uint64_t)497601544586902U, (uint64_t)575986915854059U, (uint64_t)367591404164286U,
+    (uint64_t)2020642157442835U, (uint64_t)993492693845521U, (uint64_t)1121773387604324U,
+    (uint64_t)1631319708561824U, (uint64_t)801578924896794U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1635175039233748U, (uint64_t)1051347747536240U,
+    (uint64_t)99741981736967U, (uint64_t)1215084455223161U, (uint64_t)1599146621927666U,
+    (uint64_t)842666022572077U, (uint64_t)1249836144285132U, (uint64_t)713752375351036U,
+    (uint64_t)1858928010358790U, (uint64_t)1250823726175973U, (uint64_t)705732620969209U,
+    (uint64_t)1840919398377082U, (uint64_t)1654313513984506U, (uint64_t)19188013213489U,
+    (uint64_t)1133651887176936U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1340384370957515U, (uint64_t)160027838347965U, (uint64_t)2027506894666691U,
+    (uint64_t)1214480183317528U, (uint64_t)760058384458885U, (uint64_t)246787608698861U,
+    (uint64_t)1426772414891760U, (uint64_t)198742064041871U, (uint64_t)957045848602644U,
+    (uint64_t)289457140752182U, (uint64_t)2218466207604608U, (uint64_t)1764798922780925U,
+    (uint64_t)961140144014142U, (uint64_t)1612142334710121U, (uint64_t)331756173448504U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1368676840124243U,
+    (uint64_t)630457475500613U, (uint64_t)1504736984191657U, (uint64_t)616151183700198U,
+    (uint64_t)1146242676653030U, (uint64_t)1815653225141689U, (uint64_t)852977021965425U,
+    (uint64_t)891619496917915U, (uint64_t)1503591919338670U, (uint64_t)569494211614852U,
+    (uint64_t)560306562279481U, (uint64_t)1410908648345709U, (uint64_t)1930789639758435U,
+    (uint64_t)1619077536202085U, (uint64_t)1377698118437964U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)911686843351776U, (uint64_t)2248280234529058U,
+    (uint64_t)843952043826445U, (uint64_t)1978877509722014U, (uint64_t)1799019282446983U,
+    (uint64_t)421380963274177U, (uint64_t)1845943409930764U, (uint64_t)1267764746882125U,
+    (uint64_t)592560219454638U, (uint64_t)1391306851926764U, (uint64_t)1491782486351071U,
+    (uint64_t)866635604046477U, (uint64_t)926118541760188U, (uint64_t)416339927466162U,
+    (uint64_t)330676827082738U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1547233456733993U, (uint64_t)559107513688705U, (uint64_t)1645107965693658U,
+    (uint64_t)643032076423456U, (uint64_t)1657234620902263U
+  };
+
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_g_pow2_64_table_w4[320U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)962690963841538U,
+    (uint64_t)2210719638316993U, (uint64_t)706068330177389U, (uint64_t)1384191282407386U,
+    (uint64_t)1726421572252383U, (uint64_t)1964103625364243U, (uint64_t)307116021699043U,
+    (uint64_t)120882883216088U, (uint64_t)20816463754899U, (uint64_t)55369446368493U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1568907369646169U,
+    (uint64_t)514127314339263U, (uint64_t)40774287502072U, (uint64_t)1976251032040224U,
+    (uint64_t)1733588893334842U, (uint64_t)750062550099351U, (uint64_t)905389814129192U,
+    (uint64_t)1832474728075291U, (uint64_t)671076557460882U, (uint64_t)39292419998923U,
+    (uint64_t)1427024613329390U, (uint64_t)533865537592752U, (uint64_t)1627395925992750U,
+    (uint64_t)1559539804543886U, (uint64_t)1357593972022990U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)880344481158042U, (uint64_t)342704282232351U,
+    (uint64_t)1608507383450322U, (uint64_t)1165743019066438U, (uint64_t)772015470246470U,
+    (uint64_t)2080336987436135U, (uint64_t)1365169349005312U, (uint64_t)608611842827050U,
+    (uint64_t)36158478591205U, (uint64_t)337139462944196U, (uint64_t)1682519579156015U,
+    (uint64_t)992033591571212U, (uint64_t)2136622863631043U, (uint64_t)1055784946744770U,
+    (uint64_t)1465577875133231U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)663067569222663U, (uint64_t)1664353198797470U, (uint64_t)1996592184691058U,
+    (uint64_t)794854911865658U, (uint64_t)349550099834080U, (uint64_t)1746006164754793U,
+    (uint64_t)807170041845911U, (uint64_t)504818080674209U, (uint64_t)653986169498075U,
+    (uint64_t)1923073434915707U, (uint64_t)922564647560215U, (uint64_t)1834285324266390U,
+    (uint64_t)809658778732546U, (uint64_t)1095396343524703U, (uint64_t)1490631977509032U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)258215189904496U,
+    (uint64_t)973179234567961U, (uint64_t)626431653205003U, (uint64_t)2026461387046677U,
+    (uint64_t)1698832137260671U, (uint64_t)636189799662285U, (uint64_t)553274489235982U,
+    (uint64_t)818218072473796U, (uint64_t)1295498167233850U, (uint64_t)949947844112518U,
+    (uint64_t)1298225383246730U, (uint64_t)840010594329080U, (uint64_t)1949991072984412U,
+    (uint64_t)2113992381445289U, (uint64_t)1422891636166997U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)714354197586903U, (uint64_t)186418713424139U,
+    (uint64_t)1933795552915693U, (uint64_t)1311495388229315U, (uint64_t)898028939320082U,
+    (uint64_t)582785759576595U, (uint64_t)1287040380708190U, (uint64_t)576846672448241U,
+    (uint64_t)342728311538637U, (uint64_t)1906786635871419U, (uint64_t)362419349407618U,
+    (uint64_t)1491036995936353U, (uint64_t)747333841285324U, (uint64_t)1324241916330027U,
+    (uint64_t)498560787103002U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)583138641118288U, (uint64_t)1841034295507326U, (uint64_t)1366820874379552U,
+    (uint64_t)374383513919230U, (uint64_t)1011507135570483U, (uint64_t)1209906713102289U,
+    (uint64_t)854424623900530U, (uint64_t)549386666801044U, (uint64_t)728272237273311U,
+    (uint64_t)1842238347850525U, (uint64_t)251650408810534U, (uint64_t)746249419417829U,
+    (uint64_t)1607748233598553U, (uint64_t)942369364667305U, (uint64_t)537327049638006U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)2134193351514946U,
+    (uint64_t)933120727916180U, (uint64_t)1237484076999615U, (uint64_t)367828594017028U,
+    (uint64_t)2083732765653646U, (uint64_t)1100329912591017U, (uint64_t)709969737533774U,
+    (uint64_t)694525392496962U, (uint64_t)1872580031920945U, (uint64_t)1889379092825858U,
+    (uint64_t)1717586560194245U, (uint64_t)110277684947965U, (uint64_t)299938625457186U,
+    (uint64_t)706377393450668U, (uint64_t)455012038971133U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)3671790517699U, (uint64_t)1914154710889578U,
+    (uint64_t)616973847032431U, (uint64_t)253605095755784U, (uint64_t)1803180493901251U,
+    (uint64_t)88181225362842U, (uint64_t)1634096779268916U, (uint64_t)902444887474292U,
+    (uint64_t)935143232038767U, (uint64_t)514256233151143U, (uint64_t)2247338269593785U,
+    (uint64_t)2186268231444711U, (uint64_t)1041756159001657U, (uint64_t)705770631928807U,
+    (uint64_t)1844375046825443U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)973893865129843U, (uint64_t)1618423896248102U, (uint64_t)510627087648079U,
+    (uint64_t)2169406896289481U, (uint64_t)80402666560628U, (uint64_t)811946549191681U,
+    (uint64_t)616392860511554U, (uint64_t)1084653407351495U, (uint64_t)1828151313598203U,
+    (uint64_t)458643308367824U, (uint64_t)1834774909570857U, (uint64_t)631194256309926U,
+    (uint64_t)1502173792264883U, (uint64_t)2103870183893682U, (uint64_t)510696412607863U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1467649978050013U,
+    (uint64_t)1327440340416106U, (uint64_t)1540308976468341U, (uint64_t)433887262248877U,
+    (uint64_t)1463833496092194U, (uint64_t)1816053796308599U, (uint64_t)756587150073223U,
+    (uint64_t)201308216302906U, (uint64_t)248724885317576U, (uint64_t)422196529081340U,
+    (uint64_t)1501864166594677U, (uint64_t)912077041198365U, (uint64_t)1698535929535691U,
+    (uint64_t)1447286559355252U, (uint64_t)1859858219227887U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1343181575308059U, (uint64_t)2047627641753541U,
+    (uint64_t)1993094065314045U, (uint64_t)200267397308487U, (uint64_t)1534791649316998U,
+    (uint64_t)1522417547067981U, (uint64_t)2001559994554489U, (uint64_t)1003016549188645U,
+    (uint64_t)580609768238153U, (uint64_t)1952876998288777U, (uint64_t)1028406596130336U,
+    (uint64_t)1723212929524766U, (uint64_t)1637809548017440U, (uint64_t)2224394516047625U,
+    (uint64_t)1773015600679180U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1177597302435784U, (uint64_t)1652294795902303U, (uint64_t)319331146115744U,
+    (uint64_t)1664574714282430U, (uint64_t)220882471936396U, (uint64_t)1327252430675141U,
+    (uint64_t)2077999692770332U, (uint64_t)503167428705098U, (uint64_t)306453394162443U,
+    (uint64_t)1307469781154142U, (uint64_t)1084387826635901U, (uint64_t)326639588602768U,
+    (uint64_t)432551090847893U, (uint64_t)1876475539231966U, (uint64_t)1873834400232463U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)657744389842004U,
+    (uint64_t)1026553797670827U, (uint64_t)1698756877747385U, (uint64_t)925661005533673U,
+    (uint64_t)999086550511116U, (uint64_t)155888872055302U, (uint64_t)1163576141982093U,
+    (uint64_t)1831686604995188U, (uint64_t)84180038373726U, (uint64_t)2206050216157223U,
+    (uint64_t)946741829835497U, (uint64_t)1038751298737683U, (uint64_t)12698813071019U,
+    (uint64_t)1635040536400569U, (uint64_t)816388617704834U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)208039053839421U, (uint64_t)866553403471982U,
+    (uint64_t)549286264319720U, (uint64_t)659531533114713U, (uint64_t)1153697176529543U,
+    (uint64_t)1720170799659477U, (uint64_t)1336730464713739U, (uint64_t)486367764837328U,
+    (uint64_t)1884139821746119U, (uint64_t)754375817847764U, (uint64_t)976253579399988U,
+    (uint64_t)1590594229125818U, (uint64_t)2109208163626889U, (uint64_t)2080229750821840U,
+    (uint64_t)1966252622418661U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1360903338444467U, (uint64_t)788241441370683U, (uint64_t)408486858651660U,
+    (uint64_t)1114001646262046U, (uint64_t)1094038853501886U
+  };
+
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_g_pow2_128_table_w4[320U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)78814272546852U,
+    (uint64_t)343446598238096U, (uint64_t)1469662686845463U, (uint64_t)446722075312752U,
+    (uint64_t)1339733442806879U, (uint64_t)770831939905131U, (uint64_t)1066752177064823U,
+    (uint64_t)855905013023480U, (uint64_t)1194941381303059U, (uint64_t)1674322643330780U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)2025065385374602U,
+    (uint64_t)84441031851324U, (uint64_t)1769310306558354U, (uint64_t)26295680040963U,
+    (uint64_t)99051874860870U, (uint64_t)2200896702570629U, (uint64_t)1778975257739165U,
+    (uint64_t)551660964959409U, (uint64_t)1543509251980232U, (uint64_t)2118476251741949U,
+    (uint64_t)852202146899766U, (uint64_t)2206117152672213U, (uint64_t)1112847982129186U,
+    (uint64_t)1176039682696938U, (uint64_t)1780822146478921U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1381087295005896U, (uint64_t)750929258070040U,
+    (uint64_t)2057614449644473U, (uint64_t)2046770023714093U, (uint64_t)330351389233939U,
+    (uint64_t)1630068695877575U, (uint64_t)440813350381092U, (uint64_t)1710575662568171U,
+    (uint64_t)719430621156037U, (uint64_t)171628688016185U, (uint64_t)1295454469555759U,
+    (uint64_t)1539155922133830U, (uint64_t)1716511463612585U, (uint64_t)468158469822628U,
+    (uint64_t)1710268984197755U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1515406440199010U, (uint64_t)139024159502691U, (uint64_t)1742187863449837U,
+    (uint64_t)1905964486375153U, (uint64_t)1533576276865635U, (uint64_t)38415465622035U,
+    (uint64_t)1545267546844567U, (uint64_t)2009316481209153U, (uint64_t)1295154982666413U,
+    (uint64_t)598058224359050U, (uint64_t)232998495590144U, (uint64_t)2059584328312332U,
+    (uint64_t)587194623759577U, (uint64_t)719770855854248U, (uint64_t)1408162808754891U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)181990140903928U,
+    (uint64_t)805121466178480U, (uint64_t)2148800855087556U, (uint64_t)2243228251453314U,
+    (uint64_t)448981107261832U, (uint64_t)531762873454359U, (uint64_t)1322607583078691U,
+    (uint64_t)606001157276723U, (uint64_t)71863559527214U, (uint64_t)1304991342980686U,
+    (uint64_t)1328427689078724U, (uint64_t)613968608266394U, (uint64_t)2106898949114489U,
+    (uint64_t)1739179537515615U, (uint64_t)1904295220011397U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)196620590872184U, (uint64_t)1890835981937238U,
+    (uint64_t)880198376593034U, (uint64_t)335184846551184U, (uint64_t)806954239719645U,
+    (uint64_t)356923608937572U, (uint64_t)1492727272576488U, (uint64_t)691115352691907U,
+    (uint64_t)1023874985287363U, (uint64_t)1649077382367565U, (uint64_t)1374145659165559U,
+    (uint64_t)1494714988724847U, (uint64_t)673635128642360U, (uint64_t)1645157668380756U,
+    (uint64_t)1529830700445343U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1236100952565097U, (uint64_t)106748886601330U, (uint64_t)1936779023152398U,
+    (uint64_t)1700472076325224U, (uint64_t)1552851117256747U, (uint64_t)205456050837125U,
+    (uint64_t)949586864779886U, (uint64_t)1649764296177668U, (uint64_t)528285161930492U,
+    (uint64_t)1323194065901405U, (uint64_t)43623220099104U, (uint64_t)551927395010820U,
+    (uint64_t)1549945241712428U, (uint64_t)416266640506994U, (uint64_t)1481264511766323U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)688132078253544U,
+    (uint64_t)1416208332982185U, (uint64_t)19126511976590U, (uint64_t)261980744908224U,
+    (uint64_t)512161125392632U, (uint64_t)1991688294151135U, (uint64_t)1581353989162262U,
+    (uint64_t)653264040059574U, (uint64_t)1606877469999919U, (uint64_t)2110962028286127U,
+    (uint64_t)1624733077799494U, (uint64_t)2182834059431342U, (uint64_t)1273467543139111U,
+    (uint64_t)434605056432586U, (uint64_t)1061238907732895U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1520101053607212U, (uint64_t)2061240723627973U,
+    (uint64_t)2035940678394739U, (uint64_t)1143228262330879U, (uint64_t)662096467948128U,
+    (uint64_t)946189418483232U, (uint64_t)1393700767619455U, (uint64_t)1087991203764221U,
+    (uint64_t)453889495239569U, (uint64_t)1090103925519925U, (uint64_t)2008159909182104U,
+    (uint64_t)1481720769662840U, (uint64_t)89915843785386U, (uint64_t)1861355261384754U,
+    (uint64_t)2213284550451717U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)223808219834805U, (uint64_t)530590348630090U, (uint64_t)1697062999991366U,
+    (uint64_t)271921405305534U, (uint64_t)1244964452283838U, (uint64_t)226350272558768U,
+    (uint64_t)587874613265559U, (uint64_t)529910196286250U, (uint64_t)1957091409005817U,
+    (uint64_t)157810633259998U, (uint64_t)755358728767620U, (uint64_t)1640955369186927U,
+    (uint64_t)665342547888320U, (uint64_t)4243714785384U, (uint64_t)316111952531743U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)423759913967798U,
+    (uint64_t)1372241992442252U, (uint64_t)1713032016257424U, (uint64_t)1078985176503605U,
+    (uint64_t)853921038684763U, (uint64_t)820015448408844U, (uint64_t)1346736817259053U,
+    (uint64_t)2063351990877964U, (uint64_t)1846172098565691U, (uint64_t)1353553428639897U,
+    (uint64_t)1415921454257973U, (uint64_t)498084842083863U, (uint64_t)2192592169265769U,
+    (uint64_t)859556004585508U, (uint64_t)6456644550244U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1842500197063880U, (uint64_t)1926836262491848U,
+    (uint64_t)69821039733391U, (uint64_t)1972163814761614U, (uint64_t)666351876324226U,
+    (uint64_t)104792115951275U, (uint64_t)969377082377580U, (uint64_t)1530750415562896U,
+    (uint64_t)1722959384007431U, (uint64_t)1492481688100623U, (uint64_t)704166599706137U,
+    (uint64_t)1818383096991697U, (uint64_t)1282003955484900U, (uint64_t)1386235779263576U,
+    (uint64_t)1681740111464793U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1254842274398738U, (uint64_t)1753120543927915U, (uint64_t)1534173473945749U,
+    (uint64_t)666565412293801U, (uint64_t)715681141929604U, (uint64_t)355703954184595U,
+    (uint64_t)2162316746190768U, (uint64_t)661488273357412U, (uint64_t)7312136493426U,
+    (uint64_t)1003034927792667U, (uint64_t)1120178472542042U, (uint64_t)761678323401337U,
+    (uint64_t)1933628387230625U, (uint64_t)2127261736121483U, (uint64_t)1854947820686646U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)85930479693419U,
+    (uint64_t)925426916702088U, (uint64_t)644650604638989U, (uint64_t)219168208678887U,
+    (uint64_t)2229038307250551U, (uint64_t)1832760417087728U, (uint64_t)1130601206280492U,
+    (uint64_t)110391288458991U, (uint64_t)1131645929017789U, (uint64_t)355307354772276U,
+    (uint64_t)791437258464467U, (uint64_t)1030244689139211U, (uint64_t)881500128537834U,
+    (uint64_t)1574190294833214U, (uint64_t)1951831665912193U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1990178132236474U, (uint64_t)569889031053348U,
+    (uint64_t)932253718728352U, (uint64_t)24855880648378U, (uint64_t)1310289222901605U,
+    (uint64_t)2201218842646500U, (uint64_t)1503512883804063U, (uint64_t)1886236374291432U,
+    (uint64_t)1135326282101462U, (uint64_t)733426638292073U, (uint64_t)106184685506076U,
+    (uint64_t)1633061197691119U, (uint64_t)1808188486730421U, (uint64_t)815592288899816U,
+    (uint64_t)1014271316180362U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)662959418878283U, (uint64_t)2066579411355244U, (uint64_t)90972935620312U,
+    (uint64_t)374636048748753U, (uint64_t)1201144184109347U
+  };
+
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_g_pow2_192_table_w4[320U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)798540852548237U,
+    (uint64_t)1186388878089071U, (uint64_t)554557418141563U, (uint64_t)2038592377592718U,
+    (uint64_t)488711206961541U, (uint64_t)833812069173299U, (uint64_t)646939731425630U,
+    (uint64_t)1538221673810424U, (uint64_t)2137163637965756U, (uint64_t)1721356815521377U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)76009751102151U,
+    (uint64_t)1911895294413367U, (uint64_t)1262509771121608U, (uint64_t)1445197895593765U,
+    (uint64_t)460973337299855U, (uint64_t)443661934560084U, (uint64_t)1894575924445427U,
+    (uint64_t)1937955409881637U, (uint64_t)1325912576142645U, (uint64_t)118533117676581U,
+    (uint64_t)1290077324165221U, (uint64_t)388939606299359U, (uint64_t)515814349022470U,
+    (uint64_t)1917980282099592U, (uint64_t)1075775655497974U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)956487316359959U, (uint64_t)26685384219625U,
+    (uint64_t)237016502235760U, (uint64_t)2119940177086914U, (uint64_t)2157199502501178U,
+    (uint64_t)1558025612125743U, (uint64_t)517851418841047U, (uint64_t)562893316867004U,
+    (uint64_t)835294334903521U, (uint64_t)2082857420518468U, (uint64_t)1020408185769121U,
+    (uint64_t)1995707900915216U, (uint64_t)1137789006809188U, (uint64_t)742612931445543U,
+    (uint64_t)1386590056549796U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1481333044679611U, (uint64_t)374074217106694U, (uint64_t)957428778764107U,
+    (uint64_t)1942211155513793U, (uint64_t)1895132592002267U, (uint64_t)1571538936976631U,
+    (uint64_t)2192724453354419U, (uint64_t)1851134185886067U, (uint64_t)1500301240170909U,
+    (uint64_t)176588501768708U, (uint64_t)821402351360294U, (uint64_t)1295804105236084U,
+    (uint64_t)1043767047699067U, (uint64_t)146313890338263U, (uint64_t)1031651100523057U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1039916457050195U,
+    (uint64_t)350081801805764U, (uint64_t)2243099296045669U, (uint64_t)1878323680526871U,
+    (uint64_t)1052636275754568U, (uint64_t)1360392522789726U, (uint64_t)658941661155891U,
+    (uint64_t)1505395032884619U, (uint64_t)1888138026472543U, (uint64_t)500401865898214U,
+    (uint64_t)280243023906507U, (uint64_t)2226027105721469U, (uint64_t)707256011207776U,
+    (uint64_t)394252745796557U, (uint64_t)2119913208676411U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)860569650868908U, (uint64_t)8502084906757U,
+    (uint64_t)297871363771991U, (uint64_t)214601530810670U, (uint64_t)2128863429084741U,
+    (uint64_t)1018695187679446U, (uint64_t)155652392890979U, (uint64_t)1982692535581157U,
+    (uint64_t)2180077035027530U, (uint64_t)1062161120763378U, (uint64_t)2140228277824104U,
+    (uint64_t)1176903729913166U, (uint64_t)2093162531528578U, (uint64_t)1439336996100676U,
+    (uint64_t)920397215209793U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)66437208552541U, (uint64_t)1979198590034609U, (uint64_t)1705129324147880U,
+    (uint64_t)415583024574164U, (uint64_t)125826802855511U, (uint64_t)831333865500064U,
+    (uint64_t)1359851547756065U, (uint64_t)1613944639217649U, (uint64_t)1745062335377072U,
+    (uint64_t)151418216513547U, (uint64_t)25225392352136U, (uint64_t)1400465930878193U,
+    (uint64_t)2016048942362514U, (uint64_t)2230196605255304U, (uint64_t)1810857540100973U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1258078828195112U,
+    (uint64_t)1464888625034740U, (uint64_t)2128002169628724U, (uint64_t)560354593178765U,
+    (uint64_t)231745797820769U, (uint64_t)1885486283792347U, (uint64_t)1601854480467395U,
+    (uint64_t)525848762239512U, (uint64_t)1882897512047011U, (uint64_t)134045219817751U,
+    (uint64_t)343167967135639U, (uint64_t)2133536696633120U, (uint64_t)842812531671443U,
+    (uint64_t)1445413586815528U, (uint64_t)392605462241856U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)485688654515754U, (uint64_t)1250626230204552U,
+    (uint64_t)2005645024708497U, (uint64_t)172169769541416U, (uint64_t)433400176007179U,
+    (uint64_t)1490551587715791U, (uint64_t)1377788733536185U, (uint64_t)2029587488179997U,
+    (uint64_t)106744591126762U, (uint64_t)356539253851600U, (uint64_t)563299406346172U,
+    (uint64_t)378210475880925U, (uint64_t)812909109817126U, (uint64_t)1872053597667535U,
+    (uint64_t)751201979508460U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1247039053556907U, (uint64_t)1608138754043450U, (uint64_t)1186524310484315U,
+    (uint64_t)379612960303674U, (uint64_t)974781970407444U, (uint64_t)148951582758840U,
+    (uint64_t)136014138195698U, (uint64_t)1972669289383143U, (uint64_t)297077894694490U,
+    (uint64_t)2166289125513737U, (uint64_t)567398623176048U, (uint64_t)1017018452208066U,
+    (uint64_t)824352367265707U, (uint64_t)846116458240507U, (uint64_t)2105013853544892U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)663117507915057U,
+    (uint64_t)1985423483637565U, (uint64_t)1425836974787373U, (uint64_t)280140962316765U,
+    (uint64_t)1820793124531973U, (uint64_t)349838965939548U, (uint64_t)151208563580645U,
+    (uint64_t)449193894379557U, (uint64_t)176035635593492U, (uint64_t)1276074509211751U,
+    (uint64_t)63299818898448U, (uint64_t)22137327847102U, (uint64_t)1423906297243005U,
+    (uint64_t)723717092025437U, (uint64_t)2178356139224580U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)259621342171378U, (uint64_t)1277144693945352U,
+    (uint64_t)1344568090986353U, (uint64_t)1841809944624255U, (uint64_t)1691612515075979U,
+    (uint64_t)915048254002969U, (uint64_t)845916063616062U, (uint64_t)1426433360253835U,
+    (uint64_t)1115116876349233U, (uint64_t)626101498272875U, (uint64_t)1927118226734558U,
+    (uint64_t)2101451220057147U, (uint64_t)1279923233165479U, (uint64_t)1855989766234027U,
+    (uint64_t)1818133395276302U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2017268355365227U, (uint64_t)1957946339004123U, (uint64_t)1396060779617344U,
+    (uint64_t)1272943759864724U, (uint64_t)1149893031351602U, (uint64_t)1785279071635192U,
+    (uint64_t)957295500603725U, (uint64_t)737441678096375U, (uint64_t)482422031589587U,
+    (uint64_t)609095149661794U, (uint64_t)1109887796610480U, (uint64_t)2196299366773256U,
+    (uint64_t)2146357735552840U, (uint64_t)1394765106324960U, (uint64_t)514909795075558U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1680630487302091U,
+    (uint64_t)2158559321355981U, (uint64_t)907838887762910U, (uint64_t)715313349834618U,
+    (uint64_t)2087205571154155U, (uint64_t)224413245936580U, (uint64_t)907329692154231U,
+    (uint64_t)540197870849068U, (uint64_t)1291730831480449U, (uint64_t)1345575648711258U,
+    (uint64_t)436323897202497U, (uint64_t)728501067011325U, (uint64_t)255449187746405U,
+    (uint64_t)825318571783851U, (uint64_t)1347277828154315U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)940677308757211U, (uint64_t)1882794297891973U,
+    (uint64_t)276652467777423U, (uint64_t)1620226664113351U, (uint64_t)2231058131382488U,
+    (uint64_t)242063820025770U, (uint64_t)1619801971170733U, (uint64_t)1196433158169029U,
+    (uint64_t)249406142476850U, (uint64_t)744066923520503U, (uint64_t)1535497370196634U,
+    (uint64_t)2137784098775192U, (uint64_t)1671663664760321U, (uint64_t)1719340840443112U,
+    (uint64_t)345566727460071U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)64817452910475U, (uint64_t)583981474200066U, (uint64_t)1400353909833831U,
+    (uint64_t)1931389829102337U, (uint64_t)1512281476092811U
+  };
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_Ed25519_PrecompTable_H_DEFINED
+#endif
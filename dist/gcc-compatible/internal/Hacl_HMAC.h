@@ -38,6 +38,7 @@ extern "C" {
 #include "internal/Hacl_Hash_SHA2.h"
 #include "internal/Hacl_Hash_SHA1.h"
 #include "internal/Hacl_Hash_Blake2.h"
+#include "Lib_Memzero0.h"
 #include "../Hacl_HMAC.h"
 #include "evercrypt_targetconfig.h"
 typedef struct K____uint32_t__uint64_t_s
@@ -41,6 +41,8 @@ void Hacl_Hash_Core_SHA1_legacy_init(uint32_t *s);
 
 void Hacl_Hash_Core_SHA1_legacy_update(uint32_t *h, uint8_t *l);
 
+void Hacl_Hash_Core_SHA1_legacy_pad(uint64_t len, uint8_t *dst);
+
 void Hacl_Hash_Core_SHA1_legacy_finish(uint32_t *s, uint8_t *dst);
 
 #if defined(__cplusplus)
@@ -0,0 +1,720 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_Hacl_K256_PrecompTable_H
+#define __internal_Hacl_K256_PrecompTable_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+
+#include "evercrypt_targetconfig.h"
+static const
+uint64_t
+Hacl_K256_PrecompTable_precomp_basepoint_table_w4[240U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)705178180786072U, (uint64_t)3855836460717471U, (uint64_t)4089131105950716U,
+    (uint64_t)3301581525494108U, (uint64_t)133858670344668U, (uint64_t)2199641648059576U,
+    (uint64_t)1278080618437060U, (uint64_t)3959378566518708U, (uint64_t)3455034269351872U,
+    (uint64_t)79417610544803U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3388391445012197U, (uint64_t)1329098899749562U, (uint64_t)1619017321969550U,
+    (uint64_t)2206526636033769U, (uint64_t)217722622591469U, (uint64_t)1180503181878570U,
+    (uint64_t)1780274363765302U, (uint64_t)1808606147638834U, (uint64_t)3434437250924948U,
+    (uint64_t)29555431482941U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)546542052194041U, (uint64_t)1222893046007904U, (uint64_t)2424776026304968U,
+    (uint64_t)3431595440928863U, (uint64_t)273986869105240U, (uint64_t)2811955970106994U,
+    (uint64_t)2695229990876875U, (uint64_t)2876268033147049U, (uint64_t)4082765816626786U,
+    (uint64_t)62188896084781U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2978215832636691U, (uint64_t)2534297115838287U, (uint64_t)856605537889299U,
+    (uint64_t)2268522300608585U, (uint64_t)251323701379341U, (uint64_t)2669460812175650U,
+    (uint64_t)910377909226750U, (uint64_t)4122156214085550U, (uint64_t)1507934633599128U,
+    (uint64_t)90080920117460U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2486449752567780U, (uint64_t)3340067647749306U, (uint64_t)2916253415541636U,
+    (uint64_t)573074722943568U, (uint64_t)52277776554503U, (uint64_t)2389490671575766U,
+    (uint64_t)486743652699594U, (uint64_t)1910694164793383U, (uint64_t)4008189338754522U,
+    (uint64_t)238233818904293U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1541602814817622U, (uint64_t)836000521171696U, (uint64_t)1497766018872903U,
+    (uint64_t)4198218935279939U, (uint64_t)281446989526366U, (uint64_t)1983753865261719U,
+    (uint64_t)4333282670543816U, (uint64_t)4298838686728432U, (uint64_t)3204042312998935U,
+    (uint64_t)191394337172731U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3340238122711484U, (uint64_t)2216834723597970U, (uint64_t)820759899226523U,
+    (uint64_t)3182717760910943U, (uint64_t)101970851688029U, (uint64_t)2293753195947226U,
+    (uint64_t)3238336059365968U, (uint64_t)1717801625064400U, (uint64_t)1572345407395544U,
+    (uint64_t)117560943098405U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2338609173244417U, (uint64_t)103744809772663U, (uint64_t)1987075998620637U,
+    (uint64_t)934425956729851U, (uint64_t)51685198224586U, (uint64_t)2863916082129156U,
+    (uint64_t)3777534187633501U, (uint64_t)893987590431251U, (uint64_t)2696632056447649U,
+    (uint64_t)101488611770707U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4240876413373630U, (uint64_t)2661666369129525U, (uint64_t)4316247749597078U,
+    (uint64_t)4333384080914601U, (uint64_t)190028762509511U, (uint64_t)3419664878115895U,
+    (uint64_t)2888923732832348U, (uint64_t)1754141578614920U, (uint64_t)3834917301557015U,
+    (uint64_t)224521716084903U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1845162106046407U, (uint64_t)2728525013153066U, (uint64_t)3068386329510612U,
+    (uint64_t)3525186019641265U, (uint64_t)176210925471731U, (uint64_t)4192691297675479U,
+    (uint64_t)824116078023627U, (uint64_t)1022874000259404U, (uint64_t)3310054982581865U,
+    (uint64_t)150885326017561U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3403578469255371U, (uint64_t)209302741130174U, (uint64_t)218092740692376U,
+    (uint64_t)1145579166123703U, (uint64_t)131163603097769U, (uint64_t)3787584712197659U,
+    (uint64_t)3991225554862849U, (uint64_t)2172305962118577U, (uint64_t)1655384083125613U,
+    (uint64_t)239163646602091U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)268763764090970U, (uint64_t)1153808614145115U, (uint64_t)3785920044629236U,
+    (uint64_t)1514789267894276U, (uint64_t)228771799320807U, (uint64_t)1437147395924775U,
+    (uint64_t)1651030640371376U, (uint64_t)417642980123532U, (uint64_t)3955469649728382U,
+    (uint64_t)186862484178965U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3904980394203816U, (uint64_t)3489922477252078U, (uint64_t)972545175090683U,
+    (uint64_t)713293087711324U, (uint64_t)266663576656245U, (uint64_t)1630931605777793U,
+    (uint64_t)3840740053611163U, (uint64_t)1633527581514246U, (uint64_t)185367972097718U,
+    (uint64_t)11753449491848U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3135920457393124U, (uint64_t)1748741377650249U, (uint64_t)2202932517186171U,
+    (uint64_t)1998705281361904U, (uint64_t)80951000336734U, (uint64_t)4293403988803419U,
+    (uint64_t)3421284937223269U, (uint64_t)2168049633739385U, (uint64_t)2345365928169034U,
+    (uint64_t)222938712552782U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3866951835060238U, (uint64_t)1956891781096522U, (uint64_t)2638776655537556U,
+    (uint64_t)4126903688867376U, (uint64_t)237023362252099U, (uint64_t)1368479502592856U,
+    (uint64_t)771347894131792U, (uint64_t)2476572362293423U, (uint64_t)2016951945849890U,
+    (uint64_t)96886550866028U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U
+  };
+
+static const
+uint64_t
+Hacl_K256_PrecompTable_precomp_g_pow2_64_table_w4[240U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2217608700028605U, (uint64_t)1756680109240635U, (uint64_t)85138263733457U,
+    (uint64_t)1374768198666177U, (uint64_t)56224678749244U, (uint64_t)1023548355818144U,
+    (uint64_t)1101884390597199U, (uint64_t)3899940751803894U, (uint64_t)1389078239091652U,
+    (uint64_t)95550264830310U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2653339538809954U, (uint64_t)3534576571031494U, (uint64_t)1345857346424029U,
+    (uint64_t)3336885198860720U, (uint64_t)155194885296334U, (uint64_t)185512776582924U,
+    (uint64_t)1380052326657422U, (uint64_t)1106343748258555U, (uint64_t)4296329638900444U,
+    (uint64_t)259404141457755U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2766311219967129U, (uint64_t)2751971240118973U, (uint64_t)1828495286801193U,
+    (uint64_t)100767752612668U, (uint64_t)132743211188572U, (uint64_t)3697764959557629U,
+    (uint64_t)4196634642192001U, (uint64_t)3802146349867822U, (uint64_t)3389772817518094U,
+    (uint64_t)190541339548422U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1236117711414835U, (uint64_t)229191698659606U, (uint64_t)1570996956877971U,
+    (uint64_t)3354184305248799U, (uint64_t)20034956455598U, (uint64_t)3860560470571013U,
+    (uint64_t)805698286026844U, (uint64_t)496825023415845U, (uint64_t)340425224724013U,
+    (uint64_t)152409870285607U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1092283147922662U, (uint64_t)967036080268361U, (uint64_t)2579089645072539U,
+    (uint64_t)4008046849706372U, (uint64_t)122530888261962U, (uint64_t)3357035391538654U,
+    (uint64_t)1807484043845704U, (uint64_t)2174418737771157U, (uint64_t)2171771576749876U,
+    (uint64_t)133172074419202U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1745133893407609U, (uint64_t)991239995055152U, (uint64_t)2995972207392660U,
+    (uint64_t)343230032150968U, (uint64_t)26115327749085U, (uint64_t)3061391234223397U,
+    (uint64_t)2078513902444412U, (uint64_t)4254024707168684U, (uint64_t)2821683853468794U,
+    (uint64_t)238601505089597U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4191262641888064U, (uint64_t)1608716879429064U, (uint64_t)285653250927944U,
+    (uint64_t)2886628202028825U, (uint64_t)247775014067562U, (uint64_t)1731038645556134U,
+    (uint64_t)2053626425630237U, (uint64_t)2867284995880506U, (uint64_t)3740602897831082U,
+    (uint64_t)133261596764801U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)23443954104934U, (uint64_t)706646340886939U, (uint64_t)2931374131371223U,
+    (uint64_t)2745886328137560U, (uint64_t)43007034749131U, (uint64_t)3784900741994279U,
+    (uint64_t)3998960970950568U, (uint64_t)2722972756516965U, (uint64_t)4302519014328724U,
+    (uint64_t)102506446730471U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3934225640197182U, (uint64_t)66594014113665U, (uint64_t)3735145587674767U,
+    (uint64_t)1853107501149491U, (uint64_t)205655996040256U, (uint64_t)2982069103057461U,
+    (uint64_t)1382111291418521U, (uint64_t)3010120631871236U, (uint64_t)2803988018952727U,
+    (uint64_t)70814956802991U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4090014286291895U, (uint64_t)4201791297359265U, (uint64_t)2308434975192656U,
+    (uint64_t)2716915788188342U, (uint64_t)189299804545433U, (uint64_t)3397812377952422U,
+    (uint64_t)3361400984762925U, (uint64_t)349226800296144U, (uint64_t)2010808287469791U,
+    (uint64_t)130310423777729U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2071050508382950U, (uint64_t)1437422037401102U, (uint64_t)2069692122817461U,
+    (uint64_t)2121961715653600U, (uint64_t)242280201273749U, (uint64_t)2211643837290937U,
+    (uint64_t)2541445055313934U, (uint64_t)491865093698286U, (uint64_t)1823500791340576U,
+    (uint64_t)82410366975903U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1055637633863086U, (uint64_t)4382641099543929U, (uint64_t)3573573560840869U,
+    (uint64_t)2585620353539833U, (uint64_t)149701555020305U, (uint64_t)681762675914713U,
+    (uint64_t)1931229847461812U, (uint64_t)1596446537351303U, (uint64_t)2087577474085806U,
+    (uint64_t)236506087379057U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1226695361488843U, (uint64_t)663360215669229U, (uint64_t)282912073254466U,
+    (uint64_t)1048778991028823U, (uint64_t)23562617371015U, (uint64_t)1005781166393911U,
+    (uint64_t)2487006242068181U, (uint64_t)988786977969877U, (uint64_t)2541910150705830U,
+    (uint64_t)118474753937201U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3287306170082319U, (uint64_t)3289338950998261U, (uint64_t)2217583796615364U,
+    (uint64_t)2027010233600281U, (uint64_t)23880975344941U, (uint64_t)4396916450717770U,
+    (uint64_t)3014593038471906U, (uint64_t)2152429734003559U, (uint64_t)2481063756397772U,
+    (uint64_t)132409312710398U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3310203329598410U, (uint64_t)1893297215065535U, (uint64_t)2505881812527458U,
+    (uint64_t)1187638931843618U, (uint64_t)73021906668392U, (uint64_t)1564558702990183U,
+    (uint64_t)2919883495587241U, (uint64_t)1180480518830400U, (uint64_t)399613362490012U,
+    (uint64_t)260769410876096U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U
+  };
+
+static const
+uint64_t
+Hacl_K256_PrecompTable_precomp_g_pow2_128_table_w4[240U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3171320615715034U, (uint64_t)2118913159811511U, (uint64_t)2285979950419030U,
+    (uint64_t)1674801619671769U, (uint64_t)157679956981307U, (uint64_t)3588227476750210U,
+    (uint64_t)4478676213161763U, (uint64_t)1897900376058412U, (uint64_t)1012022638087211U,
+    (uint64_t)112333245233670U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1264405303160950U, (uint64_t)3059348824321640U, (uint64_t)4461471800531032U,
+    (uint64_t)2275507143884407U, (uint64_t)84978863798350U, (uint64_t)200532084553758U,
+    (uint64_t)466052496778937U, (uint64_t)1579615695802157U, (uint64_t)3680471061831939U,
+    (uint64_t)225618865791245U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)766281527069178U, (uint64_t)3154625918919054U, (uint64_t)638949550556252U,
+    (uint64_t)2799531533219391U, (uint64_t)61813668326992U, (uint64_t)128746797395282U,
+    (uint64_t)3574707976985559U, (uint64_t)579106751545852U, (uint64_t)419785963756117U,
+    (uint64_t)251389486436281U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3319799966212134U, (uint64_t)3950037697883789U, (uint64_t)4323669078518333U,
+    (uint64_t)1961887330081249U, (uint64_t)129073760077269U, (uint64_t)783929691737331U,
+    (uint64_t)3823326098306071U, (uint64_t)2940270813924012U, (uint64_t)3162629822346532U,
+    (uint64_t)213127102805833U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1167993132458768U, (uint64_t)2907113615721450U, (uint64_t)2892375428007598U,
+    (uint64_t)754743481841706U, (uint64_t)80428214314039U, (uint64_t)482141723418320U,
+    (uint64_t)328161263673540U, (uint64_t)1992522224965174U, (uint64_t)3025399169656169U,
+    (uint64_t)21130827250855U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1807704547278244U, (uint64_t)2561818349805441U, (uint64_t)3453197387932514U,
+    (uint64_t)1976812394147543U, (uint64_t)116987564223141U, (uint64_t)866394560012996U,
+    (uint64_t)325346998918184U, (uint64_t)1898911694887190U, (uint64_t)4108542621969433U,
+    (uint64_t)75428523496701U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1319937112878385U, (uint64_t)1530453307216184U, (uint64_t)1257716619004954U,
+    (uint64_t)221059251256126U, (uint64_t)249616361331236U, (uint64_t)3167158583717444U,
+    (uint64_t)1174155802338962U, (uint64_t)4359622508919936U, (uint64_t)1167718006042887U,
+    (uint64_t)16133774342291U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1366475381449336U, (uint64_t)1673453484815670U, (uint64_t)3054223327032858U,
+    (uint64_t)694438035714817U, (uint64_t)36329274137055U, (uint64_t)1992302394024497U,
+    (uint64_t)469487719532530U, (uint64_t)2487591324060134U, (uint64_t)4037095909484575U,
+    (uint64_t)113310285713589U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)215084281444016U, (uint64_t)3829235032366163U, (uint64_t)1121322335005688U,
+    (uint64_t)3641318130640738U, (uint64_t)65550060233768U, (uint64_t)4153333985819786U,
+    (uint64_t)2871568727808339U, (uint64_t)4300581466451496U, (uint64_t)3297563974516408U,
+    (uint64_t)275958495259926U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2510545245704782U, (uint64_t)1835257183985321U, (uint64_t)3856542784940034U,
+    (uint64_t)1499834768562502U, (uint64_t)135148839616620U, (uint64_t)132010685374001U,
+    (uint64_t)4393170263913461U, (uint64_t)1901988977163291U, (uint64_t)2549788852289284U,
+    (uint64_t)245958199282707U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2515988340301119U, (uint64_t)1838454240373088U, (uint64_t)1652424093190663U,
+    (uint64_t)3547654653782031U, (uint64_t)205654531338538U, (uint64_t)1005298242484597U,
+    (uint64_t)4401441426898553U, (uint64_t)729913393502810U, (uint64_t)1486097017340407U,
+    (uint64_t)257739315201411U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1973438787715422U, (uint64_t)3021578237069071U, (uint64_t)2626161266324544U,
+    (uint64_t)1305321014275361U, (uint64_t)93908835400183U, (uint64_t)3367031028067824U,
+    (uint64_t)4202494537571739U, (uint64_t)3667142598395383U, (uint64_t)3279042188344833U,
+    (uint64_t)134715817600904U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4172896648924617U, (uint64_t)1366697554338990U, (uint64_t)3094030349100427U,
+    (uint64_t)4446482175275415U, (uint64_t)133079742604526U, (uint64_t)882569020893125U,
+    (uint64_t)3220171326536035U, (uint64_t)3829231089694383U, (uint64_t)1610721142074556U,
+    (uint64_t)258022075765136U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3408332203532488U, (uint64_t)1129121829825214U, (uint64_t)3505478272064487U,
+    (uint64_t)2607817332286976U, (uint64_t)105684625016839U, (uint64_t)2590529825072471U,
+    (uint64_t)1590668760028487U, (uint64_t)4497808690400780U, (uint64_t)2512139603988393U,
+    (uint64_t)99480614105052U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2649052065875921U, (uint64_t)4077914508044838U, (uint64_t)1488439816869661U,
+    (uint64_t)2169687559224270U, (uint64_t)254521937619449U, (uint64_t)1550253460759625U,
+    (uint64_t)4347205245547756U, (uint64_t)4125458952295536U, (uint64_t)336572423844643U,
+    (uint64_t)64661076111096U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U
+  };
+
+static const
+uint64_t
+Hacl_K256_PrecompTable_precomp_g_pow2_192_table_w4[240U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3194056064688819U, (uint64_t)3632737019406323U, (uint64_t)3631571504093437U,
+    (uint64_t)3337767193194036U, (uint64_t)257999926075217U, (uint64_t)2906033833564477U,
+    (uint64_t)1793389228301639U, (uint64_t)2385572375144121U, (uint64_t)3100263785697161U,
+    (uint64_t)209124003240891U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3309307194618024U, (uint64_t)1626203263550781U, (uint64_t)37907022623611U,
+    (uint64_t)2672827507665488U, (uint64_t)64714918051513U, (uint64_t)4074197124627930U,
+    (uint64_t)4389732099081754U, (uint64_t)3388007485462984U, (uint64_t)1379972043562503U,
+    (uint64_t)60808909139687U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1122851540043533U, (uint64_t)506130332225368U, (uint64_t)2340069480966839U,
+    (uint64_t)1315012827356219U, (uint64_t)82955781866543U, (uint64_t)3281144182069120U,
+    (uint64_t)3902344081432132U, (uint64_t)3675925349708901U, (uint64_t)3972492602882870U,
+    (uint64_t)98535631363434U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4114426478102265U, (uint64_t)1523252695068756U, (uint64_t)1906537761013247U,
+    (uint64_t)2757265405335013U, (uint64_t)20471217930894U, (uint64_t)4219707096418397U,
+    (uint64_t)4452383182665762U, (uint64_t)1990220194161202U, (uint64_t)2712062159622491U,
+    (uint64_t)71875398306542U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4081216605280540U, (uint64_t)2644897003347612U, (uint64_t)1655853258044745U,
+    (uint64_t)3534003687390187U, (uint64_t)186902279644473U, (uint64_t)3058770108138204U,
+    (uint64_t)1150076129195920U, (uint64_t)2974616600086668U, (uint64_t)2376542446163873U,
+    (uint64_t)171716671822931U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1971016198329068U, (uint64_t)86062706799656U, (uint64_t)3007186903497162U,
+    (uint64_t)1609163910780564U, (uint64_t)187402875626491U, (uint64_t)1349265232451960U,
+    (uint64_t)2969644923869969U, (uint64_t)1867992610562356U, (uint64_t)2621907083093689U,
+    (uint64_t)218325811976912U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)121007173438297U, (uint64_t)3062400731504912U, (uint64_t)170434889360011U,
+    (uint64_t)2797873361562642U, (uint64_t)221276740000367U, (uint64_t)3789194327847675U,
+    (uint64_t)3206420931317743U, (uint64_t)1606885457429548U, (uint64_t)2359557247081466U,
+    (uint64_t)63604746357915U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)637535958448346U, (uint64_t)2200297056311586U, (uint64_t)4188079900808742U,
+    (uint64_t)2608615904955242U, (uint64_t)105640166213878U, (uint64_t)6120115424189U,
+    (uint64_t)3421559702469333U, (uint64_t)337439932823893U, (uint64_t)4051055713066969U,
+    (uint64_t)153613102610049U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2026629482885938U, (uint64_t)3667141423163944U, (uint64_t)1983488378078088U,
+    (uint64_t)2537360538207U, (uint64_t)34654943805165U, (uint64_t)1170580802426158U,
+    (uint64_t)796282041541972U, (uint64_t)1611806481235150U, (uint64_t)2793594175629303U,
+    (uint64_t)262175222868938U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2631653995785163U, (uint64_t)1093197703854557U, (uint64_t)4180443985539630U,
+    (uint64_t)2797333516255763U, (uint64_t)68113086793915U, (uint64_t)612238299564511U,
+    (uint64_t)2647630785485608U, (uint64_t)1242896076083524U, (uint64_t)1951278509532080U,
+    (uint64_t)242436706549960U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2996490468305294U, (uint64_t)1830801792144845U, (uint64_t)2693708049958980U,
+    (uint64_t)4447553701631923U, (uint64_t)16578045872453U, (uint64_t)2946045812696935U,
+    (uint64_t)1655232795565064U, (uint64_t)2167562002005616U, (uint64_t)2186943093771018U,
+    (uint64_t)191130909111886U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)116707143357148U, (uint64_t)2263995126702520U, (uint64_t)2178655874145830U,
+    (uint64_t)4384077742371027U, (uint64_t)83120859854624U, (uint64_t)2920295753669798U,
+    (uint64_t)3454336813225011U, (uint64_t)1671392287490851U, (uint64_t)1022712776533835U,
+    (uint64_t)249758610972944U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)492838537501547U, (uint64_t)1754925933722206U, (uint64_t)3756098484548492U,
+    (uint64_t)4160394011124178U, (uint64_t)243960880910813U, (uint64_t)3824278185907216U,
+    (uint64_t)3305618710384490U, (uint64_t)3468827359401784U, (uint64_t)2072296125988193U,
+    (uint64_t)100244460667522U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3689085448503019U, (uint64_t)30752259768046U, (uint64_t)4281070326914196U,
+    (uint64_t)1663801246623231U, (uint64_t)144877897096889U, (uint64_t)915372765412177U,
+    (uint64_t)3566082349861631U, (uint64_t)14713259144895U, (uint64_t)4191135383807085U,
+    (uint64_t)45455248606076U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3472248220858009U, (uint64_t)939800157166440U, (uint64_t)2168333611331415U,
+    (uint64_t)1961140610235385U, (uint64_t)105188063899011U, (uint64_t)881064252195754U,
+    (uint64_t)2250324548098839U, (uint64_t)235499424885521U, (uint64_t)3681502600315155U,
+    (uint64_t)50147944866755U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U
+  };
+
+static const
+uint64_t
+Hacl_K256_PrecompTable_precomp_basepoint_odd_table_w7[480U] =
+  {
+    (uint64_t)705178180786072U, (uint64_t)3855836460717471U, (uint64_t)4089131105950716U,
+    (uint64_t)3301581525494108U, (uint64_t)133858670344668U, (uint64_t)2199641648059576U,
+    (uint64_t)1278080618437060U, (uint64_t)3959378566518708U, (uint64_t)3455034269351872U,
+    (uint64_t)79417610544803U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)546542052194041U, (uint64_t)1222893046007904U, (uint64_t)2424776026304968U,
+    (uint64_t)3431595440928863U, (uint64_t)273986869105240U, (uint64_t)2811955970106994U,
+    (uint64_t)2695229990876875U, (uint64_t)2876268033147049U, (uint64_t)4082765816626786U,
+    (uint64_t)62188896084781U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2486449752567780U, (uint64_t)3340067647749306U, (uint64_t)2916253415541636U,
+    (uint64_t)573074722943568U, (uint64_t)52277776554503U, (uint64_t)2389490671575766U,
+    (uint64_t)486743652699594U, (uint64_t)1910694164793383U, (uint64_t)4008189338754522U,
+    (uint64_t)238233818904293U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3340238122711484U, (uint64_t)2216834723597970U, (uint64_t)820759899226523U,
+    (uint64_t)3182717760910943U, (uint64_t)101970851688029U, (uint64_t)2293753195947226U,
+    (uint64_t)3238336059365968U, (uint64_t)1717801625064400U, (uint64_t)1572345407395544U,
+    (uint64_t)117560943098405U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4240876413373630U, (uint64_t)2661666369129525U, (uint64_t)4316247749597078U,
+    (uint64_t)4333384080914601U, (uint64_t)190028762509511U, (uint64_t)3419664878115895U,
+    (uint64_t)2888923732832348U, (uint64_t)1754141578614920U, (uint64_t)3834917301557015U,
+    (uint64_t)224521716084903U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3403578469255371U, (uint64_t)209302741130174U, (uint64_t)218092740692376U,
+    (uint64_t)1145579166123703U, (uint64_t)131163603097769U, (uint64_t)3787584712197659U,
+    (uint64_t)3991225554862849U, (uint64_t)2172305962118577U, (uint64_t)1655384083125613U,
+    (uint64_t)239163646602091U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3904980394203816U, (uint64_t)3489922477252078U, (uint64_t)972545175090683U,
+    (uint64_t)713293087711324U, (uint64_t)266663576656245U, (uint64_t)1630931605777793U,
+    (uint64_t)3840740053611163U, (uint64_t)1633527581514246U, (uint64_t)185367972097718U,
+    (uint64_t)11753449491848U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3866951835060238U, (uint64_t)1956891781096522U, (uint64_t)2638776655537556U,
+    (uint64_t)4126903688867376U, (uint64_t)237023362252099U, (uint64_t)1368479502592856U,
+    (uint64_t)771347894131792U, (uint64_t)2476572362293423U, (uint64_t)2016951945849890U,
+    (uint64_t)96886550866028U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1401466253036084U, (uint64_t)3069405213259374U, (uint64_t)2228500185192600U,
+    (uint64_t)2099011755437696U, (uint64_t)245182138997607U, (uint64_t)450759474211703U,
+    (uint64_t)2819875207605499U, (uint64_t)749032344310260U, (uint64_t)1432176599699117U,
+    (uint64_t)72643651212387U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1518843113003884U, (uint64_t)4149000799418183U, (uint64_t)1213076903848655U,
+    (uint64_t)1193147266093044U, (uint64_t)47616702781348U, (uint64_t)220266957413242U,
+    (uint64_t)216614149962583U, (uint64_t)2846111938773494U, (uint64_t)1646223185445813U,
+    (uint64_t)147234091972500U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1137922153535957U, (uint64_t)43016262195219U, (uint64_t)3627508710611668U,
+    (uint64_t)322590585365298U, (uint64_t)58462009183453U, (uint64_t)3726845388364172U,
+    (uint64_t)817053375776379U, (uint64_t)3899135045016379U, (uint64_t)4313716334101081U,
+    (uint64_t)55107450786632U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3618343765068863U, (uint64_t)3939547477089737U, (uint64_t)2682332249336504U,
+    (uint64_t)3678622896361557U, (uint64_t)52373104716600U, (uint64_t)3280304142515559U,
+    (uint64_t)4169109761983523U, (uint64_t)3331372057369968U, (uint64_t)3806901780779829U,
+    (uint64_t)3152781257053U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2828871439562516U, (uint64_t)2337601837999772U, (uint64_t)1950372619238461U,
+    (uint64_t)3774463197485830U, (uint64_t)160838599772596U, (uint64_t)2870612658435074U,
+    (uint64_t)748250163314260U, (uint64_t)4119535049228510U, (uint64_t)3005952343830973U,
+    (uint64_t)126450002555444U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2653414654641961U, (uint64_t)357063739574249U, (uint64_t)209694567126798U,
+    (uint64_t)3362825829430011U, (uint64_t)240712770380712U, (uint64_t)251936620026965U,
+    (uint64_t)861170914454196U, (uint64_t)4214251979768770U, (uint64_t)2690012275198599U,
+    (uint64_t)183196701064556U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1044435066611675U, (uint64_t)4116430473334378U, (uint64_t)3291523618827481U,
+    (uint64_t)2272590356974972U, (uint64_t)215835306559069U, (uint64_t)2540142678926466U,
+    (uint64_t)2359474477881859U, (uint64_t)2677300815335534U, (uint64_t)1915106258948716U,
+    (uint64_t)36394015706674U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3489625803450036U, (uint64_t)1463914504534881U, (uint64_t)4175980915927913U,
+    (uint64_t)2340089470520573U, (uint64_t)116704394271849U, (uint64_t)4049810832067202U,
+    (uint64_t)1280948825419733U, (uint64_t)398180739658682U, (uint64_t)1309555727602287U,
+    (uint64_t)246440110768829U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3067083609593509U, (uint64_t)194333329616789U, (uint64_t)4033079598256944U,
+    (uint64_t)4048934515129647U, (uint64_t)24842085006749U, (uint64_t)4113701692711830U,
+    (uint64_t)10877418765022U, (uint64_t)1219857477717781U, (uint64_t)1959134121513070U,
+    (uint64_t)204249735726720U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)620532353102969U, (uint64_t)1706422708592536U, (uint64_t)2309846525143939U,
+    (uint64_t)1997509946830974U, (uint64_t)105947632605569U, (uint64_t)529865911274569U,
+    (uint64_t)4086863595520944U, (uint64_t)3543717986331642U, (uint64_t)3694806190053694U,
+    (uint64_t)2848321299704U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)501282150282045U, (uint64_t)937426458562531U, (uint64_t)2851437660647452U,
+    (uint64_t)3365155197934661U, (uint64_t)108651090755920U, (uint64_t)1517482874658479U,
+    (uint64_t)728403710976863U, (uint64_t)262580794927635U, (uint64_t)3097365066588565U,
+    (uint64_t)141819933199557U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1508734068099951U, (uint64_t)4317480318412261U, (uint64_t)1135681345442025U,
+    (uint64_t)701135790059628U, (uint64_t)141588073284623U, (uint64_t)34455352497530U,
+    (uint64_t)1350092943438250U, (uint64_t)4476315590090477U, (uint64_t)3431517512973015U,
+    (uint64_t)31027653188805U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4129426271095035U, (uint64_t)2612978720459221U, (uint64_t)3594635101128156U,
+    (uint64_t)3049266378203976U, (uint64_t)134773753078119U, (uint64_t)1295139373697015U,
+    (uint64_t)2833196867825709U, (uint64_t)2575675894384030U, (uint64_t)2012727259816151U,
+    (uint64_t)14354848804008U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1441758710071241U, (uint64_t)3441155949003963U, (uint64_t)1482667702567054U,
+    (uint64_t)3189447137553668U, (uint64_t)234371749099158U, (uint64_t)1237728528210227U,
+    (uint64_t)1132244124811363U, (uint64_t)560087068066629U, (uint64_t)4045762932449672U,
+    (uint64_t)262573918597430U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)870851741505891U, (uint64_t)1658784765261938U, (uint64_t)2512224355771921U,
+    (uint64_t)916093478588750U, (uint64_t)5031296546292U, (uint64_t)850103188626586U,
+    (uint64_t)3091507635964773U, (uint64_t)334071856415731U, (uint64_t)4173920941382405U,
+    (uint64_t)129258102042582U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)350409138134388U, (uint64_t)528733183029020U, (uint64_t)1766927794445697U,
+    (uint64_t)2475814366974733U, (uint64_t)131882080759528U, (uint64_t)4138318683726038U,
+    (uint64_t)859367246969832U, (uint64_t)3274016938182995U, (uint64_t)3206178599495401U,
+    (uint64_t)164441214318726U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2343177243194672U, (uint64_t)2052486837546674U, (uint64_t)3514089868937216U,
+    (uint64_t)4023794407081957U, (uint64_t)267021498567756U, (uint64_t)419714676964407U,
+    (uint64_t)4134548360122785U, (uint64_t)3418595855873531U, (uint64_t)2492407541084894U,
+    (uint64_t)247247788522287U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2894261533070427U, (uint64_t)3936928860597195U, (uint64_t)3981469351027052U,
+    (uint64_t)597798055481275U, (uint64_t)77220250871334U, (uint64_t)976023180488830U,
+    (uint64_t)2191810426188235U, (uint64_t)3806658904335074U, (uint64_t)1903616228339821U,
+    (uint64_t)104265445510185U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1291602322059847U, (uint64_t)3399907019659826U, (uint64_t)4287380629199098U,
+    (uint64_t)1938029135713455U, (uint64_t)265461195490532U, (uint64_t)2138974326038006U,
+    (uint64_t)3420468147285349U, (uint64_t)4308109244394579U, (uint64_t)1116971695370189U,
+    (uint64_t)227438879277600U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3964800629293521U, (uint64_t)381316453782377U, (uint64_t)1179891762275411U,
+    (uint64_t)1220711365654433U, (uint64_t)223163617586632U, (uint64_t)4381017378931830U,
+    (uint64_t)3229687147551794U, (uint64_t)1658477317410729U, (uint64_t)4326759746388986U,
+    (uint64_t)223506983874357U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2669375576875296U, (uint64_t)137131552674372U, (uint64_t)2699977692586140U,
+    (uint64_t)3263829497672048U, (uint64_t)41784835778604U, (uint64_t)3352717413993280U,
+    (uint64_t)2052470128723120U, (uint64_t)3900742404064958U, (uint64_t)1615639613211644U,
+    (uint64_t)71578725864385U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)747068383093813U, (uint64_t)2355312683945056U, (uint64_t)318998965240966U,
+    (uint64_t)1181713961866189U, (uint64_t)129973401868264U, (uint64_t)2092577530289249U,
+    (uint64_t)1721109435887006U, (uint64_t)4355057500737472U, (uint64_t)2768655403574672U,
+    (uint64_t)10013256321352U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1415362437893144U, (uint64_t)923165749394458U, (uint64_t)4202927870177971U,
+    (uint64_t)1531403807533181U, (uint64_t)128978710557477U, (uint64_t)3826340131464835U,
+    (uint64_t)3660925543764165U, (uint64_t)1383501847064115U, (uint64_t)2868605382356272U,
+    (uint64_t)7095210927549U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)678701769013736U, (uint64_t)1796403513981438U, (uint64_t)797630996350976U,
+    (uint64_t)4106332155697608U, (uint64_t)250580153954721U, (uint64_t)47229910792181U,
+    (uint64_t)1012918925923952U, (uint64_t)2139910389998120U, (uint64_t)4071440220071299U,
+    (uint64_t)98723593692052U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U
+  };
+
+static const
+uint64_t
+Hacl_K256_PrecompTable_precomp_lambda_basepoint_odd_table_w7[480U] =
+  {
+    (uint64_t)3272438674132939U, (uint64_t)114286371854971U, (uint64_t)1847330488133700U,
+    (uint64_t)431535497948009U, (uint64_t)207450727357856U, (uint64_t)2199641648059576U,
+    (uint64_t)1278080618437060U, (uint64_t)3959378566518708U, (uint64_t)3455034269351872U,
+    (uint64_t)79417610544803U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)125947619601199U, (uint64_t)611799986720639U, (uint64_t)2859804771676640U,
+    (uint64_t)2731980862577906U, (uint64_t)245667280941855U, (uint64_t)2811955970106994U,
+    (uint64_t)2695229990876875U, (uint64_t)2876268033147049U, (uint64_t)4082765816626786U,
+    (uint64_t)62188896084781U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3493451599984232U, (uint64_t)1106164691288376U, (uint64_t)3581411925706089U,
+    (uint64_t)1299620495183804U, (uint64_t)56604764646618U, (uint64_t)2389490671575766U,
+    (uint64_t)486743652699594U, (uint64_t)1910694164793383U, (uint64_t)4008189338754522U,
+    (uint64_t)238233818904293U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1240722876644500U, (uint64_t)3976911943017404U, (uint64_t)164653712620320U,
+    (uint64_t)201735954779420U, (uint64_t)21931956194282U, (uint64_t)2293753195947226U,
+    (uint64_t)3238336059365968U, (uint64_t)1717801625064400U, (uint64_t)1572345407395544U,
+    (uint64_t)117560943098405U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3818803156040274U, (uint64_t)4326538867511820U, (uint64_t)3475191731938765U,
+    (uint64_t)4083138273053438U, (uint64_t)149207231200836U, (uint64_t)3419664878115895U,
+    (uint64_t)2888923732832348U, (uint64_t)1754141578614920U, (uint64_t)3834917301557015U,
+    (uint64_t)224521716084903U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4296018407496935U, (uint64_t)3220151719824479U, (uint64_t)4150768709502363U,
+    (uint64_t)3027886858028059U, (uint64_t)90111967565597U, (uint64_t)3787584712197659U,
+    (uint64_t)3991225554862849U, (uint64_t)2172305962118577U, (uint64_t)1655384083125613U,
+    (uint64_t)239163646602091U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3076889998505592U, (uint64_t)3787421621036554U, (uint64_t)2529393133129854U,
+    (uint64_t)2544409229313111U, (uint64_t)265314494794680U, (uint64_t)1630931605777793U,
+    (uint64_t)3840740053611163U, (uint64_t)1633527581514246U, (uint64_t)185367972097718U,
+    (uint64_t)11753449491848U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)180373354034100U, (uint64_t)3549343967843244U, (uint64_t)329206156610619U,
+    (uint64_t)1218949865046613U, (uint64_t)141145795851769U, (uint64_t)1368479502592856U,
+    (uint64_t)771347894131792U, (uint64_t)2476572362293423U, (uint64_t)2016951945849890U,
+    (uint64_t)96886550866028U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)196172467879113U, (uint64_t)1260484117408868U, (uint64_t)2419373991843205U,
+    (uint64_t)297064911557836U, (uint64_t)214307463995889U, (uint64_t)450759474211703U,
+    (uint64_t)2819875207605499U, (uint64_t)749032344310260U, (uint64_t)1432176599699117U,
+    (uint64_t)72643651212387U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4144146010302313U, (uint64_t)665723935507922U, (uint64_t)4438027377556219U,
+    (uint64_t)3113143276438235U, (uint64_t)93411689323115U, (uint64_t)220266957413242U,
+    (uint64_t)216614149962583U, (uint64_t)2846111938773494U, (uint64_t)1646223185445813U,
+    (uint64_t)147234091972500U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4128324339874869U, (uint64_t)2331007375545085U, (uint64_t)2850222528605128U,
+    (uint64_t)1217066557663136U, (uint64_t)114412410084222U, (uint64_t)3726845388364172U,
+    (uint64_t)817053375776379U, (uint64_t)3899135045016379U, (uint64_t)4313716334101081U,
+    (uint64_t)55107450786632U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)85549180858620U, (uint64_t)267499315817319U, (uint64_t)3075667491538230U,
+    (uint64_t)3314945921264131U, (uint64_t)205472377017945U, (uint64_t)3280304142515559U,
+    (uint64_t)4169109761983523U, (uint64_t)3331372057369968U, (uint64_t)3806901780779829U,
+    (uint64_t)3152781257053U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1564089368286654U, (uint64_t)4336748916660439U, (uint64_t)32132258945905U,
+    (uint64_t)3521812906999299U, (uint64_t)271945766425704U, (uint64_t)2870612658435074U,
+    (uint64_t)748250163314260U, (uint64_t)4119535049228510U, (uint64_t)3005952343830973U,
+    (uint64_t)126450002555444U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2865322841043497U, (uint64_t)3484565125023799U, (uint64_t)3034003843343138U,
+    (uint64_t)3352968608101873U, (uint64_t)154659638469783U, (uint64_t)251936620026965U,
+    (uint64_t)861170914454196U, (uint64_t)4214251979768770U, (uint64_t)2690012275198599U,
+    (uint64_t)183196701064556U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1518914466717728U, (uint64_t)652120947739740U, (uint64_t)1786680274820101U,
+    (uint64_t)412667047577568U, (uint64_t)251262309462963U, (uint64_t)2540142678926466U,
+    (uint64_t)2359474477881859U, (uint64_t)2677300815335534U, (uint64_t)1915106258948716U,
+    (uint64_t)36394015706674U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)38099307207579U, (uint64_t)23726988224760U, (uint64_t)1039700888435280U,
+    (uint64_t)699489192146200U, (uint64_t)252901842016997U, (uint64_t)4049810832067202U,
+    (uint64_t)1280948825419733U, (uint64_t)398180739658682U, (uint64_t)1309555727602287U,
+    (uint64_t)246440110768829U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2211245361259857U, (uint64_t)719108323824709U, (uint64_t)154548511416550U,
+    (uint64_t)3194730648512292U, (uint64_t)233003055873450U, (uint64_t)4113701692711830U,
+    (uint64_t)10877418765022U, (uint64_t)1219857477717781U, (uint64_t)1959134121513070U,
+    (uint64_t)204249735726720U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2405295303798847U, (uint64_t)832644933008216U, (uint64_t)930841696170922U,
+    (uint64_t)2144694152580594U, (uint64_t)140697062297487U, (uint64_t)529865911274569U,
+    (uint64_t)4086863595520944U, (uint64_t)3543717986331642U, (uint64_t)3694806190053694U,
+    (uint64_t)2848321299704U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1986766044986547U, (uint64_t)950084660027056U, (uint64_t)1377603677170880U,
+    (uint64_t)1489792433795785U, (uint64_t)188600742964556U, (uint64_t)1517482874658479U,
+    (uint64_t)728403710976863U, (uint64_t)262580794927635U, (uint64_t)3097365066588565U,
+    (uint64_t)141819933199557U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4131793940730273U, (uint64_t)3036073558499060U, (uint64_t)2811244523988629U,
+    (uint64_t)1930603542355898U, (uint64_t)22598489378729U, (uint64_t)34455352497530U,
+    (uint64_t)1350092943438250U, (uint64_t)4476315590090477U, (uint64_t)3431517512973015U,
+    (uint64_t)31027653188805U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1725264373085507U, (uint64_t)4366999585342222U, (uint64_t)3864133670253278U,
+    (uint64_t)2560997672362991U, (uint64_t)216608600275062U, (uint64_t)1295139373697015U,
+    (uint64_t)2833196867825709U, (uint64_t)2575675894384030U, (uint64_t)2012727259816151U,
+    (uint64_t)14354848804008U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3218971610195431U, (uint64_t)4379114897839627U, (uint64_t)2986103162249773U,
+    (uint64_t)397716634496340U, (uint64_t)257053063509592U, (uint64_t)1237728528210227U,
+    (uint64_t)1132244124811363U, (uint64_t)560087068066629U, (uint64_t)4045762932449672U,
+    (uint64_t)262573918597430U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2927841680398141U, (uint64_t)1388593367142507U, (uint64_t)4341100323647297U,
+    (uint64_t)187418077085977U, (uint64_t)103704254116331U, (uint64_t)850103188626586U,
+    (uint64_t)3091507635964773U, (uint64_t)334071856415731U, (uint64_t)4173920941382405U,
+    (uint64_t)129258102042582U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3994668286229676U, (uint64_t)3607541385909621U, (uint64_t)3885795691884386U,
+    (uint64_t)497257609510564U, (uint64_t)176634277709992U, (uint64_t)4138318683726038U,
+    (uint64_t)859367246969832U, (uint64_t)3274016938182995U, (uint64_t)3206178599495401U,
+    (uint64_t)164441214318726U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1339095322748398U, (uint64_t)4100692030577307U, (uint64_t)493382251480625U,
+    (uint64_t)4221406533648154U, (uint64_t)150356110637413U, (uint64_t)419714676964407U,
+    (uint64_t)4134548360122785U, (uint64_t)3418595855873531U, (uint64_t)2492407541084894U,
+    (uint64_t)247247788522287U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)4137215933619405U, (uint64_t)3535209602776498U, (uint64_t)1720252600607901U,
+    (uint64_t)4311091261493396U, (uint64_t)232927216574264U, (uint64_t)976023180488830U,
+    (uint64_t)2191810426188235U, (uint64_t)3806658904335074U, (uint64_t)1903616228339821U,
+    (uint64_t)104265445510185U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1163892036482640U, (uint64_t)1979987672067982U, (uint64_t)429794389268669U,
+    (uint64_t)3048595314319916U, (uint64_t)187648977682990U, (uint64_t)2138974326038006U,
+    (uint64_t)3420468147285349U, (uint64_t)4308109244394579U, (uint64_t)1116971695370189U,
+    (uint64_t)227438879277600U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)2395428161385216U, (uint64_t)1488004404911425U, (uint64_t)890506468390235U,
+    (uint64_t)2198093461312958U, (uint64_t)171382374778123U, (uint64_t)4381017378931830U,
+    (uint64_t)3229687147551794U, (uint64_t)1658477317410729U, (uint64_t)4326759746388986U,
+    (uint64_t)223506983874357U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3696584075661571U, (uint64_t)2573767592087723U, (uint64_t)3256930103711959U,
+    (uint64_t)4492636689096259U, (uint64_t)119338941619452U, (uint64_t)3352717413993280U,
+    (uint64_t)2052470128723120U, (uint64_t)3900742404064958U, (uint64_t)1615639613211644U,
+    (uint64_t)71578725864385U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1584528609427919U, (uint64_t)3015398686435253U, (uint64_t)1635408836377031U,
+    (uint64_t)4155756160677802U, (uint64_t)276534669608498U, (uint64_t)2092577530289249U,
+    (uint64_t)1721109435887006U, (uint64_t)4355057500737472U, (uint64_t)2768655403574672U,
+    (uint64_t)10013256321352U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)1849408892970264U, (uint64_t)2128485730910423U, (uint64_t)923431289146879U,
+    (uint64_t)3552892015430061U, (uint64_t)208919483262685U, (uint64_t)3826340131464835U,
+    (uint64_t)3660925543764165U, (uint64_t)1383501847064115U, (uint64_t)2868605382356272U,
+    (uint64_t)7095210927549U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)3193460315058038U, (uint64_t)2984439703661591U, (uint64_t)2403335347859994U,
+    (uint64_t)3472607582312560U, (uint64_t)149248411638824U, (uint64_t)47229910792181U,
+    (uint64_t)1012918925923952U, (uint64_t)2139910389998120U, (uint64_t)4071440220071299U,
+    (uint64_t)98723593692052U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U
+  };
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_K256_PrecompTable_H_DEFINED
+#endif
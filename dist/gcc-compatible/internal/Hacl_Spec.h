@@ -52,6 +52,8 @@ Spec_ECDSA_hash_alg_ecdsa;
 #define Spec_Cipher_Expansion_Hacl_CHACHA20 0
 #define Spec_Cipher_Expansion_Vale_AES128 1
 #define Spec_Cipher_Expansion_Vale_AES256 2
+#define Spec_Cipher_Expansion_Hacl_AES128 3
+#define Spec_Cipher_Expansion_Hacl_AES256 4
 
 typedef uint8_t Spec_Cipher_Expansion_impl;
 
@@ -0,0 +1,191 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "test_helpers.h"
+
+#include "EverCrypt_AEAD.h"
+#include "Hacl_AES_GCM_CT64.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#define ROUNDS 10000
+#define SIZE   16384
+
+// Test cases 4, 6 and 16 of the GCM specification (McGrew and Viega)
+static uint8_t key[32] = {
+  0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+  0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08
+};
+static uint8_t iv12[12] = {
+  0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88
+};
+static uint8_t iv60[60] = {
+  0x93, 0x13, 0x22, 0x5d, 0xf8, 0x84, 0x06, 0xe5, 0x55, 0x90, 0x9c, 0x5a, 0xff, 0x52, 0x69, 0xaa,
+  0x6a, 0x7a, 0x95, 0x38, 0x53, 0x4f, 0x7d, 0xa1, 0xe4, 0xc3, 0x03, 0xd2, 0xa3, 0x18, 0xa7, 0x28,
+  0xc3, 0xc0, 0xc9, 0x51, 0x56, 0x80, 0x95, 0x39, 0xfc, 0xf0, 0xe2, 0x42, 0x9a, 0x6b, 0x52, 0x54,
+  0x16, 0xae, 0xdb, 0xf5, 0xa0, 0xde, 0x6a, 0x57, 0xa6, 0x37, 0xb3, 0x9b
+};
+static uint8_t aad[20] = {
+  0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+  0xab, 0xad, 0xda, 0xd2
+};
+static uint8_t plain[60] = {
+  0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+  0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+  0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+  0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39
+};
+static uint8_t cipher4[60] = {
+  0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+  0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0, 0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+  0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+  0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91
+};
+static uint8_t tag4[16] = {
+  0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a, 0xe7, 0x12, 0x1a, 0x47
+};
+static uint8_t cipher6[60] = {
+  0x8c, 0xe2, 0x49, 0x98, 0x62, 0x56, 0x15, 0xb6, 0x03, 0xa0, 0x33, 0xac, 0xa1, 0x3f, 0xb8, 0x94,
+  0xbe, 0x91, 0x12, 0xa5, 0xc3, 0xa2, 0x11, 0xa8, 0xba, 0x26, 0x2a, 0x3c, 0xca, 0x7e, 0x2c, 0xa7,
+  0x01, 0xe4, 0xa9, 0xa4, 0xfb, 0xa4, 0x3c, 0x90, 0xcc, 0xdc, 0xb2, 0x81, 0xd4, 0x8c, 0x7c, 0x6f,
+  0xd6, 0x28, 0x75, 0xd2, 0xac, 0xa4, 0x17, 0x03, 0x4c, 0x34, 0xae, 0xe5
+};
+static uint8_t tag6[16] = {
+  0x61, 0x9c, 0xc5, 0xae, 0xff, 0xfe, 0x0b, 0xfa, 0x46, 0x2a, 0xf4, 0x3c, 0x16, 0x99, 0xd0, 0x50
+};
+static uint8_t cipher16[60] = {
+  0x52, 0x2d, 0xc1, 0xf0, 0x99, 0x56, 0x7d, 0x07, 0xf4, 0x7f, 0x37, 0xa3, 0x2a, 0x84, 0x42, 0x7d,
+  0x64, 0x3a, 0x8c, 0xdc, 0xbf, 0xe5, 0xc0, 0xc9, 0x75, 0x98, 0xa2, 0xbd, 0x25, 0x55, 0xd1, 0xaa,
+  0x8c, 0xb0, 0x8e, 0x48, 0x59, 0x0d, 0xbb, 0x3d, 0xa7, 0xb0, 0x8b, 0x10, 0x56, 0x82, 0x88, 0x38,
+  0xc5, 0xf6, 0x1e, 0x63, 0x93, 0xba, 0x7a, 0x0a, 0xbc, 0xc9, 0xf6, 0x62
+};
+static uint8_t tag16[16] = {
+  0x76, 0xfc, 0x6e, 0xce, 0x0f, 0x4e, 0x17, 0x68, 0xcd, 0xdf, 0x88, 0x53, 0xbb, 0x2d, 0x55, 0x1b
+};
+
+static uint8_t in[SIZE];
+static uint8_t out[SIZE];
+static uint8_t out1[SIZE];
+static uint8_t dec[SIZE];
+
+bool test_vector(Spec_Agile_AEAD_alg a, uint8_t *iv, uint32_t iv_len,
+                 uint8_t *exp_cipher, uint8_t *exp_tag)
+{
+  bool ok = true;
+  uint8_t tag[16];
+  EverCrypt_AEAD_state_s *s = NULL;
+  ok &= EverCrypt_AEAD_create_in(a, &s, key) == EverCrypt_Error_Success;
+  ok &= EverCrypt_AEAD_alg_of_state(s) == a;
+  ok &= EverCrypt_AEAD_encrypt(s, iv, iv_len, aad, sizeof(aad), plain, sizeof(plain), out, tag)
+    == EverCrypt_Error_Success;
+  ok &= compare(sizeof(plain), out, exp_cipher);
+  ok &= compare(16, tag, exp_tag);
+  ok &= EverCrypt_AEAD_decrypt(s, iv, iv_len, aad, sizeof(aad), out, sizeof(plain), tag, dec)
+    == EverCrypt_Error_Success;
+  ok &= compare(sizeof(plain), dec, plain);
+  tag[15] ^= 1;
+  ok &= EverCrypt_AEAD_decrypt(s, iv, iv_len, aad, sizeof(aad), out, sizeof(plain), tag, dec)
+    == EverCrypt_Error_AuthenticationFailure;
+  ok &= EverCrypt_AEAD_encrypt(s, iv, 0, aad, sizeof(aad), plain, sizeof(plain), out, tag)
+    == EverCrypt_Error_InvalidIVLength;
+  EverCrypt_AEAD_free(s);
+  return ok;
+}
+
+bool test_vectors()
+{
+  bool ok = true;
+  ok &= test_vector(Spec_Agile_AEAD_AES128_GCM, iv12, sizeof(iv12), cipher4, tag4);
+  ok &= test_vector(Spec_Agile_AEAD_AES128_GCM, iv60, sizeof(iv60), cipher6, tag6);
+  ok &= test_vector(Spec_Agile_AEAD_AES256_GCM, iv12, sizeof(iv12), cipher16, tag16);
+  return ok;
+}
+
+// Compare the portable implementation with the current EverCrypt one, on all lengths of
+// message and additional data around the block and four-block boundaries
+bool test_against_evercrypt(Spec_Agile_AEAD_alg a)
+{
+  bool ok = true;
+  EverCrypt_AEAD_state_s *s = NULL;
+  if (EverCrypt_AEAD_create_in(a, &s, key) != EverCrypt_Error_Success)
+    return false;
+  uint64_t ctx[Hacl_AES_GCM_CT64_aes256_ctx_len];
+  if (a == Spec_Agile_AEAD_AES128_GCM)
+    Hacl_AES_GCM_CT64_aes128_init(ctx, key);
+  else
+    Hacl_AES_GCM_CT64_aes256_init(ctx, key);
+  uint8_t tag[16], tag1[16];
+  for (uint32_t len = 0; len < 300; len += 7) {
+    uint32_t aad_len = len % 37;
+    uint32_t iv_len = len % 3 == 0 ? 12 : 1 + len % 29;
+    EverCrypt_AEAD_encrypt(s, in + 1, iv_len, in + 2, aad_len, in + 3, len, out, tag);
+    if (a == Spec_Agile_AEAD_AES128_GCM) {
+      Hacl_AES_GCM_CT64_aes128_encrypt(ctx, len, out1, in + 3, aad_len, in + 2, iv_len, in + 1, tag1);
+      ok &= Hacl_AES_GCM_CT64_aes128_decrypt(ctx, len, dec, out, aad_len, in + 2, iv_len, in + 1, tag);
+    } else {
+      Hacl_AES_GCM_CT64_aes256_encrypt(ctx, len, out1, in + 3, aad_len, in + 2, iv_len, in + 1, tag1);
+      ok &= Hacl_AES_GCM_CT64_aes256_decrypt(ctx, len, dec, out, aad_len, in + 2, iv_len, in + 1, tag);
+    }
+    ok &= compare(len, out1, out);
+    ok &= compare(16, tag1, tag);
+    ok &= compare(len, dec, in + 3);
+  }
+  EverCrypt_AEAD_free(s);
+  return ok;
+}
+
+void benchmark(Spec_Agile_AEAD_alg a, const char *name)
+{
+  EverCrypt_AEAD_state_s *s = NULL;
+  uint8_t tag[16];
+  EverCrypt_AEAD_create_in(a, &s, key);
+  cycles c0, c1;
+  clock_t t1, t2;
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_AEAD_encrypt(s, iv12, sizeof(iv12), aad, sizeof(aad), in, SIZE, out, tag);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("\n %s encrypt:\n", name);
+  print_time((uint64_t)SIZE * ROUNDS, t2 - t1, c1 - c0);
+  EverCrypt_AEAD_free(s);
+}
+
+int main()
+{
+  EverCrypt_AutoConfig2_init();
+  for (int i = 0; i < SIZE; i++)
+    in[i] = (uint8_t)(i * 13 + 5);
+
+  bool ok = true;
+  bool vale = EverCrypt_AutoConfig2_has_aesni() && EverCrypt_AutoConfig2_has_pclmulqdq();
+  ok &= test_vectors();
+  if (vale) {
+    ok &= test_against_evercrypt(Spec_Agile_AEAD_AES128_GCM);
+    ok &= test_against_evercrypt(Spec_Agile_AEAD_AES256_GCM);
+    benchmark(Spec_Agile_AEAD_AES128_GCM, "AES128-GCM (Vale)");
+    benchmark(Spec_Agile_AEAD_AES256_GCM, "AES256-GCM (Vale)");
+  }
+
+  // The same tests and benchmarks on the portable fallback
+  EverCrypt_AutoConfig2_disable_aesni();
+  ok &= test_vectors();
+  benchmark(Spec_Agile_AEAD_AES128_GCM, "AES128-GCM (portable)");
+  benchmark(Spec_Agile_AEAD_AES256_GCM, "AES256-GCM (portable)");
+
+  if (ok)
+    printf ("\n Success :) \n");
+  else
+    printf ("\n Failed :( \n");
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
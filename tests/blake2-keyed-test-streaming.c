@@ -0,0 +1,175 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "test_helpers.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Streaming_Blake2.h"
+#include "Hacl_Streaming_Blake2b_256.h"
+#include "Hacl_Streaming_Blake2s_128.h"
+#include "Hacl_Hash_Blake2.h"
+#include "blake2_vectors.h"
+
+#define ROUNDS 4096
+#define SIZE   16384
+
+// Reference values computed with Python's hashlib, over input[i] = i % 251
+static uint8_t salt2b[16] = {
+  0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+static uint8_t personal2b[16] = "MAC-over-stream!";
+static uint8_t expected2b_params[40] = {
+  0x81, 0x1a, 0x50, 0x69, 0x16, 0x5f, 0xfd, 0xd9, 0x50, 0x9b, 0xfb, 0x33, 0xe8, 0xe0, 0x82, 0x55,
+  0x01, 0xb6, 0x5a, 0x9f, 0x4e, 0x58, 0x07, 0xea, 0x4b, 0x28, 0x32, 0x35, 0xe9, 0xe0, 0x9b, 0x1d,
+  0x09, 0x03, 0xd2, 0x7e, 0x68, 0xbf, 0x8d, 0xaa
+};
+static uint8_t expected2b_params_empty[40] = {
+  0xd1, 0x7e, 0x83, 0x83, 0x47, 0xc6, 0xa1, 0xa5, 0xff, 0x56, 0x62, 0xc4, 0xa4, 0x24, 0x27, 0x1f,
+  0x2b, 0x2a, 0x38, 0x55, 0x1b, 0x3e, 0xaa, 0x16, 0x1c, 0xbe, 0x6d, 0x42, 0x2b, 0x87, 0xb7, 0x09,
+  0x5a, 0x2f, 0xa8, 0x39, 0xed, 0x0b, 0x7c, 0x00
+};
+static uint8_t salt2s[8] = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17 };
+static uint8_t personal2s[8] = "MACstrm!";
+static uint8_t expected2s_params[20] = {
+  0x5c, 0xba, 0xae, 0xb8, 0xc8, 0xf7, 0xf3, 0xc3, 0x8d, 0x6c, 0x9f, 0x60, 0x20, 0x1d, 0x34, 0x0b,
+  0x38, 0x6a, 0xf5, 0xc9
+};
+
+static uint8_t key[64];
+static uint8_t input[SIZE];
+
+// Feeds len bytes in chunks of chunk bytes (the last one may be shorter)
+#define STREAM(P, s, data, len, chunk)                          \
+  do {                                                          \
+    for (uint32_t off = 0; off < (len); off += (chunk)) {       \
+      uint32_t n = (len) - off < (chunk) ? (len) - off : (chunk); \
+      P##_keyed_update(s, (data) + off, n);                     \
+    }                                                           \
+  } while (0)
+
+// Checks the RFC 7693 keyed vectors, the parameterized vector (fed in uneven chunks, then again
+// after re-initialization), and the empty message, for which the key block is the last block.
+#define DEFINE_TEST(name, P, vectors, n_vectors, salt, personal, expected_params, max_len) \
+  bool name()                                                           \
+  {                                                                     \
+    bool ok = true;                                                     \
+    uint8_t tag[64] = { 0 };                                            \
+    for (size_t i = 0; i < (n_vectors); i++) {                          \
+      blake2_test_vector *v = &(vectors)[i];                            \
+      P##_keyed_state *s = P##_keyed_create_in(v->key, v->key_len, NULL, NULL, v->expected_len); \
+      STREAM(P, s, v->input, (uint32_t)v->input_len, 7);                \
+      P##_keyed_finish(s, tag);                                         \
+      ok &= compare_and_print(v->expected_len, tag, v->expected);       \
+      P##_keyed_free(s);                                                \
+    }                                                                   \
+    P##_keyed_state *s =                                                \
+      P##_keyed_create_in(key, (max_len), salt, personal, sizeof(expected_params)); \
+    uint32_t chunks[4] = { 1, 13, (max_len), 2 * (max_len) + 1 };     \
+    for (int c = 0; c < 4; c++) {                                       \
+      P##_keyed_init(s);                                                \
+      STREAM(P, s, input, 300, chunks[c]);                              \
+      memset(tag, 0, sizeof(tag));                                      \
+      P##_keyed_finish(s, tag);                                         \
+      ok &= compare_and_print(sizeof(expected_params), tag, expected_params); \
+      ok &= tag[sizeof(expected_params)] == 0;                          \
+    }                                                                   \
+    P##_keyed_free(s);                                                  \
+    ok &= P##_keyed_create_in(key, (max_len) + 1, NULL, NULL, 16) == NULL; \
+    ok &= P##_keyed_create_in(key, 0, NULL, NULL, 0) == NULL;           \
+    ok &= P##_keyed_create_in(key, 0, NULL, NULL, (max_len) + 1) == NULL; \
+    return ok;                                                          \
+  }
+
+DEFINE_TEST(test_blake2b_32, Hacl_Streaming_Blake2_blake2b_32, vectors2b, 2,
+            salt2b, personal2b, expected2b_params, 64)
+DEFINE_TEST(test_blake2s_32, Hacl_Streaming_Blake2_blake2s_32, vectors2s, 5,
+            salt2s, personal2s, expected2s_params, 32)
+DEFINE_TEST(test_blake2b_256, Hacl_Streaming_Blake2b_256_blake2b_256, vectors2b, 2,
+            salt2b, personal2b, expected2b_params, 64)
+DEFINE_TEST(test_blake2s_128, Hacl_Streaming_Blake2s_128_blake2s_128, vectors2s, 5,
+            salt2s, personal2s, expected2s_params, 32)
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  for (int i = 0; i < sizeof(key); i++)
+    key[i] = (uint8_t)i;
+  for (int i = 0; i < SIZE; i++)
+    input[i] = (uint8_t)(i % 251);
+
+  bool ok = true;
+  ok &= test_blake2b_32();
+  ok &= test_blake2s_32();
+  if (EverCrypt_AutoConfig2_has_avx2())
+    ok &= test_blake2b_256();
+  else
+    printf("Blake2b (256-bit) keyed streaming: no AVX2 support: ignoring tests\n");
+  if (EverCrypt_AutoConfig2_has_avx())
+    ok &= test_blake2s_128();
+  else
+    printf("Blake2s (128-bit) keyed streaming: no AVX support: ignoring tests\n");
+
+  // Keyed, empty message: the key block is compressed as the last block
+  uint8_t tag[64];
+  Hacl_Streaming_Blake2_blake2b_32_keyed_state *s =
+    Hacl_Streaming_Blake2_blake2b_32_keyed_create_in(key, 64, salt2b, personal2b, 40);
+  Hacl_Streaming_Blake2_blake2b_32_keyed_update(s, NULL, 0);
+  Hacl_Streaming_Blake2_blake2b_32_keyed_finish(s, tag);
+  ok &= compare_and_print(40, tag, expected2b_params_empty);
+  Hacl_Streaming_Blake2_blake2b_32_keyed_free(s);
+
+  // A keyed MAC over a large streamed object, against the one-shot function
+  uint8_t expected[64];
+  Hacl_Blake2b_32_blake2b(32, expected, SIZE, input, 32, key);
+  s = Hacl_Streaming_Blake2_blake2b_32_keyed_create_in(key, 32, NULL, NULL, 32);
+  STREAM(Hacl_Streaming_Blake2_blake2b_32, s, input, SIZE, 1000);
+  Hacl_Streaming_Blake2_blake2b_32_keyed_finish(s, tag);
+  ok &= compare_and_print(32, tag, expected);
+
+  if (ok)
+    printf ("\n Success :) \n");
+  else
+    printf ("\n Failed :( \n");
+
+  cycles a,b;
+  clock_t t1,t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Streaming_Blake2_blake2b_32_keyed_init(s);
+    Hacl_Streaming_Blake2_blake2b_32_keyed_update(s, input, SIZE);
+    Hacl_Streaming_Blake2_blake2b_32_keyed_finish(s, tag);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("\n Keyed BLAKE2b (32-bit) streaming:\n");
+  print_time((uint64_t)SIZE * ROUNDS, t2 - t1, b - a);
+  Hacl_Streaming_Blake2_blake2b_32_keyed_free(s);
+
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    Hacl_Streaming_Blake2b_256_blake2b_256_keyed_state *s256 =
+      Hacl_Streaming_Blake2b_256_blake2b_256_keyed_create_in(key, 32, NULL, NULL, 32);
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Streaming_Blake2b_256_blake2b_256_keyed_init(s256);
+      Hacl_Streaming_Blake2b_256_blake2b_256_keyed_update(s256, input, SIZE);
+      Hacl_Streaming_Blake2b_256_blake2b_256_keyed_finish(s256, tag);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    printf("\n Keyed BLAKE2b (256-bit) streaming:\n");
+    print_time((uint64_t)SIZE * ROUNDS, t2 - t1, b - a);
+    ok &= compare_and_print(32, tag, expected);
+    Hacl_Streaming_Blake2b_256_blake2b_256_keyed_free(s256);
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,146 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "test_helpers.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Hash_Blake2b_Tree_256.h"
+#include "Hacl_Hash_Blake2s_Tree_128.h"
+
+#define ROUNDS 16
+#define SIZE   (64 * 1024 * 1024)
+#define CHUNK  (1024 * 1024)
+
+// Leaves of 1024 bytes, over input[i] = i % 251; computed with Python's hashlib tree parameters
+static uint8_t blake2b_tree_empty[64] = {
+  0x2d, 0x7c, 0xcb, 0xf2, 0xc9, 0xf8, 0x35, 0xc1, 0x7f, 0x9d, 0x28, 0x65, 0x35, 0x35, 0x4c, 0x98,
+  0xee, 0x7e, 0xc8, 0x7d, 0x60, 0x5c, 0x7f, 0x55, 0x60, 0xb4, 0x4c, 0x5a, 0x97, 0x3f, 0x1b, 0x72,
+  0x60, 0x9c, 0x9b, 0xe5, 0xc6, 0x61, 0x8f, 0x73, 0x0d, 0xf0, 0xbf, 0x59, 0xfc, 0xbf, 0xa2, 0xd2,
+  0x74, 0x2a, 0x71, 0xe0, 0x02, 0x3a, 0x44, 0x17, 0x46, 0x28, 0xaf, 0xd4, 0xe0, 0xae, 0x3d, 0x70
+};
+static uint8_t blake2b_tree_10000[64] = {
+  0x36, 0x8a, 0xf5, 0x26, 0xa3, 0xac, 0x75, 0xcf, 0xea, 0x89, 0xe9, 0x57, 0xd2, 0xe1, 0x93, 0xfa,
+  0x10, 0x35, 0xea, 0xe4, 0x6e, 0xcb, 0x4e, 0xa1, 0xae, 0x52, 0x00, 0x21, 0x9e, 0x52, 0xe9, 0x05,
+  0xf0, 0x67, 0x8c, 0xe4, 0x07, 0x75, 0x29, 0x7b, 0x4e, 0xbf, 0x60, 0x49, 0xd3, 0x38, 0xac, 0x27,
+  0x18, 0x97, 0x96, 0xd2, 0xac, 0xa0, 0xf1, 0xa0, 0x30, 0xf6, 0x8c, 0xef, 0x85, 0xad, 0xbb, 0xe8
+};
+static uint8_t blake2b_tree_8192_32[32] = {
+  0x44, 0xe8, 0x48, 0xec, 0x92, 0x61, 0x2f, 0x2d, 0xc8, 0xe5, 0x6e, 0xc5, 0x53, 0x51, 0x2d, 0x75,
+  0x5f, 0xe0, 0xb2, 0x75, 0x6e, 0x2f, 0xf5, 0xc9, 0xb0, 0xe9, 0xa6, 0xb4, 0x74, 0xe8, 0x89, 0xc0
+};
+static uint8_t blake2s_tree_empty[32] = {
+  0x96, 0xbb, 0x7d, 0x02, 0x95, 0xf6, 0xe7, 0x10, 0xe2, 0xa9, 0x63, 0x16, 0x1d, 0x78, 0x8e, 0xf0,
+  0xf9, 0x99, 0x5f, 0x5d, 0xd9, 0x16, 0x34, 0x9c, 0x2b, 0xbe, 0x71, 0x04, 0x8c, 0xb8, 0x83, 0x7d
+};
+static uint8_t blake2s_tree_10000[32] = {
+  0x4d, 0x60, 0xc0, 0xf6, 0x8c, 0xb1, 0x83, 0xfb, 0x1f, 0xc9, 0x8d, 0xdf, 0x57, 0x59, 0xb2, 0xae,
+  0xe5, 0xd6, 0x4f, 0x47, 0xf6, 0x00, 0x9f, 0xcd, 0xaf, 0x70, 0x32, 0xad, 0xd6, 0xb9, 0xa8, 0xc9
+};
+static uint8_t blake2s_tree_8192_16[16] = {
+  0x6a, 0x63, 0xca, 0x02, 0xf9, 0x67, 0x9e, 0x32, 0x1c, 0xfb, 0x6f, 0x66, 0x96, 0x8c, 0xb4, 0xbf
+};
+
+static uint8_t *input;
+
+// The digest does not depend on the number of threads, including more threads than leaves,
+// nor on whether the last leaf is full
+#define DEFINE_TEST(name, P, nn)                                        \
+  bool name()                                                           \
+  {                                                                     \
+    bool ok = true;                                                     \
+    uint8_t expected[64], tag[64];                                      \
+    uint64_t lens[3] = { SIZE, SIZE - 4321, 3 * CHUNK };                \
+    uint32_t threads[5] = { 0, 2, 3, 8, 1000 };                         \
+    for (int k = 0; k < 3; k++) {                                       \
+      ok &= P##_hash(nn, expected, lens[k], input, CHUNK, 1);           \
+      for (int j = 0; j < 5; j++) {                                     \
+        ok &= P##_hash(nn, tag, lens[k], input, CHUNK, threads[j]);     \
+        ok &= memcmp(tag, expected, nn) == 0;                           \
+      }                                                                 \
+    }                                                                   \
+    return ok;                                                          \
+  }
+
+DEFINE_TEST(test_blake2b_tree, Hacl_Blake2b_Tree_256, 64)
+DEFINE_TEST(test_blake2s_tree, Hacl_Blake2s_Tree_128, 32)
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  input = malloc(SIZE);
+  for (int i = 0; i < SIZE; i++)
+    input[i] = (uint8_t)(i % 251);
+
+  bool ok = true;
+  uint8_t tag[64];
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    ok &= Hacl_Blake2b_Tree_256_hash(64, tag, 0, input, 1024, 4);
+    ok &= compare_and_print(64, tag, blake2b_tree_empty);
+    ok &= Hacl_Blake2b_Tree_256_hash(64, tag, 10000, input, 1024, 4);
+    ok &= compare_and_print(64, tag, blake2b_tree_10000);
+    ok &= Hacl_Blake2b_Tree_256_hash(32, tag, 8192, input, 1024, 3);
+    ok &= compare_and_print(32, tag, blake2b_tree_8192_32);
+    ok &= test_blake2b_tree();
+    ok &= !Hacl_Blake2b_Tree_256_hash(65, tag, 8192, input, 1024, 1);
+    ok &= !Hacl_Blake2b_Tree_256_hash(64, tag, 8192, input, 1000, 1);
+    ok &= !Hacl_Blake2b_Tree_256_hash(64, tag, 8192, input, 0, 1);
+  } else
+    printf("BLAKE2b tree: no AVX2 support: ignoring tests\n");
+
+  if (EverCrypt_AutoConfig2_has_avx()) {
+    ok &= Hacl_Blake2s_Tree_128_hash(32, tag, 0, input, 1024, 4);
+    ok &= compare_and_print(32, tag, blake2s_tree_empty);
+    ok &= Hacl_Blake2s_Tree_128_hash(32, tag, 10000, input, 1024, 4);
+    ok &= compare_and_print(32, tag, blake2s_tree_10000);
+    ok &= Hacl_Blake2s_Tree_128_hash(16, tag, 8192, input, 1024, 3);
+    ok &= compare_and_print(16, tag, blake2s_tree_8192_16);
+    ok &= test_blake2s_tree();
+    ok &= !Hacl_Blake2s_Tree_128_hash(33, tag, 8192, input, 1024, 1);
+    ok &= !Hacl_Blake2s_Tree_128_hash(32, tag, 8192, input, 96, 1);
+  } else
+    printf("BLAKE2s tree: no AVX support: ignoring tests\n");
+
+  if (ok)
+    printf ("\n Success :) \n");
+  else
+    printf ("\n Failed :( \n");
+
+  // Benchmarking the tree mode with 1 to 8 threads; clock() adds up the time of all threads,
+  // so the cycle counts are the ones to compare
+  cycles a,b;
+  clock_t t1,t2;
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    for (uint32_t n = 1; n <= 8; n *= 2) {
+      t1 = clock();
+      a = cpucycles_begin();
+      for (int j = 0; j < ROUNDS; j++)
+        Hacl_Blake2b_Tree_256_hash(64, tag, SIZE, input, CHUNK, n);
+      b = cpucycles_end();
+      t2 = clock();
+      printf("\n BLAKE2b tree (256-bit), %" PRIu32 " thread(s):\n", n);
+      print_time((uint64_t)SIZE * ROUNDS, t2 - t1, b - a);
+    }
+  }
+  if (EverCrypt_AutoConfig2_has_avx()) {
+    for (uint32_t n = 1; n <= 8; n *= 2) {
+      t1 = clock();
+      a = cpucycles_begin();
+      for (int j = 0; j < ROUNDS; j++)
+        Hacl_Blake2s_Tree_128_hash(32, tag, SIZE, input, CHUNK, n);
+      b = cpucycles_end();
+      t2 = clock();
+      printf("\n BLAKE2s tree (128-bit), %" PRIu32 " thread(s):\n", n);
+      print_time((uint64_t)SIZE * ROUNDS, t2 - t1, b - a);
+    }
+  }
+
+  free(input);
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
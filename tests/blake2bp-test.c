@@ -0,0 +1,169 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "test_helpers.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_Hash_Blake2b_256.h"
+#include "Hacl_Hash_Blake2bp_256.h"
+#include "Hacl_Hash_Blake2s_128.h"
+#include "Hacl_Hash_Blake2sp_128.h"
+
+#define ROUNDS 1024
+#define SIZE   (1024 * 1024)
+
+// First entries of the reference keyed KATs: key[i] = i, message of 0 bytes
+static uint8_t blake2bp_keyed_kat0[64] = {
+  0x9d, 0x94, 0x61, 0x07, 0x3e, 0x4e, 0xb6, 0x40, 0xa2, 0x55, 0x35, 0x7b, 0x83, 0x9f, 0x39, 0x4b,
+  0x83, 0x8c, 0x6f, 0xf5, 0x7c, 0x9b, 0x68, 0x6a, 0x3f, 0x76, 0x10, 0x7c, 0x10, 0x66, 0x72, 0x8f,
+  0x3c, 0x99, 0x56, 0xbd, 0x78, 0x5c, 0xbc, 0x3b, 0xf7, 0x9d, 0xc2, 0xab, 0x57, 0x8c, 0x5a, 0x0c,
+  0x06, 0x3b, 0x9d, 0x9c, 0x40, 0x58, 0x48, 0xde, 0x1d, 0xbe, 0x82, 0x1c, 0xd0, 0x5c, 0x94, 0x0a
+};
+static uint8_t blake2sp_keyed_kat0[32] = {
+  0x71, 0x5c, 0xb1, 0x38, 0x95, 0xae, 0xb6, 0x78, 0xf6, 0x12, 0x41, 0x60, 0xbf, 0xf2, 0x14, 0x65,
+  0xb3, 0x0f, 0x4f, 0x68, 0x74, 0x19, 0x3f, 0xc8, 0x51, 0xb4, 0x62, 0x10, 0x43, 0xf0, 0x9c, 0xc6
+};
+
+// Unkeyed, over input[i] = i % 251; computed with Python's hashlib tree parameters
+static uint8_t blake2bp_1000[64] = {
+  0x44, 0x0c, 0x4c, 0x3a, 0x7a, 0x50, 0x15, 0x9b, 0x43, 0xa3, 0xb8, 0x0e, 0x63, 0x08, 0x3f, 0xa8,
+  0x8b, 0x7e, 0x64, 0x44, 0x90, 0x06, 0x1c, 0xe7, 0x63, 0xe9, 0x24, 0x26, 0xd1, 0xfa, 0x9f, 0x03,
+  0x4d, 0x0a, 0x3a, 0x4f, 0x94, 0xd9, 0x90, 0x42, 0xb9, 0x8d, 0x06, 0x8d, 0xa3, 0x5c, 0x5a, 0xf6,
+  0x94, 0xea, 0x9e, 0x7f, 0x51, 0xb8, 0x55, 0x1a, 0xf5, 0xc9, 0x9c, 0x2e, 0xef, 0x95, 0x02, 0x4d
+};
+static uint8_t blake2sp_1000[32] = {
+  0x61, 0x1f, 0x1a, 0xf6, 0x61, 0x0c, 0xda, 0xf6, 0x74, 0xec, 0x2c, 0x91, 0x78, 0xf6, 0x37, 0x6e,
+  0xbe, 0x23, 0x4e, 0xf5, 0x09, 0x98, 0xa3, 0xbe, 0x3f, 0x1f, 0xa6, 0x98, 0xfb, 0x77, 0x92, 0x74
+};
+
+static uint8_t key[64];
+static uint8_t input[SIZE];
+
+// The streaming functions, fed in chunks of every size up to 3 stripes and over lengths around
+// the stripe and look-ahead boundaries, agree with the one-shot function
+bool test_blake2bp_streaming()
+{
+  bool ok = true;
+  uint8_t expected[64], tag[64];
+  uint32_t lens[8] = { 0, 383, 385, 512, 896, 897, 1409, 5000 };
+  Hacl_Blake2bp_256_state *s = Hacl_Blake2bp_256_create_in(key, 64, 64);
+  for (int k = 0; k < 8; k++) {
+    Hacl_Blake2bp_256_blake2bp(64, expected, lens[k], input, 64, key);
+    for (uint32_t chunk = 1; chunk <= 1536; chunk += 37) {
+      Hacl_Blake2bp_256_init(s);
+      for (uint32_t off = 0; off < lens[k]; off += chunk)
+        Hacl_Blake2bp_256_update(s, input + off, lens[k] - off < chunk ? lens[k] - off : chunk);
+      Hacl_Blake2bp_256_finish(s, tag);
+      ok &= memcmp(tag, expected, 64) == 0;
+    }
+  }
+  Hacl_Blake2bp_256_free(s);
+  return ok;
+}
+
+bool test_blake2sp_streaming()
+{
+  bool ok = true;
+  uint8_t expected[32], tag[32];
+  uint32_t lens[8] = { 0, 447, 449, 512, 960, 961, 1473, 5000 };
+  Hacl_Blake2sp_128_state *s = Hacl_Blake2sp_128_create_in(key, 32, 32);
+  for (int k = 0; k < 8; k++) {
+    Hacl_Blake2sp_128_blake2sp(32, expected, lens[k], input, 32, key);
+    for (uint32_t chunk = 1; chunk <= 1536; chunk += 37) {
+      Hacl_Blake2sp_128_init(s);
+      for (uint32_t off = 0; off < lens[k]; off += chunk)
+        Hacl_Blake2sp_128_update(s, input + off, lens[k] - off < chunk ? lens[k] - off : chunk);
+      Hacl_Blake2sp_128_finish(s, tag);
+      ok &= memcmp(tag, expected, 32) == 0;
+    }
+  }
+  Hacl_Blake2sp_128_free(s);
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  for (int i = 0; i < sizeof(key); i++)
+    key[i] = (uint8_t)i;
+  for (int i = 0; i < SIZE; i++)
+    input[i] = (uint8_t)(i % 251);
+
+  bool ok = true;
+  uint8_t tag[64];
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    Hacl_Blake2bp_256_blake2bp(64, tag, 0, input, 64, key);
+    ok &= compare_and_print(64, tag, blake2bp_keyed_kat0);
+    Hacl_Blake2bp_256_blake2bp(64, tag, 1000, input, 0, NULL);
+    ok &= compare_and_print(64, tag, blake2bp_1000);
+    ok &= test_blake2bp_streaming();
+    ok &= Hacl_Blake2bp_256_create_in(key, 65, 64) == NULL;
+  } else
+    printf("BLAKE2bp: no AVX2 support: ignoring tests\n");
+
+  if (EverCrypt_AutoConfig2_has_avx()) {
+    Hacl_Blake2sp_128_blake2sp(32, tag, 0, input, 32, key);
+    ok &= compare_and_print(32, tag, blake2sp_keyed_kat0);
+    Hacl_Blake2sp_128_blake2sp(32, tag, 1000, input, 0, NULL);
+    ok &= compare_and_print(32, tag, blake2sp_1000);
+    ok &= test_blake2sp_streaming();
+    ok &= Hacl_Blake2sp_128_create_in(key, 0, 33) == NULL;
+  } else
+    printf("BLAKE2sp: no AVX support: ignoring tests\n");
+
+  if (ok)
+    printf ("\n Success :) \n");
+  else
+    printf ("\n Failed :( \n");
+
+  // Benchmarking the parallel modes against the single-stream vectorized functions
+  cycles a,b;
+  clock_t t1,t2;
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++)
+      Hacl_Blake2b_256_blake2b(64, tag, SIZE, input, 0, NULL);
+    b = cpucycles_end();
+    t2 = clock();
+    printf("\n BLAKE2b (256-bit):\n");
+    print_time((uint64_t)SIZE * ROUNDS, t2 - t1, b - a);
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++)
+      Hacl_Blake2bp_256_blake2bp(64, tag, SIZE, input, 0, NULL);
+    b = cpucycles_end();
+    t2 = clock();
+    printf("\n BLAKE2bp (256-bit):\n");
+    print_time((uint64_t)SIZE * ROUNDS, t2 - t1, b - a);
+  }
+  if (EverCrypt_AutoConfig2_has_avx()) {
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++)
+      Hacl_Blake2s_128_blake2s(32, tag, SIZE, input, 0, NULL);
+    b = cpucycles_end();
+    t2 = clock();
+    printf("\n BLAKE2s (128-bit):\n");
+    print_time((uint64_t)SIZE * ROUNDS, t2 - t1, b - a);
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++)
+      Hacl_Blake2sp_128_blake2sp(32, tag, SIZE, input, 0, NULL);
+    b = cpucycles_end();
+    t2 = clock();
+    printf("\n BLAKE2sp (128-bit):\n");
+    print_time((uint64_t)SIZE * ROUNDS, t2 - t1, b - a);
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
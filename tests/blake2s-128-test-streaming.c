@@ -23,8 +23,8 @@ int main() {
     // one would write a for-loop over the test vectors.
     
     uint8_t tag[32] = {};
-    // Use only the vectors without keys: streaming blake2 in keyed mode is not
-    // implemented.
+    // Use only the vectors without keys: the keyed streaming states are
+    // exercised in blake2-keyed-test-streaming.c.
     blake2_test_vector *v = &vectors2s[5];
 
     blake2_state *s = Hacl_Streaming_Blake2s_128_blake2s_128_no_key_create_in();
@@ -13,6 +13,8 @@
 
 #include "Hacl_Chacha20Poly1305_256.h"
 
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_Chacha20Poly1305.h"
 #include "EverCrypt_AutoConfig2.h"
 
 #include "chacha20poly1305_vectors.h"
@@ -47,6 +49,84 @@ bool print_test(int in_len, uint8_t* in, uint8_t* key, uint8_t* nonce, int aad_l
   return ok;
 }
 
+#define BATCH 11
+#define BATCH_SIZE 1200
+
+bool batch_test() {
+  uint8_t keys[BATCH][32];
+  uint8_t nonces[BATCH][12];
+  uint8_t aads[BATCH][16];
+  uint8_t plains[BATCH][BATCH_SIZE];
+  uint8_t ciphers[BATCH][BATCH_SIZE];
+  uint8_t tags[BATCH][16];
+  uint8_t exp_cipher[BATCH_SIZE];
+  uint8_t exp_tag[16];
+  EverCrypt_AEAD_state_s *st[BATCH];
+  uint8_t *iv[BATCH], *ad[BATCH], *plain[BATCH], *cipher[BATCH], *tag[BATCH];
+  uint32_t iv_len[BATCH], ad_len[BATCH], plain_len[BATCH];
+  uint32_t lens[BATCH] = { 0, 1, 63, 64, 65, 511, 512, 1000, 1200, 17, 128 };
+  bool ok = true;
+
+  for (int i = 0; i < BATCH; i++) {
+    for (int j = 0; j < 32; j++) keys[i][j] = (uint8_t)(i * 31 + j);
+    for (int j = 0; j < 12; j++) nonces[i][j] = (uint8_t)(i * 7 + j);
+    for (int j = 0; j < 16; j++) aads[i][j] = (uint8_t)(i + j * 3);
+    for (int j = 0; j < BATCH_SIZE; j++) plains[i][j] = (uint8_t)(i * 13 + j);
+    EverCrypt_AEAD_create_in(Spec_Agile_AEAD_CHACHA20_POLY1305, &st[i], keys[i]);
+    iv[i] = nonces[i]; iv_len[i] = 12;
+    ad[i] = aads[i]; ad_len[i] = (uint32_t)(i % 17);
+    plain[i] = plains[i]; plain_len[i] = lens[i];
+    cipher[i] = ciphers[i]; tag[i] = tags[i];
+  }
+
+  /* The 8-lane kernel directly, on the first 8 records. */
+  uint8_t *k8[8];
+  for (int i = 0; i < 8; i++) k8[i] = keys[i];
+  Hacl_Chacha20Poly1305_256_aead_encrypt_8(k8, iv, ad_len, ad, plain_len, plain, cipher, tag);
+  for (int i = 0; i < 8; i++) {
+    Hacl_Chacha20Poly1305_256_aead_encrypt(keys[i], nonces[i], ad_len[i], aads[i], lens[i], plains[i], exp_cipher, exp_tag);
+    ok = ok && memcmp(ciphers[i], exp_cipher, lens[i]) == 0;
+    ok = ok && memcmp(tags[i], exp_tag, 16) == 0;
+  }
+
+  /* The EverCrypt entry point, through the AVX2 kernel and through the
+     one-record-at-a-time fallback selected once AVX2 is disabled. */
+  for (int pass = 0; pass < 2; pass++) {
+    memset(ciphers, 0, sizeof ciphers);
+    memset(tags, 0, sizeof tags);
+    if (pass == 1) EverCrypt_AutoConfig2_disable_avx2();
+    EverCrypt_Chacha20Poly1305_aead_encrypt_8(k8, iv, ad_len, ad, plain_len, plain, cipher, tag);
+    for (int i = 0; i < 8; i++) {
+      Hacl_Chacha20Poly1305_256_aead_encrypt(keys[i], nonces[i], ad_len[i], aads[i], lens[i], plains[i], exp_cipher, exp_tag);
+      ok = ok && memcmp(ciphers[i], exp_cipher, lens[i]) == 0;
+      ok = ok && memcmp(tags[i], exp_tag, 16) == 0;
+    }
+  }
+  EverCrypt_AutoConfig2_init();
+
+  /* The agile batch API: one full group of 8 plus a partial group of 3. */
+  memset(ciphers, 0, sizeof ciphers);
+  memset(tags, 0, sizeof tags);
+  EverCrypt_Error_error_code r =
+    EverCrypt_AEAD_encrypt_batch(BATCH, st, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  ok = ok && r == EverCrypt_Error_Success;
+  for (int i = 0; i < BATCH; i++) {
+    Hacl_Chacha20Poly1305_256_aead_encrypt(keys[i], nonces[i], ad_len[i], aads[i], lens[i], plains[i], exp_cipher, exp_tag);
+    ok = ok && memcmp(ciphers[i], exp_cipher, lens[i]) == 0;
+    ok = ok && memcmp(tags[i], exp_tag, 16) == 0;
+  }
+
+  /* An invalid record rejects the whole batch. */
+  iv_len[9] = 8;
+  r = EverCrypt_AEAD_encrypt_batch(BATCH, st, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  ok = ok && r == EverCrypt_Error_InvalidIVLength;
+
+  for (int i = 0; i < BATCH; i++) EverCrypt_AEAD_free(st[i]);
+  if (ok) printf("Chacha20Poly1305 (256-bit) batch encrypt: Success\n");
+  else printf("Chacha20Poly1305 (256-bit) batch encrypt: FAILURE\n");
+  return ok;
+}
+
 int main(){
   EverCrypt_AutoConfig2_init();
   if (!EverCrypt_AutoConfig2_has_vec256()) {
@@ -61,6 +141,7 @@ int main(){
   for (int i = 0; i < sizeof(vectors)/sizeof(chacha20poly1305_test_vector); ++i) {
     ok &= print_test(vectors[i].input_len,vectors[i].input,vectors[i].key,vectors[i].nonce,vectors[i].aad_len,vectors[i].aad,vectors[i].tag,vectors[i].cipher);
   }
+  ok &= batch_test();
 
   uint8_t plain[SIZE];
   uint8_t cipher[SIZE];
@@ -0,0 +1,163 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "test_helpers.h"
+
+#include "EverCrypt_CTR.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#define ROUNDS 100000
+#define SIZE   4096
+
+// NIST SP 800-38A, F.5.1 CTR-AES128.Encrypt
+static uint8_t key128[16] = {
+  0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static uint8_t counter128[16] = {
+  0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+static uint8_t plaintext[64] = {
+  0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+  0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+  0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+  0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+static uint8_t ciphertext128[64] = {
+  0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26, 0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+  0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff, 0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+  0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e, 0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+  0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1, 0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee
+};
+
+static uint8_t key[32];
+static uint8_t iv[16];
+static uint8_t in[SIZE];
+static uint8_t out[SIZE];
+static uint8_t expected[SIZE];
+
+// One call to EverCrypt_CTR_update_block per block, as the reference
+void update_per_block(EverCrypt_CTR_state_s *s, uint32_t block_len, uint32_t iv_len,
+                      uint8_t *dst, uint8_t *src, uint32_t len, uint32_t c)
+{
+  uint8_t zeroes[64] = { 0 };
+  uint8_t block[64];
+  for (uint32_t j = 0; j * block_len < len; j++) {
+    EverCrypt_CTR_init(s, key, iv, iv_len, c + j);
+    EverCrypt_CTR_update_block(s, block, zeroes);
+    uint32_t n = len - j * block_len < block_len ? len - j * block_len : block_len;
+    for (uint32_t l = 0; l < n; l++)
+      dst[j * block_len + l] = src[j * block_len + l] ^ block[l];
+  }
+}
+
+bool test_alg(Spec_Agile_Cipher_cipher_alg a, uint32_t block_len, uint32_t iv_len)
+{
+  bool ok = true;
+  EverCrypt_CTR_state_s *s = NULL;
+  EverCrypt_Error_error_code r = EverCrypt_CTR_create_in(a, &s, key, iv, iv_len, 0);
+  if (r == EverCrypt_Error_UnsupportedAlgorithm) {
+    printf("CTR: algorithm %d not supported, skipping\n", a);
+    return true;
+  }
+  // The counters around 2^32 - 5 exercise the carry out of the low 32 bits of the AES
+  // counter block when the IV fills the whole block
+  uint32_t counters[3] = { 0, 7, 0xfffffffbU };
+  for (int k = 0; k < 3; k++) {
+    for (uint32_t len = 0; len <= SIZE; len += len < 200 ? 13 : 977) {
+      update_per_block(s, block_len, iv_len, expected, in, len, counters[k]);
+      EverCrypt_CTR_init(s, key, iv, iv_len, 0);
+      EverCrypt_CTR_update(s, out, in, len, counters[k]);
+      ok &= compare(len, out, expected);
+      // In place
+      memcpy(out, in, len);
+      EverCrypt_CTR_update(s, out, out, len, counters[k]);
+      ok &= compare(len, out, expected);
+    }
+  }
+  EverCrypt_CTR_free(s);
+  return ok;
+}
+
+int main()
+{
+  EverCrypt_AutoConfig2_init();
+  for (int i = 0; i < sizeof(key); i++)
+    key[i] = (uint8_t)(7 * i);
+  for (int i = 0; i < sizeof(iv); i++)
+    iv[i] = (uint8_t)(0xf0 + i);
+  for (int i = 0; i < SIZE; i++)
+    in[i] = (uint8_t)i;
+
+  bool ok = true;
+  EverCrypt_CTR_state_s *s = NULL;
+  if (EverCrypt_CTR_create_in(Spec_Agile_Cipher_AES128, &s, key128, counter128, 16, 0)
+      == EverCrypt_Error_Success) {
+    EverCrypt_CTR_update(s, out, plaintext, 64, 0);
+    ok &= compare_and_print(64, out, ciphertext128);
+    EverCrypt_CTR_free(s);
+  }
+  ok &= test_alg(Spec_Agile_Cipher_AES128, 16, 16);
+  ok &= test_alg(Spec_Agile_Cipher_AES128, 16, 12);
+  ok &= test_alg(Spec_Agile_Cipher_AES256, 16, 16);
+  ok &= test_alg(Spec_Agile_Cipher_AES256, 16, 12);
+  ok &= test_alg(Spec_Agile_Cipher_CHACHA20, 64, 12);
+  // The 128-bit and portable ChaCha20 kernels
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= test_alg(Spec_Agile_Cipher_CHACHA20, 64, 12);
+  EverCrypt_AutoConfig2_disable_avx();
+  ok &= test_alg(Spec_Agile_Cipher_CHACHA20, 64, 12);
+  EverCrypt_AutoConfig2_init();
+
+  if (ok)
+    printf ("\n Success :) \n");
+  else
+    printf ("\n Failed :( \n");
+
+  // Benchmarking a 4 KB sector, one block at a time against a single call
+  Spec_Agile_Cipher_cipher_alg algs[2] = { Spec_Agile_Cipher_AES256, Spec_Agile_Cipher_CHACHA20 };
+  uint32_t block_lens[2] = { 16, 64 };
+  const char *names[2] = { "AES256", "CHACHA20" };
+  for (int k = 0; k < 2; k++) {
+    if (EverCrypt_CTR_create_in(algs[k], &s, key, iv, 12, 0) != EverCrypt_Error_Success)
+      continue;
+    cycles a,b;
+    clock_t t1,t2;
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      EverCrypt_CTR_init(s, key, iv, 12, 0);
+      for (uint32_t i = 0; i < SIZE; i += block_lens[k])
+        EverCrypt_CTR_update_block(s, out + i, in + i);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    double diff1 = t2 - t1;
+    uint64_t cyc1 = b - a;
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++)
+      EverCrypt_CTR_update(s, out, in, SIZE, 0);
+    b = cpucycles_end();
+    t2 = clock();
+    double diff2 = t2 - t1;
+    uint64_t cyc2 = b - a;
+
+    printf("\n CTR-%s, one block per call:\n", names[k]);
+    print_time((uint64_t)SIZE * ROUNDS, diff1, cyc1);
+    printf("\n CTR-%s, one call per sector:\n", names[k]);
+    print_time((uint64_t)SIZE * ROUNDS, diff2, cyc2);
+    EverCrypt_CTR_free(s);
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,263 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_HMAC_DRBG.h"
+#include "EverCrypt_DRBG.h"
+#include "EverCrypt_CTR_DRBG.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "drbg_vectors.h"
+
+#define ROUNDS 4096
+#define SIZE   65536
+
+static uint8_t entropy[48];
+static uint8_t nonce[16];
+static uint8_t personalization[15] = "personalization";
+static uint8_t additional[16] = "additional input";
+static uint8_t out[SIZE];
+static uint8_t expected[SIZE];
+
+bool test_hacl(Spec_Hash_Definitions_hash_alg a, uint8_t *tag)
+{
+  Hacl_HMAC_DRBG_state st = Hacl_HMAC_DRBG_create_in(a);
+  Hacl_HMAC_DRBG_instantiate(a, st, sizeof(entropy), entropy, sizeof(nonce), nonce,
+                             sizeof(personalization), personalization);
+  bool ok = Hacl_HMAC_DRBG_generate(a, out, st, 1000, 0, NULL);
+  ok &= Hacl_HMAC_DRBG_generate(a, out, st, 1000, sizeof(additional), additional);
+  ok &= compare(1000, out, tag);
+  KRML_HOST_FREE(st.k);
+  KRML_HOST_FREE(st.v);
+  KRML_HOST_FREE(st.reseed_counter);
+  return ok;
+}
+
+bool test_iterate()
+{
+  uint8_t key[100];
+  uint8_t v0[64], v1[64];
+  bool ok = true;
+  for (int i = 0; i < sizeof(key); i++)
+    key[i] = (uint8_t)(3 * i);
+  for (uint32_t len = 0; len < 300; len += 31) {
+    // Keys shorter and longer than a block
+    uint32_t key_len = len % 97;
+    memset(v0, 0x01, 64);
+    memset(v1, 0x01, 64);
+    for (uint32_t i = 0; i < len; i += 32) {
+      Hacl_HMAC_compute_sha2_256(v0, key, key_len, v0, 32);
+      memcpy(expected + i, v0, len - i < 32 ? len - i : 32);
+    }
+    EverCrypt_HMAC_iterate_sha2_256(out, len, key, key_len, v1);
+    ok &= compare(len, out, expected);
+    ok &= compare(32, v1, v0);
+    memset(v1, 0x01, 64);
+    Hacl_HMAC_SHA2_256_iterate(out, len, key, key_len, v1);
+    ok &= compare(len, out, expected);
+    ok &= compare(32, v1, v0);
+
+    memset(v0, 0x01, 64);
+    memset(v1, 0x01, 64);
+    for (uint32_t i = 0; i < len; i += 64) {
+      Hacl_HMAC_compute_sha2_512(v0, key, key_len, v0, 64);
+      memcpy(expected + i, v0, len - i < 64 ? len - i : 64);
+    }
+    EverCrypt_HMAC_iterate_sha2_512(out, len, key, key_len, v1);
+    ok &= compare(len, out, expected);
+    ok &= compare(64, v1, v0);
+  }
+  return ok;
+}
+
+bool test_pool()
+{
+  bool ok = true;
+  uint8_t out1[32];
+  EverCrypt_DRBG_pool *p =
+    EverCrypt_DRBG_pool_create(Spec_Hash_Definitions_SHA2_256, 4, personalization,
+                               sizeof(personalization));
+  ok &= p != NULL;
+  if (p == NULL)
+    return false;
+  ok &= EverCrypt_DRBG_pool_get(p, 4) == NULL;
+  ok &= !EverCrypt_DRBG_pool_generate(out, p, 5, 32, NULL, 0);
+  ok &= EverCrypt_DRBG_pool_get(p, 1) != EverCrypt_DRBG_pool_get(p, 2);
+  for (uint32_t i = 0; i < 4; i++) {
+    ok &= EverCrypt_DRBG_pool_generate(out, p, i, 32, NULL, 0);
+    ok &= EverCrypt_DRBG_pool_generate(out1, p, i, 32, additional, sizeof(additional));
+    ok &= memcmp(out, out1, 32) != 0;
+  }
+  ok &= !EverCrypt_DRBG_pool_generate(out, p, 0, EverCrypt_DRBG_max_output_length + 1, NULL, 0);
+  EverCrypt_DRBG_pool_free(p);
+  ok &= EverCrypt_DRBG_pool_create(Spec_Hash_Definitions_SHA2_256, 0, NULL, 0) == NULL;
+  return ok;
+}
+
+// NIST CAVP, CTR_DRBG AES-256 use df, no prediction resistance, COUNT = 0
+static uint8_t cavp_entropy[32] = {
+  0x36, 0x40, 0x19, 0x40, 0xfa, 0x8b, 0x1f, 0xba, 0x91, 0xa1, 0x66, 0x1f, 0x21, 0x1d, 0x78, 0xa0,
+  0xb9, 0x38, 0x9a, 0x74, 0xe5, 0xbc, 0xcf, 0xec, 0xe8, 0xd7, 0x66, 0xaf, 0x1a, 0x6d, 0x3b, 0x14,
+};
+static uint8_t cavp_nonce[16] = {
+  0x49, 0x6f, 0x25, 0xb0, 0xf1, 0x30, 0x1b, 0x4f, 0x50, 0x1b, 0xe3, 0x03, 0x80, 0xa1, 0x37, 0xeb,
+};
+static uint8_t cavp_returned_bits[64] = {
+  0x58, 0x62, 0xeb, 0x38, 0xbd, 0x55, 0x8d, 0xd9, 0x78, 0xa6, 0x96, 0xe6, 0xdf, 0x16, 0x47, 0x82,
+  0xdd, 0xd8, 0x87, 0xe7, 0xe9, 0xa6, 0xc9, 0xf3, 0xf1, 0xfb, 0xaf, 0xb7, 0x89, 0x41, 0xb5, 0x35,
+  0xa6, 0x49, 0x12, 0xdf, 0xd2, 0x24, 0xc6, 0xdc, 0x74, 0x54, 0xe5, 0x25, 0x0b, 0x3d, 0x97, 0x16,
+  0x5e, 0x16, 0x26, 0x0c, 0x2f, 0xaf, 0x1c, 0xc7, 0x73, 0x5c, 0xb7, 0x5f, 0xb4, 0xf0, 0x7e, 0x1d,
+};
+
+bool test_ctr_drbg()
+{
+  bool ok = true;
+  EverCrypt_CTR_DRBG_state *st = EverCrypt_CTR_DRBG_create();
+  if (st == NULL) {
+    printf("CTR_DRBG: no AES-NI support, skipping\n");
+    return true;
+  }
+
+  EverCrypt_CTR_DRBG_instantiate_with_entropy(st, sizeof(cavp_entropy), cavp_entropy,
+                                              sizeof(cavp_nonce), cavp_nonce, 0, NULL);
+  ok &= EverCrypt_CTR_DRBG_generate_no_reseed(out, st, 64, 0, NULL);
+  ok &= EverCrypt_CTR_DRBG_generate_no_reseed(out, st, 64, 0, NULL);
+  ok &= compare(64, out, cavp_returned_bits);
+
+  EverCrypt_CTR_DRBG_instantiate_with_entropy(st, 32, entropy, sizeof(nonce), nonce,
+                                              sizeof(personalization), personalization);
+  ok &= EverCrypt_CTR_DRBG_generate_no_reseed(out, st, 1000, 0, NULL);
+  ok &= EverCrypt_CTR_DRBG_generate_no_reseed(out, st, 1000, sizeof(additional), additional);
+  ok &= compare(1000, out, ctr_drbg_out1);
+  EverCrypt_CTR_DRBG_reseed_with_entropy(st, 32, entropy + 16, sizeof(additional), additional);
+  ok &= EverCrypt_CTR_DRBG_generate_no_reseed(out, st, 1000, sizeof(additional), additional);
+  ok &= compare(1000, out, ctr_drbg_out2);
+
+  // The Vale CTR kernel increments the low 32 bits of the counter only
+  static uint8_t v_wrap32[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xff, 0xff, 0xfd
+  };
+  memcpy(st->v, v_wrap32, 16);
+  ok &= EverCrypt_CTR_DRBG_generate_no_reseed(out, st, 100, 0, NULL);
+  ok &= compare(100, out, ctr_drbg_out3);
+  memset(st->v, 0xff, 16);
+  st->v[15] = 0xfe;
+  ok &= EverCrypt_CTR_DRBG_generate_no_reseed(out, st, 100, 0, NULL);
+  ok &= compare(100, out, ctr_drbg_out4);
+
+  ok &= !EverCrypt_CTR_DRBG_generate_no_reseed(out, st, EverCrypt_CTR_DRBG_max_output_length + 1,
+                                               0, NULL);
+  st->reseed_counter = EverCrypt_CTR_DRBG_reseed_interval + 1;
+  ok &= !EverCrypt_CTR_DRBG_generate_no_reseed(out, st, 16, 0, NULL);
+  ok &= EverCrypt_CTR_DRBG_reseed(st, NULL, 0);
+  ok &= EverCrypt_CTR_DRBG_generate_no_reseed(out, st, 16, 0, NULL);
+
+  uint8_t out1[32];
+  ok &= EverCrypt_CTR_DRBG_instantiate(st, personalization, sizeof(personalization));
+  ok &= EverCrypt_CTR_DRBG_generate(out, st, 32, NULL, 0);
+  ok &= EverCrypt_CTR_DRBG_generate(out1, st, 32, additional, sizeof(additional));
+  ok &= memcmp(out, out1, 32) != 0;
+  EverCrypt_CTR_DRBG_uninstantiate(st);
+  return ok;
+}
+
+int main()
+{
+  EverCrypt_AutoConfig2_init();
+  for (int i = 0; i < sizeof(entropy); i++)
+    entropy[i] = (uint8_t)i;
+  for (int i = 0; i < sizeof(nonce); i++)
+    nonce[i] = (uint8_t)(100 + i);
+
+  bool ok = true;
+  ok &= test_hacl(Spec_Hash_Definitions_SHA2_256, out_256);
+  ok &= test_hacl(Spec_Hash_Definitions_SHA2_384, out_384);
+  ok &= test_hacl(Spec_Hash_Definitions_SHA2_512, out_512);
+  ok &= test_iterate();
+  ok &= test_pool();
+  ok &= test_ctr_drbg();
+
+  if (ok)
+    printf ("\n Success :) \n");
+  else
+    printf ("\n Failed :( \n");
+
+  // Benchmarking the output loop of HMAC-DRBG, against one HMAC per block
+  uint8_t key[32] = { 0 };
+  uint8_t v[32] = { 0 };
+  cycles a,b;
+  clock_t t1,t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / 16; j++) {
+    for (uint32_t i = 0; i < SIZE; i += 32) {
+      EverCrypt_HMAC_compute_sha2_256(v, key, 32, v, 32);
+      memcpy(out + i, v, 32);
+    }
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double diff1 = t2 - t1;
+  uint64_t cyc1 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / 16; j++)
+    EverCrypt_HMAC_iterate_sha2_256(out, SIZE, key, 32, v);
+  b = cpucycles_end();
+  t2 = clock();
+  double diff2 = t2 - t1;
+  uint64_t cyc2 = b - a;
+
+  printf("\n HMAC-DRBG-SHA2-256 output, one HMAC per block:\n");
+  print_time((uint64_t)SIZE * ROUNDS / 16, diff1, cyc1);
+  printf("\n HMAC-DRBG-SHA2-256 output, with precomputed padded keys:\n");
+  print_time((uint64_t)SIZE * ROUNDS / 16, diff2, cyc2);
+
+  EverCrypt_CTR_DRBG_state *st = EverCrypt_CTR_DRBG_create();
+  if (st != NULL) {
+    Hacl_HMAC_DRBG_state hst = Hacl_HMAC_DRBG_create_in(Spec_Hash_Definitions_SHA2_256);
+    Hacl_HMAC_DRBG_instantiate(Spec_Hash_Definitions_SHA2_256, hst, 32, entropy,
+                               sizeof(nonce), nonce, 0, NULL);
+    EverCrypt_CTR_DRBG_instantiate_with_entropy(st, 32, entropy, sizeof(nonce), nonce, 0, NULL);
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS / 16; j++)
+      Hacl_HMAC_DRBG_generate(Spec_Hash_Definitions_SHA2_256, out, hst, SIZE, 0, NULL);
+    b = cpucycles_end();
+    t2 = clock();
+    diff1 = t2 - t1;
+    cyc1 = b - a;
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS / 16; j++)
+      EverCrypt_CTR_DRBG_generate_no_reseed(out, st, SIZE, 0, NULL);
+    b = cpucycles_end();
+    t2 = clock();
+    diff2 = t2 - t1;
+    cyc2 = b - a;
+
+    printf("\n HMAC-DRBG-SHA2-256 generate:\n");
+    print_time((uint64_t)SIZE * ROUNDS / 16, diff1, cyc1);
+    printf("\n CTR_DRBG-AES-256 generate:\n");
+    print_time((uint64_t)SIZE * ROUNDS / 16, diff2, cyc2);
+
+    KRML_HOST_FREE(hst.k);
+    KRML_HOST_FREE(hst.v);
+    KRML_HOST_FREE(hst.reseed_counter);
+    EverCrypt_CTR_DRBG_uninstantiate(st);
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
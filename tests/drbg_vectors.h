@@ -0,0 +1,356 @@
+// HMAC-DRBG outputs of the second generate call, computed with a reference
+// implementation of NIST SP 800-90A (see drbg-test.c for the inputs)
+
+static uint8_t out_256[1000] = {
+  0x3b, 0x1c, 0xfe, 0x77, 0xbc, 0x0d, 0x41, 0xc8, 0x05, 0x5c, 0xf8, 0x77, 0x6d, 0xe2, 0xef, 0x26,
+  0xba, 0xe2, 0xc1, 0x49, 0xfb, 0x45, 0xd0, 0xf2, 0xcd, 0x82, 0x27, 0xcb, 0xa1, 0x10, 0x6e, 0x0c,
+  0x49, 0x42, 0xba, 0x02, 0x75, 0x87, 0x24, 0x0d, 0xb7, 0x7f, 0x7d, 0x50, 0x8d, 0xac, 0x63, 0x53,
+  0xc0, 0xaf, 0x14, 0x05, 0x96, 0xb1, 0xe7, 0x5e, 0x11, 0x7e, 0x78, 0xd1, 0x21, 0x2f, 0x25, 0xf5,
+  0xb9, 0x20, 0x5c, 0x5b, 0x65, 0x00, 0x8c, 0x20, 0x1c, 0x4a, 0xb7, 0xb6, 0x93, 0xd1, 0x6f, 0xbf,
+  0xd0, 0x3f, 0x80, 0xa8, 0x1a, 0x16, 0x5f, 0xb3, 0xa7, 0x02, 0xca, 0x73, 0xc4, 0x85, 0x0c, 0x22,
+  0x88, 0x4e, 0xd3, 0xa6, 0x0e, 0x68, 0x9e, 0x98, 0x7a, 0x46, 0x89, 0x87, 0xff, 0xf5, 0x06, 0xa1,
+  0x5d, 0x3a, 0x53, 0xf0, 0xe0, 0x38, 0x87, 0xec, 0x1c, 0x59, 0x22, 0xab, 0x3f, 0x05, 0x75, 0x29,
+  0x0a, 0xa1, 0x28, 0x79, 0x24, 0x35, 0x4d, 0x9b, 0xff, 0x0e, 0x8b, 0x30, 0x27, 0x4d, 0x57, 0x11,
+  0xd9, 0xf0, 0xe2, 0x70, 0x39, 0xc7, 0xfa, 0x9a, 0xdb, 0x03, 0xa5, 0x94, 0x90, 0x99, 0xd8, 0x39,
+  0x19, 0x49, 0x23, 0x73, 0x83, 0x0d, 0x74, 0x62, 0x4a, 0x59, 0x38, 0x3c, 0xd8, 0x65, 0xf6, 0x89,
+  0xfe, 0x7a, 0x3e, 0x97, 0xa1, 0x1a, 0x9e, 0xdc, 0xea, 0x8c, 0xce, 0xb5, 0xe3, 0xb9, 0xdc, 0x3b,
+  0xd8, 0xd4, 0xef, 0x04, 0xc7, 0x33, 0x82, 0x3c, 0xc6, 0x80, 0xa2, 0x98, 0xb7, 0x1b, 0x08, 0x0c,
+  0xb1, 0x00, 0x98, 0x7b, 0x4f, 0x0f, 0x7a, 0xe1, 0x8c, 0x48, 0x3f, 0x98, 0x87, 0xf0, 0x59, 0x59,
+  0xd6, 0x37, 0xc6, 0x37, 0x84, 0xf1, 0xc7, 0xaa, 0x00, 0x50, 0x30, 0x3c, 0xd3, 0x36, 0xf5, 0xcc,
+  0x7c, 0xc1, 0x77, 0x02, 0x18, 0xba, 0x75, 0x81, 0x72, 0x94, 0x2e, 0x78, 0x4e, 0xd2, 0x67, 0xab,
+  0x0e, 0xa6, 0x24, 0xed, 0x19, 0x52, 0x2c, 0xac, 0x4b, 0xf8, 0x41, 0xe7, 0x03, 0x95, 0x9c, 0x63,
+  0x20, 0x46, 0x23, 0xfa, 0x0f, 0x84, 0x64, 0x25, 0x22, 0x56, 0x2e, 0x80, 0xbd, 0xe9, 0x23, 0x35,
+  0x22, 0xf8, 0x3d, 0x40, 0x64, 0xd7, 0xb2, 0x1a, 0x84, 0xd9, 0x98, 0x70, 0x90, 0x23, 0x53, 0xca,
+  0x52, 0x91, 0x17, 0xd1, 0x13, 0x29, 0xf4, 0xa4, 0x41, 0x6b, 0xd8, 0x35, 0xbf, 0x43, 0x18, 0x79,
+  0x85, 0x41, 0x4e, 0x33, 0x6a, 0x65, 0xfa, 0x6a, 0x7d, 0xde, 0xf9, 0xf5, 0xed, 0x88, 0xa9, 0x24,
+  0x28, 0x59, 0xc0, 0x28, 0xa7, 0x15, 0xc4, 0x67, 0xcc, 0x99, 0x49, 0x31, 0xe9, 0xb2, 0xcd, 0x14,
+  0x1b, 0x4d, 0x98, 0x10, 0xad, 0xd8, 0x22, 0xf8, 0x78, 0xad, 0xac, 0xf8, 0x8b, 0xfe, 0xea, 0x63,
+  0x0b, 0x58, 0xf7, 0xfc, 0xc2, 0x64, 0x73, 0x1d, 0x6e, 0x64, 0x96, 0x9c, 0x29, 0xef, 0x15, 0xd0,
+  0xee, 0x16, 0x43, 0x28, 0xfd, 0x3e, 0x5c, 0x8f, 0x18, 0x48, 0x1a, 0x90, 0x89, 0x4d, 0x14, 0x13,
+  0xd7, 0x34, 0xb4, 0xc3, 0x70, 0xe5, 0xbd, 0x35, 0x39, 0x32, 0x7f, 0x13, 0xe6, 0xdf, 0x4b, 0xe7,
+  0x70, 0xec, 0xf5, 0x70, 0x98, 0xe7, 0x0d, 0x1c, 0x6a, 0x3e, 0x13, 0x36, 0x84, 0xd8, 0xfc, 0x44,
+  0x90, 0x23, 0x90, 0xdd, 0xe7, 0x15, 0xa4, 0xe9, 0x1b, 0x3f, 0x0b, 0xf3, 0x22, 0xe8, 0x4a, 0xcc,
+  0x22, 0x9a, 0xf1, 0xa4, 0x0e, 0xd0, 0xa6, 0xf0, 0x6f, 0xac, 0x4d, 0x04, 0xbe, 0x3a, 0xf1, 0x44,
+  0x4b, 0xdc, 0x9c, 0x34, 0x09, 0x8d, 0x1a, 0x88, 0x28, 0x22, 0x37, 0x9f, 0x15, 0x51, 0x41, 0xfd,
+  0xf7, 0x2b, 0x09, 0x01, 0x42, 0x8c, 0xd0, 0xdf, 0xf8, 0x81, 0x66, 0x87, 0x08, 0xd5, 0x09, 0x2e,
+  0xe2, 0xa1, 0x87, 0x9b, 0x1a, 0xbd, 0xec, 0xa6, 0x15, 0xc5, 0x21, 0x1b, 0x0d, 0x29, 0x92, 0x0c,
+  0x30, 0x74, 0xa0, 0xab, 0x4d, 0xee, 0x97, 0x9e, 0xc3, 0xd3, 0x2b, 0x01, 0x40, 0x5c, 0xb7, 0x52,
+  0xab, 0x3e, 0xe8, 0xce, 0xb6, 0x3c, 0xbf, 0xa7, 0xca, 0xe0, 0xd0, 0xb1, 0x6b, 0xb6, 0x07, 0xc4,
+  0xd7, 0x27, 0xa1, 0xcc, 0x44, 0x49, 0x28, 0xd1, 0xac, 0xe3, 0x11, 0x57, 0xa9, 0x00, 0xfb, 0x50,
+  0x97, 0x38, 0x36, 0x83, 0x5d, 0x43, 0xb8, 0xbc, 0xd2, 0x25, 0x32, 0xc4, 0xfb, 0xfe, 0x0e, 0x4c,
+  0xb8, 0x3f, 0x2d, 0x65, 0xf9, 0xbb, 0x6e, 0x24, 0x1b, 0x01, 0x9a, 0xc5, 0x55, 0x4f, 0xb9, 0xbc,
+  0xd5, 0xb2, 0x81, 0x90, 0x33, 0x4b, 0x46, 0x04, 0x6c, 0xcc, 0xc1, 0x6e, 0x1b, 0xf9, 0x3b, 0x34,
+  0x92, 0xa4, 0x51, 0xbe, 0x38, 0x11, 0xe0, 0x7e, 0x22, 0x9d, 0x3b, 0x90, 0xd8, 0x45, 0xf7, 0xe7,
+  0x4b, 0x23, 0xf3, 0xd3, 0xf0, 0x3d, 0x8d, 0x65, 0x45, 0x47, 0xa7, 0x47, 0x9a, 0xdb, 0x3a, 0x85,
+  0xf5, 0x2b, 0x35, 0x1c, 0x84, 0xd0, 0xb1, 0xea, 0x9a, 0x59, 0x54, 0x5f, 0xa3, 0xd2, 0xd6, 0x86,
+  0xac, 0xf0, 0xda, 0x91, 0x21, 0x85, 0x9c, 0x8e, 0x27, 0x9d, 0xc6, 0xf9, 0x8e, 0xb5, 0x08, 0x32,
+  0x3a, 0xba, 0xb8, 0x03, 0x68, 0x83, 0xd9, 0x3b, 0x1e, 0x1c, 0x18, 0xd0, 0x97, 0x24, 0xfe, 0xf9,
+  0x4d, 0x72, 0x05, 0x8f, 0xf7, 0x51, 0xac, 0x72, 0x1a, 0x0d, 0xb5, 0x5e, 0xc6, 0x4b, 0xcb, 0x46,
+  0xc3, 0x60, 0xfd, 0x8d, 0x67, 0xac, 0xe4, 0x69, 0x27, 0x64, 0x19, 0x93, 0x1e, 0x21, 0x38, 0x2f,
+  0xfe, 0x7b, 0xe6, 0x8a, 0xc4, 0xc4, 0x4f, 0x28, 0xb0, 0x3d, 0x22, 0xac, 0x8b, 0x2c, 0x0f, 0xd3,
+  0x01, 0x55, 0x70, 0xfa, 0x87, 0x63, 0xc0, 0xb9, 0xff, 0x51, 0x8a, 0xbf, 0xd4, 0xcb, 0x5c, 0xdd,
+  0xb6, 0xe1, 0x9f, 0x6c, 0x0d, 0xb1, 0xcd, 0x44, 0xc6, 0x70, 0x9b, 0x8c, 0x1d, 0xc4, 0x08, 0x1a,
+  0x50, 0xc0, 0xd0, 0xab, 0xea, 0xec, 0x7e, 0x47, 0xc4, 0xe7, 0x9a, 0x65, 0xf3, 0x75, 0xfc, 0x57,
+  0xbc, 0x64, 0xba, 0xa4, 0x23, 0x56, 0xa1, 0x1d, 0x05, 0xae, 0x2e, 0xec, 0x49, 0xa0, 0x88, 0x58,
+  0x4e, 0xbd, 0x10, 0x9e, 0x27, 0x37, 0xb2, 0x66, 0xef, 0xb0, 0x6d, 0x06, 0x52, 0x56, 0x8b, 0xe6,
+  0x9e, 0x9c, 0xe7, 0xef, 0xbd, 0xa0, 0xcb, 0x6d, 0x7f, 0xf8, 0x12, 0x09, 0x56, 0x4d, 0xf6, 0xef,
+  0x93, 0x5c, 0x48, 0x39, 0x32, 0xa7, 0x15, 0x6f, 0x17, 0x21, 0x25, 0x7e, 0x8b, 0x72, 0x9f, 0x5a,
+  0xaa, 0xfe, 0xb9, 0xb3, 0xc1, 0x6e, 0x89, 0x13, 0xa1, 0xbf, 0x02, 0x10, 0xc0, 0x7c, 0xaa, 0x56,
+  0xd0, 0xb4, 0xd8, 0xe2, 0x6d, 0x91, 0x25, 0x9d, 0x38, 0x12, 0xfe, 0x13, 0x8e, 0x64, 0x4f, 0xcd,
+  0xe4, 0x9b, 0xf6, 0xad, 0x3f, 0xe0, 0xb3, 0xa9, 0x3b, 0x3d, 0x29, 0xad, 0xce, 0x22, 0x44, 0x12,
+  0xad, 0xce, 0x0d, 0xec, 0xae, 0x39, 0x60, 0x62, 0x82, 0x55, 0x81, 0x42, 0x82, 0xc9, 0x84, 0x8c,
+  0xa6, 0x32, 0x8a, 0x46, 0x3a, 0x84, 0x49, 0x01, 0x67, 0x54, 0xba, 0x9f, 0x3c, 0x1a, 0x53, 0xdd,
+  0x41, 0xce, 0x1e, 0x01, 0xd4, 0xe2, 0xe9, 0x6f, 0x93, 0x3f, 0x04, 0xa5, 0x3f, 0x41, 0x7f, 0x5c,
+  0x86, 0x85, 0xac, 0x3b, 0x98, 0xc9, 0xae, 0x75, 0xbd, 0xaa, 0x23, 0xb7, 0x90, 0xfe, 0xa5, 0x54,
+  0x7c, 0x16, 0x73, 0x3a, 0xd9, 0x16, 0x87, 0x05, 0x2b, 0x56, 0xc9, 0x91, 0x3f, 0xc7, 0xed, 0x2c,
+  0x1c, 0xf6, 0x8b, 0x90, 0xcf, 0x45, 0x3e, 0xdb, 0x9e, 0xad, 0x0b, 0x74, 0xf4, 0x99, 0x27, 0x5e,
+  0xac, 0x7f, 0xa2, 0x45, 0x0b, 0xe1, 0xa4, 0xd9,
+};
+
+static uint8_t out_384[1000] = {
+  0xe5, 0xb3, 0xf8, 0x14, 0x92, 0xbc, 0x7d, 0xcd, 0x40, 0x27, 0xec, 0x12, 0x79, 0x27, 0xa1, 0x22,
+  0x12, 0xbe, 0x1b, 0x09, 0x13, 0x73, 0x5f, 0xa3, 0xf2, 0x03, 0xcf, 0x7a, 0xcf, 0x2c, 0x1b, 0x64,
+  0xb5, 0x96, 0x82, 0xc4, 0xd3, 0x7f, 0xb8, 0x32, 0x9b, 0x04, 0x6b, 0xff, 0x82, 0x71, 0x57, 0xae,
+  0x0f, 0xba, 0xed, 0x05, 0xf3, 0xf5, 0x1b, 0xc5, 0x3d, 0xdf, 0xed, 0xec, 0x4e, 0x40, 0x45, 0x7c,
+  0x5f, 0x0c, 0x78, 0x97, 0x07, 0x4a, 0x70, 0x3c, 0x56, 0xc9, 0x8c, 0x62, 0x2f, 0x2b, 0xf2, 0x23,
+  0x72, 0x11, 0x92, 0x72, 0x52, 0x5e, 0x53, 0x48, 0x7c, 0x32, 0x44, 0xd0, 0x47, 0xdb, 0xf1, 0x99,
+  0x70, 0x09, 0xa2, 0x0f, 0x0e, 0xc6, 0x8a, 0xd3, 0x5d, 0xfd, 0x53, 0xcb, 0x6e, 0xe8, 0x86, 0x22,
+  0x29, 0xdf, 0x84, 0xb7, 0xc5, 0x4f, 0x09, 0x7e, 0x6d, 0xd0, 0x34, 0xf1, 0xa5, 0xc5, 0x64, 0x07,
+  0xcb, 0x28, 0x6d, 0x9f, 0x46, 0xf6, 0x3a, 0x55, 0xab, 0x03, 0x75, 0x8e, 0x57, 0x4a, 0x8f, 0xcc,
+  0xcd, 0xf8, 0x24, 0x05, 0x58, 0x2c, 0x99, 0x11, 0x74, 0xa5, 0x34, 0x6c, 0x11, 0x56, 0xc5, 0x6d,
+  0xf5, 0x3b, 0xa6, 0x7e, 0x61, 0xfb, 0xdc, 0x48, 0xfa, 0x67, 0xe1, 0xe8, 0xdc, 0x7e, 0x21, 0x43,
+  0xdd, 0xbf, 0x49, 0x64, 0x43, 0x3a, 0x36, 0x1e, 0xbc, 0x7a, 0xc0, 0x3d, 0x53, 0x5a, 0x4c, 0x06,
+  0x88, 0x44, 0xb0, 0x8c, 0x44, 0xa4, 0x3a, 0x87, 0x91, 0xf9, 0x60, 0xf0, 0xf5, 0xfc, 0x78, 0xb5,
+  0x6a, 0xda, 0xc1, 0xc2, 0x78, 0x58, 0x20, 0x04, 0x00, 0x55, 0xa8, 0x5f, 0xd2, 0x70, 0x9a, 0xe7,
+  0x02, 0x3c, 0xb1, 0x75, 0x51, 0x99, 0xb9, 0x0e, 0xee, 0x1d, 0x56, 0x6a, 0xc7, 0xe5, 0xe0, 0x0b,
+  0xbb, 0xe5, 0x4f, 0xfe, 0x51, 0x84, 0xb9, 0x0d, 0xae, 0x94, 0xeb, 0x09, 0xa9, 0x0d, 0xc6, 0x3d,
+  0xb9, 0x42, 0x3e, 0x37, 0x44, 0xaf, 0x8f, 0xbd, 0xcd, 0x33, 0x2f, 0x1b, 0x5b, 0x78, 0xae, 0x75,
+  0xea, 0xc3, 0xde, 0x00, 0x0f, 0x33, 0x6c, 0xe4, 0xaa, 0x98, 0xfd, 0xd3, 0xb3, 0x40, 0xa7, 0x26,
+  0xcc, 0xa0, 0x9c, 0x94, 0x61, 0x42, 0x13, 0x7b, 0x36, 0x4c, 0x4f, 0xe4, 0x13, 0x55, 0x8c, 0x83,
+  0x31, 0x20, 0x91, 0x37, 0xe1, 0x69, 0x3f, 0x1e, 0x9e, 0x92, 0x85, 0xf5, 0x3f, 0x0b, 0xc9, 0x1e,
+  0x2b, 0x5a, 0x62, 0xc4, 0xec, 0xf8, 0xc6, 0xbd, 0xcf, 0x6d, 0x04, 0xbc, 0xbc, 0x85, 0xcc, 0x7e,
+  0x76, 0x0b, 0xfa, 0x92, 0x70, 0xce, 0xd8, 0x6a, 0xd7, 0x3c, 0x00, 0xb2, 0x46, 0x63, 0x3c, 0x2c,
+  0x2f, 0xbf, 0x6e, 0xd9, 0xe0, 0xc6, 0x27, 0xc5, 0x65, 0xb8, 0xbf, 0x8c, 0x33, 0x4f, 0x89, 0x28,
+  0xf8, 0x89, 0xa6, 0x5e, 0x5f, 0xc5, 0xfa, 0x80, 0x2a, 0x33, 0xa9, 0x74, 0xd8, 0x99, 0x9a, 0x00,
+  0x34, 0x98, 0x73, 0x95, 0x4c, 0x47, 0x6d, 0x6b, 0x29, 0x9f, 0x8e, 0x05, 0x71, 0x24, 0x34, 0x19,
+  0x74, 0x91, 0xc4, 0x62, 0x15, 0x08, 0x18, 0xb4, 0xce, 0x12, 0xa6, 0xd3, 0x22, 0x8c, 0x73, 0xa8,
+  0xa4, 0x2a, 0x95, 0x8e, 0x58, 0xfd, 0x49, 0x78, 0xf9, 0x8c, 0x18, 0x90, 0xd2, 0x98, 0xf8, 0xe2,
+  0x10, 0x91, 0x41, 0xbd, 0xff, 0xe3, 0x1d, 0x2b, 0xf3, 0x14, 0x77, 0xf9, 0x23, 0xc1, 0x52, 0xa6,
+  0x62, 0xd7, 0x4e, 0x2f, 0xbb, 0x8b, 0xa3, 0x9b, 0xf1, 0x42, 0x17, 0x44, 0xb4, 0x7e, 0x85, 0x28,
+  0x27, 0xc2, 0xe3, 0x7e, 0x29, 0xad, 0x28, 0x04, 0x18, 0x0c, 0xf1, 0xfe, 0x40, 0x0f, 0x15, 0x27,
+  0x10, 0xa4, 0x60, 0x27, 0x11, 0xde, 0x1f, 0x15, 0xdc, 0x7e, 0x9b, 0xbf, 0x3e, 0x77, 0x62, 0xce,
+  0xb3, 0x53, 0x9d, 0xc8, 0x4a, 0xd6, 0x8a, 0x53, 0xac, 0xd5, 0xc5, 0x0d, 0x06, 0x76, 0x45, 0xbf,
+  0xe6, 0x14, 0x60, 0xd4, 0xba, 0xcd, 0x8f, 0xa4, 0x25, 0x51, 0x31, 0x51, 0x05, 0x87, 0x2e, 0xe0,
+  0xd8, 0x74, 0xec, 0x85, 0xe1, 0xf8, 0xab, 0x58, 0xa4, 0xca, 0x26, 0x57, 0x0e, 0xce, 0xf8, 0x1d,
+  0xe9, 0x50, 0x98, 0xc6, 0xcc, 0xb2, 0x80, 0x56, 0x3a, 0xab, 0x76, 0xa4, 0x1d, 0x8f, 0x25, 0xa9,
+  0x53, 0xe4, 0x76, 0x3a, 0xc0, 0x23, 0x80, 0xa3, 0x32, 0xcf, 0xa4, 0xc3, 0xda, 0x38, 0xee, 0xbb,
+  0x13, 0xb3, 0x55, 0xed, 0x7c, 0xcf, 0x96, 0x43, 0x17, 0x92, 0xe9, 0xaf, 0x67, 0xe0, 0x09, 0x4e,
+  0xa2, 0xe4, 0x5a, 0x3a, 0x05, 0xea, 0xe2, 0xcc, 0x84, 0x8d, 0x6f, 0xfc, 0xc5, 0xb4, 0xa8, 0x7f,
+  0x96, 0x25, 0xf8, 0x79, 0x0b, 0xef, 0x78, 0xf7, 0xf7, 0x12, 0xc2, 0x56, 0xcf, 0x94, 0xea, 0xfc,
+  0xbd, 0x27, 0x15, 0x83, 0x53, 0x01, 0x3f, 0x89, 0x11, 0x64, 0x3c, 0x46, 0xd1, 0xce, 0xb8, 0xc9,
+  0x82, 0x0f, 0x70, 0xd3, 0x0a, 0xba, 0xb4, 0x28, 0xcb, 0x6e, 0xa0, 0xa8, 0xb3, 0xce, 0xb6, 0x92,
+  0xff, 0x66, 0xce, 0x2b, 0x77, 0x6a, 0xbf, 0x3e, 0xfa, 0x75, 0x3f, 0xf8, 0x40, 0x8d, 0x24, 0x0d,
+  0xb2, 0x4c, 0x6b, 0x63, 0x37, 0xae, 0xc3, 0x59, 0x82, 0xbb, 0xc6, 0x73, 0x3d, 0xca, 0xad, 0x50,
+  0x2a, 0x59, 0x77, 0xff, 0xd7, 0xa2, 0xd7, 0x51, 0x30, 0x95, 0xb5, 0xea, 0x47, 0x7d, 0x36, 0xa4,
+  0xd8, 0xdd, 0xb1, 0x28, 0x0a, 0xb0, 0x0b, 0x6d, 0x3d, 0x2d, 0x6a, 0x19, 0x91, 0xac, 0x70, 0xd9,
+  0x0f, 0xbd, 0x2c, 0xb8, 0xb5, 0x64, 0x64, 0x36, 0xc4, 0xb4, 0x48, 0x5a, 0x0c, 0xee, 0x5f, 0xbd,
+  0xa0, 0xf3, 0x0f, 0xe7, 0x03, 0xe4, 0x80, 0x7e, 0xf3, 0x79, 0xde, 0xab, 0x9a, 0x08, 0xf6, 0xe4,
+  0x9d, 0x11, 0x03, 0xdc, 0xb3, 0x32, 0x5a, 0x3f, 0x2f, 0xfd, 0x7a, 0xb5, 0xe1, 0xf3, 0xc6, 0xd2,
+  0xfe, 0xd7, 0x34, 0x32, 0x33, 0x88, 0x5a, 0xa4, 0xf9, 0x7a, 0x22, 0x30, 0x12, 0x40, 0x94, 0xef,
+  0x91, 0xfe, 0x23, 0xdb, 0x66, 0x92, 0x4b, 0x12, 0xd5, 0x48, 0xb4, 0xf8, 0xd2, 0xbe, 0xbb, 0x75,
+  0x19, 0xcb, 0x59, 0xf7, 0x89, 0x0e, 0xe2, 0x11, 0x4d, 0x42, 0xb8, 0xb6, 0x13, 0xc0, 0xdf, 0x35,
+  0x51, 0xb1, 0x67, 0x58, 0x53, 0xae, 0xfa, 0x68, 0xcb, 0x7e, 0x41, 0x54, 0x7d, 0xaf, 0x33, 0xec,
+  0x19, 0x25, 0x7b, 0x60, 0x72, 0xf8, 0xa4, 0x54, 0xb6, 0x65, 0x26, 0x38, 0x6f, 0x82, 0xb2, 0xd9,
+  0xae, 0xa8, 0x4c, 0xdb, 0xef, 0xdc, 0x04, 0x48, 0x63, 0x33, 0x0b, 0xbd, 0x11, 0x22, 0x27, 0x2b,
+  0x0d, 0xed, 0x88, 0xa2, 0x6a, 0xe0, 0x0e, 0x2f, 0xbc, 0x72, 0x46, 0x11, 0xea, 0xf9, 0x90, 0x61,
+  0x98, 0x23, 0xa9, 0x29, 0x82, 0xd8, 0x9e, 0x3f, 0x21, 0x14, 0x46, 0xd3, 0x6a, 0x9d, 0xf4, 0xa5,
+  0x64, 0x14, 0x81, 0x49, 0x6b, 0x84, 0x23, 0x93, 0x5c, 0x18, 0xfa, 0x6c, 0xd3, 0x8a, 0x8b, 0x4e,
+  0xac, 0x8e, 0xaf, 0x4a, 0x89, 0x86, 0xf9, 0x9a, 0x5c, 0xc2, 0x53, 0x35, 0x27, 0x03, 0x27, 0x3d,
+  0x5d, 0x3e, 0x4d, 0x86, 0x1b, 0xdc, 0xfe, 0x10, 0xa2, 0x4b, 0x9b, 0x6a, 0x69, 0x84, 0x2f, 0x23,
+  0xf3, 0xaa, 0x57, 0xd9, 0xf2, 0x0b, 0x44, 0x71, 0xd9, 0xd1, 0xeb, 0xb6, 0xfe, 0x26, 0xc0, 0x05,
+  0x6b, 0xc1, 0x5f, 0x6d, 0x03, 0x06, 0x37, 0xbd, 0xd7, 0xc7, 0x02, 0x5c, 0x92, 0xa1, 0x0a, 0x0e,
+  0x63, 0x30, 0x19, 0x08, 0xfe, 0x60, 0x97, 0x78, 0x6b, 0x68, 0xed, 0xf1, 0xba, 0xff, 0x7a, 0x86,
+  0xab, 0xa6, 0x05, 0xfb, 0xbe, 0xc7, 0x03, 0x51,
+};
+
+static uint8_t out_512[1000] = {
+  0x5b, 0xee, 0xee, 0xdf, 0xca, 0x28, 0x86, 0x08, 0x0d, 0xa1, 0x77, 0x21, 0xc8, 0xa2, 0xea, 0xc5,
+  0x59, 0x20, 0x16, 0x56, 0xcb, 0x0d, 0xe6, 0x71, 0xd7, 0x7b, 0x38, 0xe2, 0xde, 0x46, 0xee, 0xf0,
+  0x88, 0x4e, 0xb0, 0x44, 0x7f, 0x3a, 0x70, 0x7f, 0x22, 0xc7, 0x11, 0xe3, 0x5b, 0xcb, 0x6e, 0xe9,
+  0xba, 0x8a, 0x7f, 0x35, 0x17, 0x36, 0x61, 0xb0, 0x9b, 0x51, 0x15, 0x95, 0xa0, 0xef, 0xde, 0x73,
+  0x02, 0xf8, 0xce, 0x33, 0xa7, 0xe5, 0xc6, 0xc5, 0xd4, 0xf4, 0xed, 0xc6, 0xe2, 0x7c, 0x1c, 0x3d,
+  0xd1, 0xea, 0xe4, 0x0d, 0x6c, 0x70, 0x42, 0xd7, 0x71, 0x5e, 0x52, 0xda, 0xb8, 0x49, 0x18, 0xa6,
+  0x34, 0x91, 0x0c, 0x50, 0x29, 0xe7, 0x37, 0x68, 0xa0, 0x30, 0x99, 0xa7, 0xc8, 0xda, 0xb1, 0x90,
+  0xab, 0x87, 0x22, 0x68, 0xc4, 0x03, 0x74, 0x06, 0x33, 0x3b, 0x70, 0x8e, 0xe0, 0xcb, 0x60, 0x91,
+  0x72, 0x5c, 0xcf, 0x7b, 0x59, 0xbd, 0x01, 0x81, 0xa7, 0x69, 0x9b, 0xdf, 0x6f, 0x0e, 0xd5, 0xf8,
+  0xc5, 0xf1, 0xb5, 0xbb, 0xa0, 0xda, 0xf9, 0x8b, 0xd5, 0x19, 0xb2, 0xec, 0xb8, 0x5d, 0xf2, 0xff,
+  0xaf, 0x87, 0xb5, 0xf4, 0xcc, 0x32, 0xe9, 0xa2, 0x89, 0x77, 0x9b, 0xff, 0x5f, 0x9d, 0x3e, 0x06,
+  0x4c, 0xde, 0x08, 0x5a, 0x0f, 0x36, 0x21, 0x28, 0xd4, 0x75, 0x7b, 0x1f, 0x9e, 0xaa, 0x54, 0xa8,
+  0x82, 0xdf, 0xc0, 0x83, 0xdd, 0x08, 0x94, 0xed, 0x98, 0xa0, 0x28, 0x15, 0x2b, 0x60, 0x68, 0x28,
+  0xd8, 0xd3, 0xa4, 0xd4, 0x3f, 0x05, 0x7c, 0x0c, 0x8a, 0x48, 0x7e, 0x43, 0xb1, 0x25, 0xc9, 0x5c,
+  0x45, 0x2c, 0xa4, 0xaa, 0xf2, 0xe9, 0x12, 0x88, 0x13, 0xa0, 0xd4, 0x72, 0xc4, 0x13, 0x19, 0xdb,
+  0x51, 0xf8, 0xc9, 0xcb, 0xe0, 0xbc, 0x56, 0x94, 0xf7, 0x32, 0x49, 0x31, 0x98, 0x43, 0x8c, 0xfd,
+  0x50, 0xa2, 0x08, 0x2a, 0x1b, 0x8e, 0x2f, 0x91, 0xcd, 0x0f, 0xff, 0xe5, 0x5b, 0xed, 0xc2, 0x34,
+  0xa1, 0x58, 0xb7, 0x10, 0xd0, 0x37, 0x23, 0x74, 0x30, 0x5b, 0x42, 0x7b, 0xdc, 0x05, 0xcf, 0x7c,
+  0x86, 0xea, 0xff, 0x34, 0x42, 0xf3, 0x1c, 0x6d, 0x65, 0x14, 0x68, 0x72, 0x75, 0x1b, 0xdf, 0xf9,
+  0x0d, 0xe2, 0x4b, 0x8f, 0xa5, 0xad, 0x62, 0x06, 0xd9, 0x02, 0x9f, 0x94, 0xac, 0x33, 0x83, 0x1c,
+  0x76, 0x82, 0x40, 0x93, 0x84, 0xec, 0xa6, 0x0b, 0x78, 0xb6, 0x3b, 0x30, 0x4b, 0x7b, 0x9f, 0x11,
+  0x6d, 0x5b, 0x4c, 0xf2, 0x56, 0x09, 0xf9, 0xb7, 0x0c, 0x25, 0x69, 0x51, 0x5e, 0xfe, 0xd6, 0xa8,
+  0x6a, 0x43, 0xed, 0x7c, 0x51, 0x9c, 0x83, 0x3f, 0xc3, 0xdf, 0xd7, 0xe6, 0x1a, 0xdf, 0x8d, 0x00,
+  0xa7, 0x58, 0xe2, 0x91, 0x75, 0x2a, 0x15, 0x5b, 0x89, 0xf4, 0x41, 0x38, 0xfa, 0xf4, 0x8f, 0x03,
+  0x4e, 0x1f, 0x7c, 0xf6, 0xcc, 0x20, 0x80, 0xb1, 0x5c, 0xcd, 0xf6, 0xb9, 0xdc, 0x82, 0xce, 0x44,
+  0x7f, 0xe9, 0x78, 0x77, 0x01, 0x35, 0xce, 0x2b, 0xa1, 0xff, 0xbe, 0x6f, 0x17, 0x8c, 0xe7, 0x0c,
+  0xef, 0xf9, 0xfc, 0xee, 0x7a, 0xfd, 0x0e, 0x0d, 0xdc, 0xd4, 0xfd, 0x1b, 0x6b, 0xc3, 0xce, 0xd7,
+  0x80, 0x3c, 0x26, 0x0b, 0xe6, 0x80, 0xbf, 0x42, 0xe0, 0x60, 0x81, 0xd3, 0x9b, 0xb6, 0x8f, 0x5e,
+  0x24, 0xd9, 0x61, 0x70, 0x99, 0x73, 0x0b, 0xe8, 0x80, 0xf3, 0xad, 0x1b, 0x78, 0x44, 0xf4, 0x21,
+  0x5c, 0xd5, 0x52, 0xf6, 0x84, 0x34, 0x3f, 0x3c, 0x04, 0xce, 0x0a, 0x52, 0x4b, 0xc4, 0x02, 0xf9,
+  0x51, 0x2d, 0xbc, 0x8b, 0x72, 0xbd, 0xac, 0xc8, 0x07, 0xd7, 0xe4, 0x80, 0x8d, 0xde, 0x6c, 0x12,
+  0x23, 0x4e, 0xc4, 0x17, 0x4b, 0x7a, 0x24, 0xca, 0xda, 0x7f, 0xf8, 0xf8, 0x38, 0x26, 0x16, 0xde,
+  0xb4, 0x24, 0xce, 0x5b, 0x86, 0x66, 0xaa, 0x98, 0xcf, 0x57, 0xfc, 0x0f, 0x99, 0xfa, 0x96, 0xae,
+  0xaa, 0xe6, 0x81, 0x68, 0xb9, 0xd7, 0x80, 0xb1, 0xb8, 0x22, 0x5b, 0x19, 0xd4, 0xdb, 0x40, 0x97,
+  0x40, 0x0b, 0x8b, 0x99, 0x1f, 0x77, 0x9e, 0x8b, 0x55, 0x2e, 0xb0, 0x11, 0xde, 0x45, 0x88, 0x8d,
+  0x97, 0xd9, 0x65, 0xb4, 0xdf, 0x22, 0xb9, 0xf0, 0xde, 0x15, 0xd7, 0x9d, 0x4f, 0x41, 0x00, 0xb4,
+  0xf6, 0xfb, 0xc6, 0x74, 0x87, 0xfc, 0x8e, 0xbf, 0x1e, 0x0e, 0x92, 0x34, 0x4a, 0xff, 0xde, 0xa4,
+  0xc2, 0x1f, 0x32, 0x44, 0x4e, 0xc8, 0x62, 0x86, 0xdd, 0x64, 0x91, 0x5d, 0x21, 0x98, 0xc2, 0xc9,
+  0x53, 0xb3, 0x50, 0x4f, 0x00, 0x52, 0x25, 0xe0, 0xd5, 0x08, 0xda, 0xe7, 0x60, 0x9a, 0xf3, 0x42,
+  0x47, 0xb9, 0x9a, 0xa8, 0x24, 0xec, 0x45, 0x97, 0xba, 0xe0, 0x1b, 0x47, 0x80, 0x5a, 0x09, 0x9d,
+  0x41, 0xc1, 0x12, 0x3d, 0x85, 0x87, 0x5c, 0x99, 0xa1, 0x02, 0x6e, 0x8c, 0x1a, 0x14, 0x4f, 0x12,
+  0xf8, 0xfb, 0x0d, 0x42, 0x9a, 0x3d, 0xe6, 0x75, 0x9f, 0xa7, 0x92, 0x41, 0x43, 0x76, 0xd6, 0x7c,
+  0xf3, 0xd4, 0x84, 0x81, 0x12, 0x2b, 0x27, 0x21, 0xb0, 0x83, 0xf6, 0x0a, 0xd6, 0x73, 0xdb, 0x32,
+  0xe7, 0xcc, 0xa4, 0x95, 0xb7, 0x61, 0xee, 0xf5, 0xff, 0x35, 0xb8, 0x87, 0x88, 0xa2, 0xb9, 0xda,
+  0x97, 0x55, 0xfc, 0x0e, 0x90, 0x40, 0x84, 0xc5, 0x18, 0x56, 0x99, 0x53, 0x7a, 0xae, 0x30, 0x64,
+  0x81, 0x21, 0xc6, 0x98, 0xfc, 0xdb, 0x27, 0x98, 0xdd, 0x62, 0x0b, 0xb9, 0xab, 0x9f, 0xd2, 0xb9,
+  0x10, 0xd4, 0x95, 0x80, 0xc5, 0x69, 0x1f, 0x39, 0xe2, 0x0a, 0xf7, 0xde, 0x98, 0xac, 0x27, 0xeb,
+  0xd8, 0x54, 0xd2, 0xc2, 0xc9, 0xaa, 0x04, 0x49, 0x46, 0xf1, 0x82, 0xb9, 0x2d, 0x85, 0x66, 0xa4,
+  0x30, 0x6b, 0xb9, 0xde, 0x30, 0x0a, 0xae, 0xbc, 0x12, 0x7e, 0xcd, 0x35, 0x3f, 0x75, 0xd1, 0xc7,
+  0xc9, 0x78, 0xc8, 0xd2, 0xc9, 0x5b, 0x32, 0xd8, 0xeb, 0x8a, 0x60, 0x6a, 0xf4, 0x09, 0xbe, 0x31,
+  0x62, 0x36, 0x37, 0x62, 0x92, 0x3f, 0xc4, 0xcf, 0xd0, 0x91, 0x71, 0xd2, 0x48, 0x36, 0xf0, 0x9a,
+  0xcf, 0x4a, 0x0e, 0x5d, 0x73, 0x62, 0x06, 0x0a, 0x6b, 0x42, 0x19, 0x4e, 0x29, 0xa9, 0x73, 0x0b,
+  0x4d, 0x9c, 0x6f, 0xfe, 0x90, 0xb5, 0x52, 0x2d, 0x98, 0x17, 0x9c, 0xe2, 0x7e, 0xb5, 0xf5, 0xaf,
+  0xfa, 0xf8, 0x4d, 0x8a, 0x53, 0xd7, 0xfa, 0x9d, 0x8e, 0x35, 0x4a, 0xc1, 0x82, 0x79, 0xa0, 0xc5,
+  0xce, 0xb0, 0x3f, 0xb1, 0x3e, 0x4f, 0x6e, 0x23, 0x3f, 0xd2, 0x07, 0x36, 0x5e, 0xfd, 0x05, 0xe0,
+  0xc4, 0x9e, 0xfd, 0xeb, 0x0f, 0x1c, 0x8d, 0xc0, 0x4b, 0xad, 0x7a, 0xa9, 0xe2, 0x57, 0xaa, 0x86,
+  0x89, 0xa7, 0x64, 0x92, 0x01, 0x73, 0x0b, 0x3a, 0xfd, 0x61, 0xcc, 0x4c, 0x10, 0xa4, 0x4e, 0x68,
+  0x23, 0x5e, 0x6d, 0x01, 0x16, 0x80, 0x8c, 0xd1, 0x3e, 0x22, 0x4d, 0x2b, 0x5b, 0x05, 0xf9, 0x81,
+  0x33, 0x43, 0xbd, 0x0d, 0xec, 0x6b, 0xbb, 0x99, 0x11, 0xde, 0x54, 0x90, 0xdb, 0x2d, 0x20, 0x33,
+  0x47, 0x43, 0xa0, 0x59, 0x2c, 0xe0, 0x77, 0x58, 0x46, 0x2b, 0x93, 0xf9, 0x2d, 0xc9, 0x2a, 0xec,
+  0x50, 0x75, 0x2d, 0x64, 0x0a, 0x9e, 0xef, 0x8f, 0x87, 0xdd, 0x54, 0x95, 0x20, 0x08, 0x9c, 0x54,
+  0xf1, 0xac, 0x9d, 0x48, 0x30, 0x66, 0xcd, 0xc2, 0x48, 0x2f, 0xb9, 0xfe, 0x7a, 0xb2, 0xbf, 0xeb,
+  0x60, 0xa8, 0x69, 0xda, 0xfe, 0x98, 0x48, 0x6b,
+};
+
+// CTR_DRBG (AES-256, with derivation function) outputs, computed with the same reference:
+// second generate call, generate call after a reseed, and generate calls from counters
+// whose low 32 bits and whole 128 bits wrap around
+
+static uint8_t ctr_drbg_out1[1000] = {
+  0xc2, 0x32, 0x2d, 0x35, 0x71, 0xaa, 0x10, 0xa8, 0x18, 0xe4, 0x9f, 0x86, 0xd2, 0xf3, 0xfa, 0x2f,
+  0xcf, 0x7d, 0x72, 0x2a, 0xdf, 0x42, 0x5b, 0x66, 0x57, 0xf7, 0xcf, 0xcf, 0x0e, 0x2c, 0xd7, 0xf9,
+  0xbb, 0x1a, 0xf4, 0xfb, 0x4b, 0x33, 0x6c, 0xd1, 0x5d, 0x8b, 0x4b, 0x60, 0xc5, 0xcb, 0x3f, 0x07,
+  0x2d, 0x28, 0x90, 0xaa, 0x2e, 0x4a, 0xa2, 0x96, 0x4b, 0xbc, 0x17, 0x20, 0xb0, 0xa9, 0x5c, 0xaf,
+  0x6a, 0xd0, 0xda, 0x96, 0x50, 0x56, 0xe1, 0x50, 0x6f, 0x5a, 0xf5, 0x93, 0xd4, 0x49, 0xf1, 0x1a,
+  0x06, 0x4b, 0x3d, 0xd7, 0x9c, 0x1e, 0x53, 0x50, 0x53, 0x76, 0xb4, 0xdf, 0xaa, 0xcd, 0x08, 0x6a,
+  0x41, 0x48, 0x60, 0xb3, 0x91, 0x5c, 0x32, 0xb9, 0x3c, 0xa3, 0xd9, 0xa5, 0x0b, 0xf8, 0x80, 0xa0,
+  0xd2, 0x8d, 0xa3, 0x1a, 0x03, 0xdb, 0xa0, 0x71, 0x89, 0xf6, 0x55, 0xcd, 0xa1, 0x5a, 0x15, 0x6a,
+  0x9c, 0xdd, 0x35, 0x0a, 0xf7, 0x20, 0x88, 0x97, 0x1d, 0x4a, 0x9b, 0x00, 0xc3, 0x34, 0x85, 0xe6,
+  0xb9, 0x98, 0xf3, 0x0c, 0x43, 0xb0, 0xef, 0x26, 0x14, 0x60, 0x24, 0x14, 0xac, 0x5b, 0x80, 0xbb,
+  0x8a, 0x1c, 0x17, 0x21, 0xb1, 0xeb, 0x81, 0x7f, 0x83, 0xb5, 0xba, 0x77, 0xe1, 0xcb, 0xce, 0xb7,
+  0xfb, 0x00, 0x09, 0xa7, 0x8a, 0x89, 0x87, 0xb8, 0x69, 0x1d, 0x4a, 0x8d, 0x77, 0x3e, 0x2c, 0x2f,
+  0xc9, 0x92, 0xc1, 0xf1, 0x4a, 0xdd, 0x7b, 0xd6, 0xc5, 0x51, 0xcd, 0x50, 0x63, 0xf6, 0xe8, 0x0e,
+  0x57, 0x01, 0x59, 0xa6, 0x2b, 0xb3, 0xe1, 0x87, 0x42, 0x44, 0x4b, 0x22, 0x81, 0x7f, 0xa1, 0x5e,
+  0xf0, 0xb1, 0x66, 0x1a, 0xf5, 0xd8, 0xcc, 0x8c, 0x5d, 0x56, 0xe1, 0x3d, 0x56, 0x02, 0x53, 0x7f,
+  0x37, 0x57, 0x3b, 0x7e, 0x58, 0x56, 0x73, 0xdd, 0xff, 0xea, 0x7c, 0x8f, 0x76, 0xbd, 0x77, 0xeb,
+  0xfd, 0x99, 0xad, 0x94, 0xc0, 0xb9, 0x96, 0x3d, 0x68, 0x6c, 0xb8, 0x35, 0xd5, 0xd0, 0xe3, 0xd5,
+  0xfd, 0xb5, 0x20, 0x76, 0x48, 0xe7, 0xfe, 0x97, 0x1e, 0xfd, 0xaf, 0x61, 0xc1, 0x4f, 0xbd, 0x3f,
+  0xa7, 0x72, 0x0c, 0x02, 0x40, 0xdc, 0x61, 0xc8, 0x8e, 0x78, 0x84, 0x30, 0x36, 0x94, 0xc8, 0x96,
+  0xa1, 0x4e, 0x25, 0x08, 0xb0, 0xe7, 0xb3, 0x75, 0x77, 0x29, 0xb0, 0x73, 0xf1, 0x2f, 0xb0, 0x80,
+  0x9b, 0x5e, 0xf0, 0x47, 0xae, 0x46, 0x24, 0xb9, 0xaf, 0x78, 0xc1, 0x26, 0x0c, 0x01, 0xa7, 0xef,
+  0x85, 0x1f, 0x2b, 0xab, 0x79, 0x15, 0xc6, 0x6d, 0xdc, 0xe8, 0x9a, 0xf9, 0xc7, 0x1b, 0x20, 0xe5,
+  0x07, 0xba, 0x5b, 0xe8, 0x68, 0xc2, 0x50, 0x93, 0xe4, 0x0d, 0x30, 0xa5, 0xec, 0x36, 0x49, 0xe9,
+  0x2e, 0x83, 0xa6, 0x54, 0x7b, 0x47, 0x67, 0x1f, 0x50, 0x62, 0xfa, 0xf4, 0xf0, 0x13, 0xd6, 0x0b,
+  0x5e, 0x93, 0x65, 0x3e, 0x24, 0xb7, 0xc2, 0xad, 0x00, 0x47, 0xc4, 0x5e, 0x6e, 0xb4, 0xe2, 0x35,
+  0x4b, 0x59, 0x2d, 0xc6, 0x7b, 0x6b, 0x35, 0xa0, 0x15, 0x19, 0xd3, 0xd1, 0xc1, 0x13, 0x74, 0xfa,
+  0x47, 0x9e, 0xb7, 0x51, 0x13, 0x0e, 0xb5, 0xb4, 0x7b, 0x6a, 0x96, 0x34, 0x1a, 0x94, 0x12, 0xac,
+  0x9a, 0x27, 0x46, 0x60, 0xdc, 0x6c, 0xfb, 0x31, 0xd1, 0x39, 0xbe, 0x38, 0x18, 0x6d, 0x58, 0x92,
+  0xb1, 0x5a, 0xa3, 0xa0, 0x2e, 0x87, 0x56, 0xff, 0x4e, 0x08, 0xb4, 0x74, 0x38, 0x5c, 0x03, 0x0d,
+  0xe0, 0x9f, 0x0f, 0xa6, 0xa1, 0xd5, 0xea, 0xa4, 0x49, 0xaf, 0x22, 0x5f, 0x16, 0x65, 0x13, 0xa5,
+  0x1c, 0x5e, 0xa0, 0x5d, 0x7a, 0xaf, 0x0d, 0x58, 0x38, 0x6a, 0x49, 0x59, 0x92, 0x37, 0x27, 0x89,
+  0x35, 0xdd, 0x75, 0xe6, 0xe4, 0xf0, 0x06, 0x91, 0xf7, 0x9d, 0x61, 0xba, 0x98, 0xa1, 0x1b, 0x46,
+  0x84, 0xfa, 0x15, 0x4a, 0xf8, 0xa3, 0x10, 0xed, 0x20, 0x33, 0xc6, 0x49, 0xb4, 0x73, 0x4f, 0xf7,
+  0xca, 0x81, 0x87, 0xc0, 0xd5, 0xb4, 0xdd, 0xcc, 0xa7, 0xca, 0xae, 0xec, 0xaf, 0xe6, 0x8f, 0xd8,
+  0x52, 0xc4, 0x94, 0xea, 0xda, 0x00, 0x10, 0xa7, 0xc8, 0xf2, 0x92, 0x20, 0xef, 0x13, 0xcc, 0xfd,
+  0xfa, 0xe9, 0x8d, 0x78, 0x5a, 0x50, 0x4e, 0x00, 0x69, 0xd2, 0xaf, 0xa8, 0x1d, 0x10, 0x46, 0xd9,
+  0xaf, 0xe8, 0xfc, 0xa5, 0x97, 0xb9, 0xea, 0xf7, 0x2b, 0x56, 0x5c, 0xba, 0x13, 0x5c, 0x7a, 0x11,
+  0x29, 0xd5, 0x47, 0x9c, 0xda, 0x2f, 0x96, 0x55, 0x0a, 0x2b, 0x30, 0x47, 0x5d, 0x21, 0xb6, 0x07,
+  0x6f, 0x5c, 0xa1, 0x07, 0x46, 0xd5, 0x3f, 0x80, 0xa1, 0x4d, 0xb8, 0xf7, 0x5d, 0x5e, 0x35, 0xbb,
+  0xe6, 0x85, 0x0c, 0xe0, 0x79, 0xb0, 0x92, 0x8b, 0xc9, 0x07, 0x2b, 0x0c, 0x81, 0x04, 0x01, 0x75,
+  0xe9, 0x03, 0xa1, 0xc1, 0xd6, 0xb8, 0x63, 0x33, 0x9b, 0x35, 0x01, 0xe6, 0xf0, 0x65, 0x5a, 0x0c,
+  0xad, 0x01, 0x99, 0x04, 0xf8, 0xd4, 0xa6, 0x08, 0xe6, 0xba, 0x23, 0x4e, 0xc2, 0xe4, 0x89, 0x46,
+  0xda, 0x85, 0x3f, 0x38, 0x80, 0x59, 0x3c, 0x4a, 0xf6, 0xb6, 0x75, 0xbd, 0x50, 0xf0, 0x47, 0x9d,
+  0x62, 0xa1, 0x33, 0xad, 0x19, 0xfe, 0xac, 0x97, 0x03, 0xf5, 0xd9, 0xd6, 0x3b, 0x05, 0x98, 0x6e,
+  0x8d, 0x10, 0x3d, 0x51, 0x1c, 0x46, 0x95, 0x49, 0x12, 0x24, 0x13, 0xb0, 0xb6, 0xcc, 0x32, 0xca,
+  0xe3, 0xdf, 0xf0, 0xff, 0x6c, 0x01, 0xdd, 0xcf, 0x56, 0x2d, 0xfa, 0x22, 0x38, 0xd8, 0x4e, 0x28,
+  0xe7, 0xbd, 0xe5, 0x02, 0x4a, 0x32, 0xb5, 0x1a, 0x8b, 0xd4, 0xa6, 0xa0, 0x04, 0x66, 0xcb, 0xca,
+  0x54, 0x85, 0x7f, 0x18, 0x88, 0xc5, 0x9a, 0xf3, 0xb0, 0x18, 0x2d, 0x02, 0xec, 0xa9, 0xfa, 0x8d,
+  0x6e, 0xb4, 0x7d, 0x2b, 0xa0, 0x9d, 0xa4, 0xd0, 0x45, 0x3f, 0x39, 0x9d, 0x25, 0x3b, 0xc2, 0x1b,
+  0x87, 0x39, 0x18, 0x50, 0xd1, 0x32, 0xe7, 0xbc, 0x7f, 0x38, 0x74, 0xb9, 0x13, 0x33, 0x24, 0x39,
+  0x73, 0x01, 0xed, 0xa2, 0x15, 0xb4, 0xef, 0xb2, 0xf4, 0xc9, 0x4c, 0x5b, 0xa5, 0xe9, 0x6f, 0x45,
+  0xa0, 0x44, 0x3f, 0x0c, 0xaf, 0x0c, 0x19, 0x88, 0xa4, 0xcb, 0x75, 0x21, 0xe3, 0x51, 0x75, 0x44,
+  0x18, 0x04, 0x93, 0xe8, 0xf3, 0x22, 0xe1, 0x9d, 0xf5, 0x9f, 0x12, 0x23, 0xec, 0xfc, 0x1e, 0xeb,
+  0x4c, 0x4a, 0x5e, 0xbd, 0x99, 0xd4, 0xce, 0xed, 0x25, 0x01, 0xa4, 0x7c, 0x7b, 0x59, 0x4a, 0x97,
+  0xff, 0xcd, 0x4e, 0x3c, 0x02, 0xd2, 0x91, 0x72, 0x20, 0x35, 0xc0, 0x0f, 0x75, 0x49, 0xff, 0x16,
+  0x21, 0x07, 0x48, 0x95, 0x22, 0x63, 0xf9, 0x08, 0xd5, 0x95, 0x96, 0xf4, 0x02, 0x3b, 0xd0, 0x19,
+  0x34, 0x4a, 0x1b, 0x68, 0x52, 0x50, 0xba, 0xf1, 0xbe, 0xca, 0x12, 0x36, 0xe5, 0xb2, 0x91, 0x0d,
+  0x74, 0xa4, 0x1c, 0x0c, 0x99, 0x2f, 0xdc, 0xa6, 0xb9, 0xf1, 0x72, 0x1a, 0xe2, 0xa6, 0x36, 0xca,
+  0xf1, 0xc6, 0x44, 0x8e, 0xe6, 0x25, 0x8c, 0x35, 0xb8, 0xe6, 0xe2, 0xda, 0x73, 0x75, 0xd1, 0x4b,
+  0xc5, 0x78, 0xd1, 0xc3, 0xd8, 0xef, 0x1a, 0x8b, 0xd5, 0xa6, 0x38, 0x50, 0x66, 0x01, 0x07, 0x14,
+  0xde, 0xb2, 0xce, 0xb9, 0x71, 0xd2, 0x63, 0xd1, 0xfd, 0xdd, 0xff, 0xdc, 0x70, 0x2b, 0x09, 0x5f,
+  0xdd, 0xae, 0xf8, 0x83, 0x52, 0x27, 0x47, 0x21, 0x9f, 0x75, 0x81, 0x6b, 0xf6, 0x10, 0xf5, 0xb2,
+  0xc9, 0x97, 0x6b, 0xfe, 0x41, 0x09, 0xf9, 0x49,
+};
+
+static uint8_t ctr_drbg_out2[1000] = {
+  0xd2, 0x67, 0xaa, 0xcf, 0x74, 0x04, 0xfa, 0x84, 0xde, 0x7f, 0xb1, 0x0c, 0xc7, 0x40, 0x14, 0xf1,
+  0xff, 0x2c, 0xcf, 0x7a, 0xf7, 0xe0, 0xb2, 0x00, 0x4d, 0x4f, 0x97, 0x4e, 0xdd, 0x06, 0x92, 0x55,
+  0x10, 0xe0, 0xf7, 0x84, 0xbd, 0xeb, 0x37, 0xf0, 0x12, 0x8b, 0x1d, 0xb6, 0x37, 0x90, 0x09, 0x0a,
+  0x27, 0xda, 0x88, 0xf4, 0xd9, 0xf8, 0x1a, 0xd7, 0xcf, 0xf9, 0xca, 0x0a, 0x0e, 0x7c, 0x05, 0x55,
+  0x44, 0x87, 0x8b, 0x5e, 0xaf, 0xdb, 0x4c, 0x5c, 0x2a, 0xbf, 0xd9, 0x72, 0xa7, 0x69, 0x2d, 0xcb,
+  0xe1, 0x16, 0x2c, 0x6e, 0x54, 0x55, 0xa4, 0x1a, 0x9c, 0xcb, 0x3c, 0xbd, 0x98, 0x9a, 0x37, 0xab,
+  0xbf, 0xb3, 0x55, 0x3b, 0x88, 0x95, 0xcb, 0x62, 0x18, 0xad, 0xae, 0x02, 0xdd, 0x29, 0x65, 0x4a,
+  0x13, 0x81, 0xf7, 0xaa, 0x5b, 0x2e, 0xff, 0xb9, 0x2a, 0x90, 0x7b, 0xc9, 0x11, 0x72, 0xbc, 0xa3,
+  0x90, 0x5e, 0x6a, 0xa3, 0x44, 0x90, 0xa7, 0x02, 0x7e, 0x00, 0xaa, 0xf6, 0xf5, 0x02, 0x1d, 0xe0,
+  0xc4, 0xbc, 0xa4, 0xd1, 0xb8, 0x21, 0xf4, 0xed, 0x80, 0x6c, 0xe8, 0xd6, 0xf3, 0xab, 0xce, 0xaa,
+  0xaa, 0xbd, 0xcc, 0x08, 0x22, 0xb9, 0xdf, 0xba, 0x8a, 0xf7, 0x9d, 0xb5, 0xc4, 0x4a, 0xc5, 0xd5,
+  0xf5, 0x2e, 0x2d, 0x10, 0xb3, 0xdd, 0xbd, 0xa0, 0xf1, 0x8d, 0x51, 0x46, 0x06, 0x53, 0x46, 0x8d,
+  0x8c, 0x23, 0x7c, 0x63, 0x82, 0x5f, 0xd1, 0x92, 0xf9, 0x17, 0xbd, 0x28, 0x91, 0x26, 0x0b, 0x1b,
+  0xcc, 0x29, 0x35, 0x1a, 0xb4, 0x22, 0xce, 0x96, 0x40, 0x4d, 0xbc, 0xc1, 0x0c, 0x5c, 0xac, 0x5c,
+  0x8f, 0x99, 0xf0, 0x51, 0x86, 0x53, 0x4d, 0xb7, 0xc1, 0x95, 0xad, 0x7b, 0x07, 0x02, 0xce, 0xd1,
+  0x46, 0xf7, 0x90, 0x57, 0x50, 0x20, 0x78, 0x7e, 0x00, 0x3a, 0x2b, 0x69, 0xa4, 0xb6, 0x96, 0x34,
+  0x78, 0x80, 0x62, 0xd3, 0x7a, 0x95, 0x2b, 0x1b, 0x48, 0xc7, 0x61, 0x4a, 0xbc, 0xed, 0x93, 0x47,
+  0xc4, 0xd6, 0x07, 0x3a, 0x31, 0xfa, 0xbb, 0x38, 0x02, 0xc4, 0xcf, 0x7b, 0xc6, 0x25, 0x94, 0xfc,
+  0x70, 0xd3, 0x23, 0xc8, 0x71, 0xcc, 0x83, 0x52, 0x45, 0x4c, 0xc6, 0xa2, 0xd6, 0xa3, 0x17, 0x19,
+  0x85, 0xfd, 0x68, 0xd4, 0xfd, 0x1f, 0xe9, 0x96, 0xd3, 0xd6, 0xd3, 0x75, 0x70, 0x66, 0x30, 0xcc,
+  0xef, 0xdf, 0xbc, 0x65, 0x9a, 0x42, 0x83, 0xd1, 0x0d, 0xd9, 0x8f, 0x6f, 0x38, 0xf6, 0x93, 0xeb,
+  0xaa, 0xda, 0x6c, 0x0f, 0x49, 0x67, 0xeb, 0xf7, 0x5c, 0x64, 0x8f, 0xae, 0xa3, 0x94, 0x86, 0xe1,
+  0xf2, 0x05, 0xa3, 0x93, 0xc8, 0xaf, 0x00, 0x78, 0x35, 0x42, 0x85, 0xb4, 0x18, 0xf7, 0x56, 0x68,
+  0x37, 0xf7, 0xdc, 0x36, 0x38, 0x8f, 0xb0, 0xb6, 0x6a, 0xa5, 0xfc, 0x8c, 0x7e, 0x33, 0x86, 0x06,
+  0xb6, 0xda, 0x3f, 0xe6, 0xf8, 0xe5, 0x99, 0x2f, 0x64, 0xdc, 0xa3, 0x6d, 0x1f, 0x7b, 0x36, 0xbc,
+  0x51, 0x4b, 0x4e, 0x36, 0x8b, 0x0a, 0xf7, 0x2f, 0x51, 0xd8, 0xaf, 0x59, 0xeb, 0xb1, 0x23, 0x15,
+  0x48, 0x2f, 0x85, 0x19, 0x2e, 0xe9, 0x07, 0x90, 0xbb, 0x62, 0x31, 0xa1, 0xe4, 0xf9, 0xa9, 0xed,
+  0x18, 0x51, 0xd2, 0x90, 0x3b, 0xfa, 0xca, 0xfb, 0x06, 0x3e, 0x7c, 0x7e, 0x42, 0xfb, 0x44, 0xc2,
+  0xa5, 0xcf, 0xd7, 0x20, 0x97, 0x87, 0x18, 0x6f, 0x96, 0xd5, 0x7b, 0x35, 0x61, 0x41, 0xdd, 0x31,
+  0xc1, 0x7b, 0x4d, 0x31, 0xa2, 0x35, 0x57, 0x15, 0x02, 0x72, 0xa8, 0xc0, 0x8f, 0x0a, 0x57, 0x3b,
+  0x92, 0xcd, 0x1c, 0x1b, 0x72, 0xf5, 0xbb, 0xd4, 0xd2, 0x7c, 0x4f, 0x77, 0xd4, 0xee, 0x8b, 0xb0,
+  0x84, 0x72, 0x9f, 0x6b, 0xe7, 0xaf, 0x77, 0xef, 0x3b, 0xce, 0xfb, 0xe9, 0x6d, 0xd2, 0xfc, 0x72,
+  0xd3, 0x5a, 0x9d, 0xf7, 0xab, 0x7d, 0x22, 0xf3, 0xc3, 0x8d, 0x3d, 0x2a, 0x49, 0x47, 0x91, 0x28,
+  0x6f, 0x6b, 0xf4, 0x43, 0x23, 0x52, 0x40, 0x73, 0x24, 0x43, 0xba, 0xda, 0xcc, 0xff, 0x30, 0x12,
+  0x3f, 0xa4, 0x3f, 0x71, 0x52, 0x0e, 0x74, 0x59, 0xa5, 0xe6, 0x86, 0xfc, 0xd1, 0xde, 0xf2, 0x64,
+  0xcc, 0xdc, 0x2b, 0x1e, 0x1c, 0x49, 0xbf, 0xa4, 0x25, 0xf0, 0x8b, 0xd5, 0x6f, 0xab, 0x2f, 0xfb,
+  0xc6, 0x26, 0x6a, 0x61, 0xb8, 0x87, 0xb5, 0x47, 0xc6, 0xfe, 0x56, 0xd9, 0x70, 0xa1, 0xb9, 0x1a,
+  0xf5, 0x67, 0x23, 0x57, 0xf5, 0x84, 0x5e, 0xf6, 0xae, 0xc2, 0xd0, 0x6a, 0xa7, 0x19, 0xf5, 0x34,
+  0x91, 0x26, 0xd3, 0xf9, 0xf3, 0xb3, 0xff, 0xd4, 0xc1, 0x78, 0x81, 0x53, 0x19, 0x4e, 0x7e, 0xc8,
+  0x07, 0x82, 0x13, 0xd2, 0x9b, 0xae, 0x8b, 0x61, 0x6e, 0x4c, 0x70, 0x4e, 0xd7, 0xca, 0xfe, 0x08,
+  0xaf, 0xd4, 0x41, 0x36, 0x92, 0xf9, 0x55, 0x10, 0x87, 0xce, 0x5d, 0x6b, 0x1d, 0x9b, 0x25, 0xd6,
+  0x14, 0x67, 0xd2, 0xa3, 0xa6, 0x15, 0x81, 0x93, 0x0c, 0x7a, 0xeb, 0xa4, 0x4f, 0x11, 0xca, 0x9c,
+  0xe2, 0x22, 0xee, 0x36, 0x2d, 0xf4, 0x18, 0xd7, 0x4a, 0xcf, 0x94, 0xdd, 0x5b, 0x65, 0x26, 0xa2,
+  0x57, 0xff, 0x06, 0x22, 0xc3, 0x63, 0x48, 0xfe, 0x44, 0xae, 0xa7, 0x72, 0xfe, 0x30, 0x8d, 0x53,
+  0xe7, 0xb1, 0xce, 0x15, 0xd5, 0xc2, 0x74, 0xce, 0x1c, 0x4f, 0x51, 0x90, 0x2b, 0x4a, 0x57, 0x0d,
+  0x42, 0xd3, 0x82, 0x4c, 0x58, 0x04, 0x3d, 0x78, 0x52, 0x2b, 0x65, 0xbd, 0xa3, 0x65, 0x64, 0xce,
+  0xb5, 0x85, 0xf1, 0x66, 0x83, 0x94, 0xb4, 0xaa, 0xf3, 0x05, 0x44, 0x5f, 0x00, 0x89, 0x74, 0xf3,
+  0xb2, 0x58, 0xec, 0x55, 0xaf, 0xf8, 0x8d, 0x6c, 0xbf, 0x50, 0xfc, 0x2a, 0x1a, 0x9c, 0x8c, 0x60,
+  0x03, 0x8a, 0x8f, 0x91, 0x88, 0xbd, 0x41, 0x23, 0x13, 0xd9, 0xeb, 0x5b, 0x71, 0x81, 0x2f, 0x58,
+  0xc0, 0x99, 0xef, 0xba, 0x89, 0x9c, 0xb9, 0xca, 0x4d, 0xd4, 0x53, 0xbe, 0xb3, 0x1d, 0x6e, 0xd3,
+  0x70, 0x04, 0xbe, 0xe0, 0x07, 0x76, 0x86, 0x03, 0xcb, 0x87, 0x2a, 0x8d, 0x3f, 0xc7, 0x27, 0x41,
+  0xab, 0x13, 0x97, 0x68, 0xe4, 0x9f, 0xcb, 0xad, 0xed, 0x36, 0x45, 0xe7, 0x1f, 0x16, 0x4c, 0x5a,
+  0xe1, 0xde, 0xdf, 0x16, 0x21, 0xab, 0x38, 0xa0, 0xf1, 0x2a, 0x25, 0x2c, 0x7f, 0xc6, 0xc3, 0xc0,
+  0x79, 0xc6, 0x13, 0xf9, 0x63, 0x35, 0x47, 0xe1, 0x5c, 0xc5, 0xaa, 0xde, 0x3e, 0xe5, 0xca, 0xac,
+  0x48, 0x29, 0x46, 0xc6, 0xc7, 0x2b, 0xc8, 0x6d, 0x79, 0x31, 0xd2, 0x96, 0x20, 0x2c, 0x43, 0x5f,
+  0x94, 0x45, 0x5a, 0xf5, 0xe4, 0x8a, 0xab, 0x9b, 0x02, 0x15, 0x16, 0xc6, 0x63, 0x42, 0x6a, 0x27,
+  0xf1, 0x97, 0x96, 0x71, 0x3f, 0x26, 0xd1, 0xf7, 0x65, 0xa2, 0x28, 0x38, 0x4d, 0x8d, 0xe4, 0x0c,
+  0x6a, 0xe0, 0xe2, 0x4d, 0x0e, 0xc7, 0x1e, 0x8a, 0x89, 0xfc, 0x99, 0x13, 0x11, 0xa9, 0xbc, 0x79,
+  0xda, 0xb5, 0x99, 0x89, 0x7d, 0x8d, 0x75, 0xa6, 0x7d, 0x07, 0x33, 0xa9, 0xa2, 0xcf, 0xeb, 0xeb,
+  0xe5, 0xd7, 0xff, 0xfd, 0x91, 0xec, 0xf6, 0x26, 0xfa, 0xa7, 0xaf, 0xcc, 0x5c, 0xc8, 0x30, 0x12,
+  0x09, 0x76, 0x06, 0x22, 0xe2, 0x59, 0x12, 0xc9, 0xb7, 0x29, 0x60, 0xe6, 0x7c, 0x64, 0x49, 0x19,
+  0x4a, 0x69, 0x31, 0x8f, 0xf7, 0xc2, 0x11, 0xff, 0xa7, 0x1c, 0x26, 0x2d, 0x15, 0xf3, 0xfb, 0x12,
+  0x5e, 0x08, 0x49, 0x00, 0xd3, 0xa7, 0x30, 0x2a,
+};
+
+static uint8_t ctr_drbg_out3[100] = {
+  0xd9, 0xb9, 0x6d, 0x98, 0x26, 0xd5, 0xd3, 0x91, 0x8c, 0xb0, 0xa5, 0xdc, 0x20, 0xc9, 0xf7, 0x85,
+  0xe2, 0xb1, 0xe5, 0xa4, 0x0e, 0xd6, 0xc0, 0x6a, 0x8a, 0xaa, 0xfd, 0x57, 0x8e, 0x24, 0x2e, 0xaf,
+  0x7e, 0x5e, 0x9b, 0x40, 0x63, 0xbf, 0x05, 0xc4, 0xfd, 0xdc, 0x95, 0x42, 0xc0, 0x82, 0xbc, 0x76,
+  0x24, 0xe0, 0x66, 0x40, 0x2f, 0x20, 0xdc, 0x22, 0x5c, 0x8b, 0x1e, 0x7f, 0xbd, 0x0f, 0x18, 0x80,
+  0xe4, 0xf3, 0xf9, 0xeb, 0x06, 0xc6, 0xa6, 0x19, 0x49, 0x42, 0x8e, 0xbb, 0xf2, 0xf7, 0x0f, 0xe9,
+  0x78, 0xf2, 0x66, 0xe2, 0x6f, 0x4e, 0x67, 0x66, 0xf8, 0xc9, 0xc9, 0x05, 0x04, 0xb4, 0xfb, 0x0a,
+  0xcf, 0x84, 0x7c, 0x55,
+};
+
+static uint8_t ctr_drbg_out4[100] = {
+  0x21, 0xce, 0xee, 0x26, 0x68, 0xf8, 0x58, 0x5f, 0x77, 0x32, 0x85, 0x56, 0x42, 0x43, 0x28, 0xab,
+  0x34, 0x66, 0x1a, 0xe1, 0xed, 0x75, 0xae, 0x13, 0x54, 0x4a, 0x92, 0xa1, 0x68, 0x59, 0x9e, 0x4d,
+  0x44, 0x79, 0x13, 0x92, 0x2b, 0xfa, 0xee, 0x30, 0xa6, 0x38, 0x61, 0x0e, 0xc0, 0xfe, 0xdb, 0xf7,
+  0x3e, 0xed, 0xdf, 0xdf, 0x12, 0xdf, 0xd9, 0x6e, 0xb8, 0x33, 0xe5, 0x1a, 0x82, 0x55, 0x41, 0xf1,
+  0x4c, 0x3d, 0x2f, 0x37, 0xc5, 0x30, 0x26, 0x7c, 0x88, 0x61, 0x9c, 0x74, 0xd2, 0x20, 0x36, 0xcf,
+  0x42, 0x7a, 0xba, 0xe2, 0xd9, 0x0d, 0x23, 0x85, 0x8c, 0x02, 0x7a, 0x9a, 0x1e, 0xfb, 0x48, 0x9f,
+  0x74, 0x36, 0xdd, 0x05,
+};
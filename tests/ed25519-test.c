@@ -14,6 +14,7 @@
 #include "test_helpers.h"
 
 #define ROUNDS 32768
+#define BATCH 64
 
 static uint8_t msg3[2U] = { (uint8_t)0xafU, (uint8_t)0x82U };
 
@@ -61,6 +62,78 @@ int main() {
   Hacl_Ed25519_sign_expanded(signature1, expanded_keys, 2ul, msg3);
   ok &= compare(64U, signature1, sig3);
 
+  uint8_t batch_pk[BATCH][32U];
+  uint8_t batch_msg[BATCH][16U];
+  uint8_t batch_sig[BATCH][64U];
+  uint8_t *pks[BATCH];
+  uint8_t *msgs[BATCH];
+  uint8_t *sigs[BATCH];
+  uint32_t msg_lens[BATCH];
+  bool results[BATCH];
+  for (int j = 0; j < BATCH; j++) {
+    uint8_t sk[32U];
+    memcpy(sk, sk3, 32U);
+    sk[0U] = (uint8_t)j;
+    memset(batch_msg[j], j, 16U);
+    Hacl_Ed25519_secret_to_public(batch_pk[j], sk);
+    Hacl_Ed25519_sign(batch_sig[j], sk, 16U, batch_msg[j]);
+    pks[j] = batch_pk[j];
+    msgs[j] = batch_msg[j];
+    sigs[j] = batch_sig[j];
+    msg_lens[j] = 16U;
+  }
+  bool batch_ok = Hacl_Ed25519_verify_batch(BATCH, pks, msg_lens, msgs, sigs, results);
+  for (int j = 0; j < BATCH; j++)
+    batch_ok &= results[j];
+  batch_msg[17U][3U] ^= 1U;
+  bool batch_bad = Hacl_Ed25519_verify_batch(BATCH, pks, msg_lens, msgs, sigs, results);
+  batch_ok &= !batch_bad && !results[17U];
+  for (int j = 0; j < BATCH; j++)
+    if (j != 17)
+      batch_ok &= results[j];
+  batch_msg[17U][3U] ^= 1U;
+
+  // A public key with an order-2 component: adding T = (0, -1) maps (x, y) to
+  // (-x, -y), i.e. y is replaced by p - y and the sign bit is flipped. Signing with
+  // the original secret under this key yields a signature that only the cofactored
+  // equation accepts, whenever the challenge h is odd; its result must not depend on
+  // the rest of the batch.
+  uint8_t torsion_keys[96U];
+  uint8_t torsion_msg[16U];
+  uint8_t torsion_sig[64U];
+  Hacl_Ed25519_expand_keys(torsion_keys, sk3);
+  uint16_t borrow = 0U;
+  for (int k = 0; k < 32; k++) {
+    uint16_t pk = k == 0 ? 0xedU : (k == 31 ? 0x7fU : 0xffU);
+    uint16_t yk = k == 31 ? (torsion_keys[k] & 0x7fU) : torsion_keys[k];
+    uint16_t d = pk - yk - borrow;
+    borrow = (d >> 8) & 1U;
+    torsion_keys[k] = (uint8_t)d | (k == 31 ? (torsion_keys[31U] & 0x80U) ^ 0x80U : 0U);
+  }
+  memset(torsion_msg, 0, 16U);
+  do {
+    torsion_msg[0U]++;
+    Hacl_Ed25519_sign_expanded(torsion_sig, torsion_keys, 16U, torsion_msg);
+  } while (Hacl_Ed25519_verify(torsion_keys, 16U, torsion_msg, torsion_sig));
+  pks[5U] = torsion_keys;
+  msgs[5U] = torsion_msg;
+  sigs[5U] = torsion_sig;
+  bool torsion_alone = Hacl_Ed25519_verify_batch(1U, pks + 5U, msg_lens + 5U, msgs + 5U, sigs + 5U, results);
+  batch_ok &= torsion_alone && results[0U];
+  batch_ok &= Hacl_Ed25519_verify_batch(BATCH, pks, msg_lens, msgs, sigs, results) && results[5U];
+  batch_msg[17U][3U] ^= 1U;
+  batch_ok &= !Hacl_Ed25519_verify_batch(BATCH, pks, msg_lens, msgs, sigs, results);
+  batch_ok &= results[5U] && !results[17U];
+  batch_msg[17U][3U] ^= 1U;
+  pks[5U] = batch_pk[5U];
+  msgs[5U] = batch_msg[5U];
+  sigs[5U] = batch_sig[5U];
+  if (batch_ok)
+    printf("Batch verification: Success!\n");
+  else
+    printf("Batch verification: **FAILED**\n");
+  ok &= batch_ok;
+
   if (ok)
     printf ("\n Success :) \n");
   else
@@ -114,6 +187,17 @@ int main() {
   double diff3 = t2 - t1;
   uint64_t cyc3 = b - a;
 
+  // Benchmarking for batch verifying (HACL)
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / BATCH; j++) {
+    b1 &= Hacl_Ed25519_verify_batch(BATCH, pks, msg_lens, msgs, sigs, results);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double diff4 = t2 - t1;
+  uint64_t cyc4 = b - a;
+
   uint64_t count = ROUNDS;
   printf("\n Ed25519 Signing:\n");
   print_time(count,diff1,cyc1);
@@ -121,6 +205,8 @@ int main() {
   print_time(count,diff2,cyc2);
   printf("\n Ed25519 Signing with expanded keys:\n");
   print_time(count,diff3,cyc3);
+  printf("\n Ed25519 Verifying in batches of %d:\n", BATCH);
+  print_time(count,diff4,cyc4);
 
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
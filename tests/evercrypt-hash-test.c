@@ -0,0 +1,164 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+#include <openssl/sha.h>
+
+#include "test_helpers.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Hash.h"
+#include "Hacl_Hash_Blake2.h"
+
+#define ROUNDS 16384
+#define SIZE   16384
+
+static Spec_Hash_Definitions_hash_alg algs[3] = {
+  Spec_Hash_Definitions_SHA1, Spec_Hash_Definitions_SHA2_384, Spec_Hash_Definitions_SHA2_512
+};
+
+static uint8_t input[SIZE];
+
+void ossl_hash(Spec_Hash_Definitions_hash_alg a, uint8_t *dst, uint8_t *src, size_t len)
+{
+  if (a == Spec_Hash_Definitions_SHA1)
+    SHA1(src, len, dst);
+  else if (a == Spec_Hash_Definitions_SHA2_384)
+    SHA384(src, len, dst);
+  else
+    SHA512(src, len, dst);
+}
+
+// The one-shot and incremental functions agree with OpenSSL over lengths around the block
+// boundaries, the incremental one being fed in chunks of several sizes
+bool test_alg(Spec_Hash_Definitions_hash_alg a)
+{
+  bool ok = true;
+  uint8_t expected[64], tag[64];
+  uint32_t hash_len = EverCrypt_Hash_Incremental_hash_len(a);
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s =
+    EverCrypt_Hash_Incremental_create_in(a);
+  for (uint32_t len = 0; len <= SIZE; len += len < 600 ? 1 : 4093) {
+    ossl_hash(a, expected, input, len);
+    EverCrypt_Hash_hash(a, tag, input, len);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+    uint32_t chunks[3] = { 17, 128, 1000 };
+    for (int c = 0; c < 3; c++) {
+      EverCrypt_Hash_Incremental_init(s);
+      for (uint32_t off = 0; off < len; off += chunks[c])
+        EverCrypt_Hash_Incremental_update(s, input + off,
+                                          len - off < chunks[c] ? len - off : chunks[c]);
+      EverCrypt_Hash_Incremental_finish(s, tag);
+      ok &= memcmp(tag, expected, hash_len) == 0;
+    }
+  }
+  EverCrypt_Hash_Incremental_free(s);
+  if (!ok)
+    printf("%s: Failure\n", EverCrypt_Hash_string_of_alg(a));
+  return ok;
+}
+
+// BLAKE2 agrees with the portable implementation, one-shot and through the incremental
+// state s, which may have been created under other CPU features
+bool test_blake2(Spec_Hash_Definitions_hash_alg a,
+                 Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s)
+{
+  bool ok = true;
+  uint8_t expected[64], tag[64];
+  uint32_t hash_len = EverCrypt_Hash_Incremental_hash_len(a);
+  for (uint32_t len = 0; len <= 1000; len += 37) {
+    if (a == Spec_Hash_Definitions_Blake2S)
+      Hacl_Blake2s_32_blake2s(hash_len, expected, len, input, 0, NULL);
+    else
+      Hacl_Blake2b_32_blake2b(hash_len, expected, len, input, 0, NULL);
+    EverCrypt_Hash_hash(a, tag, input, len);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+    EverCrypt_Hash_Incremental_init(s);
+    EverCrypt_Hash_Incremental_update(s, input, len);
+    EverCrypt_Hash_Incremental_finish(s, tag);
+    ok &= memcmp(tag, expected, hash_len) == 0;
+  }
+  if (!ok)
+    printf("%s: Failure\n", EverCrypt_Hash_string_of_alg(a));
+  return ok;
+}
+
+void bench(const char *name, Spec_Hash_Definitions_hash_alg a)
+{
+  uint8_t tag[64];
+  cycles c0, c1;
+  clock_t t1, t2;
+  t1 = clock();
+  c0 = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_Hash_hash(a, tag, input, SIZE);
+  c1 = cpucycles_end();
+  t2 = clock();
+  printf("\n %s %s:\n", EverCrypt_Hash_string_of_alg(a), name);
+  print_time((uint64_t)SIZE * ROUNDS, t2 - t1, c1 - c0);
+}
+
+int main()
+{
+  EverCrypt_AutoConfig2_init();
+  for (int i = 0; i < SIZE; i++)
+    input[i] = (uint8_t)(i * 7 + 3);
+
+  bool ok = true;
+  for (int k = 0; k < 3; k++)
+    ok &= test_alg(algs[k]);
+  Spec_Hash_Definitions_hash_alg blake2[2] = {
+    Spec_Hash_Definitions_Blake2S, Spec_Hash_Definitions_Blake2B
+  };
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *b2[2];
+  for (int k = 0; k < 2; k++) {
+    b2[k] = EverCrypt_Hash_Incremental_create_in(blake2[k]);
+    ok &= test_blake2(blake2[k], b2[k]);
+  }
+
+  // Benchmarking the dispatched implementations first, then the portable ones
+  for (int k = 0; k < 3; k++)
+    bench("(dispatched)", algs[k]);
+  EverCrypt_AutoConfig2_disable_shaext();
+  EverCrypt_AutoConfig2_disable_avx2();
+  EverCrypt_AutoConfig2_disable_avx();
+  for (int k = 0; k < 3; k++)
+    ok &= test_alg(algs[k]);
+  for (int k = 0; k < 2; k++) {
+    Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s =
+      EverCrypt_Hash_Incremental_create_in(blake2[k]);
+    ok &= test_blake2(blake2[k], s);
+    ok &= test_blake2(blake2[k], b2[k]);
+    EverCrypt_Hash_Incremental_free(s);
+    EverCrypt_Hash_Incremental_free(b2[k]);
+  }
+  for (int k = 0; k < 3; k++)
+    bench("(portable)", algs[k]);
+
+  uint8_t tag[64];
+  cycles c0, c1;
+  clock_t t1, t2;
+  for (int k = 0; k < 3; k++) {
+    t1 = clock();
+    c0 = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++)
+      ossl_hash(algs[k], tag, input, SIZE);
+    c1 = cpucycles_end();
+    t2 = clock();
+    printf("\n OpenSSL %s:\n", EverCrypt_Hash_string_of_alg(algs[k]));
+    print_time((uint64_t)SIZE * ROUNDS, t2 - t1, c1 - c0);
+  }
+
+  if (ok)
+    printf ("\n Success :) \n");
+  else
+    printf ("\n Failed :( \n");
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,272 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_HMAC.h"
+#include "EverCrypt_HMAC.h"
+#include "EverCrypt_HKDF.h"
+
+#include "test_helpers.h"
+#include "hmac_vectors.h"
+
+#define ROUNDS 1048576
+
+static uint8_t chunk_lens[] = { 1, 3, 63, 64, 65, 127, 128, 129 };
+
+bool test_sha2_256(hmac_test_vector *v, uint8_t *msg, uint32_t msg_len)
+{
+  uint8_t expected[32U] = { 0U };
+  uint8_t tag[32U] = { 0U };
+  bool ok = true;
+  Hacl_HMAC_compute_sha2_256(tag, v->key, v->key_len, v->input, v->input_len);
+  ok &= compare_and_print(32, tag, v->tag_256);
+
+  Hacl_HMAC_SHA2_256_state *s = Hacl_HMAC_SHA2_256_create_in(v->key, v->key_len);
+  Hacl_HMAC_SHA2_256_compute(tag, s, v->input, v->input_len);
+  ok &= compare_and_print(32, tag, v->tag_256);
+  Hacl_HMAC_SHA2_256_update(s, v->input, v->input_len);
+  Hacl_HMAC_SHA2_256_finish(s, tag);
+  ok &= compare_and_print(32, tag, v->tag_256);
+
+  // Streaming with various chunk sizes, against the one-shot function
+  Hacl_HMAC_compute_sha2_256(expected, v->key, v->key_len, msg, msg_len);
+  for (int i = 0; i < sizeof(chunk_lens); i++) {
+    Hacl_HMAC_SHA2_256_reset(s);
+    Hacl_HMAC_SHA2_256_update(s, NULL, 0);
+    for (uint32_t j = 0; j < msg_len; j += chunk_lens[i]) {
+      uint32_t n = msg_len - j < chunk_lens[i] ? msg_len - j : chunk_lens[i];
+      Hacl_HMAC_SHA2_256_update(s, msg + j, n);
+    }
+    Hacl_HMAC_SHA2_256_finish(s, tag);
+    ok &= compare(32, tag, expected);
+  }
+
+  // finish is not destructive, and copies are independent
+  Hacl_HMAC_SHA2_256_reset(s);
+  Hacl_HMAC_SHA2_256_update(s, msg, msg_len / 2);
+  Hacl_HMAC_SHA2_256_state *c = Hacl_HMAC_SHA2_256_copy(s);
+  Hacl_HMAC_SHA2_256_finish(s, tag);
+  Hacl_HMAC_SHA2_256_update(s, msg + msg_len / 2, msg_len - msg_len / 2);
+  Hacl_HMAC_SHA2_256_finish(s, tag);
+  ok &= compare(32, tag, expected);
+  Hacl_HMAC_SHA2_256_update(c, msg + msg_len / 2, msg_len - msg_len / 2);
+  Hacl_HMAC_SHA2_256_finish(c, tag);
+  ok &= compare(32, tag, expected);
+  Hacl_HMAC_SHA2_256_free(c);
+
+  // Re-keying
+  Hacl_HMAC_SHA2_256_init(key2, sizeof(key2), s);
+  Hacl_HMAC_SHA2_256_compute(tag, s, input2, sizeof(input2));
+  ok &= compare(32, tag, tag2_256);
+  Hacl_HMAC_SHA2_256_free(s);
+  return ok;
+}
+
+bool test_sha2_384(hmac_test_vector *v, uint8_t *msg, uint32_t msg_len)
+{
+  uint8_t expected[48U] = { 0U };
+  uint8_t tag[48U] = { 0U };
+  bool ok = true;
+  Hacl_HMAC_compute_sha2_384(tag, v->key, v->key_len, v->input, v->input_len);
+  ok &= compare_and_print(48, tag, v->tag_384);
+
+  Hacl_HMAC_SHA2_384_state *s = Hacl_HMAC_SHA2_384_create_in(v->key, v->key_len);
+  Hacl_HMAC_SHA2_384_compute(tag, s, v->input, v->input_len);
+  ok &= compare_and_print(48, tag, v->tag_384);
+  Hacl_HMAC_SHA2_384_update(s, v->input, v->input_len);
+  Hacl_HMAC_SHA2_384_finish(s, tag);
+  ok &= compare_and_print(48, tag, v->tag_384);
+
+  Hacl_HMAC_compute_sha2_384(expected, v->key, v->key_len, msg, msg_len);
+  for (int i = 0; i < sizeof(chunk_lens); i++) {
+    Hacl_HMAC_SHA2_384_reset(s);
+    for (uint32_t j = 0; j < msg_len; j += chunk_lens[i]) {
+      uint32_t n = msg_len - j < chunk_lens[i] ? msg_len - j : chunk_lens[i];
+      Hacl_HMAC_SHA2_384_update(s, msg + j, n);
+    }
+    Hacl_HMAC_SHA2_384_finish(s, tag);
+    ok &= compare(48, tag, expected);
+  }
+  Hacl_HMAC_SHA2_384_free(s);
+  return ok;
+}
+
+bool test_sha2_512(hmac_test_vector *v, uint8_t *msg, uint32_t msg_len)
+{
+  uint8_t expected[64U] = { 0U };
+  uint8_t tag[64U] = { 0U };
+  bool ok = true;
+  Hacl_HMAC_compute_sha2_512(tag, v->key, v->key_len, v->input, v->input_len);
+  ok &= compare_and_print(64, tag, v->tag_512);
+
+  Hacl_HMAC_SHA2_512_state *s = Hacl_HMAC_SHA2_512_create_in(v->key, v->key_len);
+  Hacl_HMAC_SHA2_512_compute(tag, s, v->input, v->input_len);
+  ok &= compare_and_print(64, tag, v->tag_512);
+  Hacl_HMAC_SHA2_512_update(s, v->input, v->input_len);
+  Hacl_HMAC_SHA2_512_finish(s, tag);
+  ok &= compare_and_print(64, tag, v->tag_512);
+
+  Hacl_HMAC_compute_sha2_512(expected, v->key, v->key_len, msg, msg_len);
+  for (int i = 0; i < sizeof(chunk_lens); i++) {
+    Hacl_HMAC_SHA2_512_reset(s);
+    for (uint32_t j = 0; j < msg_len; j += chunk_lens[i]) {
+      uint32_t n = msg_len - j < chunk_lens[i] ? msg_len - j : chunk_lens[i];
+      Hacl_HMAC_SHA2_512_update(s, msg + j, n);
+    }
+    Hacl_HMAC_SHA2_512_finish(s, tag);
+    ok &= compare(64, tag, expected);
+  }
+  Hacl_HMAC_SHA2_512_free(s);
+  return ok;
+}
+
+static Spec_Hash_Definitions_hash_alg agile_algs[] = {
+  Spec_Hash_Definitions_SHA1,
+  Spec_Hash_Definitions_SHA2_256,
+  Spec_Hash_Definitions_SHA2_384,
+  Spec_Hash_Definitions_SHA2_512,
+  Spec_Hash_Definitions_Blake2S,
+  Spec_Hash_Definitions_Blake2B
+};
+
+bool test_agile(hmac_test_vector *v, uint8_t *msg, uint32_t msg_len)
+{
+  uint8_t expected[64U] = { 0U };
+  uint8_t tag[64U] = { 0U };
+  bool ok = true;
+  for (int k = 0; k < sizeof(agile_algs) / sizeof(agile_algs[0]); k++) {
+    Spec_Hash_Definitions_hash_alg a = agile_algs[k];
+    uint32_t tag_len = EverCrypt_Hash_Incremental_hash_len(a);
+    EverCrypt_HMAC_state *s = EverCrypt_HMAC_create_in(a, v->key, v->key_len);
+
+    // The empty message
+    EverCrypt_HMAC_compute(a, expected, v->key, v->key_len, msg, 0);
+    EverCrypt_HMAC_finish(s, tag);
+    ok &= compare(tag_len, tag, expected);
+
+    EverCrypt_HMAC_compute(a, expected, v->key, v->key_len, msg, msg_len);
+    for (int i = 0; i < sizeof(chunk_lens); i++) {
+      EverCrypt_HMAC_reset(s);
+      for (uint32_t j = 0; j < msg_len; j += chunk_lens[i]) {
+        uint32_t n = msg_len - j < chunk_lens[i] ? msg_len - j : chunk_lens[i];
+        EverCrypt_HMAC_update(s, msg + j, n);
+        // finish is not destructive
+        if (j == 0)
+          EverCrypt_HMAC_finish(s, tag);
+      }
+      EverCrypt_HMAC_finish(s, tag);
+      ok &= compare(tag_len, tag, expected);
+    }
+
+    if (a == Spec_Hash_Definitions_SHA2_256) {
+      EverCrypt_HMAC_init(key2, sizeof(key2), s);
+      EverCrypt_HMAC_update(s, input2, sizeof(input2));
+      EverCrypt_HMAC_finish(s, tag);
+      ok &= compare_and_print(32, tag, tag2_256);
+    }
+    EverCrypt_HMAC_free(s);
+  }
+  return ok;
+}
+
+bool test_hkdf_lazy(uint8_t *prk, uint32_t prk_len, uint8_t *info, uint32_t info_len)
+{
+  uint8_t expected[255 * 64];
+  uint8_t okm[255 * 64];
+  bool ok = true;
+  for (int k = 0; k < sizeof(agile_algs) / sizeof(agile_algs[0]); k++) {
+    Spec_Hash_Definitions_hash_alg a = agile_algs[k];
+    uint32_t max_len = 255 * EverCrypt_Hash_Incremental_hash_len(a);
+    EverCrypt_HKDF_expand(a, expected, prk, prk_len, info, info_len, max_len);
+
+    for (int i = 0; i < sizeof(chunk_lens); i++) {
+      EverCrypt_HKDF_expand_state *s =
+        EverCrypt_HKDF_expand_create_in(a, prk, prk_len, info, info_len);
+      memset(okm, 0, sizeof(okm));
+      for (uint32_t j = 0; j < max_len; j += chunk_lens[i]) {
+        uint32_t n = max_len - j < chunk_lens[i] ? max_len - j : chunk_lens[i];
+        ok &= EverCrypt_HKDF_expand_next(s, okm + j, n);
+      }
+      ok &= compare(max_len, okm, expected);
+      // The output is exhausted
+      ok &= !EverCrypt_HKDF_expand_next(s, okm, 1);
+      ok &= EverCrypt_HKDF_expand_next(s, okm, 0);
+      EverCrypt_HKDF_expand_free(s);
+    }
+
+    // A prefix of the output
+    EverCrypt_HKDF_expand(a, expected, prk, prk_len, info, info_len, 42);
+    EverCrypt_HKDF_expand_state *s =
+      EverCrypt_HKDF_expand_create_in(a, prk, prk_len, info, info_len);
+    ok &= EverCrypt_HKDF_expand_next(s, okm, 42);
+    ok &= compare(42, okm, expected);
+    ok &= !EverCrypt_HKDF_expand_next(s, okm, max_len);
+    EverCrypt_HKDF_expand_free(s);
+  }
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  uint8_t msg[1000];
+  for (int i = 0; i < sizeof(msg); i++)
+    msg[i] = (uint8_t)(i * 7 + 1);
+
+  for (int i = 0; i < sizeof(vectors)/sizeof(hmac_test_vector); ++i) {
+    // Message lengths around the block boundaries of SHA2-256 and SHA2-384/512
+    uint32_t msg_len = (uint32_t)(i * 128 + 64 * (i % 2) + i % 3);
+    ok &= test_sha2_256(&vectors[i], msg, msg_len);
+    ok &= test_sha2_384(&vectors[i], msg, msg_len);
+    ok &= test_sha2_512(&vectors[i], msg, msg_len);
+    ok &= test_agile(&vectors[i], msg, msg_len);
+    ok &= test_hkdf_lazy(vectors[i].key, vectors[i].key_len, vectors[i].input, vectors[i].input_len);
+  }
+
+  if (ok)
+    printf ("\n Success :) \n");
+  else
+    printf ("\n Failed :( \n");
+
+  // Benchmarking short messages, with and without a precomputed key state
+  uint8_t tag[32U] = { 0U };
+  cycles a,b;
+  clock_t t1,t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_HMAC_compute_sha2_256(tag, key2, sizeof(key2), msg, 32);
+    msg[0] ^= tag[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double diff1 = t2 - t1;
+  uint64_t cyc1 = b - a;
+
+  Hacl_HMAC_SHA2_256_state *s = Hacl_HMAC_SHA2_256_create_in(key2, sizeof(key2));
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_HMAC_SHA2_256_compute(tag, s, msg, 32);
+    msg[0] ^= tag[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double diff2 = t2 - t1;
+  uint64_t cyc2 = b - a;
+  Hacl_HMAC_SHA2_256_free(s);
+
+  printf("\n HMAC-SHA2-256 (32 bytes):\n");
+  print_time(ROUNDS * 32, diff1, cyc1);
+  printf("\n HMAC-SHA2-256 with a precomputed key state (32 bytes):\n");
+  print_time(ROUNDS * 32, diff2, cyc2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
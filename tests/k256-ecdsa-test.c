@@ -10,6 +10,7 @@
 #include <time.h>
 
 #include "Hacl_K256_ECDSA.h"
+#include "Hacl_EC_K256.h"
 
 #include "test_helpers.h"
 #include "k256-ecdsa_vectors.h"
@@ -144,6 +145,111 @@ bool test_public_key_uncompressed(
 }
 
 
+/* Signs with nonces exercising every window of the fixed-base tables and checks
+   the result against the (independent) GLV verification path. */
+bool test_sign_verify(void)
+{
+  uint8_t signature[64U] = { 0U };
+  bool ok = Hacl_K256_ECDSA_ecdsa_sign_hashed_msg(signature, msgHash2, sk2, nonce2);
+  ok = ok && compare(64U, signature, sgnt2);
+  printf("K256 ECDSA sign Result: %s\n", ok ? "Success!" : "Failed");
+
+  uint8_t nonces[6U][32U] = { { 0U } };
+  nonces[0U][31U] = (uint8_t)1U;
+  nonces[1U][23U] = (uint8_t)1U;
+  nonces[2U][15U] = (uint8_t)1U;
+  nonces[2U][31U] = (uint8_t)1U;
+  nonces[3U][7U] = (uint8_t)0x80U;
+  // q - 1
+  static const uint8_t q_minus_one[32U] = {
+    0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU, 0xffU,
+    0xffU, 0xffU, 0xffU, 0xffU, 0xfeU, 0xbaU, 0xaeU, 0xdcU, 0xe6U, 0xafU, 0x48U,
+    0xa0U, 0x3bU, 0xbfU, 0xd2U, 0x5eU, 0x8cU, 0xd0U, 0x36U, 0x41U, 0x40U };
+  memcpy(nonces[4U], q_minus_one, 32U);
+  memcpy(nonces[5U], msgHash2, 32U);
+  for (int i = 0; i < 6; i++) {
+    bool b = Hacl_K256_ECDSA_ecdsa_sign_hashed_msg(signature, msgHash2, sk2, nonces[i]);
+    b = b && Hacl_K256_ECDSA_ecdsa_verify_hashed_msg(msgHash2, pk2, signature);
+    signature[63U] ^= (uint8_t)1U;
+    b = b && !Hacl_K256_ECDSA_ecdsa_verify_hashed_msg(msgHash2, pk2, signature);
+    printf("K256 ECDSA sign/verify Result %d: %s\n", i, b ? "Success!" : "Failed");
+    ok = ok && b;
+  }
+  return ok;
+}
+
+
+#define BATCH 70
+
+bool test_verify_batch(void)
+{
+  static uint8_t sks[3U][32U];
+  static uint8_t pks[3U][64U];
+  static uint8_t hashes[BATCH][32U];
+  static uint8_t sgnts[BATCH][65U];
+  uint8_t *hash_ptrs[BATCH];
+  uint8_t *pk_ptrs[BATCH];
+  uint8_t *sgnt_ptrs[BATCH];
+  bool expected[BATCH];
+  bool results[BATCH];
+  uint64_t g[15U];
+  uint64_t p[15U];
+  uint8_t c[33U];
+  Hacl_EC_K256_mk_base_point(g);
+  for (int k = 0; k < 3; k++) {
+    memcpy(sks[k], sk2, 32U);
+    sks[k][0U] ^= (uint8_t)k;
+    Hacl_EC_K256_point_mul(sks[k], g, p);
+    Hacl_EC_K256_point_compress(p, c);
+    Hacl_K256_ECDSA_public_key_compressed_to_raw(pks[k], c);
+  }
+  for (int i = 0; i < BATCH; i++) {
+    uint8_t nonce[32U];
+    memcpy(hashes[i], msgHash2, 32U);
+    hashes[i][0U] = (uint8_t)i;
+    memcpy(nonce, nonce2, 32U);
+    nonce[0U] = (uint8_t)i;
+    // runs of signatures under the same key, so that the key tables get shared
+    int k = (i / 5) % 3;
+    Hacl_K256_ECDSA_ecdsa_sign_hashed_msg(sgnts[i], hashes[i], sks[k], nonce);
+    Hacl_EC_K256_point_mul(nonce, g, p);
+    Hacl_EC_K256_point_compress(p, c);
+    sgnts[i][64U] = c[0U] - (uint8_t)0x02U;
+    hash_ptrs[i] = hashes[i];
+    pk_ptrs[i] = pks[k];
+    sgnt_ptrs[i] = sgnts[i];
+  }
+
+  bool ok = Hacl_K256_ECDSA_ecdsa_verify_batch_hashed_msg(BATCH, hash_ptrs, pk_ptrs, sgnt_ptrs, results);
+  ok = ok && Hacl_K256_ECDSA_ecdsa_verify_batch_recoverable_hashed_msg(BATCH, hash_ptrs, pk_ptrs, sgnt_ptrs, results);
+  for (int i = 0; i < BATCH; i++)
+    ok = ok && results[i];
+  printf("K256 ECDSA verify batch Result (valid): %s\n", ok ? "Success!" : "Failed");
+
+  // invalid signatures, and valid signatures with a wrong or out of range recovery id
+  sgnts[3U][40U] ^= (uint8_t)1U;
+  hashes[17U][31U] ^= (uint8_t)1U;
+  memset(sgnts[30U] + 32U, 0U, 32U);
+  pk_ptrs[41U] = pks[0U];
+  sgnts[50U][64U] ^= (uint8_t)1U;
+  sgnts[51U][64U] = (uint8_t)2U;
+  sgnts[66U][64U] = (uint8_t)4U;
+  bool all = true;
+  for (int i = 0; i < BATCH; i++) {
+    expected[i] = Hacl_K256_ECDSA_ecdsa_verify_hashed_msg(hash_ptrs[i], pk_ptrs[i], sgnt_ptrs[i]);
+    all = all && expected[i];
+  }
+  bool b = !expected[3U] && !expected[17U] && !expected[30U] && !expected[41U] && expected[50U];
+  b = b && Hacl_K256_ECDSA_ecdsa_verify_batch_hashed_msg(BATCH, hash_ptrs, pk_ptrs, sgnt_ptrs, results) == all;
+  for (int i = 0; i < BATCH; i++)
+    b = b && results[i] == expected[i];
+  b = b && Hacl_K256_ECDSA_ecdsa_verify_batch_recoverable_hashed_msg(BATCH, hash_ptrs, pk_ptrs, sgnt_ptrs, results) == all;
+  for (int i = 0; i < BATCH; i++)
+    b = b && results[i] == expected[i];
+  printf("K256 ECDSA verify batch Result (invalid): %s\n", b ? "Success!" : "Failed");
+  return ok && b;
+}
+
 int main() {
   bool ok = true;
   for (int i = 0; i < sizeof(vectors)/sizeof(k256ecdsa_verify_test_vector); ++i) {
@@ -153,6 +259,8 @@ int main() {
     ok &= test_public_key_compressed(vectors[i].pk_x,vectors[i].pk_y,vectors[i].id);
     printf("\n");
   }
+  ok &= test_sign_verify();
+  ok &= test_verify_batch();
 
   if (ok)
     printf ("\n Success :) \n");
@@ -1,6 +1,10 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <assert.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 
 #include "EverCrypt_AutoConfig2.h"
 #include "MerkleTree.h"
@@ -16,6 +20,25 @@ const char* hash_to_string(const uint8_t *h) {
   return hs;
 }
 
+// A hash function other than mt_sha256_compress, with the same hash size
+static void xor_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst) {
+  for (uint32_t i = 0; i < 32U; i++)
+    dst[i] = src1[i] ^ src2[i] ^ 0x5c;
+}
+
+// Overwrites 4 bytes of the header of a tree file, returning the previous ones
+static uint32_t patch_header(const char *path, long pos, uint32_t v) {
+  uint32_t old;
+  FILE *f = fopen(path, "r+b");
+  assert(f != NULL);
+  fseek(f, pos, SEEK_SET);
+  assert(fread(&old, sizeof old, 1, f) == 1);
+  fseek(f, pos, SEEK_SET);
+  assert(fwrite(&v, sizeof v, 1, f) == 1);
+  fclose(f);
+  return old;
+}
+
 void print_hash(const char *name, const uint8_t *h) {
   const char* hs = hash_to_string(h);
   printf("%s: %s\n", name, hs);
@@ -203,6 +226,324 @@ int main(int argc, char *argv[]) {
     mt_free_path(cur_path);
   }
 
+  {
+    printf("Testing batch insertion...\n");
+    // Without SHA extensions, batch insertion goes through the multi-buffer SHA-256 code
+    EverCrypt_AutoConfig2_disable_shaext();
+    uint32_t batch_elts = 1000;
+    uint8_t *leaves = calloc(batch_elts, hash_size);
+    for (uint32_t i = 0; i < batch_elts; i++) {
+      leaves[i * hash_size] = (uint8_t)i;
+      leaves[i * hash_size + 1] = (uint8_t)(i >> 8);
+    }
+
+    uint8_t *ih = mt_init_hash(hash_size);
+    mt_p mt1 = mt_create(ih);
+    mt_p mt2 = mt_create(ih);
+    mt_free_hash(ih);
+
+    uint8_t *hash = mt_init_hash(hash_size);
+    for (uint32_t i = 0; i < batch_elts; i++) {
+      memcpy(hash, leaves + i * hash_size, hash_size);
+      mt_insert(mt1, hash);
+    }
+    mt_free_hash(hash);
+
+    // Uneven chunks, so that batches start at both even and odd indices
+    uint32_t chunks[] = { 1, 5, 0, 16, 7, 300, 671 };
+    uint32_t pos = 0;
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+      assert(mt_insert_batch_pre(mt2, leaves + pos * hash_size, chunks[c]));
+      mt_insert_batch(mt2, leaves + pos * hash_size, chunks[c]);
+      pos += chunks[c];
+    }
+    assert(pos == batch_elts);
+
+    uint8_t *root1 = mt_init_hash(hash_size);
+    uint8_t *root2 = mt_init_hash(hash_size);
+    mt_get_root(mt1, root1);
+    mt_get_root(mt2, root2);
+    print_hash("root (sequential)", root1);
+    print_hash("root (batch)     ", root2);
+    if (memcmp(root1, root2, hash_size) != 0) {
+      printf("ERROR: batch insertion yields a different root; exiting.\n");
+      exit(1);
+    }
+
+    for (uint64_t k = 0; k <= batch_elts; k += 37) {
+      MerkleTree_Low_path *cur_path = mt_init_path(hash_size);
+      uint32_t j = mt_get_path(mt2, k, cur_path, root2);
+      if (!mt_verify(mt2, k, j, cur_path, root2)) {
+        printf("ERROR: path verification failed on batch tree with k(%ld); exiting.\n", k);
+        exit(1);
+      }
+      mt_free_path(cur_path);
+    }
+    printf("Batch insertion matches sequential insertion.\n");
+
+    printf("Testing contiguous (arena) storage...\n");
+    ih = mt_init_hash(hash_size);
+    mt_p mt3 = mt_create_arena(ih);
+    mt_free_hash(ih);
+    hash = mt_init_hash(hash_size);
+    for (uint32_t i = 0; i < 10; i++) {
+      memcpy(hash, leaves + i * hash_size, hash_size);
+      mt_insert(mt3, hash);
+    }
+    mt_free_hash(hash);
+    mt_insert_batch(mt3, leaves + 10 * hash_size, batch_elts - 10);
+
+    uint8_t *root3 = mt_init_hash(hash_size);
+    mt_get_root(mt3, root3);
+    print_hash("root (arena)     ", root3);
+    if (memcmp(root1, root3, hash_size) != 0) {
+      printf("ERROR: arena storage yields a different root; exiting.\n");
+      exit(1);
+    }
+
+    mt_flush_to(mt1, 333);
+    mt_flush_to(mt3, 333);
+    mt_retract_to(mt1, 900);
+    mt_retract_to(mt3, 900);
+    for (uint64_t k = 333; k <= 900; k += 11) {
+      MerkleTree_Low_path *cur_path = mt_init_path(hash_size);
+      uint32_t j = mt_get_path(mt1, k, cur_path, root1);
+      mt_free_path(cur_path);
+      cur_path = mt_init_path(hash_size);
+      j = mt_get_path(mt3, k, cur_path, root3);
+      if (memcmp(root1, root3, hash_size) != 0 || !mt_verify(mt3, k, j, cur_path, root3)) {
+        printf("ERROR: path verification failed on arena tree with k(%ld); exiting.\n", k);
+        exit(1);
+      }
+      mt_free_path(cur_path);
+    }
+    uint64_t ser_len = mt_serialize_size(mt1);
+    uint8_t *ser1 = malloc(ser_len);
+    uint8_t *ser3 = malloc(ser_len);
+    if (mt_serialize_size(mt3) != ser_len
+        || mt_serialize(mt1, ser1, ser_len) != ser_len
+        || mt_serialize(mt3, ser3, ser_len) != ser_len
+        || memcmp(ser1, ser3, ser_len) != 0) {
+      printf("ERROR: arena storage serializes differently; exiting.\n");
+      exit(1);
+    }
+    free(ser1);
+    free(ser3);
+    printf("Arena storage matches pointer storage.\n");
+    mt_free_hash(root3);
+    mt_free(mt3);
+
+    printf("Testing file storage...\n");
+    const char *path = "merkle_tree_test.mt";
+    ih = mt_init_hash(hash_size);
+    mt_p mt4 = mt_create_file(path, ih);
+    mt_free_hash(ih);
+    if (mt4 == NULL) {
+      printf("ERROR: cannot create %s; exiting.\n", path);
+      exit(1);
+    }
+    mt_insert_batch(mt4, leaves, 600);
+    if (!mt_close_file(mt4)) {
+      printf("ERROR: cannot close %s; exiting.\n", path);
+      exit(1);
+    }
+    // A mismatched hash size or function, or an inconsistent header, is rejected
+    if (mt_open_file(path, 16, mt_sha256_compress) != NULL
+        || mt_open_file(path, hash_size, xor_compress) != NULL) {
+      printf("ERROR: opened %s with the wrong hash function; exiting.\n", path);
+      exit(1);
+    }
+    // The number of hashes of level 3, and then j
+    long fields[] = { 40 + 3 * 16 + 12, 16 };
+    for (int f = 0; f < 2; f++) {
+      uint32_t old = patch_header(path, fields[f], 7);
+      if (mt_open_file(path, hash_size, mt_sha256_compress) != NULL) {
+        printf("ERROR: opened %s with a corrupted header; exiting.\n", path);
+        exit(1);
+      }
+      patch_header(path, fields[f], old);
+    }
+    // Reopen, append the remaining leaves and flush part of the tree
+    mt4 = mt_open_file(path, hash_size, mt_sha256_compress);
+    if (mt4 == NULL) {
+      printf("ERROR: cannot open %s; exiting.\n", path);
+      exit(1);
+    }
+    // A file that cannot grow makes the precondition fail and leaves the tree unchanged
+    struct stat fs;
+    struct rlimit old_lim, lim;
+    assert(stat(path, &fs) == 0 && getrlimit(RLIMIT_FSIZE, &old_lim) == 0);
+    lim = old_lim;
+    lim.rlim_cur = (rlim_t)fs.st_size;
+    signal(SIGXFSZ, SIG_IGN);
+    assert(setrlimit(RLIMIT_FSIZE, &lim) == 0);
+    uint32_t j4 = mt4->j;
+    uint8_t *more = calloc(4096, hash_size);
+    bool grown = mt_insert_batch_pre(mt4, more, 4096);
+    mt_insert_batch(mt4, more, 4096);
+    assert(setrlimit(RLIMIT_FSIZE, &old_lim) == 0);
+    signal(SIGXFSZ, SIG_DFL);
+    free(more);
+    if (grown || mt4->j != j4) {
+      printf("ERROR: inserted into %s beyond its size limit; exiting.\n", path);
+      exit(1);
+    }
+    mt_insert_batch(mt4, leaves + 600 * hash_size, batch_elts - 600);
+    mt_flush_to(mt4, 333);
+    if (!mt_sync_file(mt4)) {
+      printf("ERROR: cannot sync %s; exiting.\n", path);
+      exit(1);
+    }
+    mt_free(mt4);
+    mt4 = mt_open_file(path, hash_size, mt_sha256_compress);
+    uint8_t *root4 = mt_init_hash(hash_size);
+    mt_get_root(mt4, root4);
+    print_hash("root (file)      ", root4);
+    if (memcmp(root2, root4, hash_size) != 0) {
+      printf("ERROR: file storage yields a different root; exiting.\n");
+      exit(1);
+    }
+    for (uint64_t k = 333; k <= batch_elts; k += 13) {
+      MerkleTree_Low_path *cur_path = mt_init_path(hash_size);
+      uint32_t j = mt_get_path(mt4, k, cur_path, root4);
+      if (!mt_verify(mt4, k, j, cur_path, root4)) {
+        printf("ERROR: path verification failed on file tree with k(%ld); exiting.\n", k);
+        exit(1);
+      }
+      mt_free_path(cur_path);
+    }
+    printf("File storage matches pointer storage.\n");
+    mt_free_hash(root4);
+    if (!mt_close_file(mt4)) {
+      printf("ERROR: cannot close %s; exiting.\n", path);
+      exit(1);
+    }
+    unlink(path);
+
+    printf("Testing multi-threaded batch insertion...\n");
+    uint32_t par_elts = 100000;
+    uint8_t *par_leaves = calloc(par_elts, hash_size);
+    for (uint32_t i = 0; i < par_elts; i++) {
+      par_leaves[i * hash_size] = (uint8_t)i;
+      par_leaves[i * hash_size + 1] = (uint8_t)(i >> 8);
+      par_leaves[i * hash_size + 2] = (uint8_t)(i >> 16);
+    }
+    uint8_t *root5 = mt_init_hash(hash_size);
+    uint8_t *root6 = mt_init_hash(hash_size);
+    ih = mt_init_hash(hash_size);
+    mt_p mt5 = mt_create(ih);
+    mt_p mt6 = mt_create_arena(ih);
+    mt_free_hash(ih);
+    mt_insert_batch(mt5, par_leaves, par_elts);
+    mt_insert_batch_par(mt6, par_leaves, 12345, 4);
+    mt_insert_batch_par(mt6, par_leaves + 12345 * hash_size, par_elts - 12345, 8);
+    mt_get_root(mt5, root5);
+    mt_get_root(mt6, root6);
+    if (memcmp(root5, root6, hash_size) != 0) {
+      printf("ERROR: multi-threaded batch insertion yields a different root; exiting.\n");
+      exit(1);
+    }
+    mt_free(mt6);
+    ih = mt_init_hash(hash_size);
+    mt6 = mt_create(ih);
+    mt_free_hash(ih);
+    mt_insert_batch_par(mt6, par_leaves, par_elts, 3);
+    mt_get_root(mt6, root6);
+    if (memcmp(root5, root6, hash_size) != 0) {
+      printf("ERROR: multi-threaded batch insertion yields a different root; exiting.\n");
+      exit(1);
+    }
+    printf("Multi-threaded batch insertion matches batch insertion.\n");
+    mt_free(mt5);
+    mt_free(mt6);
+    mt_free_hash(root5);
+    mt_free_hash(root6);
+    free(par_leaves);
+
+    printf("Testing batched path extraction and verification...\n");
+    uint32_t bat_elts = 1000;
+    uint8_t *bat_leaves = calloc(bat_elts, hash_size);
+    for (uint32_t i = 0; i < bat_elts; i++) {
+      bat_leaves[i * hash_size] = (uint8_t)i;
+      bat_leaves[i * hash_size + 1] = (uint8_t)(i >> 8);
+    }
+    ih = mt_init_hash(hash_size);
+    mt_p mt7 = mt_create(ih);
+    mt_free_hash(ih);
+    mt_insert_batch(mt7, bat_leaves, bat_elts);
+    mt_flush_to(mt7, 100);
+    uint64_t bat_idx[] = { 100, 101, 102, 102, 103, 511, 512, 513, 700, 998, 999 };
+    uint32_t bat_n = sizeof(bat_idx) / sizeof(bat_idx[0]);
+    uint64_t bat_len = (uint64_t)bat_n * 33 * hash_size;
+    uint8_t *bat_buf = malloc(bat_len);
+    uint32_t bat_lens[sizeof(bat_idx) / sizeof(bat_idx[0])];
+    bool bat_res[sizeof(bat_idx) / sizeof(bat_idx[0])];
+    uint8_t *root7 = mt_init_hash(hash_size);
+    uint8_t *root8 = mt_init_hash(hash_size);
+    if (!mt_get_paths_pre(mt7, bat_n, bat_idx, bat_buf, bat_len, bat_lens, root7)) {
+      printf("ERROR: Precondition for mt_get_paths does not hold; exiting.\n");
+      exit(1);
+    }
+    uint32_t bat_j = mt_get_paths(mt7, bat_n, bat_idx, bat_buf, bat_len, bat_lens, root7);
+    uint8_t *bat_p = bat_buf;
+    for (uint32_t t = 0; t < bat_n; t++) {
+      MerkleTree_Low_path *cur_path = mt_init_path(hash_size);
+      uint32_t j = mt_get_path(mt7, bat_idx[t], cur_path, root8);
+      if (j != bat_j || memcmp(root7, root8, hash_size) != 0
+          || mt_get_path_length(cur_path) != bat_lens[t]) {
+        printf("ERROR: mt_get_paths disagrees with mt_get_path; exiting.\n");
+        exit(1);
+      }
+      for (uint32_t l = 0; l < bat_lens[t]; l++) {
+        if (memcmp(mt_get_path_step(cur_path, l), bat_p + l * hash_size, hash_size) != 0) {
+          printf("ERROR: mt_get_paths disagrees with mt_get_path; exiting.\n");
+          exit(1);
+        }
+      }
+      bat_p += bat_lens[t] * hash_size;
+      mt_free_path(cur_path);
+    }
+    if (!mt_verify_batch_pre(mt7, bat_n, bat_idx, bat_j, bat_buf, bat_lens, root7, bat_res)
+        || !mt_verify_batch(mt7, bat_n, bat_idx, bat_j, bat_buf, bat_lens, root7, bat_res)) {
+      printf("ERROR: batch verification failed; exiting.\n");
+      exit(1);
+    }
+    // Corrupt the last sibling of the third path: it alone must fail, even though
+    // the next path reaches the same nodes.
+    bat_p = bat_buf + (bat_lens[0] + bat_lens[1] + bat_lens[2] - 1) * hash_size;
+    bat_p[0] ^= 1;
+    bool bat_ok = mt_verify_batch(mt7, bat_n, bat_idx, bat_j, bat_buf, bat_lens, root7, bat_res);
+    for (uint32_t t = 0; t < bat_n; t++) {
+      if (bat_ok || bat_res[t] != (t != 2)) {
+        printf("ERROR: batch verification accepted a corrupted path; exiting.\n");
+        exit(1);
+      }
+    }
+    bat_p[0] ^= 1;
+    // Corrupt the leaf of the fourth path (a duplicate of the third one).
+    bat_p = bat_buf + (bat_lens[0] + bat_lens[1] + bat_lens[2]) * hash_size;
+    bat_p[0] ^= 1;
+    bat_ok = mt_verify_batch(mt7, bat_n, bat_idx, bat_j, bat_buf, bat_lens, root7, bat_res);
+    for (uint32_t t = 0; t < bat_n; t++) {
+      if (bat_ok || bat_res[t] != (t != 3)) {
+        printf("ERROR: batch verification accepted a corrupted path; exiting.\n");
+        exit(1);
+      }
+    }
+    printf("Batched paths match single paths.\n");
+    mt_free(mt7);
+    mt_free_hash(root7);
+    mt_free_hash(root8);
+    free(bat_buf);
+    free(bat_leaves);
+
+    mt_free_hash(root1);
+    mt_free_hash(root2);
+    mt_free(mt1);
+    mt_free(mt2);
+    free(leaves);
+  }
+
   // Free
   mt_free(mt);
   mt_free_hash(root);
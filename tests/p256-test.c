@@ -16,6 +16,8 @@
 #include <openssl/ec.h>
 
 #include "Hacl_P256.h"
+#include "Hacl_Hash_SHA2.h"
+#include "ecdsap256_tv_w.h"
 
 
 uint8_t
@@ -103,6 +105,71 @@ bool testImplementationHacl()
 	return s0 && s1 && flag;
 }
 
+bool test_wycheproof_batch()
+{
+	uint32_t len = sizeof(w_ecdsa_vectors)/sizeof(ecdsap256_w_i);
+	uint8_t* hashes = (uint8_t*) malloc (sizeof (uint8_t) * 32 * len);
+	uint8_t* pks = (uint8_t*) malloc (sizeof (uint8_t) * 64 * len);
+	uint8_t** m = (uint8_t**) malloc (sizeof (uint8_t*) * len);
+	uint8_t** pubKeys = (uint8_t**) malloc (sizeof (uint8_t*) * len);
+	uint8_t** r = (uint8_t**) malloc (sizeof (uint8_t*) * len);
+	uint8_t** s = (uint8_t**) malloc (sizeof (uint8_t*) * len);
+	bool* results = (bool*) malloc (sizeof (bool) * len);
+	bool* expected = (bool*) malloc (sizeof (bool) * len);
+	bool all = true;
+
+	printf("%s\n", "Wycheproof tests ECDSA batch: ");
+
+	for (uint32_t i = 0; i < len; i++)
+	{
+		Hacl_Hash_SHA2_hash_256(w_ecdsa_vectors[i].message, w_ecdsa_vectors[i].mLen, hashes + 32 * i);
+		memcpy(pks + 64 * i, w_ecdsa_vectors[i].publicX, 32);
+		memcpy(pks + 64 * i + 32, w_ecdsa_vectors[i].publicY, 32);
+		m[i] = hashes + 32 * i;
+		pubKeys[i] = pks + 64 * i;
+		r[i] = w_ecdsa_vectors[i].r;
+		s[i] = w_ecdsa_vectors[i].s;
+		expected[i] = Hacl_P256_ecdsa_verif_p256_sha2(w_ecdsa_vectors[i].mLen, w_ecdsa_vectors[i].message, pubKeys[i], r[i], s[i]);
+		all = all && expected[i];
+	}
+
+	bool ok = Hacl_P256_ecdsa_verif_batch_without_hash(len, m, pubKeys, r, s, results) == all;
+	for (uint32_t i = 0; i < len; i++)
+	{
+		if (results[i] != expected[i])
+		{
+			printf("\n Batch test %d failed \n", i);
+			ok = false;
+		}
+	}
+
+	/* Only the valid signatures, several of them under the same key */
+	uint32_t n = 0;
+	for (uint32_t i = 0; i < len; i++)
+	{
+		if (expected[i])
+		{
+			m[n] = m[i];
+			pubKeys[n] = pubKeys[i];
+			r[n] = r[i];
+			s[n] = s[i];
+			n++;
+		}
+	}
+	ok = ok && Hacl_P256_ecdsa_verif_batch_without_hash(n, m, pubKeys, r, s, results);
+
+	free(hashes);
+	free(pks);
+	free(m);
+	free(pubKeys);
+	free(r);
+	free(s);
+	free(results);
+	free(expected);
+
+	return ok;
+}
+
 void handleErrors()
 {
 	printf("%s\n", "OpenSSl exception");
@@ -115,6 +182,11 @@ int main()
 		printf("%s\n", "Test Implementation failed for Hacl* ECDSA");
 		return -1;
 	}
+	if (!test_wycheproof_batch())
+	{
+		printf("%s\n", "ECDSA Wycheproof batch tests have failed");
+		return -1;
+	}
 
 
   	cycles a,b;
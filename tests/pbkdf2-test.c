@@ -0,0 +1,251 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "test_helpers.h"
+
+#include "Hacl_HMAC.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#if defined(HACL_CAN_COMPILE_VEC256)
+#include "Hacl_SHA2_Vec256.h"
+#endif
+
+#define ITERATIONS 100000
+
+// RFC 7914, Section 11
+static uint8_t tag256_1[64] = {
+  0x55, 0xac, 0x04, 0x6e, 0x56, 0xe3, 0x08, 0x9f, 0xec, 0x16, 0x91, 0xc2, 0x25, 0x44, 0xb6, 0x05,
+  0xf9, 0x41, 0x85, 0x21, 0x6d, 0xde, 0x04, 0x65, 0xe6, 0x8b, 0x9d, 0x57, 0xc2, 0x0d, 0xac, 0xbc,
+  0x49, 0xca, 0x9c, 0xcc, 0xf1, 0x79, 0xb6, 0x45, 0x99, 0x16, 0x64, 0xb3, 0x9d, 0x77, 0xef, 0x31,
+  0x7c, 0x71, 0xb8, 0x45, 0xb1, 0xe3, 0x0b, 0xd5, 0x09, 0x11, 0x20, 0x41, 0xd3, 0xa1, 0x97, 0x83
+};
+
+static uint8_t tag256_2[64] = {
+  0x4d, 0xdc, 0xd8, 0xf6, 0x0b, 0x98, 0xbe, 0x21, 0x83, 0x0c, 0xee, 0x5e, 0xf2, 0x27, 0x01, 0xf9,
+  0x64, 0x1a, 0x44, 0x18, 0xd0, 0x4c, 0x04, 0x14, 0xae, 0xff, 0x08, 0x87, 0x6b, 0x34, 0xab, 0x56,
+  0xa1, 0xd4, 0x25, 0xa1, 0x22, 0x58, 0x33, 0x54, 0x9a, 0xdb, 0x84, 0x1b, 0x51, 0xc9, 0xb3, 0x17,
+  0x6a, 0x27, 0x2b, 0xde, 0xbb, 0xa1, 0xd0, 0x78, 0x47, 0x8f, 0x62, 0xb3, 0x97, 0xf3, 0x3c, 0x8d
+};
+
+// PBKDF2-HMAC-SHA512, P = "passwordPASSWORDpassword",
+// S = "saltSALTsaltSALTsaltSALTsaltSALTsalt", c = 4096
+static uint8_t tag512[64] = {
+  0x8c, 0x05, 0x11, 0xf4, 0xc6, 0xe5, 0x97, 0xc6, 0xac, 0x63, 0x15, 0xd8, 0xf0, 0x36, 0x2e, 0x22,
+  0x5f, 0x3c, 0x50, 0x14, 0x95, 0xba, 0x23, 0xb8, 0x68, 0xc0, 0x05, 0x17, 0x4d, 0xc4, 0xee, 0x71,
+  0x11, 0x5b, 0x59, 0xf9, 0xe6, 0x0c, 0xd9, 0x53, 0x2f, 0xa3, 0x3e, 0x0f, 0x75, 0xae, 0xfe, 0x30,
+  0x22, 0x5c, 0x58, 0x3a, 0x18, 0x6c, 0xd8, 0x2b, 0xd4, 0xda, 0xea, 0x97, 0x24, 0xa3, 0xd3, 0xb8
+};
+
+// Reference PBKDF2 on top of the one-lane HMAC with a precomputed key state
+void pbkdf2_sha256(uint8_t *dst, uint32_t dst_len, uint8_t *password, uint32_t password_len,
+                   uint8_t *salt, uint32_t salt_len, uint32_t iterations)
+{
+  Hacl_HMAC_SHA2_256_state *s = Hacl_HMAC_SHA2_256_create_in(password, password_len);
+  for (uint32_t i = 0; i * 32 < dst_len; i++) {
+    uint8_t ctr[4] = { 0, 0, (uint8_t)((i + 1) >> 8), (uint8_t)(i + 1) };
+    uint8_t u[32], t[32];
+    Hacl_HMAC_SHA2_256_reset(s);
+    Hacl_HMAC_SHA2_256_update(s, salt, salt_len);
+    Hacl_HMAC_SHA2_256_update(s, ctr, 4);
+    Hacl_HMAC_SHA2_256_finish(s, u);
+    memcpy(t, u, 32);
+    for (uint32_t j = 1; j < iterations; j++) {
+      Hacl_HMAC_SHA2_256_compute(u, s, u, 32);
+      for (int k = 0; k < 32; k++)
+        t[k] ^= u[k];
+    }
+    uint32_t len = dst_len - i * 32 < 32 ? dst_len - i * 32 : 32;
+    memcpy(dst + i * 32, t, len);
+  }
+  Hacl_HMAC_SHA2_256_free(s);
+}
+
+void pbkdf2_sha512(uint8_t *dst, uint32_t dst_len, uint8_t *password, uint32_t password_len,
+                   uint8_t *salt, uint32_t salt_len, uint32_t iterations)
+{
+  Hacl_HMAC_SHA2_512_state *s = Hacl_HMAC_SHA2_512_create_in(password, password_len);
+  for (uint32_t i = 0; i * 64 < dst_len; i++) {
+    uint8_t ctr[4] = { 0, 0, (uint8_t)((i + 1) >> 8), (uint8_t)(i + 1) };
+    uint8_t u[64], t[64];
+    Hacl_HMAC_SHA2_512_reset(s);
+    Hacl_HMAC_SHA2_512_update(s, salt, salt_len);
+    Hacl_HMAC_SHA2_512_update(s, ctr, 4);
+    Hacl_HMAC_SHA2_512_finish(s, u);
+    memcpy(t, u, 64);
+    for (uint32_t j = 1; j < iterations; j++) {
+      Hacl_HMAC_SHA2_512_compute(u, s, u, 64);
+      for (int k = 0; k < 64; k++)
+        t[k] ^= u[k];
+    }
+    uint32_t len = dst_len - i * 64 < 64 ? dst_len - i * 64 : 64;
+    memcpy(dst + i * 64, t, len);
+  }
+  Hacl_HMAC_SHA2_512_free(s);
+}
+
+#if defined(HACL_CAN_COMPILE_VEC256)
+
+static uint8_t buf[8][300];
+static uint8_t out[8][200];
+static uint8_t expected[200];
+
+bool test_hmac_lanes()
+{
+  uint8_t *key[8], *data[8], *dst[8];
+  uint32_t key_len[8];
+  bool ok = true;
+  for (int i = 0; i < 8; i++) {
+    for (int j = 0; j < 300; j++)
+      buf[i][j] = (uint8_t)(i * 31 + j * 7);
+    dst[i] = out[i];
+  }
+  // Keys of different lengths, including keys longer than a block, in the same call
+  for (uint32_t data_len = 0; data_len < 300; data_len += 17) {
+    for (int i = 0; i < 8; i++) {
+      key_len[i] = (uint32_t)(i * 25 + data_len % 5);
+      key[i] = buf[(i + 1) % 8];
+      data[i] = buf[i];
+    }
+    Hacl_SHA2_Vec256_hmac_sha256_8(dst, key, key_len, data, data_len);
+    for (int i = 0; i < 8; i++) {
+      Hacl_HMAC_compute_sha2_256(expected, key[i], key_len[i], data[i], data_len);
+      ok &= compare(32, out[i], expected);
+    }
+    Hacl_SHA2_Vec256_hmac_sha512_4(dst, key, key_len, data, data_len);
+    for (int i = 0; i < 4; i++) {
+      Hacl_HMAC_compute_sha2_512(expected, key[i], key_len[i], data[i], data_len);
+      ok &= compare(64, out[i], expected);
+    }
+  }
+  return ok;
+}
+
+bool test_pbkdf2_lanes()
+{
+  uint8_t *password[8], *salt[8], *dst[8];
+  uint32_t password_len[8];
+  bool ok = true;
+  for (int i = 0; i < 8; i++)
+    dst[i] = out[i];
+
+  // Known answers, with the same inputs in every lane
+  for (int i = 0; i < 8; i++) {
+    password[i] = (uint8_t *)"passwd";
+    password_len[i] = 6;
+    salt[i] = (uint8_t *)"salt";
+  }
+  Hacl_SHA2_Vec256_pbkdf2_sha256_8(dst, 64, password, password_len, salt, 4, 1);
+  for (int i = 0; i < 8; i++)
+    ok &= compare_and_print(64, out[i], tag256_1);
+  for (int i = 0; i < 8; i++) {
+    password[i] = (uint8_t *)"Password";
+    password_len[i] = 8;
+    salt[i] = (uint8_t *)"NaCl";
+  }
+  Hacl_SHA2_Vec256_pbkdf2_sha256_8(dst, 64, password, password_len, salt, 4, 80000);
+  for (int i = 0; i < 8; i++)
+    ok &= compare_and_print(64, out[i], tag256_2);
+  for (int i = 0; i < 4; i++) {
+    password[i] = (uint8_t *)"passwordPASSWORDpassword";
+    password_len[i] = 24;
+    salt[i] = (uint8_t *)"saltSALTsaltSALTsaltSALTsaltSALTsalt";
+  }
+  Hacl_SHA2_Vec256_pbkdf2_sha512_4(dst, 64, password, password_len, salt, 36, 4096);
+  for (int i = 0; i < 4; i++)
+    ok &= compare_and_print(64, out[i], tag512);
+
+  // Distinct passwords and salts in every lane, against the reference
+  for (uint32_t salt_len = 0; salt_len < 260; salt_len += 37) {
+    uint32_t dst_len = 1 + salt_len % 150;
+    for (int i = 0; i < 8; i++) {
+      password[i] = buf[i];
+      password_len[i] = (uint32_t)(i * 23 + salt_len % 3);
+      salt[i] = buf[(i + 3) % 8] + 1;
+    }
+    Hacl_SHA2_Vec256_pbkdf2_sha256_8(dst, dst_len, password, password_len, salt, salt_len, 3);
+    for (int i = 0; i < 8; i++) {
+      pbkdf2_sha256(expected, dst_len, password[i], password_len[i], salt[i], salt_len, 3);
+      ok &= compare(dst_len, out[i], expected);
+    }
+    Hacl_SHA2_Vec256_pbkdf2_sha512_4(dst, dst_len, password, password_len, salt, salt_len, 3);
+    for (int i = 0; i < 4; i++) {
+      pbkdf2_sha512(expected, dst_len, password[i], password_len[i], salt[i], salt_len, 3);
+      ok &= compare(dst_len, out[i], expected);
+    }
+  }
+  return ok;
+}
+
+#endif
+
+int main()
+{
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  uint8_t dk[64];
+
+  pbkdf2_sha256(dk, 64, (uint8_t *)"passwd", 6, (uint8_t *)"salt", 4, 1);
+  ok &= compare_and_print(64, dk, tag256_1);
+
+#if defined(HACL_CAN_COMPILE_VEC256)
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    ok &= test_hmac_lanes();
+    ok &= test_pbkdf2_lanes();
+  }
+#endif
+
+  if (ok)
+    printf ("\n Success :) \n");
+  else
+    printf ("\n Failed :( \n");
+
+#if defined(HACL_CAN_COMPILE_VEC256)
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    // Benchmarking eight PBKDF2-HMAC-SHA2-256 derivations
+    uint8_t *password[8], *salt[8], *dst[8];
+    uint32_t password_len[8];
+    for (int i = 0; i < 8; i++) {
+      password[i] = buf[i];
+      password_len[i] = 12;
+      salt[i] = buf[(i + 1) % 8];
+      dst[i] = out[i];
+    }
+    cycles a,b;
+    clock_t t1,t2;
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int i = 0; i < 8; i++)
+      pbkdf2_sha256(out[i], 32, password[i], password_len[i], salt[i], 16, ITERATIONS);
+    b = cpucycles_end();
+    t2 = clock();
+    double diff1 = t2 - t1;
+    uint64_t cyc1 = b - a;
+
+    t1 = clock();
+    a = cpucycles_begin();
+    Hacl_SHA2_Vec256_pbkdf2_sha256_8(dst, 32, password, password_len, salt, 16, ITERATIONS);
+    b = cpucycles_end();
+    t2 = clock();
+    double diff2 = t2 - t1;
+    uint64_t cyc2 = b - a;
+
+    printf("\n 8 x PBKDF2-HMAC-SHA2-256 (%d iterations), one lane:\n", ITERATIONS);
+    printf("cycles per iteration: %.2f, time: %.2f ms\n", (double)cyc1 / (8.0 * ITERATIONS),
+           diff1 * 1000.0 / CLOCKS_PER_SEC);
+    printf("\n 8 x PBKDF2-HMAC-SHA2-256 (%d iterations), eight lanes:\n", ITERATIONS);
+    printf("cycles per iteration: %.2f, time: %.2f ms\n", (double)cyc2 / (8.0 * ITERATIONS),
+           diff2 * 1000.0 / CLOCKS_PER_SEC);
+  }
+#endif
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
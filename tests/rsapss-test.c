@@ -25,6 +25,12 @@ bool print_test(
   uint8_t *eb,
   uint32_t dBits,
   uint8_t *db,
+  uint32_t pqBits,
+  uint8_t *pb,
+  uint8_t *qb,
+  uint8_t *dpb,
+  uint8_t *dqb,
+  uint8_t *qinvb,
   uint32_t msgLen,
   uint8_t *msg,
   uint32_t saltLen,
@@ -47,6 +53,43 @@ bool print_test(
   bool ver = Hacl_RSAPSS_rsapss_verify(Spec_Hash_Definitions_SHA2_256, modBits, eBits, pkey, saltLen, nbLen, sgnt, msgLen, msg);
   if (ver) printf("Success!\n");
   ok = ok && ver;
+
+  Hacl_RSAPSS_crt_skey *crt_skey =
+    Hacl_RSAPSS_new_rsapss_load_crt_skey(modBits, eBits, pqBits, nb, eb, pb, qb, dpb, dqb, qinvb);
+  memset(sgnt, 0U, nbLen * sizeof (sgnt[0U]));
+  bool crt = crt_skey != NULL
+    && Hacl_RSAPSS_rsapss_crt_sign(Spec_Hash_Definitions_SHA2_256, crt_skey, saltLen, salt, msgLen, msg, sgnt);
+  printf("RSAPSS CRT sign Result:\n");
+  ok = print_result(nbLen, sgnt, sgnt_expected) && crt && ok;
+
+  // A corrupted dp must be caught by the final check rather than leak a bad signature.
+  if (crt_skey != NULL) {
+    Hacl_RSAPSS_free_crt_skey(crt_skey);
+    uint32_t pqLen = (pqBits - 1U) / 8U + 1U;
+    uint8_t bad_dpb[pqLen];
+    memcpy(bad_dpb, dpb, pqLen);
+    bad_dpb[pqLen - 1U] ^= (uint8_t)1U;
+    crt_skey = Hacl_RSAPSS_new_rsapss_load_crt_skey(modBits, eBits, pqBits, nb, eb, pb, qb, bad_dpb, dqb, qinvb);
+    if (crt_skey != NULL) {
+      bool bad = Hacl_RSAPSS_rsapss_crt_sign(Spec_Hash_Definitions_SHA2_256, crt_skey, saltLen, salt, msgLen, msg, sgnt);
+      uint8_t acc = 0U;
+      for (uint32_t i = 0U; i < nbLen; i++) acc |= sgnt[i];
+      if (bad || acc != 0U) {
+        printf("RSAPSS CRT sign accepted a faulty key!\n");
+        ok = false;
+      }
+      Hacl_RSAPSS_free_crt_skey(crt_skey);
+    }
+  }
+
+  // p * q must match n.
+  crt_skey = Hacl_RSAPSS_new_rsapss_load_crt_skey(modBits, eBits, pqBits, nb, eb, pb, pb, dpb, dqb, qinvb);
+  if (crt_skey != NULL) {
+    printf("RSAPSS CRT key load accepted p * p != n!\n");
+    Hacl_RSAPSS_free_crt_skey(crt_skey);
+    ok = false;
+  }
+
   return ok;
 }
 
@@ -55,6 +98,7 @@ int main() {
   bool ok = true;
   for (int i = 0; i < sizeof(vectors)/sizeof(rsapss_test_vector); ++i) {
     ok &= print_test(vectors[i].modBits,vectors[i].n,vectors[i].eBits,vectors[i].e,vectors[i].dBits,vectors[i].d,
+		     vectors[i].pqBits,vectors[i].p,vectors[i].q,vectors[i].dp,vectors[i].dq,vectors[i].qinv,
 		     vectors[i].msgLen,vectors[i].msg,vectors[i].saltLen,vectors[i].salt,vectors[i].sgnt_expected);
   }
 
@@ -22,6 +22,7 @@
 #endif
 
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Hash.h"
 
 #include "sha2_vectors.h"
 #include "sha2mb_vectors.h"
@@ -116,6 +117,45 @@ bool print_test8(uint8_t* in, uint8_t* in1, uint8_t* in2, uint8_t* in3, uint8_t*
   return ok;
 }
 
+bool print_test_many(Spec_Hash_Definitions_hash_alg a, int hash_len) {
+  // Each multi-buffer vector twice and each single vector once, interleaved so
+  // that the grouping by length has to reorder them.
+  const int nmb = sizeof(vectors_mb)/sizeof(vectors_mb[0]);
+  const int n1 = sizeof(vectors)/sizeof(sha2_test_vector);
+  const int n = 2 * nmb + n1;
+  uint8_t* inputs[2 * 8 + 8];
+  uint32_t lens[2 * 8 + 8];
+  uint8_t* outs[2 * 8 + 8];
+  uint8_t* exps[2 * 8 + 8];
+  uint8_t comp[(2 * 8 + 8) * 64] = {0};
+  int k = 0;
+  for (int i = 0; i < nmb || i < n1; ++i) {
+    if (i < nmb) {
+      for (int r = 0; r < 2; ++r) {
+        inputs[k] = vectors_mb[i].input;
+        lens[k] = vectors_mb[i].input_len;
+        exps[k] = a == Spec_Hash_Definitions_SHA2_256 ? vectors_mb[i].tag_256 : vectors_mb[i].tag_512;
+        k++;
+      }
+    }
+    if (i < n1) {
+      inputs[k] = vectors[i].input;
+      lens[k] = vectors[i].input_len;
+      exps[k] = a == Spec_Hash_Definitions_SHA2_256 ? vectors[i].tag_256 : vectors[i].tag_512;
+      k++;
+    }
+  }
+  for (int i = 0; i < n; ++i)
+    outs[i] = comp + i * 64;
+
+  EverCrypt_Hash_hash_many(a, inputs, lens, outs, n);
+  printf("EverCrypt_Hash_hash_many %s Result:\n", EverCrypt_Hash_string_of_alg(a));
+  bool ok = true;
+  for (int i = 0; i < n; ++i)
+    ok = print_result(outs[i], exps[i], hash_len) && ok;
+  return ok;
+}
+
 int main()
 {
   EverCrypt_AutoConfig2_init();
@@ -140,6 +180,14 @@ int main()
 			vectors_mb[0].tag_512,vectors_mb[1].tag_512,vectors_mb[2].tag_512,vectors_mb[3].tag_512);
   }
 
+  ok &= print_test_many(Spec_Hash_Definitions_SHA2_256, 32);
+  ok &= print_test_many(Spec_Hash_Definitions_SHA2_512, 64);
+  if (EverCrypt_AutoConfig2_has_shaext()) {
+    // Exercise the multi-buffer kernels rather than the SHA extensions.
+    EverCrypt_AutoConfig2_disable_shaext();
+    ok &= print_test_many(Spec_Hash_Definitions_SHA2_256, 32);
+  }
+
   uint64_t len = SIZE;
   uint8_t plain[SIZE];
   cycles a,b;
@@ -0,0 +1,252 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include <openssl/evp.h>
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+
+#include "test_helpers.h"
+#include "Hacl_SHA3.h"
+#include "Hacl_Streaming_SHA3.h"
+
+#define ROUNDS 4096
+#define SIZE   16384
+
+// NIST SP 800-185 example values (cSHAKE_samples.pdf, KMAC_samples.pdf, TupleHash_samples.pdf)
+static uint8_t cshake128_sample1[32] = {
+  0xc1, 0xc3, 0x69, 0x25, 0xb6, 0x40, 0x9a, 0x04, 0xf1, 0xb5, 0x04, 0xfc, 0xbc, 0xa9, 0xd8, 0x2b,
+  0x40, 0x17, 0x27, 0x7c, 0xb5, 0xed, 0x2b, 0x20, 0x65, 0xfc, 0x1d, 0x38, 0x14, 0xd5, 0xaa, 0xf5
+};
+static uint8_t cshake128_sample2[32] = {
+  0xc5, 0x22, 0x1d, 0x50, 0xe4, 0xf8, 0x22, 0xd9, 0x6a, 0x2e, 0x88, 0x81, 0xa9, 0x61, 0x42, 0x0f,
+  0x29, 0x4b, 0x7b, 0x24, 0xfe, 0x3d, 0x20, 0x94, 0xba, 0xed, 0x2c, 0x65, 0x24, 0xcc, 0x16, 0x6b
+};
+static uint8_t kmac128_sample1[32] = {
+  0xe5, 0x78, 0x0b, 0x0d, 0x3e, 0xa6, 0xf7, 0xd3, 0xa4, 0x29, 0xc5, 0x70, 0x6a, 0xa4, 0x3a, 0x00,
+  0xfa, 0xdb, 0xd7, 0xd4, 0x96, 0x28, 0x83, 0x9e, 0x31, 0x87, 0x24, 0x3f, 0x45, 0x6e, 0xe1, 0x4e
+};
+static uint8_t kmac128_sample2[32] = {
+  0x3b, 0x1f, 0xba, 0x96, 0x3c, 0xd8, 0xb0, 0xb5, 0x9e, 0x8c, 0x1a, 0x6d, 0x71, 0x88, 0x8b, 0x71,
+  0x43, 0x65, 0x1a, 0xf8, 0xba, 0x0a, 0x70, 0x70, 0xc0, 0x97, 0x9e, 0x28, 0x11, 0x32, 0x4a, 0xa5
+};
+static uint8_t tuplehash128_sample1[32] = {
+  0xc5, 0xd8, 0x78, 0x6c, 0x1a, 0xfb, 0x9b, 0x82, 0x11, 0x1a, 0xb3, 0x4b, 0x65, 0xb2, 0xc0, 0x04,
+  0x8f, 0xa6, 0x4e, 0x6d, 0x48, 0xe2, 0x63, 0x26, 0x4c, 0xe1, 0x70, 0x7d, 0x3f, 0xfc, 0x8e, 0xd1
+};
+static uint8_t tuplehash128_sample2[32] = {
+  0x75, 0xcd, 0xb2, 0x0f, 0xf4, 0xdb, 0x11, 0x54, 0xe8, 0x41, 0xd7, 0x58, 0xe2, 0x41, 0x60, 0xc5,
+  0x4b, 0xae, 0x86, 0xeb, 0x8c, 0x13, 0xe7, 0xf5, 0xf4, 0x0e, 0xb3, 0x55, 0x88, 0xe9, 0x6d, 0xfb
+};
+
+static uint8_t key[64];
+static uint8_t input[SIZE];
+static uint8_t out[SIZE];
+static uint8_t expected[SIZE];
+
+// Absorbs len bytes in chunks of achunk bytes, then squeezes out_len bytes in chunks of schunk
+// bytes (the last chunks may be shorter)
+void stream(Hacl_Streaming_SHA3_xof_state *s, uint32_t len, uint32_t achunk,
+            uint8_t *dst, uint32_t out_len, uint32_t schunk)
+{
+  Hacl_Streaming_SHA3_xof_init(s);
+  for (uint32_t off = 0; off < len; off += achunk)
+    Hacl_Streaming_SHA3_xof_absorb(s, input + off, len - off < achunk ? len - off : achunk);
+  for (uint32_t off = 0; off < out_len; off += schunk)
+    Hacl_Streaming_SHA3_xof_squeeze(s, dst + off, out_len - off < schunk ? out_len - off : schunk);
+}
+
+void openssl_shake(const char *name, uint32_t len, uint8_t *dst, uint32_t out_len)
+{
+  EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+  EVP_DigestInit_ex(ctx, EVP_get_digestbyname(name), NULL);
+  EVP_DigestUpdate(ctx, input, len);
+  EVP_DigestFinalXOF(ctx, dst, out_len);
+  EVP_MD_CTX_free(ctx);
+}
+
+void openssl_kmac(const char *name, uint32_t key_len, uint8_t *custom, uint32_t custom_len,
+                  int xof, uint32_t len, uint8_t *dst, uint32_t out_len)
+{
+  EVP_MAC *mac = EVP_MAC_fetch(NULL, name, NULL);
+  EVP_MAC_CTX *ctx = EVP_MAC_CTX_new(mac);
+  size_t size = out_len;
+  OSSL_PARAM params[4];
+  params[0] = OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_CUSTOM, custom, custom_len);
+  params[1] = OSSL_PARAM_construct_size_t(OSSL_MAC_PARAM_SIZE, &size);
+  params[2] = OSSL_PARAM_construct_int(OSSL_MAC_PARAM_XOF, &xof);
+  params[3] = OSSL_PARAM_construct_end();
+  EVP_MAC_init(ctx, key, key_len, params);
+  EVP_MAC_update(ctx, input, len);
+  size_t written;
+  EVP_MAC_final(ctx, dst, &written, out_len);
+  EVP_MAC_CTX_free(ctx);
+  EVP_MAC_free(mac);
+}
+
+// Streaming absorb and squeeze, in chunks around the rate, agree with OpenSSL and with the
+// one-shot functions
+bool test_shake(Hacl_Streaming_SHA3_xof_state *s, const char *name, uint32_t rate)
+{
+  bool ok = true;
+  uint32_t lens[6] = { 0, 1, rate - 1, rate, rate + 1, 3 * rate + 17 };
+  uint32_t chunks[5] = { 1, 7, rate - 1, rate, 2 * rate + 1 };
+  for (int k = 0; k < 6; k++) {
+    openssl_shake(name, lens[k], expected, 4 * rate);
+    for (int a = 0; a < 5; a++)
+      for (int c = 0; c < 5; c++) {
+        stream(s, lens[k], chunks[a], out, 4 * rate, chunks[c]);
+        ok &= memcmp(out, expected, 4 * rate) == 0;
+      }
+  }
+  openssl_shake(name, SIZE, expected, SIZE);
+  stream(s, SIZE, 1000, out, SIZE, 1000);
+  ok &= memcmp(out, expected, SIZE) == 0;
+  if (rate == 168)
+    Hacl_SHA3_shake128_hacl(SIZE, input, SIZE, out);
+  else
+    Hacl_SHA3_shake256_hacl(SIZE, input, SIZE, out);
+  ok &= memcmp(out, expected, SIZE) == 0;
+  // No more input once squeezing has started
+  ok &= !Hacl_Streaming_SHA3_xof_absorb(s, input, 1);
+  return ok;
+}
+
+bool test_kmac(const char *name, uint32_t rate)
+{
+  bool ok = true;
+  uint8_t *custom = (uint8_t *)"My Tagged Application";
+  uint32_t lens[4] = { 0, 200, rate + 1, 1000 };
+  uint32_t out_lens[3] = { 16, 32, 2 * rate + 5 };
+  // OpenSSL requires keys of at least 4 bytes
+  uint32_t key_lens[3] = { 4, 37, 64 };
+  for (int l = 0; l < 3; l++)
+    for (int k = 0; k < 4; k++)
+      for (int o = 0; o < 3; o++) {
+        uint32_t key_len = key_lens[l];
+        Hacl_Streaming_SHA3_xof_state *s = rate == 168
+          ? Hacl_Streaming_SHA3_kmac128_create_in(key, key_len, custom, 21)
+          : Hacl_Streaming_SHA3_kmac256_create_in(key, key_len, custom, 21);
+        openssl_kmac(name, key_len, custom, 21, 0, lens[k], expected, out_lens[o]);
+        stream(s, lens[k], 13, out, 0, 1);
+        Hacl_Streaming_SHA3_xof_finish(s, out, out_lens[o]);
+        ok &= memcmp(out, expected, out_lens[o]) == 0;
+        // KMACXOF, squeezed in two calls
+        openssl_kmac(name, key_len, custom, 21, 1, lens[k], expected, out_lens[o]);
+        stream(s, lens[k], 13, out, 5, 5);
+        Hacl_Streaming_SHA3_xof_squeeze(s, out + 5, out_lens[o] - 5);
+        ok &= memcmp(out, expected, out_lens[o]) == 0;
+        Hacl_Streaming_SHA3_xof_free(s);
+      }
+  return ok;
+}
+
+int main() {
+  for (int i = 0; i < sizeof(key); i++)
+    key[i] = (uint8_t)(0x40 + i);
+  for (int i = 0; i < SIZE; i++)
+    input[i] = (uint8_t)i;
+
+  bool ok = true;
+  uint8_t tag[32];
+  Hacl_Streaming_SHA3_xof_state *s;
+
+  // cSHAKE128: N = "", S = "Email Signature", over 4 then 200 bytes
+  s = Hacl_Streaming_SHA3_cshake128_create_in(NULL, 0, (uint8_t *)"Email Signature", 15);
+  Hacl_Streaming_SHA3_xof_absorb(s, input, 4);
+  Hacl_Streaming_SHA3_xof_finish(s, tag, 32);
+  ok &= compare_and_print(32, tag, cshake128_sample1);
+  Hacl_Streaming_SHA3_xof_init(s);
+  Hacl_Streaming_SHA3_xof_absorb(s, input, 150);
+  Hacl_Streaming_SHA3_xof_absorb(s, input + 150, 50);
+  Hacl_Streaming_SHA3_xof_finish(s, tag, 32);
+  ok &= compare_and_print(32, tag, cshake128_sample2);
+  Hacl_Streaming_SHA3_xof_free(s);
+
+  // KMAC128: K = 0x40..0x5f, X = 00010203, with S = "" and S = "My Tagged Application"
+  s = Hacl_Streaming_SHA3_kmac128_create_in(key, 32, NULL, 0);
+  Hacl_Streaming_SHA3_xof_absorb(s, input, 4);
+  Hacl_Streaming_SHA3_xof_finish(s, tag, 32);
+  ok &= compare_and_print(32, tag, kmac128_sample1);
+  Hacl_Streaming_SHA3_xof_free(s);
+  s = Hacl_Streaming_SHA3_kmac128_create_in(key, 32, (uint8_t *)"My Tagged Application", 21);
+  Hacl_Streaming_SHA3_xof_absorb(s, input, 4);
+  Hacl_Streaming_SHA3_xof_finish(s, tag, 32);
+  ok &= compare_and_print(32, tag, kmac128_sample2);
+  Hacl_Streaming_SHA3_xof_free(s);
+
+  // TupleHash128: the tuple (000102, 101112131415), with S = "" and S = "My Tuple App"
+  uint8_t elem0[3] = { 0x00, 0x01, 0x02 };
+  uint8_t elem1[6] = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15 };
+  s = Hacl_Streaming_SHA3_tuplehash128_create_in(NULL, 0);
+  Hacl_Streaming_SHA3_tuplehash_update(s, elem0, 3);
+  Hacl_Streaming_SHA3_tuplehash_update(s, elem1, 6);
+  Hacl_Streaming_SHA3_xof_finish(s, tag, 32);
+  ok &= compare_and_print(32, tag, tuplehash128_sample1);
+  ok &= !Hacl_Streaming_SHA3_tuplehash_update(s, elem0, 3);
+  Hacl_Streaming_SHA3_xof_free(s);
+  s = Hacl_Streaming_SHA3_tuplehash128_create_in((uint8_t *)"My Tuple App", 12);
+  Hacl_Streaming_SHA3_tuplehash_update(s, elem0, 3);
+  Hacl_Streaming_SHA3_tuplehash_update(s, elem1, 6);
+  Hacl_Streaming_SHA3_xof_finish(s, tag, 32);
+  ok &= compare_and_print(32, tag, tuplehash128_sample2);
+  Hacl_Streaming_SHA3_xof_free(s);
+
+  // cSHAKE with an empty name and customization string is SHAKE
+  s = Hacl_Streaming_SHA3_cshake256_create_in(NULL, 0, NULL, 0);
+  ok &= test_shake(s, "SHAKE256", 136);
+  Hacl_Streaming_SHA3_xof_free(s);
+  s = Hacl_Streaming_SHA3_shake128_create_in();
+  ok &= test_shake(s, "SHAKE128", 168);
+  Hacl_Streaming_SHA3_xof_free(s);
+  s = Hacl_Streaming_SHA3_shake256_create_in();
+  ok &= test_shake(s, "SHAKE256", 136);
+  Hacl_Streaming_SHA3_xof_free(s);
+
+  ok &= test_kmac("KMAC128", 168);
+  ok &= test_kmac("KMAC256", 136);
+
+  if (ok)
+    printf ("\n Success :) \n");
+  else
+    printf ("\n Failed :( \n");
+
+  // Benchmarking a SIZE-byte SHAKE128 keystream, squeezed one block at a time, against the
+  // one-shot function
+  cycles a,b;
+  clock_t t1,t2;
+  s = Hacl_Streaming_SHA3_shake128_create_in();
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Streaming_SHA3_xof_init(s);
+    Hacl_Streaming_SHA3_xof_absorb(s, input, 32);
+    for (uint32_t off = 0; off < SIZE; off += 168)
+      Hacl_Streaming_SHA3_xof_squeeze(s, out + off, SIZE - off < 168 ? SIZE - off : 168);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  printf("\n SHAKE128 streaming squeeze, 168 bytes per call:\n");
+  print_time((uint64_t)SIZE * ROUNDS, t2 - t1, b - a);
+  Hacl_Streaming_SHA3_xof_free(s);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_SHA3_shake128_hacl(32, input, SIZE, expected);
+  b = cpucycles_end();
+  t2 = clock();
+  printf("\n SHAKE128 one-shot:\n");
+  print_time((uint64_t)SIZE * ROUNDS, t2 - t1, b - a);
+  ok &= memcmp(out, expected, SIZE) == 0;
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}